@@ -0,0 +1,5991 @@
+/* generated by mkctables, do not edit */
+
+static const unsigned char bitreverse[256] = {
+  0x00, 0x80, 0x40, 0xc0, 0x20, 0xa0, 0x60, 0xe0,
+  0x10, 0x90, 0x50, 0xd0, 0x30, 0xb0, 0x70, 0xf0,
+  0x08, 0x88, 0x48, 0xc8, 0x28, 0xa8, 0x68, 0xe8,
+  0x18, 0x98, 0x58, 0xd8, 0x38, 0xb8, 0x78, 0xf8,
+  0x04, 0x84, 0x44, 0xc4, 0x24, 0xa4, 0x64, 0xe4,
+  0x14, 0x94, 0x54, 0xd4, 0x34, 0xb4, 0x74, 0xf4,
+  0x0c, 0x8c, 0x4c, 0xcc, 0x2c, 0xac, 0x6c, 0xec,
+  0x1c, 0x9c, 0x5c, 0xdc, 0x3c, 0xbc, 0x7c, 0xfc,
+  0x02, 0x82, 0x42, 0xc2, 0x22, 0xa2, 0x62, 0xe2,
+  0x12, 0x92, 0x52, 0xd2, 0x32, 0xb2, 0x72, 0xf2,
+  0x0a, 0x8a, 0x4a, 0xca, 0x2a, 0xaa, 0x6a, 0xea,
+  0x1a, 0x9a, 0x5a, 0xda, 0x3a, 0xba, 0x7a, 0xfa,
+  0x06, 0x86, 0x46, 0xc6, 0x26, 0xa6, 0x66, 0xe6,
+  0x16, 0x96, 0x56, 0xd6, 0x36, 0xb6, 0x76, 0xf6,
+  0x0e, 0x8e, 0x4e, 0xce, 0x2e, 0xae, 0x6e, 0xee,
+  0x1e, 0x9e, 0x5e, 0xde, 0x3e, 0xbe, 0x7e, 0xfe,
+  0x01, 0x81, 0x41, 0xc1, 0x21, 0xa1, 0x61, 0xe1,
+  0x11, 0x91, 0x51, 0xd1, 0x31, 0xb1, 0x71, 0xf1,
+  0x09, 0x89, 0x49, 0xc9, 0x29, 0xa9, 0x69, 0xe9,
+  0x19, 0x99, 0x59, 0xd9, 0x39, 0xb9, 0x79, 0xf9,
+  0x05, 0x85, 0x45, 0xc5, 0x25, 0xa5, 0x65, 0xe5,
+  0x15, 0x95, 0x55, 0xd5, 0x35, 0xb5, 0x75, 0xf5,
+  0x0d, 0x8d, 0x4d, 0xcd, 0x2d, 0xad, 0x6d, 0xed,
+  0x1d, 0x9d, 0x5d, 0xdd, 0x3d, 0xbd, 0x7d, 0xfd,
+  0x03, 0x83, 0x43, 0xc3, 0x23, 0xa3, 0x63, 0xe3,
+  0x13, 0x93, 0x53, 0xd3, 0x33, 0xb3, 0x73, 0xf3,
+  0x0b, 0x8b, 0x4b, 0xcb, 0x2b, 0xab, 0x6b, 0xeb,
+  0x1b, 0x9b, 0x5b, 0xdb, 0x3b, 0xbb, 0x7b, 0xfb,
+  0x07, 0x87, 0x47, 0xc7, 0x27, 0xa7, 0x67, 0xe7,
+  0x17, 0x97, 0x57, 0xd7, 0x37, 0xb7, 0x77, 0xf7,
+  0x0f, 0x8f, 0x4f, 0xcf, 0x2f, 0xaf, 0x6f, 0xef,
+  0x1f, 0x9f, 0x5f, 0xdf, 0x3f, 0xbf, 0x7f, 0xff
+};
+
+#define CTABLES_MAX 48
+
+static const float ctables64[6][256] = {
+{
+  -7.905347957e-06f, -7.842739251e-06f, -7.656511116e-06f, -7.593902865e-06f,
+  -7.220701718e-06f, -7.158093013e-06f, -6.971865332e-06f, -6.909256626e-06f,
+  -6.423339983e-06f, -6.360731277e-06f, -6.174503596e-06f, -6.111894891e-06f,
+  -5.738693744e-06f, -5.676085038e-06f, -5.489857358e-06f, -5.427248652e-06f,
+  -5.266547305e-06f, -5.203938599e-06f, -5.017710919e-06f, -4.955102213e-06f,
+  -4.581901067e-06f, -4.519292361e-06f, -4.333064680e-06f, -4.270455975e-06f,
+  -3.784539331e-06f, -3.721930398e-06f, -3.535702945e-06f, -3.473094011e-06f,
+  -3.099893320e-06f, -3.037284387e-06f, -2.851056706e-06f, -2.788448001e-06f,
+  -4.044306024e-06f, -3.981697319e-06f, -3.795469638e-06f, -3.732860932e-06f,
+  -3.359660013e-06f, -3.297051308e-06f, -3.110823627e-06f, -3.048214694e-06f,
+  -2.562298278e-06f, -2.499689344e-06f, -2.313461664e-06f, -2.250852958e-06f,
+  -1.877652039e-06f, -1.815043220e-06f, -1.628815653e-06f, -1.566206834e-06f,
+  -1.405505486e-06f, -1.342896667e-06f, -1.156668986e-06f, -1.094060167e-06f,
+  -7.208593615e-07f, -6.582505421e-07f, -4.720229185e-07f, -4.094140991e-07f,
+  7.650247369e-08f, 1.391112932e-07f, 3.253389309e-07f, 3.879477504e-07f,
+  7.611485557e-07f, 8.237573752e-07f, 1.009984999e-06f, 1.072593818e-06f,
+  -3.572037485e-06f, -3.509428780e-06f, -3.323201099e-06f, -3.260592393e-06f,
+  -2.887391474e-06f, -2.824782541e-06f, -2.638555088e-06f, -2.575946155e-06f,
+  -2.090029511e-06f, -2.027420805e-06f, -1.841193125e-06f, -1.778584306e-06f,
+  -1.405383500e-06f, -1.342774681e-06f, -1.156547000e-06f, -1.093938181e-06f,
+  -9.332368904e-07f, -8.706280710e-07f, -6.844004474e-07f, -6.217916280e-07f,
+  -2.485907942e-07f, -1.859819605e-07f, 2.456626291e-10f, 6.285448251e-08f,
+  5.487710837e-07f, 6.113799031e-07f, 7.976075267e-07f, 8.602163462e-07f,
+  1.233417152e-06f, 1.296025971e-06f, 1.482253651e-06f, 1.544862471e-06f,
+  2.890042481e-07f, 3.516130676e-07f, 5.378406627e-07f, 6.004494821e-07f,
+  9.736503443e-07f, 1.036259164e-06f, 1.222486731e-06f, 1.285095550e-06f,
+  1.771012194e-06f, 1.833621013e-06f, 2.019848580e-06f, 2.082457513e-06f,
+  2.455658205e-06f, 2.518267138e-06f, 2.704494818e-06f, 2.767103524e-06f,
+  2.927804871e-06f, 2.990413805e-06f, 3.176641258e-06f, 3.239250191e-06f,
+  3.612451110e-06f, 3.675059816e-06f, 3.861287496e-06f, 3.923896202e-06f,
+  4.409812846e-06f, 4.472421551e-06f, 4.658649232e-06f, 4.721257937e-06f,
+  5.094459084e-06f, 5.157067790e-06f, 5.343295470e-06f, 5.405904176e-06f,
+  -5.405904176e-06f, -5.343295470e-06f, -5.157067790e-06f, -5.094459084e-06f,
+  -4.721257937e-06f, -4.658649232e-06f, -4.472421551e-06f, -4.409812846e-06f,
+  -3.923896202e-06f, -3.861287496e-06f, -3.675059816e-06f, -3.612451110e-06f,
+  -3.239250191e-06f, -3.176641258e-06f, -2.990413805e-06f, -2.927804871e-06f,
+  -2.767103524e-06f, -2.704494818e-06f, -2.518267138e-06f, -2.455658205e-06f,
+  -2.082457513e-06f, -2.019848580e-06f, -1.833621013e-06f, -1.771012194e-06f,
+  -1.285095550e-06f, -1.222486731e-06f, -1.036259164e-06f, -9.736503443e-07f,
+  -6.004494821e-07f, -5.378406627e-07f, -3.516130676e-07f, -2.890042481e-07f,
+  -1.544862471e-06f, -1.482253651e-06f, -1.296025971e-06f, -1.233417152e-06f,
+  -8.602163462e-07f, -7.976075267e-07f, -6.113799031e-07f, -5.487710837e-07f,
+  -6.285448251e-08f, -2.456626291e-10f, 1.859819605e-07f, 2.485907942e-07f,
+  6.217916280e-07f, 6.844004474e-07f, 8.706280710e-07f, 9.332368904e-07f,
+  1.093938181e-06f, 1.156547000e-06f, 1.342774681e-06f, 1.405383500e-06f,
+  1.778584306e-06f, 1.841193125e-06f, 2.027420805e-06f, 2.090029511e-06f,
+  2.575946155e-06f, 2.638555088e-06f, 2.824782541e-06f, 2.887391474e-06f,
+  3.260592393e-06f, 3.323201099e-06f, 3.509428780e-06f, 3.572037485e-06f,
+  -1.072593818e-06f, -1.009984999e-06f, -8.237573752e-07f, -7.611485557e-07f,
+  -3.879477504e-07f, -3.253389309e-07f, -1.391112932e-07f, -7.650247369e-08f,
+  4.094140991e-07f, 4.720229185e-07f, 6.582505421e-07f, 7.208593615e-07f,
+  1.094060167e-06f, 1.156668986e-06f, 1.342896667e-06f, 1.405505486e-06f,
+  1.566206834e-06f, 1.628815653e-06f, 1.815043220e-06f, 1.877652039e-06f,
+  2.250852958e-06f, 2.313461664e-06f, 2.499689344e-06f, 2.562298278e-06f,
+  3.048214694e-06f, 3.110823627e-06f, 3.297051308e-06f, 3.359660013e-06f,
+  3.732860932e-06f, 3.795469638e-06f, 3.981697319e-06f, 4.044306024e-06f,
+  2.788448001e-06f, 2.851056706e-06f, 3.037284387e-06f, 3.099893320e-06f,
+  3.473094011e-06f, 3.535702945e-06f, 3.721930398e-06f, 3.784539331e-06f,
+  4.270455975e-06f, 4.333064680e-06f, 4.519292361e-06f, 4.581901067e-06f,
+  4.955102213e-06f, 5.017710919e-06f, 5.203938599e-06f, 5.266547305e-06f,
+  5.427248652e-06f, 5.489857358e-06f, 5.676085038e-06f, 5.738693744e-06f,
+  6.111894891e-06f, 6.174503596e-06f, 6.360731277e-06f, 6.423339983e-06f,
+  6.909256626e-06f, 6.971865332e-06f, 7.158093013e-06f, 7.220701718e-06f,
+  7.593902865e-06f, 7.656511116e-06f, 7.842739251e-06f, 7.905347957e-06f
+},
+{
+  4.828860983e-04f, 4.788511724e-04f, 4.645599693e-04f, 4.605250433e-04f,
+  4.394044809e-04f, 4.353695840e-04f, 4.210783809e-04f, 4.170434549e-04f,
+  4.013875150e-04f, 3.973525891e-04f, 3.830613859e-04f, 3.790264600e-04f,
+  3.579059266e-04f, 3.538710007e-04f, 3.395797976e-04f, 3.355448716e-04f,
+  3.513334086e-04f, 3.472984827e-04f, 3.330072796e-04f, 3.289723536e-04f,
+  3.078517911e-04f, 3.038168943e-04f, 2.895256912e-04f, 2.854907652e-04f,
+  2.698348253e-04f, 2.657998994e-04f, 2.515086962e-04f, 2.474737703e-04f,
+  2.263532224e-04f, 2.223183110e-04f, 2.080271079e-04f, 2.039921819e-04f,
+  2.949611517e-04f, 2.909262257e-04f, 2.766350226e-04f, 2.726000967e-04f,
+  2.514795633e-04f, 2.474446374e-04f, 2.331534342e-04f, 2.291185083e-04f,
+  2.134625684e-04f, 2.094276424e-04f, 1.951364393e-04f, 1.911015279e-04f,
+  1.699809654e-04f, 1.659460540e-04f, 1.516548509e-04f, 1.476199395e-04f,
+  1.634084474e-04f, 1.593735360e-04f, 1.450823329e-04f, 1.410474215e-04f,
+  1.199268590e-04f, 1.158919404e-04f, 1.016007445e-04f, 9.756582585e-05f,
+  8.190987137e-05f, 7.787495269e-05f, 6.358375686e-05f, 5.954883818e-05f,
+  3.842828301e-05f, 3.439336433e-05f, 2.010216485e-05f, 1.606724436e-05f,
+  2.448920277e-04f, 2.408571017e-04f, 2.265659132e-04f, 2.225309872e-04f,
+  2.014104393e-04f, 1.973755134e-04f, 1.830843248e-04f, 1.790493989e-04f,
+  1.633934444e-04f, 1.593585330e-04f, 1.450673299e-04f, 1.410324039e-04f,
+  1.199118560e-04f, 1.158769373e-04f, 1.015857415e-04f, 9.755081555e-05f,
+  1.133393380e-04f, 1.093044193e-04f, 9.501322347e-05f, 9.097830480e-05f,
+  6.985774962e-05f, 6.582283095e-05f, 5.153163147e-05f, 4.749670916e-05f,
+  3.184076195e-05f, 2.780583964e-05f, 1.351464289e-05f, 9.479722394e-06f,
+  -1.164083096e-05f, -1.567575055e-05f, -2.996694820e-05f, -3.400187052e-05f,
+  5.696708467e-05f, 5.293216236e-05f, 3.864096652e-05f, 3.460604421e-05f,
+  1.348549267e-05f, 9.450572179e-06f, -4.840625479e-06f, -8.875545973e-06f,
+  -2.453149500e-05f, -2.856641549e-05f, -4.285761315e-05f, -4.689253183e-05f,
+  -6.801308336e-05f, -7.204800932e-05f, -8.633920515e-05f, -9.037412383e-05f,
+  -7.458560140e-05f, -7.862052735e-05f, -9.291172319e-05f, -9.694664186e-05f,
+  -1.180671970e-04f, -1.221021084e-04f, -1.363933115e-04f, -1.404282375e-04f,
+  -1.560841774e-04f, -1.601191034e-04f, -1.744103065e-04f, -1.784452179e-04f,
+  -1.995657803e-04f, -2.036006917e-04f, -2.178918949e-04f, -2.219268063e-04f,
+  2.219268063e-04f, 2.178918949e-04f, 2.036006917e-04f, 1.995657803e-04f,
+  1.784452179e-04f, 1.744103065e-04f, 1.601191034e-04f, 1.560841774e-04f,
+  1.404282375e-04f, 1.363933115e-04f, 1.221021084e-04f, 1.180671970e-04f,
+  9.694664186e-05f, 9.291172319e-05f, 7.862052735e-05f, 7.458560140e-05f,
+  9.037412383e-05f, 8.633920515e-05f, 7.204800932e-05f, 6.801308336e-05f,
+  4.689253183e-05f, 4.285761315e-05f, 2.856641549e-05f, 2.453149500e-05f,
+  8.875545973e-06f, 4.840625479e-06f, -9.450572179e-06f, -1.348549267e-05f,
+  -3.460604421e-05f, -3.864096652e-05f, -5.293216236e-05f, -5.696708467e-05f,
+  3.400187052e-05f, 2.996694820e-05f, 1.567575055e-05f, 1.164083096e-05f,
+  -9.479722394e-06f, -1.351464289e-05f, -2.780583964e-05f, -3.184076195e-05f,
+  -4.749670916e-05f, -5.153163147e-05f, -6.582283095e-05f, -6.985774962e-05f,
+  -9.097830480e-05f, -9.501322347e-05f, -1.093044193e-04f, -1.133393380e-04f,
+  -9.755081555e-05f, -1.015857415e-04f, -1.158769373e-04f, -1.199118560e-04f,
+  -1.410324039e-04f, -1.450673299e-04f, -1.593585330e-04f, -1.633934444e-04f,
+  -1.790493989e-04f, -1.830843248e-04f, -1.973755134e-04f, -2.014104393e-04f,
+  -2.225309872e-04f, -2.265659132e-04f, -2.408571017e-04f, -2.448920277e-04f,
+  -1.606724436e-05f, -2.010216485e-05f, -3.439336433e-05f, -3.842828301e-05f,
+  -5.954883818e-05f, -6.358375686e-05f, -7.787495269e-05f, -8.190987137e-05f,
+  -9.756582585e-05f, -1.016007445e-04f, -1.158919404e-04f, -1.199268590e-04f,
+  -1.410474215e-04f, -1.450823329e-04f, -1.593735360e-04f, -1.634084474e-04f,
+  -1.476199395e-04f, -1.516548509e-04f, -1.659460540e-04f, -1.699809654e-04f,
+  -1.911015279e-04f, -1.951364393e-04f, -2.094276424e-04f, -2.134625684e-04f,
+  -2.291185083e-04f, -2.331534342e-04f, -2.474446374e-04f, -2.514795633e-04f,
+  -2.726000967e-04f, -2.766350226e-04f, -2.909262257e-04f, -2.949611517e-04f,
+  -2.039921819e-04f, -2.080271079e-04f, -2.223183110e-04f, -2.263532224e-04f,
+  -2.474737703e-04f, -2.515086962e-04f, -2.657998994e-04f, -2.698348253e-04f,
+  -2.854907652e-04f, -2.895256912e-04f, -3.038168943e-04f, -3.078517911e-04f,
+  -3.289723536e-04f, -3.330072796e-04f, -3.472984827e-04f, -3.513334086e-04f,
+  -3.355448716e-04f, -3.395797976e-04f, -3.538710007e-04f, -3.579059266e-04f,
+  -3.790264600e-04f, -3.830613859e-04f, -3.973525891e-04f, -4.013875150e-04f,
+  -4.170434549e-04f, -4.210783809e-04f, -4.353695840e-04f, -4.394044809e-04f,
+  -4.605250433e-04f, -4.645599693e-04f, -4.788511724e-04f, -4.828860983e-04f
+},
+{
+  -4.350513220e-03f, -4.578638356e-03f, -4.456101451e-03f, -4.684226587e-03f,
+  -4.210453946e-03f, -4.438579082e-03f, -4.316041712e-03f, -4.544166848e-03f,
+  -3.817620454e-03f, -4.045745824e-03f, -3.923208453e-03f, -4.151333589e-03f,
+  -3.677561181e-03f, -3.905686317e-03f, -3.783149179e-03f, -4.011274315e-03f,
+  -3.274185816e-03f, -3.502310952e-03f, -3.379774047e-03f, -3.607899183e-03f,
+  -3.134126542e-03f, -3.362251678e-03f, -3.239714773e-03f, -3.467839910e-03f,
+  -2.741293283e-03f, -2.969418420e-03f, -2.846881282e-03f, -3.075006418e-03f,
+  -2.601233777e-03f, -2.829358913e-03f, -2.706822008e-03f, -2.934947144e-03f,
+  -2.609648509e-03f, -2.837773645e-03f, -2.715236740e-03f, -2.943361877e-03f,
+  -2.469589235e-03f, -2.697714372e-03f, -2.575177466e-03f, -2.803302603e-03f,
+  -2.076755976e-03f, -2.304881113e-03f, -2.182343975e-03f, -2.410469111e-03f,
+  -1.936696586e-03f, -2.164821606e-03f, -2.042284701e-03f, -2.270409837e-03f,
+  -1.533321338e-03f, -1.761446474e-03f, -1.638909569e-03f, -1.867034705e-03f,
+  -1.393262064e-03f, -1.621387084e-03f, -1.498850179e-03f, -1.726975315e-03f,
+  -1.000428689e-03f, -1.228553825e-03f, -1.106016804e-03f, -1.334141940e-03f,
+  -8.603692986e-04f, -1.088494435e-03f, -9.659574716e-04f, -1.194082550e-03f,
+  -1.897120732e-03f, -2.125245752e-03f, -2.002708847e-03f, -2.230833983e-03f,
+  -1.757061342e-03f, -1.985186478e-03f, -1.862649457e-03f, -2.090774709e-03f,
+  -1.364227966e-03f, -1.592353103e-03f, -1.469816198e-03f, -1.697941334e-03f,
+  -1.224168693e-03f, -1.452293829e-03f, -1.329756808e-03f, -1.557881944e-03f,
+  -8.207934443e-04f, -1.048918581e-03f, -9.263816173e-04f, -1.154506695e-03f,
+  -6.807341124e-04f, -9.088592487e-04f, -7.863222272e-04f, -1.014447422e-03f,
+  -2.879007661e-04f, -5.160259316e-04f, -3.934889100e-04f, -6.216140464e-04f,
+  -1.478414051e-04f, -3.759665415e-04f, -2.534295490e-04f, -4.815546854e-04f,
+  -1.562561665e-04f, -3.843813029e-04f, -2.618443104e-04f, -4.899694468e-04f,
+  -1.619679642e-05f, -2.443219128e-04f, -1.217849349e-04f, -3.499100567e-04f,
+  3.766365116e-04f, 1.485113899e-04f, 2.710483677e-04f, 4.292324957e-05f,
+  5.166959018e-04f, 2.885707654e-04f, 4.111077578e-04f, 1.829826215e-04f,
+  9.200710920e-04f, 6.919459556e-04f, 8.144829189e-04f, 5.863577826e-04f,
+  1.060130424e-03f, 8.320052875e-04f, 9.545423090e-04f, 7.264171727e-04f,
+  1.452963799e-03f, 1.224838663e-03f, 1.347375568e-03f, 1.119250432e-03f,
+  1.593023189e-03f, 1.364898053e-03f, 1.487434958e-03f, 1.259309822e-03f,
+  -1.259309822e-03f, -1.487434958e-03f, -1.364898053e-03f, -1.593023189e-03f,
+  -1.119250432e-03f, -1.347375568e-03f, -1.224838663e-03f, -1.452963799e-03f,
+  -7.264171727e-04f, -9.545423090e-04f, -8.320052875e-04f, -1.060130424e-03f,
+  -5.863577826e-04f, -8.144829189e-04f, -6.919459556e-04f, -9.200710920e-04f,
+  -1.829826215e-04f, -4.111077578e-04f, -2.885707654e-04f, -5.166959018e-04f,
+  -4.292324957e-05f, -2.710483677e-04f, -1.485113899e-04f, -3.766365116e-04f,
+  3.499100567e-04f, 1.217849349e-04f, 2.443219128e-04f, 1.619679642e-05f,
+  4.899694468e-04f, 2.618443104e-04f, 3.843813029e-04f, 1.562561665e-04f,
+  4.815546854e-04f, 2.534295490e-04f, 3.759665415e-04f, 1.478414051e-04f,
+  6.216140464e-04f, 3.934889100e-04f, 5.160259316e-04f, 2.879007661e-04f,
+  1.014447422e-03f, 7.863222272e-04f, 9.088592487e-04f, 6.807341124e-04f,
+  1.154506695e-03f, 9.263816173e-04f, 1.048918581e-03f, 8.207934443e-04f,
+  1.557881944e-03f, 1.329756808e-03f, 1.452293829e-03f, 1.224168693e-03f,
+  1.697941334e-03f, 1.469816198e-03f, 1.592353103e-03f, 1.364227966e-03f,
+  2.090774709e-03f, 1.862649457e-03f, 1.985186478e-03f, 1.757061342e-03f,
+  2.230833983e-03f, 2.002708847e-03f, 2.125245752e-03f, 1.897120732e-03f,
+  1.194082550e-03f, 9.659574716e-04f, 1.088494435e-03f, 8.603692986e-04f,
+  1.334141940e-03f, 1.106016804e-03f, 1.228553825e-03f, 1.000428689e-03f,
+  1.726975315e-03f, 1.498850179e-03f, 1.621387084e-03f, 1.393262064e-03f,
+  1.867034705e-03f, 1.638909569e-03f, 1.761446474e-03f, 1.533321338e-03f,
+  2.270409837e-03f, 2.042284701e-03f, 2.164821606e-03f, 1.936696586e-03f,
+  2.410469111e-03f, 2.182343975e-03f, 2.304881113e-03f, 2.076755976e-03f,
+  2.803302603e-03f, 2.575177466e-03f, 2.697714372e-03f, 2.469589235e-03f,
+  2.943361877e-03f, 2.715236740e-03f, 2.837773645e-03f, 2.609648509e-03f,
+  2.934947144e-03f, 2.706822008e-03f, 2.829358913e-03f, 2.601233777e-03f,
+  3.075006418e-03f, 2.846881282e-03f, 2.969418420e-03f, 2.741293283e-03f,
+  3.467839910e-03f, 3.239714773e-03f, 3.362251678e-03f, 3.134126542e-03f,
+  3.607899183e-03f, 3.379774047e-03f, 3.502310952e-03f, 3.274185816e-03f,
+  4.011274315e-03f, 3.783149179e-03f, 3.905686317e-03f, 3.677561181e-03f,
+  4.151333589e-03f, 3.923208453e-03f, 4.045745824e-03f, 3.817620454e-03f,
+  4.544166848e-03f, 4.316041712e-03f, 4.438579082e-03f, 4.210453946e-03f,
+  4.684226587e-03f, 4.456101451e-03f, 4.578638356e-03f, 4.350513220e-03f
+},
+{
+  9.101628326e-03f, 1.258572191e-02f, 1.252904721e-02f, 1.601313986e-02f,
+  1.180930436e-02f, 1.529339794e-02f, 1.523672324e-02f, 1.872081682e-02f,
+  1.024178136e-02f, 1.372587495e-02f, 1.366919931e-02f, 1.715329289e-02f,
+  1.294945739e-02f, 1.643355004e-02f, 1.637687534e-02f, 1.986096986e-02f,
+  7.717191242e-03f, 1.120128483e-02f, 1.114460919e-02f, 1.462870277e-02f,
+  1.042486727e-02f, 1.390896086e-02f, 1.385228522e-02f, 1.733637974e-02f,
+  8.857343346e-03f, 1.234143693e-02f, 1.228476223e-02f, 1.576885581e-02f,
+  1.156501938e-02f, 1.504911296e-02f, 1.499243826e-02f, 1.847653091e-02f,
+  4.251556471e-03f, 7.735650055e-03f, 7.678974885e-03f, 1.116306894e-02f,
+  6.959232502e-03f, 1.044332609e-02f, 1.038665138e-02f, 1.387074497e-02f,
+  5.391709041e-03f, 8.875803091e-03f, 8.819127455e-03f, 1.230322104e-02f,
+  8.099384606e-03f, 1.158347912e-02f, 1.152680349e-02f, 1.501089707e-02f,
+  2.867119154e-03f, 6.351212971e-03f, 6.294537336e-03f, 9.778630920e-03f,
+  5.574795417e-03f, 9.058889002e-03f, 9.002213366e-03f, 1.248630695e-02f,
+  4.007271491e-03f, 7.491365075e-03f, 7.434689905e-03f, 1.091878396e-02f,
+  6.714947522e-03f, 1.019904111e-02f, 1.014236640e-02f, 1.362645999e-02f,
+  3.125987860e-05f, 3.515353659e-03f, 3.458678257e-03f, 6.942771841e-03f,
+  2.738935873e-03f, 6.223029457e-03f, 6.166354287e-03f, 9.650448337e-03f,
+  1.171412296e-03f, 4.655505996e-03f, 4.598830827e-03f, 8.082924411e-03f,
+  3.879088210e-03f, 7.363182027e-03f, 7.306506857e-03f, 1.079060044e-02f,
+  -1.353177591e-03f, 2.130916109e-03f, 2.074240707e-03f, 5.558334291e-03f,
+  1.354498439e-03f, 4.838592373e-03f, 4.781916738e-03f, 8.266010322e-03f,
+  -2.130251087e-04f, 3.271068679e-03f, 3.214393277e-03f, 6.698486861e-03f,
+  2.494650893e-03f, 5.978744477e-03f, 5.922069307e-03f, 9.406163357e-03f,
+  -4.818812013e-03f, -1.334718312e-03f, -1.391393715e-03f, 2.092699986e-03f,
+  -2.111135982e-03f, 1.372957602e-03f, 1.316282316e-03f, 4.800376017e-03f,
+  -3.678659676e-03f, -1.945659315e-04f, -2.512412611e-04f, 3.232852323e-03f,
+  -9.709835867e-04f, 2.513110172e-03f, 2.456434770e-03f, 5.940528587e-03f,
+  -6.203249563e-03f, -2.719155746e-03f, -2.775831148e-03f, 7.082625525e-04f,
+  -3.495573532e-03f, -1.147976673e-05f, -6.815510278e-05f, 3.415938467e-03f,
+  -5.063096993e-03f, -1.579003292e-03f, -1.635678695e-03f, 1.848415006e-03f,
+  -2.355420962e-03f, 1.128672622e-03f, 1.071997336e-03f, 4.556091037e-03f,
+  -4.556091037e-03f, -1.071997336e-03f, -1.128672622e-03f, 2.355420962e-03f,
+  -1.848415006e-03f, 1.635678695e-03f, 1.579003292e-03f, 5.063096993e-03f,
+  -3.415938467e-03f, 6.815510278e-05f, 1.147976673e-05f, 3.495573532e-03f,
+  -7.082625525e-04f, 2.775831148e-03f, 2.719155746e-03f, 6.203249563e-03f,
+  -5.940528587e-03f, -2.456434770e-03f, -2.513110172e-03f, 9.709835867e-04f,
+  -3.232852323e-03f, 2.512412611e-04f, 1.945659315e-04f, 3.678659676e-03f,
+  -4.800376017e-03f, -1.316282316e-03f, -1.372957602e-03f, 2.111135982e-03f,
+  -2.092699986e-03f, 1.391393715e-03f, 1.334718312e-03f, 4.818812013e-03f,
+  -9.406163357e-03f, -5.922069307e-03f, -5.978744477e-03f, -2.494650893e-03f,
+  -6.698486861e-03f, -3.214393277e-03f, -3.271068679e-03f, 2.130251087e-04f,
+  -8.266010322e-03f, -4.781916738e-03f, -4.838592373e-03f, -1.354498439e-03f,
+  -5.558334291e-03f, -2.074240707e-03f, -2.130916109e-03f, 1.353177591e-03f,
+  -1.079060044e-02f, -7.306506857e-03f, -7.363182027e-03f, -3.879088210e-03f,
+  -8.082924411e-03f, -4.598830827e-03f, -4.655505996e-03f, -1.171412296e-03f,
+  -9.650448337e-03f, -6.166354287e-03f, -6.223029457e-03f, -2.738935873e-03f,
+  -6.942771841e-03f, -3.458678257e-03f, -3.515353659e-03f, -3.125987860e-05f,
+  -1.362645999e-02f, -1.014236640e-02f, -1.019904111e-02f, -6.714947522e-03f,
+  -1.091878396e-02f, -7.434689905e-03f, -7.491365075e-03f, -4.007271491e-03f,
+  -1.248630695e-02f, -9.002213366e-03f, -9.058889002e-03f, -5.574795417e-03f,
+  -9.778630920e-03f, -6.294537336e-03f, -6.351212971e-03f, -2.867119154e-03f,
+  -1.501089707e-02f, -1.152680349e-02f, -1.158347912e-02f, -8.099384606e-03f,
+  -1.230322104e-02f, -8.819127455e-03f, -8.875803091e-03f, -5.391709041e-03f,
+  -1.387074497e-02f, -1.038665138e-02f, -1.044332609e-02f, -6.959232502e-03f,
+  -1.116306894e-02f, -7.678974885e-03f, -7.735650055e-03f, -4.251556471e-03f,
+  -1.847653091e-02f, -1.499243826e-02f, -1.504911296e-02f, -1.156501938e-02f,
+  -1.576885581e-02f, -1.228476223e-02f, -1.234143693e-02f, -8.857343346e-03f,
+  -1.733637974e-02f, -1.385228522e-02f, -1.390896086e-02f, -1.042486727e-02f,
+  -1.462870277e-02f, -1.114460919e-02f, -1.120128483e-02f, -7.717191242e-03f,
+  -1.986096986e-02f, -1.637687534e-02f, -1.643355004e-02f, -1.294945739e-02f,
+  -1.715329289e-02f, -1.366919931e-02f, -1.372587495e-02f, -1.024178136e-02f,
+  -1.872081682e-02f, -1.523672324e-02f, -1.529339794e-02f, -1.180930436e-02f,
+  -1.601313986e-02f, -1.252904721e-02f, -1.258572191e-02f, -9.101628326e-03f
+},
+{
+  3.586041927e-02f, 1.784460805e-02f, 1.449764334e-02f, -3.518166719e-03f,
+  1.307187416e-02f, -4.943936132e-03f, -8.290901780e-03f, -2.630671114e-02f,
+  1.451558247e-02f, -3.500227584e-03f, -6.847192999e-03f, -2.486300282e-02f,
+  -8.272961713e-03f, -2.628877200e-02f, -2.963573672e-02f, -4.765154794e-02f,
+  1.969991811e-02f, 1.684108400e-03f, -1.662857132e-03f, -1.967866719e-02f,
+  -3.088626079e-03f, -2.110443637e-02f, -2.445140108e-02f, -4.246721044e-02f,
+  -1.644917764e-03f, -1.966072805e-02f, -2.300769277e-02f, -4.102350399e-02f,
+  -2.443346195e-02f, -4.244927317e-02f, -4.579623789e-02f, -6.381204724e-02f,
+  2.929101139e-02f, 1.127520204e-02f, 7.928236388e-03f, -1.008757390e-02f,
+  6.502467208e-03f, -1.151334308e-02f, -1.486030780e-02f, -3.287611902e-02f,
+  7.946175523e-03f, -1.006963477e-02f, -1.341659948e-02f, -3.143240884e-02f,
+  -1.484236866e-02f, -3.285817802e-02f, -3.620514274e-02f, -5.422095582e-02f,
+  1.313051209e-02f, -4.885298666e-03f, -8.232263848e-03f, -2.624807321e-02f,
+  -9.658033028e-03f, -2.767384239e-02f, -3.102080896e-02f, -4.903661832e-02f,
+  -8.214324713e-03f, -2.623013407e-02f, -2.957710065e-02f, -4.759291187e-02f,
+  -3.100286983e-02f, -4.901868105e-02f, -5.236564577e-02f, -7.038145512e-02f,
+  4.362650588e-02f, 2.561069652e-02f, 2.226372994e-02f, 4.247920122e-03f,
+  2.083796076e-02f, 2.822150942e-03f, -5.248145317e-04f, -1.854062453e-02f,
+  2.228166908e-02f, 4.265859257e-03f, 9.188939002e-04f, -1.709691621e-02f,
+  -5.068751634e-04f, -1.852268539e-02f, -2.186965011e-02f, -3.988546133e-02f,
+  2.746600471e-02f, 9.450195357e-03f, 6.103229709e-03f, -1.191258058e-02f,
+  4.677460529e-03f, -1.333834976e-02f, -1.668531448e-02f, -3.470112383e-02f,
+  6.121169310e-03f, -1.189464144e-02f, -1.524160616e-02f, -3.325741738e-02f,
+  -1.666737534e-02f, -3.468318656e-02f, -3.803015128e-02f, -5.604596063e-02f,
+  3.705709800e-02f, 1.904128864e-02f, 1.569432393e-02f, -2.321486827e-03f,
+  1.426855382e-02f, -3.747256007e-03f, -7.094221190e-03f, -2.511003241e-02f,
+  1.571226306e-02f, -2.303547459e-03f, -5.650512874e-03f, -2.366632223e-02f,
+  -7.076282054e-03f, -2.509209141e-02f, -2.843905799e-02f, -4.645486921e-02f,
+  2.089659870e-02f, 2.880788408e-03f, -4.661770945e-04f, -1.848198660e-02f,
+  -1.891946187e-03f, -1.990775578e-02f, -2.325472236e-02f, -4.127053171e-02f,
+  -4.482377262e-04f, -1.846404746e-02f, -2.181101404e-02f, -3.982682526e-02f,
+  -2.323678322e-02f, -4.125259444e-02f, -4.459955916e-02f, -6.261536479e-02f,
+  6.261536479e-02f, 4.459955916e-02f, 4.125259444e-02f, 2.323678322e-02f,
+  3.982682526e-02f, 2.181101404e-02f, 1.846404746e-02f, 4.482377262e-04f,
+  4.127053171e-02f, 2.325472236e-02f, 1.990775578e-02f, 1.891946187e-03f,
+  1.848198660e-02f, 4.661770945e-04f, -2.880788408e-03f, -2.089659870e-02f,
+  4.645486921e-02f, 2.843905799e-02f, 2.509209141e-02f, 7.076282054e-03f,
+  2.366632223e-02f, 5.650512874e-03f, 2.303547459e-03f, -1.571226306e-02f,
+  2.511003241e-02f, 7.094221190e-03f, 3.747256007e-03f, -1.426855382e-02f,
+  2.321486827e-03f, -1.569432393e-02f, -1.904128864e-02f, -3.705709800e-02f,
+  5.604596063e-02f, 3.803015128e-02f, 3.468318656e-02f, 1.666737534e-02f,
+  3.325741738e-02f, 1.524160616e-02f, 1.189464144e-02f, -6.121169310e-03f,
+  3.470112383e-02f, 1.668531448e-02f, 1.333834976e-02f, -4.677460529e-03f,
+  1.191258058e-02f, -6.103229709e-03f, -9.450195357e-03f, -2.746600471e-02f,
+  3.988546133e-02f, 2.186965011e-02f, 1.852268539e-02f, 5.068751634e-04f,
+  1.709691621e-02f, -9.188939002e-04f, -4.265859257e-03f, -2.228166908e-02f,
+  1.854062453e-02f, 5.248145317e-04f, -2.822150942e-03f, -2.083796076e-02f,
+  -4.247920122e-03f, -2.226372994e-02f, -2.561069652e-02f, -4.362650588e-02f,
+  7.038145512e-02f, 5.236564577e-02f, 4.901868105e-02f, 3.100286983e-02f,
+  4.759291187e-02f, 2.957710065e-02f, 2.623013407e-02f, 8.214324713e-03f,
+  4.903661832e-02f, 3.102080896e-02f, 2.767384239e-02f, 9.658033028e-03f,
+  2.624807321e-02f, 8.232263848e-03f, 4.885298666e-03f, -1.313051209e-02f,
+  5.422095582e-02f, 3.620514274e-02f, 3.285817802e-02f, 1.484236866e-02f,
+  3.143240884e-02f, 1.341659948e-02f, 1.006963477e-02f, -7.946175523e-03f,
+  3.287611902e-02f, 1.486030780e-02f, 1.151334308e-02f, -6.502467208e-03f,
+  1.008757390e-02f, -7.928236388e-03f, -1.127520204e-02f, -2.929101139e-02f,
+  6.381204724e-02f, 4.579623789e-02f, 4.244927317e-02f, 2.443346195e-02f,
+  4.102350399e-02f, 2.300769277e-02f, 1.966072805e-02f, 1.644917764e-03f,
+  4.246721044e-02f, 2.445140108e-02f, 2.110443637e-02f, 3.088626079e-03f,
+  1.967866719e-02f, 1.662857132e-03f, -1.684108400e-03f, -1.969991811e-02f,
+  4.765154794e-02f, 2.963573672e-02f, 2.628877200e-02f, 8.272961713e-03f,
+  2.486300282e-02f, 6.847192999e-03f, 3.500227584e-03f, -1.451558247e-02f,
+  2.630671114e-02f, 8.290901780e-03f, 4.943936132e-03f, -1.307187416e-02f,
+  3.518166719e-03f, -1.449764334e-02f, -1.784460805e-02f, -3.586041927e-02f
+},
+{
+  -5.410850048e-01f, -4.912665784e-01f, -4.651990831e-01f, -4.153806567e-01f,
+  -4.376324117e-01f, -3.878139853e-01f, -3.617465198e-01f, -3.119280934e-01f,
+  -4.103874564e-01f, -3.605690300e-01f, -3.345015645e-01f, -2.846831381e-01f,
+  -3.069348633e-01f, -2.571164370e-01f, -2.310489863e-01f, -1.812305599e-01f,
+  -3.854339421e-01f, -3.356155157e-01f, -3.095480502e-01f, -2.597296238e-01f,
+  -2.819813490e-01f, -2.321629375e-01f, -2.060954571e-01f, -1.562770307e-01f,
+  -2.547364235e-01f, -2.049179822e-01f, -1.788505167e-01f, -1.290320903e-01f,
+  -1.512838304e-01f, -1.014653966e-01f, -7.539793104e-02f, -2.557950281e-02f,
+  -3.646920621e-01f, -3.148736358e-01f, -2.888061404e-01f, -2.389877290e-01f,
+  -2.612394691e-01f, -2.114210427e-01f, -1.853535622e-01f, -1.355351359e-01f,
+  -2.339945138e-01f, -1.841760874e-01f, -1.581086218e-01f, -1.082901955e-01f,
+  -1.305419356e-01f, -8.072350919e-02f, -5.465603620e-02f, -4.837610759e-03f,
+  -2.090409994e-01f, -1.592225730e-01f, -1.331551075e-01f, -8.333667368e-02f,
+  -1.055884138e-01f, -5.576998740e-02f, -2.970251814e-02f, 2.011591010e-02f,
+  -7.834347337e-02f, -2.852504328e-02f, -2.457573311e-03f, 4.736085236e-02f,
+  2.510911599e-02f, 7.492754608e-02f, 1.009950116e-01f, 1.508134454e-01f,
+  -3.498280942e-01f, -3.000096381e-01f, -2.739421725e-01f, -2.241237611e-01f,
+  -2.463754863e-01f, -1.965570599e-01f, -1.704895943e-01f, -1.206711680e-01f,
+  -2.191305459e-01f, -1.693121195e-01f, -1.432446539e-01f, -9.342622757e-02f,
+  -1.156779602e-01f, -6.585953385e-02f, -3.979206458e-02f, 1.002636179e-02f,
+  -1.941770315e-01f, -1.443586051e-01f, -1.182911322e-01f, -6.847270578e-02f,
+  -9.072444588e-02f, -4.090601578e-02f, -1.483854558e-02f, 3.497987986e-02f,
+  -6.347949803e-02f, -1.366107166e-02f, 1.240639854e-02f, 6.222482398e-02f,
+  3.997308761e-02f, 8.979151398e-02f, 1.158589870e-01f, 1.656774133e-01f,
+  -1.734351367e-01f, -1.236167103e-01f, -9.754923731e-02f, -4.773081467e-02f,
+  -6.998255104e-02f, -2.016412280e-02f, 5.903346464e-03f, 5.572177470e-02f,
+  -4.273760691e-02f, 7.080820855e-03f, 3.314829245e-02f, 8.296671510e-02f,
+  6.071497872e-02f, 1.105334088e-01f, 1.366008818e-01f, 1.864193082e-01f,
+  -1.778408699e-02f, 3.203434125e-02f, 5.810181051e-02f, 1.079202369e-01f,
+  8.566849679e-02f, 1.354869306e-01f, 1.615543962e-01f, 2.113728225e-01f,
+  1.129134446e-01f, 1.627318710e-01f, 1.887993366e-01f, 2.386177629e-01f,
+  2.163660377e-01f, 2.661844492e-01f, 2.922519147e-01f, 3.420703411e-01f,
+  -3.420703411e-01f, -2.922519147e-01f, -2.661844492e-01f, -2.163660377e-01f,
+  -2.386177629e-01f, -1.887993366e-01f, -1.627318710e-01f, -1.129134446e-01f,
+  -2.113728225e-01f, -1.615543962e-01f, -1.354869306e-01f, -8.566849679e-02f,
+  -1.079202369e-01f, -5.810181051e-02f, -3.203434125e-02f, 1.778408699e-02f,
+  -1.864193082e-01f, -1.366008818e-01f, -1.105334088e-01f, -6.071497872e-02f,
+  -8.296671510e-02f, -3.314829245e-02f, -7.080820855e-03f, 4.273760691e-02f,
+  -5.572177470e-02f, -5.903346464e-03f, 2.016412280e-02f, 6.998255104e-02f,
+  4.773081467e-02f, 9.754923731e-02f, 1.236167103e-01f, 1.734351367e-01f,
+  -1.656774133e-01f, -1.158589870e-01f, -8.979151398e-02f, -3.997308761e-02f,
+  -6.222482398e-02f, -1.240639854e-02f, 1.366107166e-02f, 6.347949803e-02f,
+  -3.497987986e-02f, 1.483854558e-02f, 4.090601578e-02f, 9.072444588e-02f,
+  6.847270578e-02f, 1.182911322e-01f, 1.443586051e-01f, 1.941770315e-01f,
+  -1.002636179e-02f, 3.979206458e-02f, 6.585953385e-02f, 1.156779602e-01f,
+  9.342622757e-02f, 1.432446539e-01f, 1.693121195e-01f, 2.191305459e-01f,
+  1.206711680e-01f, 1.704895943e-01f, 1.965570599e-01f, 2.463754863e-01f,
+  2.241237611e-01f, 2.739421725e-01f, 3.000096381e-01f, 3.498280942e-01f,
+  -1.508134454e-01f, -1.009950116e-01f, -7.492754608e-02f, -2.510911599e-02f,
+  -4.736085236e-02f, 2.457573311e-03f, 2.852504328e-02f, 7.834347337e-02f,
+  -2.011591010e-02f, 2.970251814e-02f, 5.576998740e-02f, 1.055884138e-01f,
+  8.333667368e-02f, 1.331551075e-01f, 1.592225730e-01f, 2.090409994e-01f,
+  4.837610759e-03f, 5.465603620e-02f, 8.072350919e-02f, 1.305419356e-01f,
+  1.082901955e-01f, 1.581086218e-01f, 1.841760874e-01f, 2.339945138e-01f,
+  1.355351359e-01f, 1.853535622e-01f, 2.114210427e-01f, 2.612394691e-01f,
+  2.389877290e-01f, 2.888061404e-01f, 3.148736358e-01f, 3.646920621e-01f,
+  2.557950281e-02f, 7.539793104e-02f, 1.014653966e-01f, 1.512838304e-01f,
+  1.290320903e-01f, 1.788505167e-01f, 2.049179822e-01f, 2.547364235e-01f,
+  1.562770307e-01f, 2.060954571e-01f, 2.321629375e-01f, 2.819813490e-01f,
+  2.597296238e-01f, 3.095480502e-01f, 3.356155157e-01f, 3.854339421e-01f,
+  1.812305599e-01f, 2.310489863e-01f, 2.571164370e-01f, 3.069348633e-01f,
+  2.846831381e-01f, 3.345015645e-01f, 3.605690300e-01f, 4.103874564e-01f,
+  3.119280934e-01f, 3.617465198e-01f, 3.878139853e-01f, 4.376324117e-01f,
+  4.153806567e-01f, 4.651990831e-01f, 4.912665784e-01f, 5.410850048e-01f
+}
+};
+
+static const float ctables128[12][256] = {
+{
+  -3.217246331e-06f, -3.248912208e-06f, -3.237235660e-06f, -3.268901764e-06f,
+  -3.168191142e-06f, -3.199857019e-06f, -3.188180472e-06f, -3.219846349e-06f,
+  -3.002928224e-06f, -3.034594329e-06f, -3.022917781e-06f, -3.054583658e-06f,
+  -2.953873036e-06f, -2.985539140e-06f, -2.973862365e-06f, -3.005528470e-06f,
+  -2.693636134e-06f, -2.725302238e-06f, -2.713625463e-06f, -2.745291567e-06f,
+  -2.644580945e-06f, -2.676246822e-06f, -2.664570275e-06f, -2.696236379e-06f,
+  -2.479318255e-06f, -2.510984132e-06f, -2.499307584e-06f, -2.530973461e-06f,
+  -2.430262839e-06f, -2.461928943e-06f, -2.450252396e-06f, -2.481918273e-06f,
+  -2.185644007e-06f, -2.217310112e-06f, -2.205633564e-06f, -2.237299441e-06f,
+  -2.136588819e-06f, -2.168254923e-06f, -2.156578148e-06f, -2.188244252e-06f,
+  -1.971326128e-06f, -2.002992233e-06f, -1.991315457e-06f, -2.022981562e-06f,
+  -1.922270940e-06f, -1.953936817e-06f, -1.942260269e-06f, -1.973926373e-06f,
+  -1.662033924e-06f, -1.693699915e-06f, -1.682023367e-06f, -1.713689358e-06f,
+  -1.612978735e-06f, -1.644644726e-06f, -1.632968065e-06f, -1.664634055e-06f,
+  -1.447716045e-06f, -1.479382036e-06f, -1.467705374e-06f, -1.499371365e-06f,
+  -1.398660743e-06f, -1.430326733e-06f, -1.418650186e-06f, -1.450316176e-06f,
+  -1.421272827e-06f, -1.452938818e-06f, -1.441262157e-06f, -1.472928147e-06f,
+  -1.372217639e-06f, -1.403883630e-06f, -1.392206968e-06f, -1.423872959e-06f,
+  -1.206954835e-06f, -1.238620825e-06f, -1.226944278e-06f, -1.258610268e-06f,
+  -1.157899646e-06f, -1.189565637e-06f, -1.177888976e-06f, -1.209554966e-06f,
+  -8.976626873e-07f, -9.293286780e-07f, -9.176520734e-07f, -9.493180642e-07f,
+  -8.486074421e-07f, -8.802734328e-07f, -8.685968282e-07f, -9.002628190e-07f,
+  -6.833446946e-07f, -7.150106853e-07f, -7.033340808e-07f, -7.350000715e-07f,
+  -6.342895063e-07f, -6.659554970e-07f, -6.542788356e-07f, -6.859448263e-07f,
+  -3.896706460e-07f, -4.213366367e-07f, -4.096600037e-07f, -4.413259944e-07f,
+  -3.406154008e-07f, -3.722813915e-07f, -3.606047869e-07f, -3.922707776e-07f,
+  -1.753526817e-07f, -2.070186724e-07f, -1.953420536e-07f, -2.270080444e-07f,
+  -1.262974507e-07f, -1.579634414e-07f, -1.462868227e-07f, -1.779528134e-07f,
+  1.339395084e-07f, 1.022735105e-07f, 1.139501364e-07f, 8.228414572e-08f,
+  1.829947394e-07f, 1.513287486e-07f, 1.630053674e-07f, 1.313393767e-07f,
+  3.482574584e-07f, 3.165914677e-07f, 3.282681007e-07f, 2.966021100e-07f,
+  3.973127036e-07f, 3.656467129e-07f, 3.773233175e-07f, 3.456573268e-07f,
+  -3.456573268e-07f, -3.773233175e-07f, -3.656467129e-07f, -3.973127036e-07f,
+  -2.966021100e-07f, -3.282681007e-07f, -3.165914677e-07f, -3.482574584e-07f,
+  -1.313393767e-07f, -1.630053674e-07f, -1.513287486e-07f, -1.829947394e-07f,
+  -8.228414572e-08f, -1.139501364e-07f, -1.022735105e-07f, -1.339395084e-07f,
+  1.779528134e-07f, 1.462868227e-07f, 1.579634414e-07f, 1.262974507e-07f,
+  2.270080444e-07f, 1.953420536e-07f, 2.070186724e-07f, 1.753526817e-07f,
+  3.922707776e-07f, 3.606047869e-07f, 3.722813915e-07f, 3.406154008e-07f,
+  4.413259944e-07f, 4.096600037e-07f, 4.213366367e-07f, 3.896706460e-07f,
+  6.859448263e-07f, 6.542788356e-07f, 6.659554970e-07f, 6.342895063e-07f,
+  7.350000715e-07f, 7.033340808e-07f, 7.150106853e-07f, 6.833446946e-07f,
+  9.002628190e-07f, 8.685968282e-07f, 8.802734328e-07f, 8.486074421e-07f,
+  9.493180642e-07f, 9.176520734e-07f, 9.293286780e-07f, 8.976626873e-07f,
+  1.209554966e-06f, 1.177888976e-06f, 1.189565637e-06f, 1.157899646e-06f,
+  1.258610268e-06f, 1.226944278e-06f, 1.238620825e-06f, 1.206954835e-06f,
+  1.423872959e-06f, 1.392206968e-06f, 1.403883630e-06f, 1.372217639e-06f,
+  1.472928147e-06f, 1.441262157e-06f, 1.452938818e-06f, 1.421272827e-06f,
+  1.450316176e-06f, 1.418650186e-06f, 1.430326733e-06f, 1.398660743e-06f,
+  1.499371365e-06f, 1.467705374e-06f, 1.479382036e-06f, 1.447716045e-06f,
+  1.664634055e-06f, 1.632968065e-06f, 1.644644726e-06f, 1.612978735e-06f,
+  1.713689358e-06f, 1.682023367e-06f, 1.693699915e-06f, 1.662033924e-06f,
+  1.973926373e-06f, 1.942260269e-06f, 1.953936817e-06f, 1.922270940e-06f,
+  2.022981562e-06f, 1.991315457e-06f, 2.002992233e-06f, 1.971326128e-06f,
+  2.188244252e-06f, 2.156578148e-06f, 2.168254923e-06f, 2.136588819e-06f,
+  2.237299441e-06f, 2.205633564e-06f, 2.217310112e-06f, 2.185644007e-06f,
+  2.481918273e-06f, 2.450252396e-06f, 2.461928943e-06f, 2.430262839e-06f,
+  2.530973461e-06f, 2.499307584e-06f, 2.510984132e-06f, 2.479318255e-06f,
+  2.696236379e-06f, 2.664570275e-06f, 2.676246822e-06f, 2.644580945e-06f,
+  2.745291567e-06f, 2.713625463e-06f, 2.725302238e-06f, 2.693636134e-06f,
+  3.005528470e-06f, 2.973862365e-06f, 2.985539140e-06f, 2.953873036e-06f,
+  3.054583658e-06f, 3.022917781e-06f, 3.034594329e-06f, 3.002928224e-06f,
+  3.219846349e-06f, 3.188180472e-06f, 3.199857019e-06f, 3.168191142e-06f,
+  3.268901764e-06f, 3.237235660e-06f, 3.248912208e-06f, 3.217246331e-06f
+},
+{
+  -4.923330926e-05f, -4.493070810e-05f, -4.312075907e-05f, -3.881815792e-05f,
+  -4.094057294e-05f, -3.663797179e-05f, -3.482802276e-05f, -3.052542161e-05f,
+  -3.844392268e-05f, -3.414132152e-05f, -3.233137249e-05f, -2.802876952e-05f,
+  -3.015118637e-05f, -2.584858521e-05f, -2.403863436e-05f, -1.973603321e-05f,
+  -3.574289076e-05f, -3.144028960e-05f, -2.963034058e-05f, -2.532773942e-05f,
+  -2.745015445e-05f, -2.314755329e-05f, -2.133760427e-05f, -1.703500311e-05f,
+  -2.495350418e-05f, -2.065090302e-05f, -1.884095218e-05f, -1.453835102e-05f,
+  -1.666076787e-05f, -1.235816580e-05f, -1.054821678e-05f, -6.245614713e-06f,
+  -3.302050027e-05f, -2.871789729e-05f, -2.690794827e-05f, -2.260534529e-05f,
+  -2.472776214e-05f, -2.042516098e-05f, -1.861521196e-05f, -1.431260989e-05f,
+  -2.223111187e-05f, -1.792850890e-05f, -1.611855987e-05f, -1.181595871e-05f,
+  -1.393837465e-05f, -9.635773495e-06f, -7.825823559e-06f, -3.523222176e-06f,
+  -1.953007995e-05f, -1.522747880e-05f, -1.341752886e-05f, -9.114927707e-06f,
+  -1.123734364e-05f, -6.934742487e-06f, -5.124793006e-06f, -8.221911685e-07f,
+  -8.740693374e-06f, -4.438091310e-06f, -2.628141829e-06f, 1.674459781e-06f,
+  -4.479566940e-07f, 3.854645001e-06f, 5.664594482e-06f, 9.967196092e-06f,
+  -3.054138870e-05f, -2.623878754e-05f, -2.442883851e-05f, -2.012623736e-05f,
+  -2.224865239e-05f, -1.794605123e-05f, -1.613610220e-05f, -1.183350014e-05f,
+  -1.975200212e-05f, -1.544940096e-05f, -1.363945103e-05f, -9.336848962e-06f,
+  -1.145926581e-05f, -7.156664196e-06f, -5.346714715e-06f, -1.044112878e-06f,
+  -1.705097202e-05f, -1.274836904e-05f, -1.093842002e-05f, -6.635818409e-06f,
+  -8.758234799e-06f, -4.455633189e-06f, -2.645683708e-06f, 1.656918130e-06f,
+  -6.261583621e-06f, -1.958982011e-06f, -1.490326440e-07f, 4.153569080e-06f,
+  2.031152462e-06f, 6.333754300e-06f, 8.143703781e-06f, 1.244630585e-05f,
+  -1.432857880e-05f, -1.002597674e-05f, -8.216026799e-06f, -3.913425644e-06f,
+  -6.035842034e-06f, -1.733240310e-06f, 7.670912794e-08f, 4.379310667e-06f,
+  -3.539191084e-06f, 7.634106396e-07f, 2.573360007e-06f, 6.875961844e-06f,
+  4.753545454e-06f, 9.056147064e-06f, 1.086609609e-05f, 1.516869816e-05f,
+  -8.381600765e-07f, 3.464441534e-06f, 5.274391242e-06f, 9.576992852e-06f,
+  7.454576462e-06f, 1.175717807e-05f, 1.356712710e-05f, 1.786973007e-05f,
+  9.951227185e-06f, 1.425382925e-05f, 1.606377919e-05f, 2.036638034e-05f,
+  1.824396350e-05f, 2.254656465e-05f, 2.435651550e-05f, 2.865911665e-05f,
+  -2.865911665e-05f, -2.435651550e-05f, -2.254656465e-05f, -1.824396350e-05f,
+  -2.036638034e-05f, -1.606377919e-05f, -1.425382925e-05f, -9.951227185e-06f,
+  -1.786973007e-05f, -1.356712710e-05f, -1.175717807e-05f, -7.454576462e-06f,
+  -9.576992852e-06f, -5.274391242e-06f, -3.464441534e-06f, 8.381600765e-07f,
+  -1.516869816e-05f, -1.086609609e-05f, -9.056147064e-06f, -4.753545454e-06f,
+  -6.875961844e-06f, -2.573360007e-06f, -7.634106396e-07f, 3.539191084e-06f,
+  -4.379310667e-06f, -7.670912794e-08f, 1.733240310e-06f, 6.035842034e-06f,
+  3.913425644e-06f, 8.216026799e-06f, 1.002597674e-05f, 1.432857880e-05f,
+  -1.244630585e-05f, -8.143703781e-06f, -6.333754300e-06f, -2.031152462e-06f,
+  -4.153569080e-06f, 1.490326440e-07f, 1.958982011e-06f, 6.261583621e-06f,
+  -1.656918130e-06f, 2.645683708e-06f, 4.455633189e-06f, 8.758234799e-06f,
+  6.635818409e-06f, 1.093842002e-05f, 1.274836904e-05f, 1.705097202e-05f,
+  1.044112878e-06f, 5.346714715e-06f, 7.156664196e-06f, 1.145926581e-05f,
+  9.336848962e-06f, 1.363945103e-05f, 1.544940096e-05f, 1.975200212e-05f,
+  1.183350014e-05f, 1.613610220e-05f, 1.794605123e-05f, 2.224865239e-05f,
+  2.012623736e-05f, 2.442883851e-05f, 2.623878754e-05f, 3.054138870e-05f,
+  -9.967196092e-06f, -5.664594482e-06f, -3.854645001e-06f, 4.479566940e-07f,
+  -1.674459781e-06f, 2.628141829e-06f, 4.438091310e-06f, 8.740693374e-06f,
+  8.221911685e-07f, 5.124793006e-06f, 6.934742487e-06f, 1.123734364e-05f,
+  9.114927707e-06f, 1.341752886e-05f, 1.522747880e-05f, 1.953007995e-05f,
+  3.523222176e-06f, 7.825823559e-06f, 9.635773495e-06f, 1.393837465e-05f,
+  1.181595871e-05f, 1.611855987e-05f, 1.792850890e-05f, 2.223111187e-05f,
+  1.431260989e-05f, 1.861521196e-05f, 2.042516098e-05f, 2.472776214e-05f,
+  2.260534529e-05f, 2.690794827e-05f, 2.871789729e-05f, 3.302050027e-05f,
+  6.245614713e-06f, 1.054821678e-05f, 1.235816580e-05f, 1.666076787e-05f,
+  1.453835102e-05f, 1.884095218e-05f, 2.065090302e-05f, 2.495350418e-05f,
+  1.703500311e-05f, 2.133760427e-05f, 2.314755329e-05f, 2.745015445e-05f,
+  2.532773942e-05f, 2.963034058e-05f, 3.144028960e-05f, 3.574289076e-05f,
+  1.973603321e-05f, 2.403863436e-05f, 2.584858521e-05f, 3.015118637e-05f,
+  2.802876952e-05f, 3.233137249e-05f, 3.414132152e-05f, 3.844392268e-05f,
+  3.052542161e-05f, 3.482802276e-05f, 3.663797179e-05f, 4.094057294e-05f,
+  3.881815792e-05f, 4.312075907e-05f, 4.493070810e-05f, 4.923330926e-05f
+},
+{
+  8.452427210e-06f, 2.986735308e-05f, 2.913513345e-05f, 5.055005749e-05f,
+  2.622456122e-05f, 4.763948527e-05f, 4.690726928e-05f, 6.832219515e-05f,
+  2.047855196e-05f, 4.189347601e-05f, 4.116125638e-05f, 6.257618224e-05f,
+  3.825068416e-05f, 5.966561002e-05f, 5.893339039e-05f, 8.034831990e-05f,
+  1.122123012e-05f, 3.263615508e-05f, 3.190393545e-05f, 5.331886132e-05f,
+  2.899336323e-05f, 5.040828910e-05f, 4.967606947e-05f, 7.109099533e-05f,
+  2.324735397e-05f, 4.466227983e-05f, 4.393006020e-05f, 6.534498243e-05f,
+  4.101948798e-05f, 6.243441021e-05f, 6.170219422e-05f, 8.311712008e-05f,
+  -2.198176844e-06f, 1.921674811e-05f, 1.848453030e-05f, 3.989945617e-05f,
+  1.557395626e-05f, 3.698888395e-05f, 3.625666432e-05f, 5.767159018e-05f,
+  9.827946997e-06f, 3.124287105e-05f, 3.051065323e-05f, 5.192557728e-05f,
+  2.760008101e-05f, 4.901500506e-05f, 4.828278907e-05f, 6.969771493e-05f,
+  5.706259572e-07f, 2.198555194e-05f, 2.125333231e-05f, 4.266825636e-05f,
+  1.834276009e-05f, 3.975768414e-05f, 3.902546814e-05f, 6.044039037e-05f,
+  1.259674991e-05f, 3.401167487e-05f, 3.327945524e-05f, 5.469438111e-05f,
+  3.036888302e-05f, 5.178380889e-05f, 5.105158925e-05f, 7.246651512e-05f,
+  -2.035071157e-05f, 1.064214530e-06f, 3.319960342e-07f, 2.174692054e-05f,
+  -2.578576641e-06f, 1.883634832e-05f, 1.810413050e-05f, 3.951905455e-05f,
+  -8.324586815e-06f, 1.309033814e-05f, 1.235812033e-05f, 3.377304529e-05f,
+  9.447547200e-06f, 3.086247307e-05f, 3.013025344e-05f, 5.154517930e-05f,
+  -1.758190774e-05f, 3.833017217e-06f, 3.100798949e-06f, 2.451572436e-05f,
+  1.902261317e-07f, 2.160515214e-05f, 2.087293251e-05f, 4.228785838e-05f,
+  -5.555783900e-06f, 1.585914106e-05f, 1.512692324e-05f, 3.654184911e-05f,
+  1.221635011e-05f, 3.363127689e-05f, 3.289905726e-05f, 5.431398313e-05f,
+  -3.100131653e-05f, -9.586389751e-06f, -1.031860847e-05f, 1.109631739e-05f,
+  -1.322918069e-05f, 8.185744264e-06f, 7.453525996e-06f, 2.886845141e-05f,
+  -1.897518996e-05f, 2.439734317e-06f, 1.707515935e-06f, 2.312244033e-05f,
+  -1.203056854e-06f, 2.021186810e-05f, 1.947965029e-05f, 4.089457434e-05f,
+  -2.823251270e-05f, -6.817586836e-06f, -7.549805105e-06f, 1.386512031e-05f,
+  -1.046037778e-05f, 1.095454718e-05f, 1.022232846e-05f, 3.163725341e-05f,
+  -1.620638795e-05f, 5.208537459e-06f, 4.476318736e-06f, 2.589124415e-05f,
+  1.565746061e-06f, 2.298067193e-05f, 2.224845230e-05f, 4.366337816e-05f,
+  -4.366337816e-05f, -2.224845230e-05f, -2.298067193e-05f, -1.565746061e-06f,
+  -2.589124415e-05f, -4.476318736e-06f, -5.208537459e-06f, 1.620638795e-05f,
+  -3.163725341e-05f, -1.022232846e-05f, -1.095454718e-05f, 1.046037778e-05f,
+  -1.386512031e-05f, 7.549805105e-06f, 6.817586836e-06f, 2.823251270e-05f,
+  -4.089457434e-05f, -1.947965029e-05f, -2.021186810e-05f, 1.203056854e-06f,
+  -2.312244033e-05f, -1.707515935e-06f, -2.439734317e-06f, 1.897518996e-05f,
+  -2.886845141e-05f, -7.453525996e-06f, -8.185744264e-06f, 1.322918069e-05f,
+  -1.109631739e-05f, 1.031860847e-05f, 9.586389751e-06f, 3.100131653e-05f,
+  -5.431398313e-05f, -3.289905726e-05f, -3.363127689e-05f, -1.221635011e-05f,
+  -3.654184911e-05f, -1.512692324e-05f, -1.585914106e-05f, 5.555783900e-06f,
+  -4.228785838e-05f, -2.087293251e-05f, -2.160515214e-05f, -1.902261317e-07f,
+  -2.451572436e-05f, -3.100798949e-06f, -3.833017217e-06f, 1.758190774e-05f,
+  -5.154517930e-05f, -3.013025344e-05f, -3.086247307e-05f, -9.447547200e-06f,
+  -3.377304529e-05f, -1.235812033e-05f, -1.309033814e-05f, 8.324586815e-06f,
+  -3.951905455e-05f, -1.810413050e-05f, -1.883634832e-05f, 2.578576641e-06f,
+  -2.174692054e-05f, -3.319960342e-07f, -1.064214530e-06f, 2.035071157e-05f,
+  -7.246651512e-05f, -5.105158925e-05f, -5.178380889e-05f, -3.036888302e-05f,
+  -5.469438111e-05f, -3.327945524e-05f, -3.401167487e-05f, -1.259674991e-05f,
+  -6.044039037e-05f, -3.902546814e-05f, -3.975768414e-05f, -1.834276009e-05f,
+  -4.266825636e-05f, -2.125333231e-05f, -2.198555194e-05f, -5.706259572e-07f,
+  -6.969771493e-05f, -4.828278907e-05f, -4.901500506e-05f, -2.760008101e-05f,
+  -5.192557728e-05f, -3.051065323e-05f, -3.124287105e-05f, -9.827946997e-06f,
+  -5.767159018e-05f, -3.625666432e-05f, -3.698888395e-05f, -1.557395626e-05f,
+  -3.989945617e-05f, -1.848453030e-05f, -1.921674811e-05f, 2.198176844e-06f,
+  -8.311712008e-05f, -6.170219422e-05f, -6.243441021e-05f, -4.101948798e-05f,
+  -6.534498243e-05f, -4.393006020e-05f, -4.466227983e-05f, -2.324735397e-05f,
+  -7.109099533e-05f, -4.967606947e-05f, -5.040828910e-05f, -2.899336323e-05f,
+  -5.331886132e-05f, -3.190393545e-05f, -3.263615508e-05f, -1.122123012e-05f,
+  -8.034831990e-05f, -5.893339039e-05f, -5.966561002e-05f, -3.825068416e-05f,
+  -6.257618224e-05f, -4.116125638e-05f, -4.189347601e-05f, -2.047855196e-05f,
+  -6.832219515e-05f, -4.690726928e-05f, -4.763948527e-05f, -2.622456122e-05f,
+  -5.055005749e-05f, -2.913513345e-05f, -2.986735308e-05f, -8.452427210e-06f
+},
+{
+  8.882237016e-04f, 8.074241341e-04f, 7.734508254e-04f, 6.926511996e-04f,
+  7.346395869e-04f, 6.538400194e-04f, 6.198666524e-04f, 5.390670849e-04f,
+  6.918853032e-04f, 6.110856775e-04f, 5.771123688e-04f, 4.963127431e-04f,
+  5.383011885e-04f, 4.575015628e-04f, 4.235282540e-04f, 3.427286283e-04f,
+  6.465890328e-04f, 5.657894653e-04f, 5.318161566e-04f, 4.510165309e-04f,
+  4.930049181e-04f, 4.122053215e-04f, 3.782320127e-04f, 2.974323870e-04f,
+  4.502506345e-04f, 3.694510087e-04f, 3.354777000e-04f, 2.546780743e-04f,
+  2.966664906e-04f, 2.158668940e-04f, 1.818935707e-04f, 1.010939668e-04f,
+  6.007055636e-04f, 5.199059960e-04f, 4.859326582e-04f, 4.051330616e-04f,
+  4.471214779e-04f, 3.663218522e-04f, 3.323485435e-04f, 2.515489177e-04f,
+  4.043671652e-04f, 3.235675395e-04f, 2.895942307e-04f, 2.087946195e-04f,
+  2.507830213e-04f, 1.699834247e-04f, 1.360101014e-04f, 5.521049388e-05f,
+  3.590709239e-04f, 2.782712982e-04f, 2.442979894e-04f, 1.634983782e-04f,
+  2.054867946e-04f, 1.246871834e-04f, 9.071386739e-05f, 9.914255315e-06f,
+  1.627324818e-04f, 8.193287795e-05f, 4.795956193e-05f, -3.284005288e-05f,
+  9.148366189e-06f, -7.165124407e-05f, -1.056245601e-04f, -1.864241785e-04f,
+  5.567675107e-04f, 4.759678850e-04f, 4.419945762e-04f, 3.611949505e-04f,
+  4.031833669e-04f, 3.223837411e-04f, 2.884104324e-04f, 2.076108212e-04f,
+  3.604290541e-04f, 2.796294575e-04f, 2.456561197e-04f, 1.648565230e-04f,
+  2.068449394e-04f, 1.260453282e-04f, 9.207201219e-05f, 1.127239648e-05f,
+  3.151328128e-04f, 2.343332017e-04f, 2.003598929e-04f, 1.195602817e-04f,
+  1.615486981e-04f, 8.074908692e-05f, 4.677577090e-05f, -3.402384391e-05f,
+  1.187943926e-04f, 3.799477781e-05f, 4.021463155e-06f, -7.677815302e-05f,
+  -3.478973304e-05f, -1.155893478e-04f, -1.495626639e-04f, -2.303622750e-04f,
+  2.692493435e-04f, 1.884497324e-04f, 1.544764236e-04f, 7.367681246e-05f,
+  1.156652288e-04f, 3.486561400e-05f, 8.923011023e-07f, -7.990730955e-05f,
+  7.291092334e-05f, -7.888692380e-06f, -4.186200749e-05f, -1.226616150e-04f,
+  -8.067319868e-05f, -1.614728099e-04f, -1.954461331e-04f, -2.762457298e-04f,
+  2.761468204e-05f, -5.318493277e-05f, -8.715824515e-05f, -1.679578563e-04f,
+  -1.259694400e-04f, -2.067690511e-04f, -2.407423744e-04f, -3.215419711e-04f,
+  -1.687237527e-04f, -2.495233493e-04f, -2.834966872e-04f, -3.642962838e-04f,
+  -3.223078675e-04f, -4.031074932e-04f, -4.370808019e-04f, -5.178804277e-04f,
+  5.178804277e-04f, 4.370808019e-04f, 4.031074932e-04f, 3.223078675e-04f,
+  3.642962838e-04f, 2.834966872e-04f, 2.495233493e-04f, 1.687237527e-04f,
+  3.215419711e-04f, 2.407423744e-04f, 2.067690511e-04f, 1.259694400e-04f,
+  1.679578563e-04f, 8.715824515e-05f, 5.318493277e-05f, -2.761468204e-05f,
+  2.762457298e-04f, 1.954461331e-04f, 1.614728099e-04f, 8.067319868e-05f,
+  1.226616150e-04f, 4.186200749e-05f, 7.888692380e-06f, -7.291092334e-05f,
+  7.990730955e-05f, -8.923011023e-07f, -3.486561400e-05f, -1.156652288e-04f,
+  -7.367681246e-05f, -1.544764236e-04f, -1.884497324e-04f, -2.692493435e-04f,
+  2.303622750e-04f, 1.495626639e-04f, 1.155893478e-04f, 3.478973304e-05f,
+  7.677815302e-05f, -4.021463155e-06f, -3.799477781e-05f, -1.187943926e-04f,
+  3.402384391e-05f, -4.677577090e-05f, -8.074908692e-05f, -1.615486981e-04f,
+  -1.195602817e-04f, -2.003598929e-04f, -2.343332017e-04f, -3.151328128e-04f,
+  -1.127239648e-05f, -9.207201219e-05f, -1.260453282e-04f, -2.068449394e-04f,
+  -1.648565230e-04f, -2.456561197e-04f, -2.796294575e-04f, -3.604290541e-04f,
+  -2.076108212e-04f, -2.884104324e-04f, -3.223837411e-04f, -4.031833669e-04f,
+  -3.611949505e-04f, -4.419945762e-04f, -4.759678850e-04f, -5.567675107e-04f,
+  1.864241785e-04f, 1.056245601e-04f, 7.165124407e-05f, -9.148366189e-06f,
+  3.284005288e-05f, -4.795956193e-05f, -8.193287795e-05f, -1.627324818e-04f,
+  -9.914255315e-06f, -9.071386739e-05f, -1.246871834e-04f, -2.054867946e-04f,
+  -1.634983782e-04f, -2.442979894e-04f, -2.782712982e-04f, -3.590709239e-04f,
+  -5.521049388e-05f, -1.360101014e-04f, -1.699834247e-04f, -2.507830213e-04f,
+  -2.087946195e-04f, -2.895942307e-04f, -3.235675395e-04f, -4.043671652e-04f,
+  -2.515489177e-04f, -3.323485435e-04f, -3.663218522e-04f, -4.471214779e-04f,
+  -4.051330616e-04f, -4.859326582e-04f, -5.199059960e-04f, -6.007055636e-04f,
+  -1.010939668e-04f, -1.818935707e-04f, -2.158668940e-04f, -2.966664906e-04f,
+  -2.546780743e-04f, -3.354777000e-04f, -3.694510087e-04f, -4.502506345e-04f,
+  -2.974323870e-04f, -3.782320127e-04f, -4.122053215e-04f, -4.930049181e-04f,
+  -4.510165309e-04f, -5.318161566e-04f, -5.657894653e-04f, -6.465890328e-04f,
+  -3.427286283e-04f, -4.235282540e-04f, -4.575015628e-04f, -5.383011885e-04f,
+  -4.963127431e-04f, -5.771123688e-04f, -6.110856775e-04f, -6.918853032e-04f,
+  -5.390670849e-04f, -6.198666524e-04f, -6.538400194e-04f, -7.346395869e-04f,
+  -6.926511996e-04f, -7.734508254e-04f, -8.074241341e-04f, -8.882237016e-04f
+},
+{
+  1.209622365e-03f, 8.090815390e-04f, 7.916646427e-04f, 3.911238455e-04f,
+  7.914472953e-04f, 3.909064690e-04f, 3.734896018e-04f, -2.705120824e-05f,
+  8.130057831e-04f, 4.124649859e-04f, 3.950481187e-04f, -5.492685432e-06f,
+  3.948307422e-04f, -5.710058758e-06f, -2.312694050e-05f, -4.236677487e-04f,
+  8.608583012e-04f, 4.603175330e-04f, 4.429006367e-04f, 4.235983943e-05f,
+  4.426832602e-04f, 4.214246292e-05f, 2.472558299e-05f, -3.758152307e-04f,
+  4.642417771e-04f, 6.370098708e-05f, 4.628410534e-05f, -3.542566847e-04f,
+  4.606673247e-05f, -3.544740612e-04f, -3.718909575e-04f, -7.724317256e-04f,
+  9.392067441e-04f, 5.386659177e-04f, 5.212490214e-04f, 1.207082387e-04f,
+  5.210316740e-04f, 1.204908694e-04f, 1.030739877e-04f, -2.974668168e-04f,
+  5.425902200e-04f, 1.420493936e-04f, 1.246325119e-04f, -2.759083000e-04f,
+  1.244151354e-04f, -2.761256765e-04f, -2.935425437e-04f, -6.940833409e-04f,
+  5.904427380e-04f, 1.899019117e-04f, 1.724850299e-04f, -2.280557674e-04f,
+  1.722676534e-04f, -2.282731439e-04f, -2.456900256e-04f, -6.462308229e-04f,
+  1.938261848e-04f, -2.067146124e-04f, -2.241314942e-04f, -6.246722769e-04f,
+  -2.243488707e-04f, -6.248896825e-04f, -6.423065788e-04f, -1.042847405e-03f,
+  1.051642699e-03f, 6.511018728e-04f, 6.336850347e-04f, 2.331442229e-04f,
+  6.334676291e-04f, 2.329268464e-04f, 2.155099646e-04f, -1.850308472e-04f,
+  6.550261751e-04f, 2.544853778e-04f, 2.370684815e-04f, -1.634723158e-04f,
+  2.368511050e-04f, -1.636896923e-04f, -1.811065740e-04f, -5.816473858e-04f,
+  7.028786931e-04f, 3.023378958e-04f, 2.849209995e-04f, -1.156197904e-04f,
+  2.847036230e-04f, -1.158371670e-04f, -1.332540560e-04f, -5.337948678e-04f,
+  3.062621690e-04f, -9.427864279e-05f, -1.116955245e-04f, -5.122363218e-04f,
+  -1.119129010e-04f, -5.124537274e-04f, -5.298705655e-04f, -9.304113919e-04f,
+  7.812270778e-04f, 3.806862806e-04f, 3.632694134e-04f, -3.727139119e-05f,
+  3.630520368e-04f, -3.748876406e-05f, -5.490564581e-05f, -4.554464540e-04f,
+  3.846105537e-04f, -1.593023990e-05f, -3.334712164e-05f, -4.338879371e-04f,
+  -3.356449452e-05f, -4.341052845e-04f, -4.515221808e-04f, -8.520630072e-04f,
+  4.324630718e-04f, 3.192228178e-05f, 1.450540094e-05f, -3.860353900e-04f,
+  1.428802716e-05f, -3.862527665e-04f, -4.036696628e-04f, -8.042104309e-04f,
+  3.584655133e-05f, -3.646942496e-04f, -3.821111459e-04f, -7.826519432e-04f,
+  -3.823284933e-04f, -7.828692906e-04f, -8.002861869e-04f, -1.200826955e-03f,
+  1.200826955e-03f, 8.002861869e-04f, 7.828692906e-04f, 3.823284933e-04f,
+  7.826519432e-04f, 3.821111459e-04f, 3.646942496e-04f, -3.584655133e-05f,
+  8.042104309e-04f, 4.036696628e-04f, 3.862527665e-04f, -1.428802716e-05f,
+  3.860353900e-04f, -1.450540094e-05f, -3.192228178e-05f, -4.324630718e-04f,
+  8.520630072e-04f, 4.515221808e-04f, 4.341052845e-04f, 3.356449452e-05f,
+  4.338879371e-04f, 3.334712164e-05f, 1.593023990e-05f, -3.846105537e-04f,
+  4.554464540e-04f, 5.490564581e-05f, 3.748876406e-05f, -3.630520368e-04f,
+  3.727139119e-05f, -3.632694134e-04f, -3.806862806e-04f, -7.812270778e-04f,
+  9.304113919e-04f, 5.298705655e-04f, 5.124537274e-04f, 1.119129010e-04f,
+  5.122363218e-04f, 1.116955245e-04f, 9.427864279e-05f, -3.062621690e-04f,
+  5.337948678e-04f, 1.332540560e-04f, 1.158371670e-04f, -2.847036230e-04f,
+  1.156197904e-04f, -2.849209995e-04f, -3.023378958e-04f, -7.028786931e-04f,
+  5.816473858e-04f, 1.811065740e-04f, 1.636896923e-04f, -2.368511050e-04f,
+  1.634723158e-04f, -2.370684815e-04f, -2.544853778e-04f, -6.550261751e-04f,
+  1.850308472e-04f, -2.155099646e-04f, -2.329268464e-04f, -6.334676291e-04f,
+  -2.331442229e-04f, -6.336850347e-04f, -6.511018728e-04f, -1.051642699e-03f,
+  1.042847405e-03f, 6.423065788e-04f, 6.248896825e-04f, 2.243488707e-04f,
+  6.246722769e-04f, 2.241314942e-04f, 2.067146124e-04f, -1.938261848e-04f,
+  6.462308229e-04f, 2.456900256e-04f, 2.282731439e-04f, -1.722676534e-04f,
+  2.280557674e-04f, -1.724850299e-04f, -1.899019117e-04f, -5.904427380e-04f,
+  6.940833409e-04f, 2.935425437e-04f, 2.761256765e-04f, -1.244151354e-04f,
+  2.759083000e-04f, -1.246325119e-04f, -1.420493936e-04f, -5.425902200e-04f,
+  2.974668168e-04f, -1.030739877e-04f, -1.204908694e-04f, -5.210316740e-04f,
+  -1.207082387e-04f, -5.212490214e-04f, -5.386659177e-04f, -9.392067441e-04f,
+  7.724317256e-04f, 3.718909575e-04f, 3.544740612e-04f, -4.606673247e-05f,
+  3.542566847e-04f, -4.628410534e-05f, -6.370098708e-05f, -4.642417771e-04f,
+  3.758152307e-04f, -2.472558299e-05f, -4.214246292e-05f, -4.426832602e-04f,
+  -4.235983943e-05f, -4.429006367e-04f, -4.603175330e-04f, -8.608583012e-04f,
+  4.236677487e-04f, 2.312694050e-05f, 5.710058758e-06f, -3.948307422e-04f,
+  5.492685432e-06f, -3.950481187e-04f, -4.124649859e-04f, -8.130057831e-04f,
+  2.705120824e-05f, -3.734896018e-04f, -3.909064690e-04f, -7.914472953e-04f,
+  -3.911238455e-04f, -7.916646427e-04f, -8.090815390e-04f, -1.209622365e-03f
+},
+{
+  -4.650365096e-03f, -4.471833352e-03f, -4.246569704e-03f, -4.068037961e-03f,
+  -3.985491581e-03f, -3.806960071e-03f, -3.581695957e-03f, -3.403164214e-03f,
+  -3.692917759e-03f, -3.514386015e-03f, -3.289122134e-03f, -3.110590391e-03f,
+  -3.028044244e-03f, -2.849512501e-03f, -2.624248620e-03f, -2.445716644e-03f,
+  -3.375579137e-03f, -3.197047394e-03f, -2.971783513e-03f, -2.793251770e-03f,
+  -2.710705623e-03f, -2.532173879e-03f, -2.306909999e-03f, -2.128378255e-03f,
+  -2.418131800e-03f, -2.239599824e-03f, -2.014335943e-03f, -1.835804200e-03f,
+  -1.753258286e-03f, -1.574726426e-03f, -1.349462545e-03f, -1.170930685e-03f,
+  -3.042760538e-03f, -2.864228794e-03f, -2.638964681e-03f, -2.460432937e-03f,
+  -2.377887024e-03f, -2.199355280e-03f, -1.974091167e-03f, -1.795559423e-03f,
+  -2.085312968e-03f, -1.906781225e-03f, -1.681517344e-03f, -1.502985484e-03f,
+  -1.420439570e-03f, -1.241907710e-03f, -1.016643830e-03f, -8.381119696e-04f,
+  -1.767974463e-03f, -1.589442603e-03f, -1.364178723e-03f, -1.185646863e-03f,
+  -1.103100949e-03f, -9.245690890e-04f, -6.993052084e-04f, -5.207733484e-04f,
+  -8.105269517e-04f, -6.319951499e-04f, -4.067312402e-04f, -2.281994093e-04f,
+  -1.456534665e-04f, 3.287836080e-05f, 2.581422741e-04f, 4.366741050e-04f,
+  -2.706338186e-03f, -2.527806442e-03f, -2.302542562e-03f, -2.124010585e-03f,
+  -2.041464671e-03f, -1.862932928e-03f, -1.637668931e-03f, -1.459137187e-03f,
+  -1.748890732e-03f, -1.570358989e-03f, -1.345094992e-03f, -1.166563248e-03f,
+  -1.084017218e-03f, -9.054854163e-04f, -6.802215357e-04f, -5.016896757e-04f,
+  -1.431552111e-03f, -1.253020368e-03f, -1.027756371e-03f, -8.492245688e-04f,
+  -7.666786551e-04f, -5.881467951e-04f, -3.628829145e-04f, -1.843510836e-04f,
+  -4.741046869e-04f, -2.955728560e-04f, -7.030894631e-05f, 1.082228846e-04f,
+  1.907688275e-04f, 3.693006583e-04f, 5.945645971e-04f, 7.730963989e-04f,
+  -1.098733512e-03f, -9.202016518e-04f, -6.949377130e-04f, -5.164059112e-04f,
+  -4.338599392e-04f, -2.553281374e-04f, -3.006420775e-05f, 1.484676177e-04f,
+  -1.412859856e-04f, 3.724583439e-05f, 2.625097404e-04f, 4.410415713e-04f,
+  5.235875142e-04f, 7.021193742e-04f, 9.273832547e-04f, 1.105915057e-03f,
+  1.760526211e-04f, 3.545844520e-04f, 5.798483617e-04f, 7.583801635e-04f,
+  8.409261354e-04f, 1.019457937e-03f, 1.244721818e-03f, 1.423253678e-03f,
+  1.133500133e-03f, 1.312031876e-03f, 1.537295873e-03f, 1.715827617e-03f,
+  1.798373647e-03f, 1.976905391e-03f, 2.202169271e-03f, 2.380701248e-03f,
+  -2.380701248e-03f, -2.202169271e-03f, -1.976905391e-03f, -1.798373647e-03f,
+  -1.715827617e-03f, -1.537295873e-03f, -1.312031876e-03f, -1.133500133e-03f,
+  -1.423253678e-03f, -1.244721818e-03f, -1.019457937e-03f, -8.409261354e-04f,
+  -7.583801635e-04f, -5.798483617e-04f, -3.545844520e-04f, -1.760526211e-04f,
+  -1.105915057e-03f, -9.273832547e-04f, -7.021193742e-04f, -5.235875142e-04f,
+  -4.410415713e-04f, -2.625097404e-04f, -3.724583439e-05f, 1.412859856e-04f,
+  -1.484676177e-04f, 3.006420775e-05f, 2.553281374e-04f, 4.338599392e-04f,
+  5.164059112e-04f, 6.949377130e-04f, 9.202016518e-04f, 1.098733512e-03f,
+  -7.730963989e-04f, -5.945645971e-04f, -3.693006583e-04f, -1.907688275e-04f,
+  -1.082228846e-04f, 7.030894631e-05f, 2.955728560e-04f, 4.741046869e-04f,
+  1.843510836e-04f, 3.628829145e-04f, 5.881467951e-04f, 7.666786551e-04f,
+  8.492245688e-04f, 1.027756371e-03f, 1.253020368e-03f, 1.431552111e-03f,
+  5.016896757e-04f, 6.802215357e-04f, 9.054854163e-04f, 1.084017218e-03f,
+  1.166563248e-03f, 1.345094992e-03f, 1.570358989e-03f, 1.748890732e-03f,
+  1.459137187e-03f, 1.637668931e-03f, 1.862932928e-03f, 2.041464671e-03f,
+  2.124010585e-03f, 2.302542562e-03f, 2.527806442e-03f, 2.706338186e-03f,
+  -4.366741050e-04f, -2.581422741e-04f, -3.287836080e-05f, 1.456534665e-04f,
+  2.281994093e-04f, 4.067312402e-04f, 6.319951499e-04f, 8.105269517e-04f,
+  5.207733484e-04f, 6.993052084e-04f, 9.245690890e-04f, 1.103100949e-03f,
+  1.185646863e-03f, 1.364178723e-03f, 1.589442603e-03f, 1.767974463e-03f,
+  8.381119696e-04f, 1.016643830e-03f, 1.241907710e-03f, 1.420439570e-03f,
+  1.502985484e-03f, 1.681517344e-03f, 1.906781225e-03f, 2.085312968e-03f,
+  1.795559423e-03f, 1.974091167e-03f, 2.199355280e-03f, 2.377887024e-03f,
+  2.460432937e-03f, 2.638964681e-03f, 2.864228794e-03f, 3.042760538e-03f,
+  1.170930685e-03f, 1.349462545e-03f, 1.574726426e-03f, 1.753258286e-03f,
+  1.835804200e-03f, 2.014335943e-03f, 2.239599824e-03f, 2.418131800e-03f,
+  2.128378255e-03f, 2.306909999e-03f, 2.532173879e-03f, 2.710705623e-03f,
+  2.793251770e-03f, 2.971783513e-03f, 3.197047394e-03f, 3.375579137e-03f,
+  2.445716644e-03f, 2.624248620e-03f, 2.849512501e-03f, 3.028044244e-03f,
+  3.110590391e-03f, 3.289122134e-03f, 3.514386015e-03f, 3.692917759e-03f,
+  3.403164214e-03f, 3.581695957e-03f, 3.806960071e-03f, 3.985491581e-03f,
+  4.068037961e-03f, 4.246569704e-03f, 4.471833352e-03f, 4.650365096e-03f
+},
+{
+  -1.123181172e-02f, -8.663983084e-03f, -8.411921561e-03f, -5.844093859e-03f,
+  -8.226026781e-03f, -5.658198614e-03f, -5.406137556e-03f, -2.838309389e-03f,
+  -8.127139881e-03f, -5.559311714e-03f, -5.307250656e-03f, -2.739422489e-03f,
+  -5.121355411e-03f, -2.553527243e-03f, -2.301465953e-03f, 2.663621271e-04f,
+  -8.136085235e-03f, -5.568257533e-03f, -5.316196010e-03f, -2.748368075e-03f,
+  -5.130300764e-03f, -2.562472830e-03f, -2.310411539e-03f, 2.574165701e-04f,
+  -5.031413864e-03f, -2.463585930e-03f, -2.211524406e-03f, 3.563035280e-04f,
+  -2.025629394e-03f, 5.421987153e-04f, 7.942600059e-04f, 3.362087999e-03f,
+  -8.272750303e-03f, -5.704922136e-03f, -5.452860612e-03f, -2.885032445e-03f,
+  -5.266965367e-03f, -2.699137433e-03f, -2.447076142e-03f, 1.207519890e-04f,
+  -5.168078467e-03f, -2.600250533e-03f, -2.348189009e-03f, 2.196389687e-04f,
+  -2.162293997e-03f, 4.055341124e-04f, 6.575954612e-04f, 3.225423628e-03f,
+  -5.177023821e-03f, -2.609195886e-03f, -2.357134596e-03f, 2.106934116e-04f,
+  -2.171239583e-03f, 3.965885553e-04f, 6.486498751e-04f, 3.216478042e-03f,
+  -2.072352450e-03f, 4.954755423e-04f, 7.475368911e-04f, 3.315364942e-03f,
+  9.334320202e-04f, 3.501260187e-03f, 3.753321478e-03f, 6.321149413e-03f,
+  -8.555061184e-03f, -5.987233482e-03f, -5.735171959e-03f, -3.167344024e-03f,
+  -5.549276713e-03f, -2.981448779e-03f, -2.729387488e-03f, -1.615594811e-04f,
+  -5.450389814e-03f, -2.882561879e-03f, -2.630500589e-03f, -6.267250865e-05f,
+  -2.444605343e-03f, 1.232226496e-04f, 3.752839984e-04f, 2.943112049e-03f,
+  -5.459335633e-03f, -2.891507465e-03f, -2.639446175e-03f, -7.161807298e-05f,
+  -2.453550929e-03f, 1.142770852e-04f, 3.663384123e-04f, 2.934166463e-03f,
+  -2.354664030e-03f, 2.131640504e-04f, 4.652253992e-04f, 3.033053363e-03f,
+  6.511205574e-04f, 3.218948608e-03f, 3.471009899e-03f, 6.038838066e-03f,
+  -5.596000236e-03f, -3.028172068e-03f, -2.776110778e-03f, -2.082826395e-04f,
+  -2.590215532e-03f, -2.238748857e-05f, 2.296738530e-04f, 2.797501860e-03f,
+  -2.491328632e-03f, 7.649948384e-05f, 3.285608254e-04f, 2.896388993e-03f,
+  5.144559545e-04f, 3.082284005e-03f, 3.334345296e-03f, 5.902173463e-03f,
+  -2.500274219e-03f, 6.755392678e-05f, 3.196152684e-04f, 2.887443407e-03f,
+  5.055104266e-04f, 3.073338419e-03f, 3.325399710e-03f, 5.893227644e-03f,
+  6.043973844e-04f, 3.172225552e-03f, 3.424286842e-03f, 5.992115010e-03f,
+  3.610181855e-03f, 6.178009789e-03f, 6.430071313e-03f, 8.997899480e-03f,
+  -8.997899480e-03f, -6.430071313e-03f, -6.178009789e-03f, -3.610181855e-03f,
+  -5.992115010e-03f, -3.424286842e-03f, -3.172225552e-03f, -6.043973844e-04f,
+  -5.893227644e-03f, -3.325399710e-03f, -3.073338419e-03f, -5.055104266e-04f,
+  -2.887443407e-03f, -3.196152684e-04f, -6.755392678e-05f, 2.500274219e-03f,
+  -5.902173463e-03f, -3.334345296e-03f, -3.082284005e-03f, -5.144559545e-04f,
+  -2.896388993e-03f, -3.285608254e-04f, -7.649948384e-05f, 2.491328632e-03f,
+  -2.797501860e-03f, -2.296738530e-04f, 2.238748857e-05f, 2.590215532e-03f,
+  2.082826395e-04f, 2.776110778e-03f, 3.028172068e-03f, 5.596000236e-03f,
+  -6.038838066e-03f, -3.471009899e-03f, -3.218948608e-03f, -6.511205574e-04f,
+  -3.033053363e-03f, -4.652253992e-04f, -2.131640504e-04f, 2.354664030e-03f,
+  -2.934166463e-03f, -3.663384123e-04f, -1.142770852e-04f, 2.453550929e-03f,
+  7.161807298e-05f, 2.639446175e-03f, 2.891507465e-03f, 5.459335633e-03f,
+  -2.943112049e-03f, -3.752839984e-04f, -1.232226496e-04f, 2.444605343e-03f,
+  6.267250865e-05f, 2.630500589e-03f, 2.882561879e-03f, 5.450389814e-03f,
+  1.615594811e-04f, 2.729387488e-03f, 2.981448779e-03f, 5.549276713e-03f,
+  3.167344024e-03f, 5.735171959e-03f, 5.987233482e-03f, 8.555061184e-03f,
+  -6.321149413e-03f, -3.753321478e-03f, -3.501260187e-03f, -9.334320202e-04f,
+  -3.315364942e-03f, -7.475368911e-04f, -4.954755423e-04f, 2.072352450e-03f,
+  -3.216478042e-03f, -6.486498751e-04f, -3.965885553e-04f, 2.171239583e-03f,
+  -2.106934116e-04f, 2.357134596e-03f, 2.609195886e-03f, 5.177023821e-03f,
+  -3.225423628e-03f, -6.575954612e-04f, -4.055341124e-04f, 2.162293997e-03f,
+  -2.196389687e-04f, 2.348189009e-03f, 2.600250533e-03f, 5.168078467e-03f,
+  -1.207519890e-04f, 2.447076142e-03f, 2.699137433e-03f, 5.266965367e-03f,
+  2.885032445e-03f, 5.452860612e-03f, 5.704922136e-03f, 8.272750303e-03f,
+  -3.362087999e-03f, -7.942600059e-04f, -5.421987153e-04f, 2.025629394e-03f,
+  -3.563035280e-04f, 2.211524406e-03f, 2.463585930e-03f, 5.031413864e-03f,
+  -2.574165701e-04f, 2.310411539e-03f, 2.562472830e-03f, 5.130300764e-03f,
+  2.748368075e-03f, 5.316196010e-03f, 5.568257533e-03f, 8.136085235e-03f,
+  -2.663621271e-04f, 2.301465953e-03f, 2.553527243e-03f, 5.121355411e-03f,
+  2.739422489e-03f, 5.307250656e-03f, 5.559311714e-03f, 8.127139881e-03f,
+  2.838309389e-03f, 5.406137556e-03f, 5.658198614e-03f, 8.226026781e-03f,
+  5.844093859e-03f, 8.411921561e-03f, 8.663983084e-03f, 1.123181172e-02f
+},
+{
+  8.997079916e-03f, 1.061691716e-02f, 9.826170281e-03f, 1.144600753e-02f,
+  8.859639987e-03f, 1.047947630e-02f, 9.688730352e-03f, 1.130856760e-02f,
+  7.725463249e-03f, 9.345300496e-03f, 8.554553613e-03f, 1.017439086e-02f,
+  7.588022854e-03f, 9.207860567e-03f, 8.417113684e-03f, 1.003695093e-02f,
+  6.439798512e-03f, 8.059635758e-03f, 7.268889342e-03f, 8.888726123e-03f,
+  6.302358583e-03f, 7.922195829e-03f, 7.131448947e-03f, 8.751286194e-03f,
+  5.168181844e-03f, 6.788019091e-03f, 5.997272674e-03f, 7.617109921e-03f,
+  5.030741915e-03f, 6.650578696e-03f, 5.859832745e-03f, 7.479669526e-03f,
+  5.027369596e-03f, 6.647206843e-03f, 5.856460426e-03f, 7.476297673e-03f,
+  4.889929667e-03f, 6.509766914e-03f, 5.719020497e-03f, 7.338857744e-03f,
+  3.755753161e-03f, 5.375590175e-03f, 4.584844224e-03f, 6.204681005e-03f,
+  3.618313000e-03f, 5.238150246e-03f, 4.447403830e-03f, 6.067241076e-03f,
+  2.470088657e-03f, 4.089925904e-03f, 3.299179487e-03f, 4.919016734e-03f,
+  2.332648495e-03f, 3.952485509e-03f, 3.161739325e-03f, 4.781576339e-03f,
+  1.198471989e-03f, 2.818309236e-03f, 2.027562819e-03f, 3.647400066e-03f,
+  1.061031944e-03f, 2.680869075e-03f, 1.890122658e-03f, 3.509959904e-03f,
+  3.521754406e-03f, 5.141591653e-03f, 4.350845236e-03f, 5.970682483e-03f,
+  3.384314245e-03f, 5.004151259e-03f, 4.213404842e-03f, 5.833242089e-03f,
+  2.250137739e-03f, 3.869974986e-03f, 3.079228569e-03f, 4.699065816e-03f,
+  2.112697577e-03f, 3.732534824e-03f, 2.941788407e-03f, 4.561625421e-03f,
+  9.644731181e-04f, 2.584310248e-03f, 1.793563948e-03f, 3.413401078e-03f,
+  8.270330145e-04f, 2.446870087e-03f, 1.656123786e-03f, 3.275960917e-03f,
+  -3.071434039e-04f, 1.312693697e-03f, 5.219473969e-04f, 2.141784411e-03f,
+  -4.445835657e-04f, 1.175253536e-03f, 3.845072642e-04f, 2.004344249e-03f,
+  -4.479555646e-04f, 1.171881566e-03f, 3.811352362e-04f, 2.000972396e-03f,
+  -5.853957264e-04f, 1.034441404e-03f, 2.436951036e-04f, 1.863532234e-03f,
+  -1.719572116e-03f, -9.973500710e-05f, -8.904812858e-04f, 7.293557865e-04f,
+  -1.857012277e-03f, -2.371751616e-04f, -1.027921448e-03f, 5.919156829e-04f,
+  -3.005236853e-03f, -1.385399606e-03f, -2.176146023e-03f, -5.563088343e-04f,
+  -3.142677015e-03f, -1.522839768e-03f, -2.313586185e-03f, -6.937489961e-04f,
+  -4.276853520e-03f, -2.657016274e-03f, -3.447762458e-03f, -1.827925444e-03f,
+  -4.414293449e-03f, -2.794456435e-03f, -3.585202619e-03f, -1.965365605e-03f,
+  1.965365605e-03f, 3.585202619e-03f, 2.794456435e-03f, 4.414293449e-03f,
+  1.827925444e-03f, 3.447762458e-03f, 2.657016274e-03f, 4.276853520e-03f,
+  6.937489961e-04f, 2.313586185e-03f, 1.522839768e-03f, 3.142677015e-03f,
+  5.563088343e-04f, 2.176146023e-03f, 1.385399606e-03f, 3.005236853e-03f,
+  -5.919156829e-04f, 1.027921448e-03f, 2.371751616e-04f, 1.857012277e-03f,
+  -7.293557865e-04f, 8.904812858e-04f, 9.973500710e-05f, 1.719572116e-03f,
+  -1.863532234e-03f, -2.436951036e-04f, -1.034441404e-03f, 5.853957264e-04f,
+  -2.000972396e-03f, -3.811352362e-04f, -1.171881566e-03f, 4.479555646e-04f,
+  -2.004344249e-03f, -3.845072642e-04f, -1.175253536e-03f, 4.445835657e-04f,
+  -2.141784411e-03f, -5.219473969e-04f, -1.312693697e-03f, 3.071434039e-04f,
+  -3.275960917e-03f, -1.656123786e-03f, -2.446870087e-03f, -8.270330145e-04f,
+  -3.413401078e-03f, -1.793563948e-03f, -2.584310248e-03f, -9.644731181e-04f,
+  -4.561625421e-03f, -2.941788407e-03f, -3.732534824e-03f, -2.112697577e-03f,
+  -4.699065816e-03f, -3.079228569e-03f, -3.869974986e-03f, -2.250137739e-03f,
+  -5.833242089e-03f, -4.213404842e-03f, -5.004151259e-03f, -3.384314245e-03f,
+  -5.970682483e-03f, -4.350845236e-03f, -5.141591653e-03f, -3.521754406e-03f,
+  -3.509959904e-03f, -1.890122658e-03f, -2.680869075e-03f, -1.061031944e-03f,
+  -3.647400066e-03f, -2.027562819e-03f, -2.818309236e-03f, -1.198471989e-03f,
+  -4.781576339e-03f, -3.161739325e-03f, -3.952485509e-03f, -2.332648495e-03f,
+  -4.919016734e-03f, -3.299179487e-03f, -4.089925904e-03f, -2.470088657e-03f,
+  -6.067241076e-03f, -4.447403830e-03f, -5.238150246e-03f, -3.618313000e-03f,
+  -6.204681005e-03f, -4.584844224e-03f, -5.375590175e-03f, -3.755753161e-03f,
+  -7.338857744e-03f, -5.719020497e-03f, -6.509766914e-03f, -4.889929667e-03f,
+  -7.476297673e-03f, -5.856460426e-03f, -6.647206843e-03f, -5.027369596e-03f,
+  -7.479669526e-03f, -5.859832745e-03f, -6.650578696e-03f, -5.030741915e-03f,
+  -7.617109921e-03f, -5.997272674e-03f, -6.788019091e-03f, -5.168181844e-03f,
+  -8.751286194e-03f, -7.131448947e-03f, -7.922195829e-03f, -6.302358583e-03f,
+  -8.888726123e-03f, -7.268889342e-03f, -8.059635758e-03f, -6.439798512e-03f,
+  -1.003695093e-02f, -8.417113684e-03f, -9.207860567e-03f, -7.588022854e-03f,
+  -1.017439086e-02f, -8.554553613e-03f, -9.345300496e-03f, -7.725463249e-03f,
+  -1.130856760e-02f, -9.688730352e-03f, -1.047947630e-02f, -8.859639987e-03f,
+  -1.144600753e-02f, -9.826170281e-03f, -1.061691716e-02f, -8.997079916e-03f
+},
+{
+  4.929623380e-02f, 4.070825502e-02f, 3.921079263e-02f, 3.062281385e-02f,
+  3.783752024e-02f, 2.924954332e-02f, 2.775208093e-02f, 1.916410215e-02f,
+  3.665911406e-02f, 2.807113715e-02f, 2.657367475e-02f, 1.798569597e-02f,
+  2.520040236e-02f, 1.661242545e-02f, 1.511496305e-02f, 6.526984740e-03f,
+  3.574978188e-02f, 2.716180310e-02f, 2.566434070e-02f, 1.707636379e-02f,
+  2.429107018e-02f, 1.570309140e-02f, 1.420562994e-02f, 5.617651623e-03f,
+  2.311266400e-02f, 1.452468615e-02f, 1.302722376e-02f, 4.439245909e-03f,
+  1.165395230e-02f, 3.065973753e-03f, 1.568511943e-03f, -7.019466255e-03f,
+  3.518520668e-02f, 2.659722790e-02f, 2.509976551e-02f, 1.651178673e-02f,
+  2.372649312e-02f, 1.513851527e-02f, 1.364105381e-02f, 5.053075496e-03f,
+  2.254808694e-02f, 1.396010909e-02f, 1.246264763e-02f, 3.874669317e-03f,
+  1.108937524e-02f, 2.501397626e-03f, 1.003935584e-03f, -7.584042381e-03f,
+  2.163875476e-02f, 1.305077597e-02f, 1.155331451e-02f, 2.965336433e-03f,
+  1.018004213e-02f, 1.592064509e-03f, 9.460251749e-05f, -8.493375964e-03f,
+  9.001636878e-03f, 4.136586504e-04f, -1.083803363e-03f, -9.671781212e-03f,
+  -2.457075054e-03f, -1.104505360e-02f, -1.254251506e-02f, -2.113049291e-02f,
+  3.504024819e-02f, 2.645227127e-02f, 2.495480888e-02f, 1.636683010e-02f,
+  2.358153649e-02f, 1.499355864e-02f, 1.349609718e-02f, 4.908118863e-03f,
+  2.240313031e-02f, 1.381515339e-02f, 1.231769100e-02f, 3.729713149e-03f,
+  1.094441954e-02f, 2.356441226e-03f, 8.589792415e-04f, -7.728999015e-03f,
+  2.149379812e-02f, 1.290582027e-02f, 1.140835788e-02f, 2.820380032e-03f,
+  1.003508642e-02f, 1.447108109e-03f, -5.035385766e-05f, -8.638331667e-03f,
+  8.856680244e-03f, 2.687022497e-04f, -1.228759647e-03f, -9.816737846e-03f,
+  -2.602031454e-03f, -1.119000930e-02f, -1.268747170e-02f, -2.127544954e-02f,
+  2.092922106e-02f, 1.234124415e-02f, 1.084378175e-02f, 2.255803673e-03f,
+  9.470510297e-03f, 8.825318073e-04f, -6.149301189e-04f, -9.202907793e-03f,
+  8.292104118e-03f, -2.958740224e-04f, -1.793336007e-03f, -1.038131397e-02f,
+  -3.166607814e-03f, -1.175458636e-02f, -1.325204782e-02f, -2.184002660e-02f,
+  7.382771000e-03f, -1.205207082e-03f, -2.702669008e-03f, -1.129064709e-02f,
+  -4.075940698e-03f, -1.266391948e-02f, -1.416138094e-02f, -2.274935879e-02f,
+  -5.254346877e-03f, -1.384232473e-02f, -1.533978712e-02f, -2.392776497e-02f,
+  -1.671305858e-02f, -2.530103736e-02f, -2.679849789e-02f, -3.538647667e-02f,
+  3.538647667e-02f, 2.679849789e-02f, 2.530103736e-02f, 1.671305858e-02f,
+  2.392776497e-02f, 1.533978712e-02f, 1.384232473e-02f, 5.254346877e-03f,
+  2.274935879e-02f, 1.416138094e-02f, 1.266391948e-02f, 4.075940698e-03f,
+  1.129064709e-02f, 2.702669008e-03f, 1.205207082e-03f, -7.382771000e-03f,
+  2.184002660e-02f, 1.325204782e-02f, 1.175458636e-02f, 3.166607814e-03f,
+  1.038131397e-02f, 1.793336007e-03f, 2.958740224e-04f, -8.292104118e-03f,
+  9.202907793e-03f, 6.149301189e-04f, -8.825318073e-04f, -9.470510297e-03f,
+  -2.255803673e-03f, -1.084378175e-02f, -1.234124415e-02f, -2.092922106e-02f,
+  2.127544954e-02f, 1.268747170e-02f, 1.119000930e-02f, 2.602031454e-03f,
+  9.816737846e-03f, 1.228759647e-03f, -2.687022497e-04f, -8.856680244e-03f,
+  8.638331667e-03f, 5.035385766e-05f, -1.447108109e-03f, -1.003508642e-02f,
+  -2.820380032e-03f, -1.140835788e-02f, -1.290582027e-02f, -2.149379812e-02f,
+  7.728999015e-03f, -8.589792415e-04f, -2.356441226e-03f, -1.094441954e-02f,
+  -3.729713149e-03f, -1.231769100e-02f, -1.381515339e-02f, -2.240313031e-02f,
+  -4.908118863e-03f, -1.349609718e-02f, -1.499355864e-02f, -2.358153649e-02f,
+  -1.636683010e-02f, -2.495480888e-02f, -2.645227127e-02f, -3.504024819e-02f,
+  2.113049291e-02f, 1.254251506e-02f, 1.104505360e-02f, 2.457075054e-03f,
+  9.671781212e-03f, 1.083803363e-03f, -4.136586504e-04f, -9.001636878e-03f,
+  8.493375964e-03f, -9.460251749e-05f, -1.592064509e-03f, -1.018004213e-02f,
+  -2.965336433e-03f, -1.155331451e-02f, -1.305077597e-02f, -2.163875476e-02f,
+  7.584042381e-03f, -1.003935584e-03f, -2.501397626e-03f, -1.108937524e-02f,
+  -3.874669317e-03f, -1.246264763e-02f, -1.396010909e-02f, -2.254808694e-02f,
+  -5.053075496e-03f, -1.364105381e-02f, -1.513851527e-02f, -2.372649312e-02f,
+  -1.651178673e-02f, -2.509976551e-02f, -2.659722790e-02f, -3.518520668e-02f,
+  7.019466255e-03f, -1.568511943e-03f, -3.065973753e-03f, -1.165395230e-02f,
+  -4.439245909e-03f, -1.302722376e-02f, -1.452468615e-02f, -2.311266400e-02f,
+  -5.617651623e-03f, -1.420562994e-02f, -1.570309140e-02f, -2.429107018e-02f,
+  -1.707636379e-02f, -2.566434070e-02f, -2.716180310e-02f, -3.574978188e-02f,
+  -6.526984740e-03f, -1.511496305e-02f, -1.661242545e-02f, -2.520040236e-02f,
+  -1.798569597e-02f, -2.657367475e-02f, -2.807113715e-02f, -3.665911406e-02f,
+  -1.916410215e-02f, -2.775208093e-02f, -2.924954332e-02f, -3.783752024e-02f,
+  -3.062281385e-02f, -3.921079263e-02f, -4.070825502e-02f, -4.929623380e-02f
+},
+{
+  1.159953047e-02f, -1.407126896e-03f, 1.100548034e-04f, -1.289660297e-02f,
+  2.287544077e-03f, -1.071911305e-02f, -9.201931767e-03f, -2.220858820e-02f,
+  5.158234853e-03f, -7.848422974e-03f, -6.331240758e-03f, -1.933789812e-02f,
+  -4.153751768e-03f, -1.716040820e-02f, -1.564322785e-02f, -2.864988521e-02f,
+  8.739619516e-03f, -4.267037846e-03f, -2.749856096e-03f, -1.575651392e-02f,
+  -5.723667564e-04f, -1.357902400e-02f, -1.206184272e-02f, -2.506849915e-02f,
+  2.298323903e-03f, -1.070833392e-02f, -9.191151708e-03f, -2.219780907e-02f,
+  -7.013662718e-03f, -2.002031915e-02f, -1.850313880e-02f, -3.150979429e-02f,
+  1.303208154e-02f, 2.542419861e-05f, 1.542605925e-03f, -1.146405190e-02f,
+  3.720095148e-03f, -9.286561981e-03f, -7.769380696e-03f, -2.077603713e-02f,
+  6.590785924e-03f, -6.415871438e-03f, -4.898689687e-03f, -1.790534705e-02f,
+  -2.721200464e-03f, -1.572785713e-02f, -1.421067584e-02f, -2.721733414e-02f,
+  1.017217059e-02f, -2.834486775e-03f, -1.317305025e-03f, -1.432396285e-02f,
+  8.601843147e-04f, -1.214647293e-02f, -1.062929165e-02f, -2.363594808e-02f,
+  3.730874974e-03f, -9.275782853e-03f, -7.758600637e-03f, -2.076525800e-02f,
+  -5.581111647e-03f, -1.858776808e-02f, -1.707058772e-02f, -3.007724509e-02f,
+  1.801762916e-02f, 5.010971799e-03f, 6.528153550e-03f, -6.478503812e-03f,
+  8.705643006e-03f, -4.301014822e-03f, -2.783833072e-03f, -1.579049043e-02f,
+  1.157633308e-02f, -1.430324046e-03f, 8.685766807e-05f, -1.291979942e-02f,
+  2.264346927e-03f, -1.074231043e-02f, -9.225129150e-03f, -2.223178558e-02f,
+  1.515771821e-02f, 2.151060849e-03f, 3.668242600e-03f, -9.338415228e-03f,
+  5.845732056e-03f, -7.160925772e-03f, -5.643744022e-03f, -1.865040138e-02f,
+  8.716422133e-03f, -4.290234763e-03f, -2.773053246e-03f, -1.577971131e-02f,
+  -5.955639062e-04f, -1.360222138e-02f, -1.208504010e-02f, -2.509169653e-02f,
+  1.945018023e-02f, 6.443522871e-03f, 7.960704155e-03f, -5.045952741e-03f,
+  1.013819408e-02f, -2.868463518e-03f, -1.351281884e-03f, -1.435793936e-02f,
+  1.300888415e-02f, 2.227057848e-06f, 1.519408775e-03f, -1.148724835e-02f,
+  3.696897998e-03f, -9.309759364e-03f, -7.792577613e-03f, -2.079923451e-02f,
+  1.659026928e-02f, 3.583611920e-03f, 5.100793671e-03f, -7.905864157e-03f,
+  7.278283127e-03f, -5.728374701e-03f, -4.211192951e-03f, -1.721785031e-02f,
+  1.014897320e-02f, -2.857683925e-03f, -1.340502175e-03f, -1.434715930e-02f,
+  8.369871648e-04f, -1.216967031e-02f, -1.065248810e-02f, -2.365914546e-02f,
+  2.365914546e-02f, 1.065248810e-02f, 1.216967031e-02f, -8.369871648e-04f,
+  1.434715930e-02f, 1.340502175e-03f, 2.857683925e-03f, -1.014897320e-02f,
+  1.721785031e-02f, 4.211192951e-03f, 5.728374701e-03f, -7.278283127e-03f,
+  7.905864157e-03f, -5.100793671e-03f, -3.583611920e-03f, -1.659026928e-02f,
+  2.079923451e-02f, 7.792577613e-03f, 9.309759364e-03f, -3.696897998e-03f,
+  1.148724835e-02f, -1.519408775e-03f, -2.227057848e-06f, -1.300888415e-02f,
+  1.435793936e-02f, 1.351281884e-03f, 2.868463518e-03f, -1.013819408e-02f,
+  5.045952741e-03f, -7.960704155e-03f, -6.443522871e-03f, -1.945018023e-02f,
+  2.509169653e-02f, 1.208504010e-02f, 1.360222138e-02f, 5.955639062e-04f,
+  1.577971131e-02f, 2.773053246e-03f, 4.290234763e-03f, -8.716422133e-03f,
+  1.865040138e-02f, 5.643744022e-03f, 7.160925772e-03f, -5.845732056e-03f,
+  9.338415228e-03f, -3.668242600e-03f, -2.151060849e-03f, -1.515771821e-02f,
+  2.223178558e-02f, 9.225129150e-03f, 1.074231043e-02f, -2.264346927e-03f,
+  1.291979942e-02f, -8.685766807e-05f, 1.430324046e-03f, -1.157633308e-02f,
+  1.579049043e-02f, 2.783833072e-03f, 4.301014822e-03f, -8.705643006e-03f,
+  6.478503812e-03f, -6.528153550e-03f, -5.010971799e-03f, -1.801762916e-02f,
+  3.007724509e-02f, 1.707058772e-02f, 1.858776808e-02f, 5.581111647e-03f,
+  2.076525800e-02f, 7.758600637e-03f, 9.275782853e-03f, -3.730874974e-03f,
+  2.363594808e-02f, 1.062929165e-02f, 1.214647293e-02f, -8.601843147e-04f,
+  1.432396285e-02f, 1.317305025e-03f, 2.834486775e-03f, -1.017217059e-02f,
+  2.721733414e-02f, 1.421067584e-02f, 1.572785713e-02f, 2.721200464e-03f,
+  1.790534705e-02f, 4.898689687e-03f, 6.415871438e-03f, -6.590785924e-03f,
+  2.077603713e-02f, 7.769380696e-03f, 9.286561981e-03f, -3.720095148e-03f,
+  1.146405190e-02f, -1.542605925e-03f, -2.542419861e-05f, -1.303208154e-02f,
+  3.150979429e-02f, 1.850313880e-02f, 2.002031915e-02f, 7.013662718e-03f,
+  2.219780907e-02f, 9.191151708e-03f, 1.070833392e-02f, -2.298323903e-03f,
+  2.506849915e-02f, 1.206184272e-02f, 1.357902400e-02f, 5.723667564e-04f,
+  1.575651392e-02f, 2.749856096e-03f, 4.267037846e-03f, -8.739619516e-03f,
+  2.864988521e-02f, 1.564322785e-02f, 1.716040820e-02f, 4.153751768e-03f,
+  1.933789812e-02f, 6.331240758e-03f, 7.848422974e-03f, -5.158234853e-03f,
+  2.220858820e-02f, 9.201931767e-03f, 1.071911305e-02f, -2.287544077e-03f,
+  1.289660297e-02f, -1.100548034e-04f, 1.407126896e-03f, -1.159953047e-02f
+},
+{
+  -1.758109927e-01f, -1.575103104e-01f, -1.507450044e-01f, -1.324443221e-01f,
+  -1.435486078e-01f, -1.252479255e-01f, -1.184826195e-01f, -1.001819372e-01f,
+  -1.360304356e-01f, -1.177297533e-01f, -1.109644473e-01f, -9.266376495e-02f,
+  -1.037680432e-01f, -8.546736836e-02f, -7.870206237e-02f, -6.040138006e-02f,
+  -1.283137798e-01f, -1.100130975e-01f, -1.032477915e-01f, -8.494711667e-02f,
+  -9.605139494e-02f, -7.775071263e-02f, -7.098540664e-02f, -5.268472806e-02f,
+  -8.853322268e-02f, -7.023254782e-02f, -6.346724182e-02f, -4.516655952e-02f,
+  -5.627083778e-02f, -3.797015548e-02f, -3.120485134e-02f, -1.290417090e-02f,
+  -1.205331087e-01f, -1.022324339e-01f, -9.546712786e-02f, -7.716644555e-02f,
+  -8.827072382e-02f, -6.997004151e-02f, -6.320473552e-02f, -4.490405694e-02f,
+  -8.075255156e-02f, -6.245187297e-02f, -5.568656698e-02f, -3.738588840e-02f,
+  -4.849016666e-02f, -3.018948622e-02f, -2.342418022e-02f, -5.123501178e-03f,
+  -7.303590328e-02f, -5.473522097e-02f, -4.796991497e-02f, -2.966923639e-02f,
+  -4.077351466e-02f, -2.247283421e-02f, -1.570752822e-02f, 2.593151759e-03f,
+  -3.325534612e-02f, -1.495466568e-02f, -8.189359680e-03f, 1.011131983e-02f,
+  -9.929566877e-04f, 1.730772294e-02f, 2.407302894e-02f, 4.237370938e-02f,
+  -1.128308550e-01f, -9.453018010e-02f, -8.776487410e-02f, -6.946419179e-02f,
+  -8.056847006e-02f, -6.226778775e-02f, -5.550248176e-02f, -3.720180318e-02f,
+  -7.305029780e-02f, -5.474961922e-02f, -4.798431322e-02f, -2.968363464e-02f,
+  -4.078791291e-02f, -2.248723246e-02f, -1.572192647e-02f, 2.578752814e-03f,
+  -6.533364952e-02f, -4.703296721e-02f, -4.026766121e-02f, -2.196698263e-02f,
+  -3.307126090e-02f, -1.477057952e-02f, -8.005273528e-03f, 1.029540505e-02f,
+  -2.555309050e-02f, -7.252411451e-03f, -4.871056299e-04f, 1.781357452e-02f,
+  6.709297188e-03f, 2.500997670e-02f, 3.177528083e-02f, 5.007596314e-02f,
+  -5.755297840e-02f, -3.925229609e-02f, -3.248699009e-02f, -1.418631244e-02f,
+  -2.529058978e-02f, -6.989909336e-03f, -2.246035729e-04f, 1.807607524e-02f,
+  -1.777242124e-02f, 5.282587372e-04f, 7.293564733e-03f, 2.559424378e-02f,
+  1.448996738e-02f, 3.279064596e-02f, 3.955595195e-02f, 5.785663053e-02f,
+  -1.005576830e-02f, 8.244911209e-03f, 1.501021720e-02f, 3.331089765e-02f,
+  2.220661938e-02f, 4.050729796e-02f, 4.727260396e-02f, 6.557328254e-02f,
+  2.972478792e-02f, 4.802546650e-02f, 5.479077250e-02f, 7.309145480e-02f,
+  6.198717654e-02f, 8.028785884e-02f, 8.705316484e-02f, 1.053538397e-01f,
+  -1.053538397e-01f, -8.705316484e-02f, -8.028785884e-02f, -6.198717654e-02f,
+  -7.309145480e-02f, -5.479077250e-02f, -4.802546650e-02f, -2.972478792e-02f,
+  -6.557328254e-02f, -4.727260396e-02f, -4.050729796e-02f, -2.220661938e-02f,
+  -3.331089765e-02f, -1.501021720e-02f, -8.244911209e-03f, 1.005576830e-02f,
+  -5.785663053e-02f, -3.955595195e-02f, -3.279064596e-02f, -1.448996738e-02f,
+  -2.559424378e-02f, -7.293564733e-03f, -5.282587372e-04f, 1.777242124e-02f,
+  -1.807607524e-02f, 2.246035729e-04f, 6.989909336e-03f, 2.529058978e-02f,
+  1.418631244e-02f, 3.248699009e-02f, 3.925229609e-02f, 5.755297840e-02f,
+  -5.007596314e-02f, -3.177528083e-02f, -2.500997670e-02f, -6.709297188e-03f,
+  -1.781357452e-02f, 4.871056299e-04f, 7.252411451e-03f, 2.555309050e-02f,
+  -1.029540505e-02f, 8.005273528e-03f, 1.477057952e-02f, 3.307126090e-02f,
+  2.196698263e-02f, 4.026766121e-02f, 4.703296721e-02f, 6.533364952e-02f,
+  -2.578752814e-03f, 1.572192647e-02f, 2.248723246e-02f, 4.078791291e-02f,
+  2.968363464e-02f, 4.798431322e-02f, 5.474961922e-02f, 7.305029780e-02f,
+  3.720180318e-02f, 5.550248176e-02f, 6.226778775e-02f, 8.056847006e-02f,
+  6.946419179e-02f, 8.776487410e-02f, 9.453018010e-02f, 1.128308550e-01f,
+  -4.237370938e-02f, -2.407302894e-02f, -1.730772294e-02f, 9.929566877e-04f,
+  -1.011131983e-02f, 8.189359680e-03f, 1.495466568e-02f, 3.325534612e-02f,
+  -2.593151759e-03f, 1.570752822e-02f, 2.247283421e-02f, 4.077351466e-02f,
+  2.966923639e-02f, 4.796991497e-02f, 5.473522097e-02f, 7.303590328e-02f,
+  5.123501178e-03f, 2.342418022e-02f, 3.018948622e-02f, 4.849016666e-02f,
+  3.738588840e-02f, 5.568656698e-02f, 6.245187297e-02f, 8.075255156e-02f,
+  4.490405694e-02f, 6.320473552e-02f, 6.997004151e-02f, 8.827072382e-02f,
+  7.716644555e-02f, 9.546712786e-02f, 1.022324339e-01f, 1.205331087e-01f,
+  1.290417090e-02f, 3.120485134e-02f, 3.797015548e-02f, 5.627083778e-02f,
+  4.516655952e-02f, 6.346724182e-02f, 7.023254782e-02f, 8.853322268e-02f,
+  5.268472806e-02f, 7.098540664e-02f, 7.775071263e-02f, 9.605139494e-02f,
+  8.494711667e-02f, 1.032477915e-01f, 1.100130975e-01f, 1.283137798e-01f,
+  6.040138006e-02f, 7.870206237e-02f, 8.546736836e-02f, 1.037680432e-01f,
+  9.266376495e-02f, 1.109644473e-01f, 1.177297533e-01f, 1.360304356e-01f,
+  1.001819372e-01f, 1.184826195e-01f, 1.252479255e-01f, 1.435486078e-01f,
+  1.324443221e-01f, 1.507450044e-01f, 1.575103104e-01f, 1.758109927e-01f
+},
+{
+  -3.802535236e-01f, -3.026919663e-01f, -2.961041629e-01f, -2.185426205e-01f,
+  -2.901695669e-01f, -2.126080096e-01f, -2.060202062e-01f, -1.284586489e-01f,
+  -2.850135267e-01f, -2.074519843e-01f, -2.008641809e-01f, -1.233026311e-01f,
+  -1.949295700e-01f, -1.173680201e-01f, -1.107802093e-01f, -3.321866319e-02f,
+  -2.807467282e-01f, -2.031851858e-01f, -1.965973675e-01f, -1.190358251e-01f,
+  -1.906627566e-01f, -1.131012142e-01f, -1.065134034e-01f, -2.895185724e-02f,
+  -1.855067313e-01f, -1.079451889e-01f, -1.013573855e-01f, -2.379583567e-02f,
+  -9.542276710e-02f, -1.786122099e-02f, -1.127341297e-02f, 6.628813595e-02f,
+  -2.774617970e-01f, -1.999002397e-01f, -1.933124363e-01f, -1.157508940e-01f,
+  -1.873778254e-01f, -1.098162755e-01f, -1.032284647e-01f, -2.566692047e-02f,
+  -1.822218001e-01f, -1.046602577e-01f, -9.807244688e-02f, -2.051090077e-02f,
+  -9.213782847e-02f, -1.457628515e-02f, -7.988477126e-03f, 6.957306713e-02f,
+  -1.779550016e-01f, -1.003934518e-01f, -9.380564094e-02f, -1.624409482e-02f,
+  -8.787102252e-02f, -1.030947920e-02f, -3.721671412e-03f, 7.383987308e-02f,
+  -8.271500468e-02f, -5.153458100e-03f, 1.434350037e-03f, 7.899589837e-02f,
+  7.368965074e-03f, 8.493050933e-02f, 9.151832014e-02f, 1.690798700e-01f,
+  -2.752307057e-01f, -1.976691633e-01f, -1.910813600e-01f, -1.135198101e-01f,
+  -1.851467341e-01f, -1.075851917e-01f, -1.009973809e-01f, -2.343583852e-02f,
+  -1.799907237e-01f, -1.024291739e-01f, -9.584136307e-02f, -1.827981696e-02f,
+  -8.990674466e-02f, -1.234520227e-02f, -5.757393781e-03f, 7.180415094e-02f,
+  -1.757239103e-01f, -9.816236794e-02f, -9.157455713e-02f, -1.401301101e-02f,
+  -8.563994616e-02f, -8.078396320e-03f, -1.490588300e-03f, 7.607095689e-02f,
+  -8.048392087e-02f, -2.922374988e-03f, 3.665433265e-03f, 8.122698218e-02f,
+  9.600047953e-03f, 8.716159314e-02f, 9.374940395e-02f, 1.713109463e-01f,
+  -1.724389791e-01f, -9.487742931e-02f, -8.828961849e-02f, -1.072807517e-02f,
+  -8.235500753e-02f, -4.793460015e-03f, 1.794348122e-03f, 7.935589552e-02f,
+  -7.719898224e-02f, 3.625612881e-04f, 6.950369570e-03f, 8.451191336e-02f,
+  1.288498472e-02f, 9.044653177e-02f, 9.703434259e-02f, 1.745958924e-01f,
+  -7.293217629e-02f, 4.629366565e-03f, 1.121717505e-02f, 8.877871931e-02f,
+  1.715178974e-02f, 9.471333772e-02f, 1.013011411e-01f, 1.788626909e-01f,
+  2.230781130e-02f, 9.986935556e-02f, 1.064571664e-01f, 1.840187162e-01f,
+  1.123917773e-01f, 1.899533272e-01f, 1.965411305e-01f, 2.741026878e-01f,
+  -2.741026878e-01f, -1.965411305e-01f, -1.899533272e-01f, -1.123917773e-01f,
+  -1.840187162e-01f, -1.064571664e-01f, -9.986935556e-02f, -2.230781130e-02f,
+  -1.788626909e-01f, -1.013011411e-01f, -9.471333772e-02f, -1.715178974e-02f,
+  -8.877871931e-02f, -1.121717505e-02f, -4.629366565e-03f, 7.293217629e-02f,
+  -1.745958924e-01f, -9.703434259e-02f, -9.044653177e-02f, -1.288498472e-02f,
+  -8.451191336e-02f, -6.950369570e-03f, -3.625612881e-04f, 7.719898224e-02f,
+  -7.935589552e-02f, -1.794348122e-03f, 4.793460015e-03f, 8.235500753e-02f,
+  1.072807517e-02f, 8.828961849e-02f, 9.487742931e-02f, 1.724389791e-01f,
+  -1.713109463e-01f, -9.374940395e-02f, -8.716159314e-02f, -9.600047953e-03f,
+  -8.122698218e-02f, -3.665433265e-03f, 2.922374988e-03f, 8.048392087e-02f,
+  -7.607095689e-02f, 1.490588300e-03f, 8.078396320e-03f, 8.563994616e-02f,
+  1.401301101e-02f, 9.157455713e-02f, 9.816236794e-02f, 1.757239103e-01f,
+  -7.180415094e-02f, 5.757393781e-03f, 1.234520227e-02f, 8.990674466e-02f,
+  1.827981696e-02f, 9.584136307e-02f, 1.024291739e-01f, 1.799907237e-01f,
+  2.343583852e-02f, 1.009973809e-01f, 1.075851917e-01f, 1.851467341e-01f,
+  1.135198101e-01f, 1.910813600e-01f, 1.976691633e-01f, 2.752307057e-01f,
+  -1.690798700e-01f, -9.151832014e-02f, -8.493050933e-02f, -7.368965074e-03f,
+  -7.899589837e-02f, -1.434350037e-03f, 5.153458100e-03f, 8.271500468e-02f,
+  -7.383987308e-02f, 3.721671412e-03f, 1.030947920e-02f, 8.787102252e-02f,
+  1.624409482e-02f, 9.380564094e-02f, 1.003934518e-01f, 1.779550016e-01f,
+  -6.957306713e-02f, 7.988477126e-03f, 1.457628515e-02f, 9.213782847e-02f,
+  2.051090077e-02f, 9.807244688e-02f, 1.046602577e-01f, 1.822218001e-01f,
+  2.566692047e-02f, 1.032284647e-01f, 1.098162755e-01f, 1.873778254e-01f,
+  1.157508940e-01f, 1.933124363e-01f, 1.999002397e-01f, 2.774617970e-01f,
+  -6.628813595e-02f, 1.127341297e-02f, 1.786122099e-02f, 9.542276710e-02f,
+  2.379583567e-02f, 1.013573855e-01f, 1.079451889e-01f, 1.855067313e-01f,
+  2.895185724e-02f, 1.065134034e-01f, 1.131012142e-01f, 1.906627566e-01f,
+  1.190358251e-01f, 1.965973675e-01f, 2.031851858e-01f, 2.807467282e-01f,
+  3.321866319e-02f, 1.107802093e-01f, 1.173680201e-01f, 1.949295700e-01f,
+  1.233026311e-01f, 2.008641809e-01f, 2.074519843e-01f, 2.850135267e-01f,
+  1.284586489e-01f, 2.060202062e-01f, 2.126080096e-01f, 2.901695669e-01f,
+  2.185426205e-01f, 2.961041629e-01f, 3.026919663e-01f, 3.802535236e-01f
+}
+};
+
+static const float ctables256[24][256] = {
+{
+  -1.209387506e-07f, -1.394437845e-07f, -1.404990257e-07f, -1.590040597e-07f,
+  -1.367942843e-07f, -1.552993325e-07f, -1.563545595e-07f, -1.748596077e-07f,
+  -1.263917682e-07f, -1.448968021e-07f, -1.459520291e-07f, -1.644570773e-07f,
+  -1.422473019e-07f, -1.607523359e-07f, -1.618075771e-07f, -1.803126111e-07f,
+  -1.070429931e-07f, -1.255480271e-07f, -1.266032683e-07f, -1.451083023e-07f,
+  -1.228985269e-07f, -1.414035751e-07f, -1.424588021e-07f, -1.609638360e-07f,
+  -1.124960036e-07f, -1.310010447e-07f, -1.320562717e-07f, -1.505613199e-07f,
+  -1.283515445e-07f, -1.468565785e-07f, -1.479118197e-07f, -1.664168536e-07f,
+  -7.619095754e-08f, -9.469599860e-08f, -9.575123272e-08f, -1.142562738e-07f,
+  -9.204649842e-08f, -1.105515395e-07f, -1.116067736e-07f, -1.301118147e-07f,
+  -8.164397514e-08f, -1.001490162e-07f, -1.012042432e-07f, -1.197092843e-07f,
+  -9.749950891e-08f, -1.160045500e-07f, -1.170597841e-07f, -1.355648322e-07f,
+  -6.229520011e-08f, -8.080024116e-08f, -8.185547529e-08f, -1.003605163e-07f,
+  -7.815074099e-08f, -9.665578204e-08f, -9.771101617e-08f, -1.162160572e-07f,
+  -6.774821770e-08f, -8.625325876e-08f, -8.730848577e-08f, -1.058135268e-07f,
+  -8.360375148e-08f, -1.021087925e-07f, -1.031640267e-07f, -1.216690748e-07f,
+  -3.098185175e-08f, -4.948689281e-08f, -5.054212338e-08f, -6.904716798e-08f,
+  -4.683738908e-08f, -6.534242658e-08f, -6.639766070e-08f, -8.490270176e-08f,
+  -3.643486579e-08f, -5.493990685e-08f, -5.599513742e-08f, -7.450017847e-08f,
+  -5.229040312e-08f, -7.079544417e-08f, -7.185067830e-08f, -9.035571935e-08f,
+  -1.708609254e-08f, -3.559113182e-08f, -3.664636594e-08f, -5.515140700e-08f,
+  -3.294163164e-08f, -5.144667270e-08f, -5.250190682e-08f, -7.100694432e-08f,
+  -2.253910658e-08f, -4.104414586e-08f, -4.209937998e-08f, -6.060442104e-08f,
+  -3.839464569e-08f, -5.689968674e-08f, -5.795491731e-08f, -7.645996192e-08f,
+  1.376593861e-08f, -4.739102444e-09f, -5.794335678e-09f, -2.429937673e-08f,
+  -2.089600493e-09f, -2.059464066e-08f, -2.164987478e-08f, -4.015491584e-08f,
+  8.312924571e-09f, -1.019211648e-08f, -1.124734972e-08f, -2.975239077e-08f,
+  -7.542614533e-09f, -2.604765470e-08f, -2.710288882e-08f, -4.560792988e-08f,
+  2.766169693e-08f, 9.156655878e-09f, 8.101422644e-09f, -1.040361841e-08f,
+  1.180615783e-08f, -6.698883226e-09f, -7.754116460e-09f, -2.625915663e-08f,
+  2.220868289e-08f, 3.703641616e-09f, 2.648408604e-09f, -1.585663156e-08f,
+  6.353143789e-09f, -1.215189727e-08f, -1.320713050e-08f, -3.171217244e-08f,
+  3.171217244e-08f, 1.320713050e-08f, 1.215189727e-08f, -6.353143789e-09f,
+  1.585663156e-08f, -2.648408604e-09f, -3.703641616e-09f, -2.220868289e-08f,
+  2.625915663e-08f, 7.754116460e-09f, 6.698883226e-09f, -1.180615783e-08f,
+  1.040361841e-08f, -8.101422644e-09f, -9.156655878e-09f, -2.766169693e-08f,
+  4.560792988e-08f, 2.710288882e-08f, 2.604765470e-08f, 7.542614533e-09f,
+  2.975239077e-08f, 1.124734972e-08f, 1.019211648e-08f, -8.312924571e-09f,
+  4.015491584e-08f, 2.164987478e-08f, 2.059464066e-08f, 2.089600493e-09f,
+  2.429937673e-08f, 5.794335678e-09f, 4.739102444e-09f, -1.376593861e-08f,
+  7.645996192e-08f, 5.795491731e-08f, 5.689968674e-08f, 3.839464569e-08f,
+  6.060442104e-08f, 4.209937998e-08f, 4.104414586e-08f, 2.253910658e-08f,
+  7.100694432e-08f, 5.250190682e-08f, 5.144667270e-08f, 3.294163164e-08f,
+  5.515140700e-08f, 3.664636594e-08f, 3.559113182e-08f, 1.708609254e-08f,
+  9.035571935e-08f, 7.185067830e-08f, 7.079544417e-08f, 5.229040312e-08f,
+  7.450017847e-08f, 5.599513742e-08f, 5.493990685e-08f, 3.643486579e-08f,
+  8.490270176e-08f, 6.639766070e-08f, 6.534242658e-08f, 4.683738908e-08f,
+  6.904716798e-08f, 5.054212338e-08f, 4.948689281e-08f, 3.098185175e-08f,
+  1.216690748e-07f, 1.031640267e-07f, 1.021087925e-07f, 8.360375148e-08f,
+  1.058135268e-07f, 8.730848577e-08f, 8.625325876e-08f, 6.774821770e-08f,
+  1.162160572e-07f, 9.771101617e-08f, 9.665578204e-08f, 7.815074099e-08f,
+  1.003605163e-07f, 8.185547529e-08f, 8.080024116e-08f, 6.229520011e-08f,
+  1.355648322e-07f, 1.170597841e-07f, 1.160045500e-07f, 9.749950891e-08f,
+  1.197092843e-07f, 1.012042432e-07f, 1.001490162e-07f, 8.164397514e-08f,
+  1.301118147e-07f, 1.116067736e-07f, 1.105515395e-07f, 9.204649842e-08f,
+  1.142562738e-07f, 9.575123272e-08f, 9.469599860e-08f, 7.619095754e-08f,
+  1.664168536e-07f, 1.479118197e-07f, 1.468565785e-07f, 1.283515445e-07f,
+  1.505613199e-07f, 1.320562717e-07f, 1.310010447e-07f, 1.124960036e-07f,
+  1.609638360e-07f, 1.424588021e-07f, 1.414035751e-07f, 1.228985269e-07f,
+  1.451083023e-07f, 1.266032683e-07f, 1.255480271e-07f, 1.070429931e-07f,
+  1.803126111e-07f, 1.618075771e-07f, 1.607523359e-07f, 1.422473019e-07f,
+  1.644570773e-07f, 1.459520291e-07f, 1.448968021e-07f, 1.263917682e-07f,
+  1.748596077e-07f, 1.563545595e-07f, 1.552993325e-07f, 1.367942843e-07f,
+  1.590040597e-07f, 1.404990257e-07f, 1.394437845e-07f, 1.209387506e-07f
+},
+{
+  -3.370380455e-06f, -3.134183999e-06f, -3.026229933e-06f, -2.790033250e-06f,
+  -2.890183623e-06f, -2.653986940e-06f, -2.546032874e-06f, -2.309836418e-06f,
+  -2.722313639e-06f, -2.486116955e-06f, -2.378162890e-06f, -2.141966434e-06f,
+  -2.242116580e-06f, -2.005920123e-06f, -1.897965944e-06f, -1.661769375e-06f,
+  -2.518935389e-06f, -2.282738933e-06f, -2.174784868e-06f, -1.938588184e-06f,
+  -2.038738558e-06f, -1.802541988e-06f, -1.694587809e-06f, -1.458391239e-06f,
+  -1.870868573e-06f, -1.634672003e-06f, -1.526717824e-06f, -1.290521368e-06f,
+  -1.390671628e-06f, -1.154475058e-06f, -1.046520879e-06f, -8.103243658e-07f,
+  -2.276523446e-06f, -2.040326990e-06f, -1.932372925e-06f, -1.696176241e-06f,
+  -1.796326501e-06f, -1.560130045e-06f, -1.452175866e-06f, -1.215979296e-06f,
+  -1.628456630e-06f, -1.392260060e-06f, -1.284305881e-06f, -1.048109311e-06f,
+  -1.148259685e-06f, -9.120630580e-07f, -8.041089359e-07f, -5.679123660e-07f,
+  -1.425078494e-06f, -1.188881924e-06f, -1.080927746e-06f, -8.447312325e-07f,
+  -9.448814922e-07f, -7.086849791e-07f, -6.007308571e-07f, -3.645342588e-07f,
+  -7.770115644e-07f, -5.408149946e-07f, -4.328608725e-07f, -1.966643026e-07f,
+  -2.968145907e-07f, -6.061803504e-08f, 4.733608705e-08f, 2.835326427e-07f,
+  -1.991838872e-06f, -1.755642302e-06f, -1.647688237e-06f, -1.411491667e-06f,
+  -1.511641926e-06f, -1.275445356e-06f, -1.167491291e-06f, -9.312947213e-07f,
+  -1.343771942e-06f, -1.107575372e-06f, -9.996213066e-07f, -7.634247368e-07f,
+  -8.635750532e-07f, -6.273784834e-07f, -5.194243613e-07f, -2.832277914e-07f,
+  -1.140393806e-06f, -9.041972930e-07f, -7.962431710e-07f, -5.600466011e-07f,
+  -6.601969176e-07f, -4.240003477e-07f, -3.160462256e-07f, -7.984966288e-08f,
+  -4.923269330e-07f, -2.561303631e-07f, -1.481762553e-07f, 8.802030749e-08f,
+  -1.212999123e-08f, 2.240665680e-07f, 3.320207043e-07f, 5.682172741e-07f,
+  -8.979818631e-07f, -6.617853501e-07f, -5.538311711e-07f, -3.176346297e-07f,
+  -4.177849462e-07f, -1.815883763e-07f, -7.363425425e-08f, 1.625623014e-07f,
+  -2.499149616e-07f, -1.371840330e-08f, 9.423572322e-08f, 3.304322718e-07f,
+  2.302819837e-07f, 4.664785536e-07f, 5.744326472e-07f, 8.106292171e-07f,
+  -4.653684371e-08f, 1.896597155e-07f, 2.976138376e-07f, 5.338104074e-07f,
+  4.336600909e-07f, 6.698566608e-07f, 7.778107829e-07f, 1.014007353e-06f,
+  6.015300755e-07f, 8.377266454e-07f, 9.456807675e-07f, 1.181877337e-06f,
+  1.081726964e-06f, 1.317923534e-06f, 1.425877713e-06f, 1.662074283e-06f,
+  -1.662074283e-06f, -1.425877713e-06f, -1.317923534e-06f, -1.081726964e-06f,
+  -1.181877337e-06f, -9.456807675e-07f, -8.377266454e-07f, -6.015300755e-07f,
+  -1.014007353e-06f, -7.778107829e-07f, -6.698566608e-07f, -4.336600909e-07f,
+  -5.338104074e-07f, -2.976138376e-07f, -1.896597155e-07f, 4.653684371e-08f,
+  -8.106292171e-07f, -5.744326472e-07f, -4.664785536e-07f, -2.302819837e-07f,
+  -3.304322718e-07f, -9.423572322e-08f, 1.371840330e-08f, 2.499149616e-07f,
+  -1.625623014e-07f, 7.363425425e-08f, 1.815883763e-07f, 4.177849462e-07f,
+  3.176346297e-07f, 5.538311711e-07f, 6.617853501e-07f, 8.979818631e-07f,
+  -5.682172741e-07f, -3.320207043e-07f, -2.240665680e-07f, 1.212999123e-08f,
+  -8.802030749e-08f, 1.481762553e-07f, 2.561303631e-07f, 4.923269330e-07f,
+  7.984966288e-08f, 3.160462256e-07f, 4.240003477e-07f, 6.601969176e-07f,
+  5.600466011e-07f, 7.962431710e-07f, 9.041972930e-07f, 1.140393806e-06f,
+  2.832277914e-07f, 5.194243613e-07f, 6.273784834e-07f, 8.635750532e-07f,
+  7.634247368e-07f, 9.996213066e-07f, 1.107575372e-06f, 1.343771942e-06f,
+  9.312947213e-07f, 1.167491291e-06f, 1.275445356e-06f, 1.511641926e-06f,
+  1.411491667e-06f, 1.647688237e-06f, 1.755642302e-06f, 1.991838872e-06f,
+  -2.835326427e-07f, -4.733608705e-08f, 6.061803504e-08f, 2.968145907e-07f,
+  1.966643026e-07f, 4.328608725e-07f, 5.408149946e-07f, 7.770115644e-07f,
+  3.645342588e-07f, 6.007308571e-07f, 7.086849791e-07f, 9.448814922e-07f,
+  8.447312325e-07f, 1.080927746e-06f, 1.188881924e-06f, 1.425078494e-06f,
+  5.679123660e-07f, 8.041089359e-07f, 9.120630580e-07f, 1.148259685e-06f,
+  1.048109311e-06f, 1.284305881e-06f, 1.392260060e-06f, 1.628456630e-06f,
+  1.215979296e-06f, 1.452175866e-06f, 1.560130045e-06f, 1.796326501e-06f,
+  1.696176241e-06f, 1.932372925e-06f, 2.040326990e-06f, 2.276523446e-06f,
+  8.103243658e-07f, 1.046520879e-06f, 1.154475058e-06f, 1.390671628e-06f,
+  1.290521368e-06f, 1.526717824e-06f, 1.634672003e-06f, 1.870868573e-06f,
+  1.458391239e-06f, 1.694587809e-06f, 1.802541988e-06f, 2.038738558e-06f,
+  1.938588184e-06f, 2.174784868e-06f, 2.282738933e-06f, 2.518935389e-06f,
+  1.661769375e-06f, 1.897965944e-06f, 2.005920123e-06f, 2.242116580e-06f,
+  2.141966434e-06f, 2.378162890e-06f, 2.486116955e-06f, 2.722313639e-06f,
+  2.309836418e-06f, 2.546032874e-06f, 2.653986940e-06f, 2.890183623e-06f,
+  2.790033250e-06f, 3.026229933e-06f, 3.134183999e-06f, 3.370380455e-06f
+},
+{
+  -1.561773934e-05f, -1.353237258e-05f, -1.310656626e-05f, -1.102119950e-05f,
+  -1.263151626e-05f, -1.054614950e-05f, -1.012034318e-05f, -8.034976418e-06f,
+  -1.210787741e-05f, -1.002251065e-05f, -9.596704331e-06f, -7.511337117e-06f,
+  -9.121654330e-06f, -7.036287570e-06f, -6.610480796e-06f, -4.525114036e-06f,
+  -1.153765970e-05f, -9.452292943e-06f, -9.026486623e-06f, -6.941119864e-06f,
+  -8.551436622e-06f, -6.466069863e-06f, -6.040263543e-06f, -3.954896329e-06f,
+  -8.027797776e-06f, -5.942431017e-06f, -5.516624242e-06f, -3.431257483e-06f,
+  -5.041574695e-06f, -2.956207936e-06f, -2.530401161e-06f, -4.450343170e-07f,
+  -1.092444199e-05f, -8.839075235e-06f, -8.413268915e-06f, -6.327901701e-06f,
+  -7.938218914e-06f, -5.852852155e-06f, -5.427045380e-06f, -3.341678621e-06f,
+  -7.414580068e-06f, -5.329213309e-06f, -4.903406534e-06f, -2.818039775e-06f,
+  -4.428356988e-06f, -2.342990001e-06f, -1.917183226e-06f, 1.681835471e-07f,
+  -6.844362815e-06f, -4.758995601e-06f, -4.333189281e-06f, -2.247822295e-06f,
+  -3.858139280e-06f, -1.772772521e-06f, -1.346965860e-06f, 7.384009564e-07f,
+  -3.334500434e-06f, -1.249133675e-06f, -8.233270137e-07f, 1.262039859e-06f,
+  -3.482772684e-07f, 1.737089633e-06f, 2.162896180e-06f, 4.248262940e-06f,
+  -1.027358121e-05f, -8.188214451e-06f, -7.762407222e-06f, -5.677040917e-06f,
+  -7.287357676e-06f, -5.201990916e-06f, -4.776184142e-06f, -2.690817382e-06f,
+  -6.763718829e-06f, -4.678352070e-06f, -4.252545295e-06f, -2.167178536e-06f,
+  -3.777495749e-06f, -1.692128876e-06f, -1.266322215e-06f, 8.190446579e-07f,
+  -6.193501576e-06f, -4.108134817e-06f, -3.682328042e-06f, -1.596961170e-06f,
+  -3.207278269e-06f, -1.121911396e-06f, -6.961047916e-07f, 1.389262025e-06f,
+  -2.683639423e-06f, -5.982725497e-07f, -1.724658745e-07f, 1.912900871e-06f,
+  3.025838566e-07f, 2.387950644e-06f, 2.813757419e-06f, 4.899124178e-06f,
+  -5.580283869e-06f, -3.494916882e-06f, -3.069110107e-06f, -9.837433481e-07f,
+  -2.594060334e-06f, -5.086935744e-07f, -8.288691333e-08f, 2.002479960e-06f,
+  -2.070421488e-06f, 1.494532498e-08f, 4.407519896e-07f, 2.526118806e-06f,
+  9.158017065e-07f, 3.001168579e-06f, 3.426975354e-06f, 5.512341886e-06f,
+  -1.500204121e-06f, 5.851627520e-07f, 1.010969413e-06f, 3.096336286e-06f,
+  1.486019187e-06f, 3.571386060e-06f, 3.997192835e-06f, 6.082559594e-06f,
+  2.009657919e-06f, 4.095024906e-06f, 4.520831681e-06f, 6.606198440e-06f,
+  4.995881227e-06f, 7.081247986e-06f, 7.507054761e-06f, 9.592421520e-06f,
+  -9.592421520e-06f, -7.507054761e-06f, -7.081247986e-06f, -4.995881227e-06f,
+  -6.606198440e-06f, -4.520831681e-06f, -4.095024906e-06f, -2.009657919e-06f,
+  -6.082559594e-06f, -3.997192835e-06f, -3.571386060e-06f, -1.486019187e-06f,
+  -3.096336286e-06f, -1.010969413e-06f, -5.851627520e-07f, 1.500204121e-06f,
+  -5.512341886e-06f, -3.426975354e-06f, -3.001168579e-06f, -9.158017065e-07f,
+  -2.526118806e-06f, -4.407519896e-07f, -1.494532498e-08f, 2.070421488e-06f,
+  -2.002479960e-06f, 8.288691333e-08f, 5.086935744e-07f, 2.594060334e-06f,
+  9.837433481e-07f, 3.069110107e-06f, 3.494916882e-06f, 5.580283869e-06f,
+  -4.899124178e-06f, -2.813757419e-06f, -2.387950644e-06f, -3.025838566e-07f,
+  -1.912900871e-06f, 1.724658745e-07f, 5.982725497e-07f, 2.683639423e-06f,
+  -1.389262025e-06f, 6.961047916e-07f, 1.121911396e-06f, 3.207278269e-06f,
+  1.596961170e-06f, 3.682328042e-06f, 4.108134817e-06f, 6.193501576e-06f,
+  -8.190446579e-07f, 1.266322215e-06f, 1.692128876e-06f, 3.777495749e-06f,
+  2.167178536e-06f, 4.252545295e-06f, 4.678352070e-06f, 6.763718829e-06f,
+  2.690817382e-06f, 4.776184142e-06f, 5.201990916e-06f, 7.287357676e-06f,
+  5.677040917e-06f, 7.762407222e-06f, 8.188214451e-06f, 1.027358121e-05f,
+  -4.248262940e-06f, -2.162896180e-06f, -1.737089633e-06f, 3.482772684e-07f,
+  -1.262039859e-06f, 8.233270137e-07f, 1.249133675e-06f, 3.334500434e-06f,
+  -7.384009564e-07f, 1.346965860e-06f, 1.772772521e-06f, 3.858139280e-06f,
+  2.247822295e-06f, 4.333189281e-06f, 4.758995601e-06f, 6.844362815e-06f,
+  -1.681835471e-07f, 1.917183226e-06f, 2.342990001e-06f, 4.428356988e-06f,
+  2.818039775e-06f, 4.903406534e-06f, 5.329213309e-06f, 7.414580068e-06f,
+  3.341678621e-06f, 5.427045380e-06f, 5.852852155e-06f, 7.938218914e-06f,
+  6.327901701e-06f, 8.413268915e-06f, 8.839075235e-06f, 1.092444199e-05f,
+  4.450343170e-07f, 2.530401161e-06f, 2.956207936e-06f, 5.041574695e-06f,
+  3.431257483e-06f, 5.516624242e-06f, 5.942431017e-06f, 8.027797776e-06f,
+  3.954896329e-06f, 6.040263543e-06f, 6.466069863e-06f, 8.551436622e-06f,
+  6.941119864e-06f, 9.026486623e-06f, 9.452292943e-06f, 1.153765970e-05f,
+  4.525114036e-06f, 6.610480796e-06f, 7.036287570e-06f, 9.121654330e-06f,
+  7.511337117e-06f, 9.596704331e-06f, 1.002251065e-05f, 1.210787741e-05f,
+  8.034976418e-06f, 1.012034318e-05f, 1.054614950e-05f, 1.263151626e-05f,
+  1.102119950e-05f, 1.310656626e-05f, 1.353237258e-05f, 1.561773934e-05f
+},
+{
+  -3.602360084e-05f, -2.929635957e-05f, -2.858558037e-05f, -2.185833910e-05f,
+  -2.788040183e-05f, -2.115315874e-05f, -2.044237954e-05f, -1.371513827e-05f,
+  -2.719796794e-05f, -2.047072667e-05f, -1.975994746e-05f, -1.303270437e-05f,
+  -1.905476711e-05f, -1.232752584e-05f, -1.161674572e-05f, -4.889503998e-06f,
+  -2.655822937e-05f, -1.983098628e-05f, -1.912020707e-05f, -1.239296489e-05f,
+  -1.841502853e-05f, -1.168778635e-05f, -1.097700624e-05f, -4.249764515e-06f,
+  -1.773259464e-05f, -1.100535246e-05f, -1.029457326e-05f, -3.567330850e-06f,
+  -9.589393812e-06f, -2.862151860e-06f, -2.151372428e-06f, 4.575869752e-06f,
+  -2.598401261e-05f, -1.925676952e-05f, -1.854599032e-05f, -1.181874813e-05f,
+  -1.784081178e-05f, -1.111356960e-05f, -1.040278948e-05f, -3.675547759e-06f,
+  -1.715837789e-05f, -1.043113571e-05f, -9.720356502e-06f, -2.993114094e-06f,
+  -9.015177056e-06f, -2.287935104e-06f, -1.577155786e-06f, 5.150086508e-06f,
+  -1.651863749e-05f, -9.791396224e-06f, -9.080617019e-06f, -2.353374612e-06f,
+  -8.375437574e-06f, -1.648195621e-06f, -9.374163028e-07f, 5.789825991e-06f,
+  -7.693004591e-06f, -9.657619557e-07f, -2.549827229e-07f, 6.472259429e-06f,
+  4.501962962e-07f, 7.177438420e-06f, 7.888217624e-06f, 1.461545980e-05f,
+  -2.550105819e-05f, -1.877381692e-05f, -1.806303771e-05f, -1.133579462e-05f,
+  -1.735785736e-05f, -1.063061609e-05f, -9.919836884e-06f, -3.192594477e-06f,
+  -1.667542529e-05f, -9.948182196e-06f, -9.237402992e-06f, -2.510160812e-06f,
+  -8.532224456e-06f, -1.804981821e-06f, -1.094202503e-06f, 5.633039564e-06f,
+  -1.603568489e-05f, -9.308442714e-06f, -8.597663509e-06f, -1.870421329e-06f,
+  -7.892484973e-06f, -1.165242338e-06f, -4.544630485e-07f, 6.272779046e-06f,
+  -7.210051081e-06f, -4.828087299e-07f, 2.279705456e-07f, 6.955212939e-06f,
+  9.331495789e-07f, 7.660391930e-06f, 8.371171134e-06f, 1.509841331e-05f,
+  -1.546146814e-05f, -8.734225958e-06f, -8.023446753e-06f, -1.296204573e-06f,
+  -7.318267762e-06f, -5.910255823e-07f, 1.197536790e-07f, 6.846995802e-06f,
+  -6.635834325e-06f, 9.140803314e-08f, 8.021872873e-07f, 7.529429695e-06f,
+  1.507366278e-06f, 8.234608686e-06f, 8.945387890e-06f, 1.567263098e-05f,
+  -5.996094842e-06f, 7.311475088e-07f, 1.441926770e-06f, 8.169168723e-06f,
+  2.147105761e-06f, 8.874348168e-06f, 9.585127373e-06f, 1.631236955e-05f,
+  2.829539426e-06f, 9.556782061e-06f, 1.026756127e-05f, 1.699480345e-05f,
+  1.097273980e-05f, 1.769998198e-05f, 1.841076119e-05f, 2.513800428e-05f,
+  -2.513800428e-05f, -1.841076119e-05f, -1.769998198e-05f, -1.097273980e-05f,
+  -1.699480345e-05f, -1.026756127e-05f, -9.556782061e-06f, -2.829539426e-06f,
+  -1.631236955e-05f, -9.585127373e-06f, -8.874348168e-06f, -2.147105761e-06f,
+  -8.169168723e-06f, -1.441926770e-06f, -7.311475088e-07f, 5.996094842e-06f,
+  -1.567263098e-05f, -8.945387890e-06f, -8.234608686e-06f, -1.507366278e-06f,
+  -7.529429695e-06f, -8.021872873e-07f, -9.140803314e-08f, 6.635834325e-06f,
+  -6.846995802e-06f, -1.197536790e-07f, 5.910255823e-07f, 7.318267762e-06f,
+  1.296204573e-06f, 8.023446753e-06f, 8.734225958e-06f, 1.546146814e-05f,
+  -1.509841331e-05f, -8.371171134e-06f, -7.660391930e-06f, -9.331495789e-07f,
+  -6.955212939e-06f, -2.279705456e-07f, 4.828087299e-07f, 7.210051081e-06f,
+  -6.272779046e-06f, 4.544630485e-07f, 1.165242338e-06f, 7.892484973e-06f,
+  1.870421329e-06f, 8.597663509e-06f, 9.308442714e-06f, 1.603568489e-05f,
+  -5.633039564e-06f, 1.094202503e-06f, 1.804981821e-06f, 8.532224456e-06f,
+  2.510160812e-06f, 9.237402992e-06f, 9.948182196e-06f, 1.667542529e-05f,
+  3.192594477e-06f, 9.919836884e-06f, 1.063061609e-05f, 1.735785736e-05f,
+  1.133579462e-05f, 1.806303771e-05f, 1.877381692e-05f, 2.550105819e-05f,
+  -1.461545980e-05f, -7.888217624e-06f, -7.177438420e-06f, -4.501962962e-07f,
+  -6.472259429e-06f, 2.549827229e-07f, 9.657619557e-07f, 7.693004591e-06f,
+  -5.789825991e-06f, 9.374163028e-07f, 1.648195621e-06f, 8.375437574e-06f,
+  2.353374612e-06f, 9.080617019e-06f, 9.791396224e-06f, 1.651863749e-05f,
+  -5.150086508e-06f, 1.577155786e-06f, 2.287935104e-06f, 9.015177056e-06f,
+  2.993114094e-06f, 9.720356502e-06f, 1.043113571e-05f, 1.715837789e-05f,
+  3.675547759e-06f, 1.040278948e-05f, 1.111356960e-05f, 1.784081178e-05f,
+  1.181874813e-05f, 1.854599032e-05f, 1.925676952e-05f, 2.598401261e-05f,
+  -4.575869752e-06f, 2.151372428e-06f, 2.862151860e-06f, 9.589393812e-06f,
+  3.567330850e-06f, 1.029457326e-05f, 1.100535246e-05f, 1.773259464e-05f,
+  4.249764515e-06f, 1.097700624e-05f, 1.168778635e-05f, 1.841502853e-05f,
+  1.239296489e-05f, 1.912020707e-05f, 1.983098628e-05f, 2.655822937e-05f,
+  4.889503998e-06f, 1.161674572e-05f, 1.232752584e-05f, 1.905476711e-05f,
+  1.303270437e-05f, 1.975994746e-05f, 2.047072667e-05f, 2.719796794e-05f,
+  1.371513827e-05f, 2.044237954e-05f, 2.115315874e-05f, 2.788040183e-05f,
+  2.185833910e-05f, 2.858558037e-05f, 2.929635957e-05f, 3.602360084e-05f
+},
+{
+  -3.713501792e-05f, -2.603771463e-05f, -2.601149754e-05f, -1.491419607e-05f,
+  -2.620737359e-05f, -1.511007122e-05f, -1.508385412e-05f, -3.986552201e-06f,
+  -2.666414002e-05f, -1.556683856e-05f, -1.554061964e-05f, -4.443318630e-06f,
+  -1.573649570e-05f, -4.639194231e-06f, -4.612976682e-06f, 6.484325240e-06f,
+  -2.742242577e-05f, -1.632512431e-05f, -1.629890721e-05f, -5.201604836e-06f,
+  -1.649478145e-05f, -5.397479981e-06f, -5.371262887e-06f, 5.726039035e-06f,
+  -1.695154788e-05f, -5.854246410e-06f, -5.828029316e-06f, 5.269272606e-06f,
+  -6.023904461e-06f, 5.073397460e-06f, 5.099614555e-06f, 1.619691648e-05f,
+  -2.852424586e-05f, -1.742694440e-05f, -1.740072730e-05f, -6.303425380e-06f,
+  -1.759660336e-05f, -6.499300980e-06f, -6.473083431e-06f, 4.624218036e-06f,
+  -1.805336979e-05f, -6.956067409e-06f, -6.929850315e-06f, 4.167451607e-06f,
+  -7.125725460e-06f, 3.971576461e-06f, 3.997793556e-06f, 1.509509548e-05f,
+  -1.881165554e-05f, -7.714353160e-06f, -7.688136066e-06f, 3.409165856e-06f,
+  -7.884011211e-06f, 3.213290256e-06f, 3.239507805e-06f, 1.433680973e-05f,
+  -8.340777640e-06f, 2.756523827e-06f, 2.782741376e-06f, 1.388004330e-05f,
+  2.586865776e-06f, 1.368416724e-05f, 1.371038525e-05f, 2.480768671e-05f,
+  -3.001247569e-05f, -1.891517422e-05f, -1.888895713e-05f, -7.791654753e-06f,
+  -1.908483137e-05f, -7.987529898e-06f, -7.961312804e-06f, 3.135989118e-06f,
+  -1.954159779e-05f, -8.444296327e-06f, -8.418079233e-06f, 2.679222689e-06f,
+  -8.613954378e-06f, 2.483347089e-06f, 2.509564411e-06f, 1.360686656e-05f,
+  -2.029988536e-05f, -9.202582987e-06f, -9.176364983e-06f, 1.920936711e-06f,
+  -9.372241038e-06f, 1.725061111e-06f, 1.751278546e-06f, 1.284858081e-05f,
+  -9.829007467e-06f, 1.268294682e-06f, 1.294512117e-06f, 1.239181438e-05f,
+  1.098636631e-06f, 1.219593833e-05f, 1.222215542e-05f, 2.331945689e-05f,
+  -2.140170545e-05f, -1.030440399e-05f, -1.027818598e-05f, 8.191156553e-07f,
+  -1.047406204e-05f, 6.232401688e-07f, 6.494575473e-07f, 1.174675981e-05f,
+  -1.093082847e-05f, 1.664737539e-07f, 1.926911324e-07f, 1.128999338e-05f,
+  -3.184321251e-09f, 1.109411733e-05f, 1.112033533e-05f, 2.221763680e-05f,
+  -1.168911422e-05f, -5.918122383e-07f, -5.655948598e-07f, 1.053170672e-05f,
+  -7.614702895e-07f, 1.033583158e-05f, 1.036204867e-05f, 2.145935105e-05f,
+  -1.218236775e-06f, 9.879065146e-06f, 9.905282241e-06f, 2.100258462e-05f,
+  9.709407095e-06f, 2.080670856e-05f, 2.083292566e-05f, 3.193022712e-05f,
+  -3.193022712e-05f, -2.083292566e-05f, -2.080670856e-05f, -9.709407095e-06f,
+  -2.100258462e-05f, -9.905282241e-06f, -9.879065146e-06f, 1.218236775e-06f,
+  -2.145935105e-05f, -1.036204867e-05f, -1.033583158e-05f, 7.614702895e-07f,
+  -1.053170672e-05f, 5.655948598e-07f, 5.918122383e-07f, 1.168911422e-05f,
+  -2.221763680e-05f, -1.112033533e-05f, -1.109411733e-05f, 3.184321251e-09f,
+  -1.128999338e-05f, -1.926911324e-07f, -1.664737539e-07f, 1.093082847e-05f,
+  -1.174675981e-05f, -6.494575473e-07f, -6.232401688e-07f, 1.047406204e-05f,
+  -8.191156553e-07f, 1.027818598e-05f, 1.030440399e-05f, 2.140170545e-05f,
+  -2.331945689e-05f, -1.222215542e-05f, -1.219593833e-05f, -1.098636631e-06f,
+  -1.239181438e-05f, -1.294512117e-06f, -1.268294682e-06f, 9.829007467e-06f,
+  -1.284858081e-05f, -1.751278546e-06f, -1.725061111e-06f, 9.372241038e-06f,
+  -1.920936711e-06f, 9.176364983e-06f, 9.202582987e-06f, 2.029988536e-05f,
+  -1.360686656e-05f, -2.509564411e-06f, -2.483347089e-06f, 8.613954378e-06f,
+  -2.679222689e-06f, 8.418079233e-06f, 8.444296327e-06f, 1.954159779e-05f,
+  -3.135989118e-06f, 7.961312804e-06f, 7.987529898e-06f, 1.908483137e-05f,
+  7.791654753e-06f, 1.888895713e-05f, 1.891517422e-05f, 3.001247569e-05f,
+  -2.480768671e-05f, -1.371038525e-05f, -1.368416724e-05f, -2.586865776e-06f,
+  -1.388004330e-05f, -2.782741376e-06f, -2.756523827e-06f, 8.340777640e-06f,
+  -1.433680973e-05f, -3.239507805e-06f, -3.213290256e-06f, 7.884011211e-06f,
+  -3.409165856e-06f, 7.688136066e-06f, 7.714353160e-06f, 1.881165554e-05f,
+  -1.509509548e-05f, -3.997793556e-06f, -3.971576461e-06f, 7.125725460e-06f,
+  -4.167451607e-06f, 6.929850315e-06f, 6.956067409e-06f, 1.805336979e-05f,
+  -4.624218036e-06f, 6.473083431e-06f, 6.499300980e-06f, 1.759660336e-05f,
+  6.303425380e-06f, 1.740072730e-05f, 1.742694440e-05f, 2.852424586e-05f,
+  -1.619691648e-05f, -5.099614555e-06f, -5.073397460e-06f, 6.023904461e-06f,
+  -5.269272606e-06f, 5.828029316e-06f, 5.854246410e-06f, 1.695154788e-05f,
+  -5.726039035e-06f, 5.371262887e-06f, 5.397479981e-06f, 1.649478145e-05f,
+  5.201604836e-06f, 1.629890721e-05f, 1.632512431e-05f, 2.742242577e-05f,
+  -6.484325240e-06f, 4.612976682e-06f, 4.639194231e-06f, 1.573649570e-05f,
+  4.443318630e-06f, 1.554061964e-05f, 1.556683856e-05f, 2.666414002e-05f,
+  3.986552201e-06f, 1.508385412e-05f, 1.511007122e-05f, 2.620737359e-05f,
+  1.491419607e-05f, 2.601149754e-05f, 2.603771463e-05f, 3.713501792e-05f
+},
+{
+  4.600596731e-05f, 4.882083158e-05f, 4.591732431e-05f, 4.873218495e-05f,
+  4.246096796e-05f, 4.527582860e-05f, 4.237232497e-05f, 4.518718561e-05f,
+  3.841556099e-05f, 4.123042163e-05f, 3.832691800e-05f, 4.114177864e-05f,
+  3.487056165e-05f, 3.768542228e-05f, 3.478191502e-05f, 3.759677566e-05f,
+  3.374901280e-05f, 3.656387344e-05f, 3.366036981e-05f, 3.647523044e-05f,
+  3.020401164e-05f, 3.301887409e-05f, 3.011536865e-05f, 3.293022746e-05f,
+  2.615860649e-05f, 2.897346712e-05f, 2.606996168e-05f, 2.888482231e-05f,
+  2.261360532e-05f, 2.542846596e-05f, 2.252496051e-05f, 2.533982115e-05f,
+  2.843442780e-05f, 3.124928844e-05f, 2.834578299e-05f, 3.116064545e-05f,
+  2.488942664e-05f, 2.770428728e-05f, 2.480078183e-05f, 2.761564247e-05f,
+  2.084401967e-05f, 2.365888031e-05f, 2.075537668e-05f, 2.357023732e-05f,
+  1.729901851e-05f, 2.011387915e-05f, 1.721037370e-05f, 2.002523433e-05f,
+  1.617747330e-05f, 1.899233393e-05f, 1.608882849e-05f, 1.890368912e-05f,
+  1.263247123e-05f, 1.544733277e-05f, 1.254382641e-05f, 1.535868796e-05f,
+  8.587065167e-06f, 1.140192580e-05f, 8.498420357e-06f, 1.131328099e-05f,
+  5.042063549e-06f, 7.856924640e-06f, 4.953419193e-06f, 7.768279829e-06f,
+  2.245124597e-05f, 2.526610660e-05f, 2.236260116e-05f, 2.517746179e-05f,
+  1.890624480e-05f, 2.172110544e-05f, 1.881759999e-05f, 2.163246063e-05f,
+  1.486083875e-05f, 1.767570029e-05f, 1.477219394e-05f, 1.758705548e-05f,
+  1.131583758e-05f, 1.413069822e-05f, 1.122719277e-05f, 1.404205341e-05f,
+  1.019429146e-05f, 1.300915210e-05f, 1.010564665e-05f, 1.292050729e-05f,
+  6.649289844e-06f, 9.464150025e-06f, 6.560645488e-06f, 9.375506124e-06f,
+  2.603883559e-06f, 5.418744422e-06f, 2.515239203e-06f, 5.330100066e-06f,
+  -9.411178894e-07f, 1.873742804e-06f, -1.029762188e-06f, 1.785098448e-06f,
+  4.879705102e-06f, 7.694565284e-06f, 4.791060746e-06f, 7.605921382e-06f,
+  1.334703484e-06f, 4.149564120e-06f, 1.246059128e-06f, 4.060919764e-06f,
+  -2.710702574e-06f, 1.041580902e-07f, -2.799346930e-06f, 1.551372719e-08f,
+  -6.255704193e-06f, -3.440843329e-06f, -6.344348549e-06f, -3.529487685e-06f,
+  -7.377249858e-06f, -4.562389222e-06f, -7.465894669e-06f, -4.651033578e-06f,
+  -1.092225193e-05f, -8.107391295e-06f, -1.101089583e-05f, -8.196035196e-06f,
+  -1.496765799e-05f, -1.215279735e-05f, -1.505630189e-05f, -1.224144125e-05f,
+  -1.851265915e-05f, -1.569779852e-05f, -1.860130396e-05f, -1.578644333e-05f,
+  1.578644333e-05f, 1.860130396e-05f, 1.569779852e-05f, 1.851265915e-05f,
+  1.224144125e-05f, 1.505630189e-05f, 1.215279735e-05f, 1.496765799e-05f,
+  8.196035196e-06f, 1.101089583e-05f, 8.107391295e-06f, 1.092225193e-05f,
+  4.651033578e-06f, 7.465894669e-06f, 4.562389222e-06f, 7.377249858e-06f,
+  3.529487685e-06f, 6.344348549e-06f, 3.440843329e-06f, 6.255704193e-06f,
+  -1.551372719e-08f, 2.799346930e-06f, -1.041580902e-07f, 2.710702574e-06f,
+  -4.060919764e-06f, -1.246059128e-06f, -4.149564120e-06f, -1.334703484e-06f,
+  -7.605921382e-06f, -4.791060746e-06f, -7.694565284e-06f, -4.879705102e-06f,
+  -1.785098448e-06f, 1.029762188e-06f, -1.873742804e-06f, 9.411178894e-07f,
+  -5.330100066e-06f, -2.515239203e-06f, -5.418744422e-06f, -2.603883559e-06f,
+  -9.375506124e-06f, -6.560645488e-06f, -9.464150025e-06f, -6.649289844e-06f,
+  -1.292050729e-05f, -1.010564665e-05f, -1.300915210e-05f, -1.019429146e-05f,
+  -1.404205341e-05f, -1.122719277e-05f, -1.413069822e-05f, -1.131583758e-05f,
+  -1.758705548e-05f, -1.477219394e-05f, -1.767570029e-05f, -1.486083875e-05f,
+  -2.163246063e-05f, -1.881759999e-05f, -2.172110544e-05f, -1.890624480e-05f,
+  -2.517746179e-05f, -2.236260116e-05f, -2.526610660e-05f, -2.245124597e-05f,
+  -7.768279829e-06f, -4.953419193e-06f, -7.856924640e-06f, -5.042063549e-06f,
+  -1.131328099e-05f, -8.498420357e-06f, -1.140192580e-05f, -8.587065167e-06f,
+  -1.535868796e-05f, -1.254382641e-05f, -1.544733277e-05f, -1.263247123e-05f,
+  -1.890368912e-05f, -1.608882849e-05f, -1.899233393e-05f, -1.617747330e-05f,
+  -2.002523433e-05f, -1.721037370e-05f, -2.011387915e-05f, -1.729901851e-05f,
+  -2.357023732e-05f, -2.075537668e-05f, -2.365888031e-05f, -2.084401967e-05f,
+  -2.761564247e-05f, -2.480078183e-05f, -2.770428728e-05f, -2.488942664e-05f,
+  -3.116064545e-05f, -2.834578299e-05f, -3.124928844e-05f, -2.843442780e-05f,
+  -2.533982115e-05f, -2.252496051e-05f, -2.542846596e-05f, -2.261360532e-05f,
+  -2.888482231e-05f, -2.606996168e-05f, -2.897346712e-05f, -2.615860649e-05f,
+  -3.293022746e-05f, -3.011536865e-05f, -3.301887409e-05f, -3.020401164e-05f,
+  -3.647523044e-05f, -3.366036981e-05f, -3.656387344e-05f, -3.374901280e-05f,
+  -3.759677566e-05f, -3.478191502e-05f, -3.768542228e-05f, -3.487056165e-05f,
+  -4.114177864e-05f, -3.832691800e-05f, -4.123042163e-05f, -3.841556099e-05f,
+  -4.518718561e-05f, -4.237232497e-05f, -4.527582860e-05f, -4.246096796e-05f,
+  -4.873218495e-05f, -4.591732431e-05f, -4.882083158e-05f, -4.600596731e-05f
+},
+{
+  2.798654314e-04f, 2.422951948e-04f, 2.342642838e-04f, 1.966940617e-04f,
+  2.255700820e-04f, 1.879998454e-04f, 1.799689489e-04f, 1.423987123e-04f,
+  2.162418823e-04f, 1.786716603e-04f, 1.706407493e-04f, 1.330705272e-04f,
+  1.619465475e-04f, 1.243763109e-04f, 1.163454072e-04f, 7.877517783e-05f,
+  2.063225838e-04f, 1.687523472e-04f, 1.607214508e-04f, 1.231512142e-04f,
+  1.520272490e-04f, 1.144570124e-04f, 1.064261014e-04f, 6.885587209e-05f,
+  1.426990493e-04f, 1.051288200e-04f, 9.709790902e-05f, 5.952767970e-05f,
+  8.840370720e-05f, 5.083347787e-05f, 4.280257053e-05f, 5.232338935e-06f,
+  1.958696957e-04f, 1.582994591e-04f, 1.502685627e-04f, 1.126983261e-04f,
+  1.415743463e-04f, 1.040041243e-04f, 9.597321332e-05f, 5.840298400e-05f,
+  1.322461612e-04f, 9.467593190e-05f, 8.664502093e-05f, 4.907479160e-05f,
+  7.795081910e-05f, 4.038058978e-05f, 3.234968244e-05f, -5.220549610e-06f,
+  1.223268628e-04f, 8.475662617e-05f, 7.672572247e-05f, 3.915548950e-05f,
+  6.803151336e-05f, 3.046128404e-05f, 2.243037670e-05f, -1.513985353e-05f,
+  5.870332097e-05f, 2.113309165e-05f, 1.310218522e-05f, -2.446804683e-05f,
+  4.407980214e-06f, -3.316225047e-05f, -4.119315781e-05f, -7.876339077e-05f,
+  1.849563996e-04f, 1.473861776e-04f, 1.393552666e-04f, 1.017850300e-04f,
+  1.306610648e-04f, 9.309082816e-05f, 8.505992446e-05f, 4.748969150e-05f,
+  1.213328651e-04f, 8.376263577e-05f, 7.573173207e-05f, 3.816149911e-05f,
+  6.703752297e-05f, 2.946729364e-05f, 2.143638631e-05f, -1.613384484e-05f,
+  1.114135594e-04f, 7.384333003e-05f, 6.581242633e-05f, 2.824219519e-05f,
+  5.711822087e-05f, 1.954798972e-05f, 1.151708238e-05f, -2.605314876e-05f,
+  4.779002847e-05f, 1.021979733e-05f, 2.188890676e-06f, -3.538134115e-05f,
+  -6.505314559e-06f, -4.407554661e-05f, -5.210645031e-05f, -8.967667964e-05f,
+  1.009606713e-04f, 6.339044194e-05f, 5.535953824e-05f, 1.778930528e-05f,
+  4.666533277e-05f, 9.095100722e-06f, 1.064194180e-06f, -3.650603685e-05f,
+  3.733714038e-05f, -2.330910434e-07f, -8.263998097e-06f, -4.583422924e-05f,
+  -1.695820356e-05f, -5.452843470e-05f, -6.255933840e-05f, -1.001295677e-04f,
+  2.741783646e-05f, -1.015239559e-05f, -1.818330202e-05f, -5.575353134e-05f,
+  -2.687750748e-05f, -6.444774044e-05f, -7.247864414e-05f, -1.100488735e-04f,
+  -3.620569987e-05f, -7.377593283e-05f, -8.180683653e-05f, -1.193770659e-04f,
+  -9.050103836e-05f, -1.280712750e-04f, -1.361021859e-04f, -1.736724080e-04f,
+  1.736724080e-04f, 1.361021859e-04f, 1.280712750e-04f, 9.050103836e-05f,
+  1.193770659e-04f, 8.180683653e-05f, 7.377593283e-05f, 3.620569987e-05f,
+  1.100488735e-04f, 7.247864414e-05f, 6.444774044e-05f, 2.687750748e-05f,
+  5.575353134e-05f, 1.818330202e-05f, 1.015239559e-05f, -2.741783646e-05f,
+  1.001295677e-04f, 6.255933840e-05f, 5.452843470e-05f, 1.695820356e-05f,
+  4.583422924e-05f, 8.263998097e-06f, 2.330910434e-07f, -3.733714038e-05f,
+  3.650603685e-05f, -1.064194180e-06f, -9.095100722e-06f, -4.666533277e-05f,
+  -1.778930528e-05f, -5.535953824e-05f, -6.339044194e-05f, -1.009606713e-04f,
+  8.967667964e-05f, 5.210645031e-05f, 4.407554661e-05f, 6.505314559e-06f,
+  3.538134115e-05f, -2.188890676e-06f, -1.021979733e-05f, -4.779002847e-05f,
+  2.605314876e-05f, -1.151708238e-05f, -1.954798972e-05f, -5.711822087e-05f,
+  -2.824219519e-05f, -6.581242633e-05f, -7.384333003e-05f, -1.114135594e-04f,
+  1.613384484e-05f, -2.143638631e-05f, -2.946729364e-05f, -6.703752297e-05f,
+  -3.816149911e-05f, -7.573173207e-05f, -8.376263577e-05f, -1.213328651e-04f,
+  -4.748969150e-05f, -8.505992446e-05f, -9.309082816e-05f, -1.306610648e-04f,
+  -1.017850300e-04f, -1.393552666e-04f, -1.473861776e-04f, -1.849563996e-04f,
+  7.876339077e-05f, 4.119315781e-05f, 3.316225047e-05f, -4.407980214e-06f,
+  2.446804683e-05f, -1.310218522e-05f, -2.113309165e-05f, -5.870332097e-05f,
+  1.513985353e-05f, -2.243037670e-05f, -3.046128404e-05f, -6.803151336e-05f,
+  -3.915548950e-05f, -7.672572247e-05f, -8.475662617e-05f, -1.223268628e-04f,
+  5.220549610e-06f, -3.234968244e-05f, -4.038058978e-05f, -7.795081910e-05f,
+  -4.907479160e-05f, -8.664502093e-05f, -9.467593190e-05f, -1.322461612e-04f,
+  -5.840298400e-05f, -9.597321332e-05f, -1.040041243e-04f, -1.415743463e-04f,
+  -1.126983261e-04f, -1.502685627e-04f, -1.582994591e-04f, -1.958696957e-04f,
+  -5.232338935e-06f, -4.280257053e-05f, -5.083347787e-05f, -8.840370720e-05f,
+  -5.952767970e-05f, -9.709790902e-05f, -1.051288200e-04f, -1.426990493e-04f,
+  -6.885587209e-05f, -1.064261014e-04f, -1.144570124e-04f, -1.520272490e-04f,
+  -1.231512142e-04f, -1.607214508e-04f, -1.687523472e-04f, -2.063225838e-04f,
+  -7.877517783e-05f, -1.163454072e-04f, -1.243763109e-04f, -1.619465475e-04f,
+  -1.330705272e-04f, -1.706407493e-04f, -1.786716603e-04f, -2.162418823e-04f,
+  -1.423987123e-04f, -1.799689489e-04f, -1.879998454e-04f, -2.255700820e-04f,
+  -1.966940617e-04f, -2.342642838e-04f, -2.422951948e-04f, -2.798654314e-04f
+},
+{
+  6.283054245e-04f, 5.105646560e-04f, 4.988780711e-04f, 3.811373317e-04f,
+  4.871955898e-04f, 3.694548504e-04f, 3.577682364e-04f, 2.400275116e-04f,
+  4.756786220e-04f, 3.579378827e-04f, 3.462512686e-04f, 2.285105584e-04f,
+  3.345687874e-04f, 2.168280625e-04f, 2.051414485e-04f, 8.740072371e-05f,
+  4.645068548e-04f, 3.467661445e-04f, 3.350795305e-04f, 2.173387911e-04f,
+  3.233970201e-04f, 2.056563098e-04f, 1.939696958e-04f, 7.622896374e-05f,
+  3.118800523e-04f, 1.941393421e-04f, 1.824527280e-04f, 6.471200322e-05f,
+  1.707702322e-04f, 5.302951467e-05f, 4.134290066e-05f, -7.639782416e-05f,
+  4.538779031e-04f, 3.361371637e-04f, 3.244505497e-04f, 2.067098249e-04f,
+  3.127680684e-04f, 1.950273436e-04f, 1.833407296e-04f, 6.560000475e-05f,
+  3.012511006e-04f, 1.835103758e-04f, 1.718237618e-04f, 5.408304060e-05f,
+  1.601412805e-04f, 4.240055205e-05f, 3.071393803e-05f, -8.702678315e-05f,
+  2.900793334e-04f, 1.723386231e-04f, 1.606520091e-04f, 4.291128062e-05f,
+  1.489695132e-04f, 3.122879207e-05f, 1.954217623e-05f, -9.819855040e-05f,
+  1.374525455e-04f, 1.971182792e-05f, 8.025212992e-06f, -1.097155109e-04f,
+  -3.657275329e-06f, -1.213979995e-04f, -1.330846135e-04f, -2.508253383e-04f,
+  4.440066114e-04f, 3.262658720e-04f, 3.145792580e-04f, 1.968385332e-04f,
+  3.028967767e-04f, 1.851560519e-04f, 1.734694379e-04f, 5.572870941e-05f,
+  2.913798089e-04f, 1.736390841e-04f, 1.619524701e-04f, 4.421174526e-05f,
+  1.502699888e-04f, 3.252925671e-05f, 2.084264270e-05f, -9.689808212e-05f,
+  2.802080417e-04f, 1.624673168e-04f, 1.507807028e-04f, 3.303998528e-05f,
+  1.390982216e-04f, 2.135749673e-05f, 9.670881809e-06f, -1.080698421e-04f,
+  1.275812538e-04f, 9.840532584e-06f, -1.846081886e-06f, -1.195868099e-04f,
+  -1.352856998e-05f, -1.312692912e-04f, -1.429559052e-04f, -2.606966300e-04f,
+  2.695790899e-04f, 1.518383651e-04f, 1.401517511e-04f, 2.241102266e-05f,
+  1.284692553e-04f, 1.072853502e-05f, -9.580799087e-07f, -1.186988011e-04f,
+  1.169522948e-04f, -7.884286788e-07f, -1.247504315e-05f, -1.302157616e-04f,
+  -2.415753261e-05f, -1.418982574e-04f, -1.535848714e-04f, -2.713255817e-04f,
+  1.057805348e-04f, -1.196019002e-05f, -2.364680404e-05f, -1.413875289e-04f,
+  -3.532929259e-05f, -1.530700101e-04f, -1.647566387e-04f, -2.824973490e-04f,
+  -4.684625674e-05f, -1.645869779e-04f, -1.762735919e-04f, -2.940143168e-04f,
+  -1.879560878e-04f, -3.056967980e-04f, -3.173834120e-04f, -4.351241514e-04f,
+  4.351241514e-04f, 3.173834120e-04f, 3.056967980e-04f, 1.879560878e-04f,
+  2.940143168e-04f, 1.762735919e-04f, 1.645869779e-04f, 4.684625674e-05f,
+  2.824973490e-04f, 1.647566387e-04f, 1.530700101e-04f, 3.532929259e-05f,
+  1.413875289e-04f, 2.364680404e-05f, 1.196019002e-05f, -1.057805348e-04f,
+  2.713255817e-04f, 1.535848714e-04f, 1.418982574e-04f, 2.415753261e-05f,
+  1.302157616e-04f, 1.247504315e-05f, 7.884286788e-07f, -1.169522948e-04f,
+  1.186988011e-04f, 9.580799087e-07f, -1.072853502e-05f, -1.284692553e-04f,
+  -2.241102266e-05f, -1.401517511e-04f, -1.518383651e-04f, -2.695790899e-04f,
+  2.606966300e-04f, 1.429559052e-04f, 1.312692912e-04f, 1.352856998e-05f,
+  1.195868099e-04f, 1.846081886e-06f, -9.840532584e-06f, -1.275812538e-04f,
+  1.080698421e-04f, -9.670881809e-06f, -2.135749673e-05f, -1.390982216e-04f,
+  -3.303998528e-05f, -1.507807028e-04f, -1.624673168e-04f, -2.802080417e-04f,
+  9.689808212e-05f, -2.084264270e-05f, -3.252925671e-05f, -1.502699888e-04f,
+  -4.421174526e-05f, -1.619524701e-04f, -1.736390841e-04f, -2.913798089e-04f,
+  -5.572870941e-05f, -1.734694379e-04f, -1.851560519e-04f, -3.028967767e-04f,
+  -1.968385332e-04f, -3.145792580e-04f, -3.262658720e-04f, -4.440066114e-04f,
+  2.508253383e-04f, 1.330846135e-04f, 1.213979995e-04f, 3.657275329e-06f,
+  1.097155109e-04f, -8.025212992e-06f, -1.971182792e-05f, -1.374525455e-04f,
+  9.819855040e-05f, -1.954217623e-05f, -3.122879207e-05f, -1.489695132e-04f,
+  -4.291128062e-05f, -1.606520091e-04f, -1.723386231e-04f, -2.900793334e-04f,
+  8.702678315e-05f, -3.071393803e-05f, -4.240055205e-05f, -1.601412805e-04f,
+  -5.408304060e-05f, -1.718237618e-04f, -1.835103758e-04f, -3.012511006e-04f,
+  -6.560000475e-05f, -1.833407296e-04f, -1.950273436e-04f, -3.127680684e-04f,
+  -2.067098249e-04f, -3.244505497e-04f, -3.361371637e-04f, -4.538779031e-04f,
+  7.639782416e-05f, -4.134290066e-05f, -5.302951467e-05f, -1.707702322e-04f,
+  -6.471200322e-05f, -1.824527280e-04f, -1.941393421e-04f, -3.118800523e-04f,
+  -7.622896374e-05f, -1.939696958e-04f, -2.056563098e-04f, -3.233970201e-04f,
+  -2.173387911e-04f, -3.350795305e-04f, -3.467661445e-04f, -4.645068548e-04f,
+  -8.740072371e-05f, -2.051414485e-04f, -2.168280625e-04f, -3.345687874e-04f,
+  -2.285105584e-04f, -3.462512686e-04f, -3.579378827e-04f, -4.756786220e-04f,
+  -2.400275116e-04f, -3.577682364e-04f, -3.694548504e-04f, -4.871955898e-04f,
+  -3.811373317e-04f, -4.988780711e-04f, -5.105646560e-04f, -6.283054245e-04f
+},
+{
+  8.300831541e-04f, 6.292544422e-04f, 6.231016596e-04f, 4.222729767e-04f,
+  6.187144318e-04f, 4.178857780e-04f, 4.117329663e-04f, 2.109042980e-04f,
+  6.163728540e-04f, 4.155442002e-04f, 4.093913885e-04f, 2.085627202e-04f,
+  4.050041898e-04f, 2.041755070e-04f, 1.980227098e-04f, -2.805972372e-06f,
+  6.163633079e-04f, 4.155345960e-04f, 4.093818134e-04f, 2.085531305e-04f,
+  4.049945856e-04f, 2.041659172e-04f, 1.980131201e-04f, -2.815561402e-06f,
+  4.026530078e-04f, 2.018243395e-04f, 1.956715278e-04f, -5.157144642e-06f,
+  1.912843290e-04f, -9.544351997e-06f, -1.569715278e-05f, -2.165258338e-04f,
+  6.189753185e-04f, 4.181466356e-04f, 4.119938530e-04f, 2.111651702e-04f,
+  4.076066543e-04f, 2.067779569e-04f, 2.006251598e-04f, -2.035180984e-07f,
+  4.052650474e-04f, 2.044363791e-04f, 1.982835820e-04f, -2.545101324e-06f,
+  1.938963687e-04f, -6.932308679e-06f, -1.308510946e-05f, -2.139137941e-04f,
+  4.052554723e-04f, 2.044267894e-04f, 1.982739923e-04f, -2.554690127e-06f,
+  1.938867790e-04f, -6.941897482e-06f, -1.309469917e-05f, -2.139233839e-04f,
+  1.915452012e-04f, -9.283480722e-06f, -1.543628241e-05f, -2.162649616e-04f,
+  -1.982348840e-05f, -2.206521749e-04f, -2.268049720e-04f, -4.276336404e-04f,
+  6.244984688e-04f, 4.236698151e-04f, 4.175170034e-04f, 2.166883205e-04f,
+  4.131298047e-04f, 2.123011218e-04f, 2.061483101e-04f, 5.319637694e-06f,
+  4.107882269e-04f, 2.099595295e-04f, 2.038067323e-04f, 2.978054681e-06f,
+  1.994195190e-04f, -1.409152560e-06f, -7.561954135e-06f, -2.083906293e-04f,
+  4.107786226e-04f, 2.099499397e-04f, 2.037971426e-04f, 2.968465651e-06f,
+  1.994099439e-04f, -1.418741476e-06f, -7.571542938e-06f, -2.084002190e-04f,
+  1.970683516e-04f, -3.760324716e-06f, -9.913125723e-06f, -2.107418113e-04f,
+  -1.430033353e-05f, -2.151290100e-04f, -2.212818072e-04f, -4.221104900e-04f,
+  4.133906623e-04f, 2.125619940e-04f, 2.064091823e-04f, 5.580508969e-06f,
+  2.020219836e-04f, 1.193301841e-06f, -4.959499620e-06f, -2.057881793e-04f,
+  1.996803912e-04f, -1.148281285e-06f, -7.301082860e-06f, -2.081297571e-04f,
+  -1.168829021e-05f, -2.125169704e-04f, -2.186697675e-04f, -4.194984504e-04f,
+  1.996708015e-04f, -1.157870201e-06f, -7.310671663e-06f, -2.081393468e-04f,
+  -1.169787902e-05f, -2.125265601e-04f, -2.186793572e-04f, -4.195080255e-04f,
+  -1.403946226e-05f, -2.148681378e-04f, -2.210209350e-04f, -4.218496324e-04f,
+  -2.254081483e-04f, -4.262368311e-04f, -4.323896428e-04f, -6.332183257e-04f,
+  6.332183257e-04f, 4.323896428e-04f, 4.262368311e-04f, 2.254081483e-04f,
+  4.218496324e-04f, 2.210209350e-04f, 2.148681378e-04f, 1.403946226e-05f,
+  4.195080255e-04f, 2.186793572e-04f, 2.125265601e-04f, 1.169787902e-05f,
+  2.081393468e-04f, 7.310671663e-06f, 1.157870201e-06f, -1.996708015e-04f,
+  4.194984504e-04f, 2.186697675e-04f, 2.125169704e-04f, 1.168829021e-05f,
+  2.081297571e-04f, 7.301082860e-06f, 1.148281285e-06f, -1.996803912e-04f,
+  2.057881793e-04f, 4.959499620e-06f, -1.193301841e-06f, -2.020219836e-04f,
+  -5.580508969e-06f, -2.064091823e-04f, -2.125619940e-04f, -4.133906623e-04f,
+  4.221104900e-04f, 2.212818072e-04f, 2.151290100e-04f, 1.430033353e-05f,
+  2.107418113e-04f, 9.913125723e-06f, 3.760324716e-06f, -1.970683516e-04f,
+  2.084002190e-04f, 7.571542938e-06f, 1.418741476e-06f, -1.994099439e-04f,
+  -2.968465651e-06f, -2.037971426e-04f, -2.099499397e-04f, -4.107786226e-04f,
+  2.083906293e-04f, 7.561954135e-06f, 1.409152560e-06f, -1.994195190e-04f,
+  -2.978054681e-06f, -2.038067323e-04f, -2.099595295e-04f, -4.107882269e-04f,
+  -5.319637694e-06f, -2.061483101e-04f, -2.123011218e-04f, -4.131298047e-04f,
+  -2.166883205e-04f, -4.175170034e-04f, -4.236698151e-04f, -6.244984688e-04f,
+  4.276336404e-04f, 2.268049720e-04f, 2.206521749e-04f, 1.982348840e-05f,
+  2.162649616e-04f, 1.543628241e-05f, 9.283480722e-06f, -1.915452012e-04f,
+  2.139233839e-04f, 1.309469917e-05f, 6.941897482e-06f, -1.938867790e-04f,
+  2.554690127e-06f, -1.982739923e-04f, -2.044267894e-04f, -4.052554723e-04f,
+  2.139137941e-04f, 1.308510946e-05f, 6.932308679e-06f, -1.938963687e-04f,
+  2.545101324e-06f, -1.982835820e-04f, -2.044363791e-04f, -4.052650474e-04f,
+  2.035180984e-07f, -2.006251598e-04f, -2.067779569e-04f, -4.076066543e-04f,
+  -2.111651702e-04f, -4.119938530e-04f, -4.181466356e-04f, -6.189753185e-04f,
+  2.165258338e-04f, 1.569715278e-05f, 9.544351997e-06f, -1.912843290e-04f,
+  5.157144642e-06f, -1.956715278e-04f, -2.018243395e-04f, -4.026530078e-04f,
+  2.815561402e-06f, -1.980131201e-04f, -2.041659172e-04f, -4.049945856e-04f,
+  -2.085531305e-04f, -4.093818134e-04f, -4.155345960e-04f, -6.163633079e-04f,
+  2.805972372e-06f, -1.980227098e-04f, -2.041755070e-04f, -4.050041898e-04f,
+  -2.085627202e-04f, -4.093913885e-04f, -4.155442002e-04f, -6.163728540e-04f,
+  -2.109042980e-04f, -4.117329663e-04f, -4.178857780e-04f, -6.187144318e-04f,
+  -4.222729767e-04f, -6.231016596e-04f, -6.292544422e-04f, -8.300831541e-04f
+},
+{
+  3.968816600e-04f, 2.122108563e-04f, 2.281442430e-04f, 4.347344293e-05f,
+  2.480650728e-04f, 6.339426909e-05f, 7.932765584e-05f, -1.053431406e-04f,
+  2.721994824e-04f, 8.752868598e-05f, 1.034620727e-04f, -8.120872371e-05f,
+  1.233829098e-04f, -6.128789391e-05f, -4.535451080e-05f, -2.300253109e-04f,
+  3.007466439e-04f, 1.160758402e-04f, 1.320092269e-04f, -5.266157314e-05f,
+  1.519300567e-04f, -3.274074334e-05f, -1.680735841e-05f, -2.014781639e-04f,
+  1.760644809e-04f, -8.606325537e-06f, 7.327061212e-06f, -1.773437398e-04f,
+  2.724788828e-05f, -1.574229100e-04f, -1.414895232e-04f, -3.261603124e-04f,
+  3.338734386e-04f, 1.492026495e-04f, 1.651360362e-04f, -1.953476385e-05f,
+  1.850568660e-04f, 3.860644995e-07f, 1.631945088e-05f, -1.683513547e-04f,
+  2.091912902e-04f, 2.452048284e-05f, 4.045386959e-05f, -1.442169305e-04f,
+  6.037469939e-05f, -1.242961007e-04f, -1.083627139e-04f, -2.930335177e-04f,
+  2.377384371e-04f, 5.306763705e-05f, 6.900102017e-05f, -1.156697763e-04f,
+  8.892184997e-05f, -9.574895375e-05f, -7.981556701e-05f, -2.644863562e-04f,
+  1.130562669e-04f, -7.161452959e-05f, -5.568114284e-05f, -2.403519466e-04f,
+  -3.576031668e-05f, -2.204311168e-04f, -2.044977300e-04f, -3.891685337e-04f,
+  3.717093205e-04f, 1.870385313e-04f, 2.029719180e-04f, 1.830111432e-05f,
+  2.228927478e-04f, 3.822194412e-05f, 5.415533087e-05f, -1.305154728e-04f,
+  2.470271720e-04f, 6.235636101e-05f, 7.828974776e-05f, -1.063810560e-04f,
+  9.821057756e-05f, -8.646022616e-05f, -7.052683941e-05f, -2.551976359e-04f,
+  2.755743044e-04f, 9.090351523e-05f, 1.068369020e-04f, -7.783390174e-05f,
+  1.267577318e-04f, -5.791307194e-05f, -4.197968519e-05f, -2.266504889e-04f,
+  1.508921414e-04f, -3.377865505e-05f, -1.784526648e-05f, -2.025160647e-04f,
+  2.075561270e-06f, -1.825952349e-04f, -1.666618482e-04f, -3.513326519e-04f,
+  3.087011282e-04f, 1.240303245e-04f, 1.399637113e-04f, -4.470709246e-05f,
+  1.598845411e-04f, -2.478626266e-05f, -8.852875908e-06f, -1.935236796e-04f,
+  1.840189507e-04f, -6.518440614e-07f, 1.528154280e-05f, -1.693892555e-04f,
+  3.520237078e-05f, -1.494684257e-04f, -1.335350389e-04f, -3.182058572e-04f,
+  2.125661122e-04f, 2.789530845e-05f, 4.382869520e-05f, -1.408421085e-04f,
+  6.374952500e-05f, -1.209212787e-04f, -1.049878920e-04f, -2.896586957e-04f,
+  8.788394189e-05f, -9.678686183e-05f, -8.085347508e-05f, -2.655242861e-04f,
+  -6.093264528e-05f, -2.456034417e-04f, -2.296700550e-04f, -4.143408732e-04f,
+  4.143408732e-04f, 2.296700550e-04f, 2.456034417e-04f, 6.093264528e-05f,
+  2.655242861e-04f, 8.085347508e-05f, 9.678686183e-05f, -8.788394189e-05f,
+  2.896586957e-04f, 1.049878920e-04f, 1.209212787e-04f, -6.374952500e-05f,
+  1.408421085e-04f, -4.382869520e-05f, -2.789530845e-05f, -2.125661122e-04f,
+  3.182058572e-04f, 1.335350389e-04f, 1.494684257e-04f, -3.520237078e-05f,
+  1.693892555e-04f, -1.528154280e-05f, 6.518440614e-07f, -1.840189507e-04f,
+  1.935236796e-04f, 8.852875908e-06f, 2.478626266e-05f, -1.598845411e-04f,
+  4.470709246e-05f, -1.399637113e-04f, -1.240303245e-04f, -3.087011282e-04f,
+  3.513326519e-04f, 1.666618482e-04f, 1.825952349e-04f, -2.075561270e-06f,
+  2.025160647e-04f, 1.784526648e-05f, 3.377865505e-05f, -1.508921414e-04f,
+  2.266504889e-04f, 4.197968519e-05f, 5.791307194e-05f, -1.267577318e-04f,
+  7.783390174e-05f, -1.068369020e-04f, -9.090351523e-05f, -2.755743044e-04f,
+  2.551976359e-04f, 7.052683941e-05f, 8.646022616e-05f, -9.821057756e-05f,
+  1.063810560e-04f, -7.828974776e-05f, -6.235636101e-05f, -2.470271720e-04f,
+  1.305154728e-04f, -5.415533087e-05f, -3.822194412e-05f, -2.228927478e-04f,
+  -1.830111432e-05f, -2.029719180e-04f, -1.870385313e-04f, -3.717093205e-04f,
+  3.891685337e-04f, 2.044977300e-04f, 2.204311168e-04f, 3.576031668e-05f,
+  2.403519466e-04f, 5.568114284e-05f, 7.161452959e-05f, -1.130562669e-04f,
+  2.644863562e-04f, 7.981556701e-05f, 9.574895375e-05f, -8.892184997e-05f,
+  1.156697763e-04f, -6.900102017e-05f, -5.306763705e-05f, -2.377384371e-04f,
+  2.930335177e-04f, 1.083627139e-04f, 1.242961007e-04f, -6.037469939e-05f,
+  1.442169305e-04f, -4.045386959e-05f, -2.452048284e-05f, -2.091912902e-04f,
+  1.683513547e-04f, -1.631945088e-05f, -3.860644995e-07f, -1.850568660e-04f,
+  1.953476385e-05f, -1.651360362e-04f, -1.492026495e-04f, -3.338734386e-04f,
+  3.261603124e-04f, 1.414895232e-04f, 1.574229100e-04f, -2.724788828e-05f,
+  1.773437398e-04f, -7.327061212e-06f, 8.606325537e-06f, -1.760644809e-04f,
+  2.014781639e-04f, 1.680735841e-05f, 3.274074334e-05f, -1.519300567e-04f,
+  5.266157314e-05f, -1.320092269e-04f, -1.160758402e-04f, -3.007466439e-04f,
+  2.300253109e-04f, 4.535451080e-05f, 6.128789391e-05f, -1.233829098e-04f,
+  8.120872371e-05f, -1.034620727e-04f, -8.752868598e-05f, -2.721994824e-04f,
+  1.053431406e-04f, -7.932765584e-05f, -6.339426909e-05f, -2.480650728e-04f,
+  -4.347344293e-05f, -2.281442430e-04f, -2.122108563e-04f, -3.968816600e-04f
+},
+{
+  -1.117888489e-03f, -1.052963547e-03f, -1.000678632e-03f, -9.357537492e-04f,
+  -9.436472901e-04f, -8.787224069e-04f, -8.264373755e-04f, -7.615125505e-04f,
+  -8.820056100e-04f, -8.170807851e-04f, -7.647957536e-04f, -6.998708704e-04f,
+  -7.077644696e-04f, -6.428395864e-04f, -5.905545549e-04f, -5.256297300e-04f,
+  -8.159569697e-04f, -7.510320866e-04f, -6.987471133e-04f, -6.338222302e-04f,
+  -6.417157711e-04f, -5.767909461e-04f, -5.245059147e-04f, -4.595810606e-04f,
+  -5.800741492e-04f, -5.151492660e-04f, -4.628642928e-04f, -3.979394096e-04f,
+  -4.058329796e-04f, -3.409080964e-04f, -2.886230941e-04f, -2.236982400e-04f,
+  -7.457758766e-04f, -6.808510516e-04f, -6.285660202e-04f, -5.636411370e-04f,
+  -5.715347361e-04f, -5.066098529e-04f, -4.543248506e-04f, -3.893999674e-04f,
+  -5.098930560e-04f, -4.449682019e-04f, -3.926831996e-04f, -3.277583455e-04f,
+  -3.356518864e-04f, -2.707270323e-04f, -2.184420155e-04f, -1.535171614e-04f,
+  -4.438444157e-04f, -3.789195616e-04f, -3.266345593e-04f, -2.617096761e-04f,
+  -2.696032170e-04f, -2.046783629e-04f, -1.523933606e-04f, -8.746849926e-05f,
+  -2.079615952e-04f, -1.430367265e-04f, -9.075172420e-05f, -2.582686102e-05f,
+  -3.372040737e-05f, 3.120445763e-05f, 8.348945994e-05f, 1.484143286e-04f,
+  -6.718116347e-04f, -6.068868097e-04f, -5.546017783e-04f, -4.896769533e-04f,
+  -4.975704942e-04f, -4.326456110e-04f, -3.803606087e-04f, -3.154357546e-04f,
+  -4.359288432e-04f, -3.710039891e-04f, -3.187189577e-04f, -2.537941036e-04f,
+  -2.616876445e-04f, -1.967627904e-04f, -1.444777881e-04f, -7.955292676e-05f,
+  -3.698801738e-04f, -3.049553197e-04f, -2.526703174e-04f, -1.877454488e-04f,
+  -1.956390042e-04f, -1.307141356e-04f, -7.842913328e-05f, -1.350427283e-05f,
+  -1.339973533e-04f, -6.907249917e-05f, -1.678749322e-05f, 4.813736814e-05f,
+  4.024382361e-05f, 1.051686850e-04f, 1.574536873e-04f, 2.223785559e-04f,
+  -2.996991097e-04f, -2.347742411e-04f, -1.824892388e-04f, -1.175643702e-04f,
+  -1.254579256e-04f, -6.053305697e-05f, -8.248051927e-06f, 5.667681035e-05f,
+  -6.381627463e-05f, 1.108585366e-06f, 5.339358904e-05f, 1.183184504e-04f,
+  1.104249022e-04f, 1.753497636e-04f, 2.276347659e-04f, 2.925596200e-04f,
+  2.232375891e-06f, 6.715724157e-05f, 1.194422439e-04f, 1.843671052e-04f,
+  1.764735644e-04f, 2.413984184e-04f, 2.936834353e-04f, 3.586082894e-04f,
+  2.381152008e-04f, 3.030400549e-04f, 3.553250572e-04f, 4.202499404e-04f,
+  4.123563704e-04f, 4.772812536e-04f, 5.295662559e-04f, 5.944911391e-04f,
+  -5.944911391e-04f, -5.295662559e-04f, -4.772812536e-04f, -4.123563704e-04f,
+  -4.202499404e-04f, -3.553250572e-04f, -3.030400549e-04f, -2.381152008e-04f,
+  -3.586082894e-04f, -2.936834353e-04f, -2.413984184e-04f, -1.764735644e-04f,
+  -1.843671052e-04f, -1.194422439e-04f, -6.715724157e-05f, -2.232375891e-06f,
+  -2.925596200e-04f, -2.276347659e-04f, -1.753497636e-04f, -1.104249022e-04f,
+  -1.183184504e-04f, -5.339358904e-05f, -1.108585366e-06f, 6.381627463e-05f,
+  -5.667681035e-05f, 8.248051927e-06f, 6.053305697e-05f, 1.254579256e-04f,
+  1.175643702e-04f, 1.824892388e-04f, 2.347742411e-04f, 2.996991097e-04f,
+  -2.223785559e-04f, -1.574536873e-04f, -1.051686850e-04f, -4.024382361e-05f,
+  -4.813736814e-05f, 1.678749322e-05f, 6.907249917e-05f, 1.339973533e-04f,
+  1.350427283e-05f, 7.842913328e-05f, 1.307141356e-04f, 1.956390042e-04f,
+  1.877454488e-04f, 2.526703174e-04f, 3.049553197e-04f, 3.698801738e-04f,
+  7.955292676e-05f, 1.444777881e-04f, 1.967627904e-04f, 2.616876445e-04f,
+  2.537941036e-04f, 3.187189577e-04f, 3.710039891e-04f, 4.359288432e-04f,
+  3.154357546e-04f, 3.803606087e-04f, 4.326456110e-04f, 4.975704942e-04f,
+  4.896769533e-04f, 5.546017783e-04f, 6.068868097e-04f, 6.718116347e-04f,
+  -1.484143286e-04f, -8.348945994e-05f, -3.120445763e-05f, 3.372040737e-05f,
+  2.582686102e-05f, 9.075172420e-05f, 1.430367265e-04f, 2.079615952e-04f,
+  8.746849926e-05f, 1.523933606e-04f, 2.046783629e-04f, 2.696032170e-04f,
+  2.617096761e-04f, 3.266345593e-04f, 3.789195616e-04f, 4.438444157e-04f,
+  1.535171614e-04f, 2.184420155e-04f, 2.707270323e-04f, 3.356518864e-04f,
+  3.277583455e-04f, 3.926831996e-04f, 4.449682019e-04f, 5.098930560e-04f,
+  3.893999674e-04f, 4.543248506e-04f, 5.066098529e-04f, 5.715347361e-04f,
+  5.636411370e-04f, 6.285660202e-04f, 6.808510516e-04f, 7.457758766e-04f,
+  2.236982400e-04f, 2.886230941e-04f, 3.409080964e-04f, 4.058329796e-04f,
+  3.979394096e-04f, 4.628642928e-04f, 5.151492660e-04f, 5.800741492e-04f,
+  4.595810606e-04f, 5.245059147e-04f, 5.767909461e-04f, 6.417157711e-04f,
+  6.338222302e-04f, 6.987471133e-04f, 7.510320866e-04f, 8.159569697e-04f,
+  5.256297300e-04f, 5.905545549e-04f, 6.428395864e-04f, 7.077644696e-04f,
+  6.998708704e-04f, 7.647957536e-04f, 8.170807851e-04f, 8.820056100e-04f,
+  7.615125505e-04f, 8.264373755e-04f, 8.787224069e-04f, 9.436472901e-04f,
+  9.357537492e-04f, 1.000678632e-03f, 1.052963547e-03f, 1.117888489e-03f
+},
+{
+  -3.584440565e-03f, -2.980872989e-03f, -2.898440463e-03f, -2.294872887e-03f,
+  -2.814415377e-03f, -2.210847568e-03f, -2.128415043e-03f, -1.524847466e-03f,
+  -2.729548141e-03f, -2.125980332e-03f, -2.043547807e-03f, -1.439980231e-03f,
+  -1.959522720e-03f, -1.355955028e-03f, -1.273522503e-03f, -6.699548685e-04f,
+  -2.644669497e-03f, -2.041101921e-03f, -1.958669396e-03f, -1.355101820e-03f,
+  -1.874644193e-03f, -1.271076617e-03f, -1.188644092e-03f, -5.850764574e-04f,
+  -1.789776958e-03f, -1.186209382e-03f, -1.103776856e-03f, -5.002091639e-04f,
+  -1.019751653e-03f, -4.161839606e-04f, -3.337514936e-04f, 2.698161697e-04f,
+  -2.560688648e-03f, -1.957120840e-03f, -1.874688431e-03f, -1.271120855e-03f,
+  -1.790663227e-03f, -1.187095535e-03f, -1.104663126e-03f, -5.010954337e-04f,
+  -1.705795992e-03f, -1.102228300e-03f, -1.019795891e-03f, -4.162281984e-04f,
+  -9.357706294e-04f, -3.322029661e-04f, -2.497704991e-04f, 3.537971643e-04f,
+  -1.620917581e-03f, -1.017349889e-03f, -9.349174215e-04f, -3.313497582e-04f,
+  -8.508922183e-04f, -2.473245258e-04f, -1.648920734e-04f, 4.386756045e-04f,
+  -7.660249830e-04f, -1.624572906e-04f, -8.002482355e-05f, 5.235428689e-04f,
+  4.000401532e-06f, 6.075680722e-04f, 6.900005392e-04f, 1.293568173e-03f,
+  -2.478588140e-03f, -1.875020331e-03f, -1.792587922e-03f, -1.189020230e-03f,
+  -1.708562719e-03f, -1.104995026e-03f, -1.022562617e-03f, -4.189948959e-04f,
+  -1.623695483e-03f, -1.020127791e-03f, -9.376953240e-04f, -3.341276315e-04f,
+  -8.536700625e-04f, -2.501023991e-04f, -1.676699467e-04f, 4.358977312e-04f,
+  -1.538817072e-03f, -9.352493216e-04f, -8.528168546e-04f, -2.492492204e-04f,
+  -7.687916514e-04f, -1.652239735e-04f, -8.279152098e-05f, 5.207761424e-04f,
+  -6.839244161e-04f, -8.035673090e-05f, 2.075731118e-06f, 6.056433776e-04f,
+  8.610096120e-05f, 6.896686391e-04f, 7.721011061e-04f, 1.375668799e-03f,
+  -1.454835990e-03f, -8.512683562e-04f, -7.688358892e-04f, -1.652682113e-04f,
+  -6.848106859e-04f, -8.124298620e-05f, 1.189476620e-06f, 6.047571660e-04f,
+  -5.999433924e-04f, 3.624263854e-06f, 8.605672338e-05f, 6.896244013e-04f,
+  1.700819557e-04f, 7.736496045e-04f, 8.560820716e-04f, 1.459649764e-03f,
+  -5.150649813e-04f, 8.850269660e-05f, 1.709351491e-04f, 7.745028124e-04f,
+  2.549603814e-04f, 8.585280739e-04f, 9.409605409e-04f, 1.544528175e-03f,
+  3.398276458e-04f, 9.433953092e-04f, 1.025827718e-03f, 1.629395410e-03f,
+  1.109853038e-03f, 1.713420614e-03f, 1.795853139e-03f, 2.399420831e-03f,
+  -2.399420831e-03f, -1.795853139e-03f, -1.713420614e-03f, -1.109853038e-03f,
+  -1.629395410e-03f, -1.025827718e-03f, -9.433953092e-04f, -3.398276458e-04f,
+  -1.544528175e-03f, -9.409605409e-04f, -8.585280739e-04f, -2.549603814e-04f,
+  -7.745028124e-04f, -1.709351491e-04f, -8.850269660e-05f, 5.150649813e-04f,
+  -1.459649764e-03f, -8.560820716e-04f, -7.736496045e-04f, -1.700819557e-04f,
+  -6.896244013e-04f, -8.605672338e-05f, -3.624263854e-06f, 5.999433924e-04f,
+  -6.047571660e-04f, -1.189476620e-06f, 8.124298620e-05f, 6.848106859e-04f,
+  1.652682113e-04f, 7.688358892e-04f, 8.512683562e-04f, 1.454835990e-03f,
+  -1.375668799e-03f, -7.721011061e-04f, -6.896686391e-04f, -8.610096120e-05f,
+  -6.056433776e-04f, -2.075731118e-06f, 8.035673090e-05f, 6.839244161e-04f,
+  -5.207761424e-04f, 8.279152098e-05f, 1.652239735e-04f, 7.687916514e-04f,
+  2.492492204e-04f, 8.528168546e-04f, 9.352493216e-04f, 1.538817072e-03f,
+  -4.358977312e-04f, 1.676699467e-04f, 2.501023991e-04f, 8.536700625e-04f,
+  3.341276315e-04f, 9.376953240e-04f, 1.020127791e-03f, 1.623695483e-03f,
+  4.189948959e-04f, 1.022562617e-03f, 1.104995026e-03f, 1.708562719e-03f,
+  1.189020230e-03f, 1.792587922e-03f, 1.875020331e-03f, 2.478588140e-03f,
+  -1.293568173e-03f, -6.900005392e-04f, -6.075680722e-04f, -4.000401532e-06f,
+  -5.235428689e-04f, 8.002482355e-05f, 1.624572906e-04f, 7.660249830e-04f,
+  -4.386756045e-04f, 1.648920734e-04f, 2.473245258e-04f, 8.508922183e-04f,
+  3.313497582e-04f, 9.349174215e-04f, 1.017349889e-03f, 1.620917581e-03f,
+  -3.537971643e-04f, 2.497704991e-04f, 3.322029661e-04f, 9.357706294e-04f,
+  4.162281984e-04f, 1.019795891e-03f, 1.102228300e-03f, 1.705795992e-03f,
+  5.010954337e-04f, 1.104663126e-03f, 1.187095535e-03f, 1.790663227e-03f,
+  1.271120855e-03f, 1.874688431e-03f, 1.957120840e-03f, 2.560688648e-03f,
+  -2.698161697e-04f, 3.337514936e-04f, 4.161839606e-04f, 1.019751653e-03f,
+  5.002091639e-04f, 1.103776856e-03f, 1.186209382e-03f, 1.789776958e-03f,
+  5.850764574e-04f, 1.188644092e-03f, 1.271076617e-03f, 1.874644193e-03f,
+  1.355101820e-03f, 1.958669396e-03f, 2.041101921e-03f, 2.644669497e-03f,
+  6.699548685e-04f, 1.273522503e-03f, 1.355955028e-03f, 1.959522720e-03f,
+  1.439980231e-03f, 2.043547807e-03f, 2.125980332e-03f, 2.729548141e-03f,
+  1.524847466e-03f, 2.128415043e-03f, 2.210847568e-03f, 2.814415377e-03f,
+  2.294872887e-03f, 2.898440463e-03f, 2.980872989e-03f, 3.584440565e-03f
+},
+{
+  -5.793572403e-03f, -4.533435684e-03f, -4.463543650e-03f, -3.203406930e-03f,
+  -4.400100093e-03f, -3.139963141e-03f, -3.070071107e-03f, -1.809934387e-03f,
+  -4.344368819e-03f, -3.084232099e-03f, -3.014340065e-03f, -1.754203346e-03f,
+  -2.950896509e-03f, -1.690759789e-03f, -1.620867639e-03f, -3.607309191e-04f,
+  -4.297643900e-03f, -3.037507180e-03f, -2.967614913e-03f, -1.707478310e-03f,
+  -2.904171357e-03f, -1.644034637e-03f, -1.574142603e-03f, -3.140058543e-04f,
+  -2.848440316e-03f, -1.588303596e-03f, -1.518411445e-03f, -2.582747256e-04f,
+  -1.454967889e-03f, -1.948311692e-04f, -1.249390771e-04f, 1.135197701e-03f,
+  -4.261236638e-03f, -3.001100151e-03f, -2.931207884e-03f, -1.671071281e-03f,
+  -2.867764328e-03f, -1.607627724e-03f, -1.537735574e-03f, -2.775988833e-04f,
+  -2.812033286e-03f, -1.551896567e-03f, -1.482004533e-03f, -2.218677400e-04f,
+  -1.418560976e-03f, -1.584241836e-04f, -8.853208419e-05f, 1.171604614e-03f,
+  -2.765308367e-03f, -1.505171531e-03f, -1.435279381e-03f, -1.751427044e-04f,
+  -1.371835824e-03f, -1.116991407e-04f, -4.180704491e-05f, 1.218329649e-03f,
+  -1.316104783e-03f, -5.596801202e-05f, 1.392408558e-05f, 1.274060807e-03f,
+  7.736764383e-05f, 1.337504364e-03f, 1.407396514e-03f, 2.667533234e-03f,
+  -4.236465786e-03f, -2.976328833e-03f, -2.906436799e-03f, -1.646300079e-03f,
+  -2.842993243e-03f, -1.582856523e-03f, -1.512964373e-03f, -2.528276527e-04f,
+  -2.787261968e-03f, -1.527125365e-03f, -1.457233215e-03f, -1.970965095e-04f,
+  -1.393789658e-03f, -1.336529531e-04f, -6.376085366e-05f, 1.196375932e-03f,
+  -2.740537049e-03f, -1.480400329e-03f, -1.410508179e-03f, -1.503714739e-04f,
+  -1.347064623e-03f, -8.692791016e-05f, -1.703581074e-05f, 1.243100967e-03f,
+  -1.291333465e-03f, -3.119677785e-05f, 3.869532156e-05f, 1.298832009e-03f,
+  1.021388744e-04f, 1.362275565e-03f, 1.432167715e-03f, 2.692304552e-03f,
+  -2.704130020e-03f, -1.443993300e-03f, -1.374101266e-03f, -1.139644737e-04f,
+  -1.310657710e-03f, -5.052092092e-05f, 1.937117850e-05f, 1.279507880e-03f,
+  -1.254926552e-03f, 5.210211839e-06f, 7.510231080e-05f, 1.335239038e-03f,
+  1.385458745e-04f, 1.398682594e-03f, 1.468574745e-03f, 2.728711348e-03f,
+  -1.208201516e-03f, 5.193525431e-05f, 1.218273537e-04f, 1.381964074e-03f,
+  1.852709102e-04f, 1.445407630e-03f, 1.515299780e-03f, 2.775436500e-03f,
+  2.410020388e-04f, 1.501138788e-03f, 1.571030822e-03f, 2.831167541e-03f,
+  1.634474378e-03f, 2.894611098e-03f, 2.964503365e-03f, 4.224639852e-03f,
+  -4.224639852e-03f, -2.964503365e-03f, -2.894611098e-03f, -1.634474378e-03f,
+  -2.831167541e-03f, -1.571030822e-03f, -1.501138788e-03f, -2.410020388e-04f,
+  -2.775436500e-03f, -1.515299780e-03f, -1.445407630e-03f, -1.852709102e-04f,
+  -1.381964074e-03f, -1.218273537e-04f, -5.193525431e-05f, 1.208201516e-03f,
+  -2.728711348e-03f, -1.468574745e-03f, -1.398682594e-03f, -1.385458745e-04f,
+  -1.335239038e-03f, -7.510231080e-05f, -5.210211839e-06f, 1.254926552e-03f,
+  -1.279507880e-03f, -1.937117850e-05f, 5.052092092e-05f, 1.310657710e-03f,
+  1.139644737e-04f, 1.374101266e-03f, 1.443993300e-03f, 2.704130020e-03f,
+  -2.692304552e-03f, -1.432167715e-03f, -1.362275565e-03f, -1.021388744e-04f,
+  -1.298832009e-03f, -3.869532156e-05f, 3.119677785e-05f, 1.291333465e-03f,
+  -1.243100967e-03f, 1.703581074e-05f, 8.692791016e-05f, 1.347064623e-03f,
+  1.503714739e-04f, 1.410508179e-03f, 1.480400329e-03f, 2.740537049e-03f,
+  -1.196375932e-03f, 6.376085366e-05f, 1.336529531e-04f, 1.393789658e-03f,
+  1.970965095e-04f, 1.457233215e-03f, 1.527125365e-03f, 2.787261968e-03f,
+  2.528276527e-04f, 1.512964373e-03f, 1.582856523e-03f, 2.842993243e-03f,
+  1.646300079e-03f, 2.906436799e-03f, 2.976328833e-03f, 4.236465786e-03f,
+  -2.667533234e-03f, -1.407396514e-03f, -1.337504364e-03f, -7.736764383e-05f,
+  -1.274060807e-03f, -1.392408558e-05f, 5.596801202e-05f, 1.316104783e-03f,
+  -1.218329649e-03f, 4.180704491e-05f, 1.116991407e-04f, 1.371835824e-03f,
+  1.751427044e-04f, 1.435279381e-03f, 1.505171531e-03f, 2.765308367e-03f,
+  -1.171604614e-03f, 8.853208419e-05f, 1.584241836e-04f, 1.418560976e-03f,
+  2.218677400e-04f, 1.482004533e-03f, 1.551896567e-03f, 2.812033286e-03f,
+  2.775988833e-04f, 1.537735574e-03f, 1.607627724e-03f, 2.867764328e-03f,
+  1.671071281e-03f, 2.931207884e-03f, 3.001100151e-03f, 4.261236638e-03f,
+  -1.135197701e-03f, 1.249390771e-04f, 1.948311692e-04f, 1.454967889e-03f,
+  2.582747256e-04f, 1.518411445e-03f, 1.588303596e-03f, 2.848440316e-03f,
+  3.140058543e-04f, 1.574142603e-03f, 1.644034637e-03f, 2.904171357e-03f,
+  1.707478310e-03f, 2.967614913e-03f, 3.037507180e-03f, 4.297643900e-03f,
+  3.607309191e-04f, 1.620867639e-03f, 1.690759789e-03f, 2.950896509e-03f,
+  1.754203346e-03f, 3.014340065e-03f, 3.084232099e-03f, 4.344368819e-03f,
+  1.809934387e-03f, 3.070071107e-03f, 3.139963141e-03f, 4.400100093e-03f,
+  3.203406930e-03f, 4.463543650e-03f, 4.533435684e-03f, 5.793572403e-03f
+},
+{
+  -5.511906929e-03f, -3.945382312e-03f, -3.963272553e-03f, -2.396747936e-03f,
+  -3.997842781e-03f, -2.431317931e-03f, -2.449208638e-03f, -8.826837293e-04f,
+  -4.050217569e-03f, -2.483692719e-03f, -2.501583425e-03f, -9.350586333e-04f,
+  -2.536153421e-03f, -9.696285124e-04f, -9.875191608e-04f, 5.790056312e-04f,
+  -4.121435806e-03f, -2.554910723e-03f, -2.572801430e-03f, -1.006276696e-03f,
+  -2.607371425e-03f, -1.040846575e-03f, -1.058737165e-03f, 5.077875685e-04f,
+  -2.659746213e-03f, -1.093221363e-03f, -1.111112069e-03f, 4.554127227e-04f,
+  -1.145681948e-03f, 4.208428145e-04f, 4.029521369e-04f, 1.969476929e-03f,
+  -4.212429747e-03f, -2.645905130e-03f, -2.663795836e-03f, -1.097270986e-03f,
+  -2.698365599e-03f, -1.131840865e-03f, -1.149731572e-03f, 4.167932202e-04f,
+  -2.750740619e-03f, -1.184215769e-03f, -1.202106476e-03f, 3.644183453e-04f,
+  -1.236676355e-03f, 3.298484371e-04f, 3.119577887e-04f, 1.878482522e-03f,
+  -2.821958624e-03f, -1.255433774e-03f, -1.273324480e-03f, 2.932003117e-04f,
+  -1.307894359e-03f, 2.586304036e-04f, 2.407397405e-04f, 1.807264518e-03f,
+  -1.360269263e-03f, 2.062555432e-04f, 1.883648802e-04f, 1.754889730e-03f,
+  1.537949720e-04f, 1.720319735e-03f, 1.702429145e-03f, 3.268953878e-03f,
+  -4.324011039e-03f, -2.757486422e-03f, -2.775377128e-03f, -1.208852278e-03f,
+  -2.809946891e-03f, -1.243422157e-03f, -1.261312864e-03f, 3.052119573e-04f,
+  -2.862321911e-03f, -1.295797061e-03f, -1.313687651e-03f, 2.528371115e-04f,
+  -1.348257647e-03f, 2.182672033e-04f, 2.003765403e-04f, 1.766901347e-03f,
+  -2.933539916e-03f, -1.367015066e-03f, -1.384905772e-03f, 1.816190634e-04f,
+  -1.419475651e-03f, 1.470491698e-04f, 1.291585068e-04f, 1.695683342e-03f,
+  -1.471850555e-03f, 9.467430209e-05f, 7.678363181e-05f, 1.643308438e-03f,
+  4.221373456e-05f, 1.608738559e-03f, 1.590847853e-03f, 3.157372586e-03f,
+  -3.024534322e-03f, -1.458009472e-03f, -1.475900062e-03f, 9.062470053e-05f,
+  -1.510469941e-03f, 5.605480328e-05f, 3.816413664e-05f, 1.604688936e-03f,
+  -1.562844845e-03f, 3.679931751e-06f, -1.421073466e-05f, 1.552314032e-03f,
+  -4.878063191e-05f, 1.517744153e-03f, 1.499853446e-03f, 3.066378180e-03f,
+  -1.634062850e-03f, -6.753810158e-05f, -8.542876458e-05f, 1.481096027e-03f,
+  -1.199986655e-04f, 1.446526148e-03f, 1.428635442e-03f, 2.995160175e-03f,
+  -1.723735331e-04f, 1.394151244e-03f, 1.376260538e-03f, 2.942785388e-03f,
+  1.341690659e-03f, 2.908215392e-03f, 2.890324919e-03f, 4.456849769e-03f,
+  -4.456849769e-03f, -2.890324919e-03f, -2.908215392e-03f, -1.341690659e-03f,
+  -2.942785388e-03f, -1.376260538e-03f, -1.394151244e-03f, 1.723735331e-04f,
+  -2.995160175e-03f, -1.428635442e-03f, -1.446526148e-03f, 1.199986655e-04f,
+  -1.481096027e-03f, 8.542876458e-05f, 6.753810158e-05f, 1.634062850e-03f,
+  -3.066378180e-03f, -1.499853446e-03f, -1.517744153e-03f, 4.878063191e-05f,
+  -1.552314032e-03f, 1.421073466e-05f, -3.679931751e-06f, 1.562844845e-03f,
+  -1.604688936e-03f, -3.816413664e-05f, -5.605480328e-05f, 1.510469941e-03f,
+  -9.062470053e-05f, 1.475900062e-03f, 1.458009472e-03f, 3.024534322e-03f,
+  -3.157372586e-03f, -1.590847853e-03f, -1.608738559e-03f, -4.221373456e-05f,
+  -1.643308438e-03f, -7.678363181e-05f, -9.467430209e-05f, 1.471850555e-03f,
+  -1.695683342e-03f, -1.291585068e-04f, -1.470491698e-04f, 1.419475651e-03f,
+  -1.816190634e-04f, 1.384905772e-03f, 1.367015066e-03f, 2.933539916e-03f,
+  -1.766901347e-03f, -2.003765403e-04f, -2.182672033e-04f, 1.348257647e-03f,
+  -2.528371115e-04f, 1.313687651e-03f, 1.295797061e-03f, 2.862321911e-03f,
+  -3.052119573e-04f, 1.261312864e-03f, 1.243422157e-03f, 2.809946891e-03f,
+  1.208852278e-03f, 2.775377128e-03f, 2.757486422e-03f, 4.324011039e-03f,
+  -3.268953878e-03f, -1.702429145e-03f, -1.720319735e-03f, -1.537949720e-04f,
+  -1.754889730e-03f, -1.883648802e-04f, -2.062555432e-04f, 1.360269263e-03f,
+  -1.807264518e-03f, -2.407397405e-04f, -2.586304036e-04f, 1.307894359e-03f,
+  -2.932003117e-04f, 1.273324480e-03f, 1.255433774e-03f, 2.821958624e-03f,
+  -1.878482522e-03f, -3.119577887e-04f, -3.298484371e-04f, 1.236676355e-03f,
+  -3.644183453e-04f, 1.202106476e-03f, 1.184215769e-03f, 2.750740619e-03f,
+  -4.167932202e-04f, 1.149731572e-03f, 1.131840865e-03f, 2.698365599e-03f,
+  1.097270986e-03f, 2.663795836e-03f, 2.645905130e-03f, 4.212429747e-03f,
+  -1.969476929e-03f, -4.029521369e-04f, -4.208428145e-04f, 1.145681948e-03f,
+  -4.554127227e-04f, 1.111112069e-03f, 1.093221363e-03f, 2.659746213e-03f,
+  -5.077875685e-04f, 1.058737165e-03f, 1.040846575e-03f, 2.607371425e-03f,
+  1.006276696e-03f, 2.572801430e-03f, 2.554910723e-03f, 4.121435806e-03f,
+  -5.790056312e-04f, 9.875191608e-04f, 9.696285124e-04f, 2.536153421e-03f,
+  9.350586333e-04f, 2.501583425e-03f, 2.483692719e-03f, 4.050217569e-03f,
+  8.826837293e-04f, 2.449208638e-03f, 2.431317931e-03f, 3.997842781e-03f,
+  2.396747936e-03f, 3.963272553e-03f, 3.945382312e-03f, 5.511906929e-03f
+},
+{
+  -5.130842328e-04f, 3.873647365e-04f, 2.106484317e-04f, 1.111097401e-03f,
+  1.167704067e-05f, 9.121259791e-04f, 7.354096742e-04f, 1.635858673e-03f,
+  -2.094898955e-04f, 6.909590447e-04f, 5.142427399e-04f, 1.414691680e-03f,
+  3.152713471e-04f, 1.215720316e-03f, 1.039003953e-03f, 1.939452952e-03f,
+  -4.525716649e-04f, 4.478773044e-04f, 2.711609704e-04f, 1.171609969e-03f,
+  7.218958490e-05f, 9.726385470e-04f, 7.959222421e-04f, 1.696371124e-03f,
+  -1.489773567e-04f, 7.514716126e-04f, 5.747553078e-04f, 1.475204248e-03f,
+  3.757838858e-04f, 1.276232884e-03f, 1.099516521e-03f, 1.999965403e-03f,
+  -7.170528988e-04f, 1.833960414e-04f, 6.679729722e-06f, 9.071286768e-04f,
+  -1.922916563e-04f, 7.081573131e-04f, 5.314409500e-04f, 1.431889948e-03f,
+  -4.134585906e-04f, 4.869903496e-04f, 3.102740448e-04f, 1.210722956e-03f,
+  1.113026447e-04f, 1.011751592e-03f, 8.350352873e-04f, 1.735484228e-03f,
+  -6.565403892e-04f, 2.439085947e-04f, 6.719227531e-05f, 9.676412446e-04f,
+  -1.317791175e-04f, 7.686698227e-04f, 5.919535179e-04f, 1.492402516e-03f,
+  -3.529460519e-04f, 5.475028884e-04f, 3.707865835e-04f, 1.271235524e-03f,
+  1.718151907e-04f, 1.072264160e-03f, 8.955478552e-04f, 1.795996795e-03f,
+  -1.002171775e-03f, -1.017227769e-04f, -2.784390817e-04f, 6.220098585e-04f,
+  -4.774104746e-04f, 4.230384657e-04f, 2.463221608e-04f, 1.146771130e-03f,
+  -6.985774380e-04f, 2.018715313e-04f, 2.515521373e-05f, 9.256041958e-04f,
+  -1.738161809e-04f, 7.266327739e-04f, 5.499164690e-04f, 1.450365409e-03f,
+  -9.416592075e-04f, -4.121023085e-05f, -2.179265430e-04f, 6.825224264e-04f,
+  -4.168979358e-04f, 4.835510044e-04f, 3.068346996e-04f, 1.207283698e-03f,
+  -6.380648701e-04f, 2.623840701e-04f, 8.566775796e-05f, 9.861167055e-04f,
+  -1.133036276e-04f, 7.871453417e-04f, 6.104289787e-04f, 1.510877977e-03f,
+  -1.206140383e-03f, -3.056914720e-04f, -4.824078060e-04f, 4.180411634e-04f,
+  -6.813791697e-04f, 2.190697705e-04f, 4.235345114e-05f, 9.428024059e-04f,
+  -9.025461040e-04f, -2.097171091e-06f, -1.788134832e-04f, 7.216354716e-04f,
+  -3.777848906e-04f, 5.226640496e-04f, 3.459477739e-04f, 1.246396685e-03f,
+  -1.145627932e-03f, -2.451789333e-04f, -4.218952381e-04f, 4.785537021e-04f,
+  -6.208666600e-04f, 2.795823093e-04f, 1.028659972e-04f, 1.003314974e-03f,
+  -8.420335944e-04f, 5.841537495e-05f, -1.183009445e-04f, 7.821480394e-04f,
+  -3.172723227e-04f, 5.831766175e-04f, 4.064603127e-04f, 1.306909253e-03f,
+  -1.306909253e-03f, -4.064603127e-04f, -5.831766175e-04f, 3.172723227e-04f,
+  -7.821480394e-04f, 1.183009445e-04f, -5.841537495e-05f, 8.420335944e-04f,
+  -1.003314974e-03f, -1.028659972e-04f, -2.795823093e-04f, 6.208666600e-04f,
+  -4.785537021e-04f, 4.218952381e-04f, 2.451789333e-04f, 1.145627932e-03f,
+  -1.246396685e-03f, -3.459477739e-04f, -5.226640496e-04f, 3.777848906e-04f,
+  -7.216354716e-04f, 1.788134832e-04f, 2.097171091e-06f, 9.025461040e-04f,
+  -9.428024059e-04f, -4.235345114e-05f, -2.190697705e-04f, 6.813791697e-04f,
+  -4.180411634e-04f, 4.824078060e-04f, 3.056914720e-04f, 1.206140383e-03f,
+  -1.510877977e-03f, -6.104289787e-04f, -7.871453417e-04f, 1.133036276e-04f,
+  -9.861167055e-04f, -8.566775796e-05f, -2.623840701e-04f, 6.380648701e-04f,
+  -1.207283698e-03f, -3.068346996e-04f, -4.835510044e-04f, 4.168979358e-04f,
+  -6.825224264e-04f, 2.179265430e-04f, 4.121023085e-05f, 9.416592075e-04f,
+  -1.450365409e-03f, -5.499164690e-04f, -7.266327739e-04f, 1.738161809e-04f,
+  -9.256041958e-04f, -2.515521373e-05f, -2.018715313e-04f, 6.985774380e-04f,
+  -1.146771130e-03f, -2.463221608e-04f, -4.230384657e-04f, 4.774104746e-04f,
+  -6.220098585e-04f, 2.784390817e-04f, 1.017227769e-04f, 1.002171775e-03f,
+  -1.795996795e-03f, -8.955478552e-04f, -1.072264160e-03f, -1.718151907e-04f,
+  -1.271235524e-03f, -3.707865835e-04f, -5.475028884e-04f, 3.529460519e-04f,
+  -1.492402516e-03f, -5.919535179e-04f, -7.686698227e-04f, 1.317791175e-04f,
+  -9.676412446e-04f, -6.719227531e-05f, -2.439085947e-04f, 6.565403892e-04f,
+  -1.735484228e-03f, -8.350352873e-04f, -1.011751592e-03f, -1.113026447e-04f,
+  -1.210722956e-03f, -3.102740448e-04f, -4.869903496e-04f, 4.134585906e-04f,
+  -1.431889948e-03f, -5.314409500e-04f, -7.081573131e-04f, 1.922916563e-04f,
+  -9.071286768e-04f, -6.679729722e-06f, -1.833960414e-04f, 7.170528988e-04f,
+  -1.999965403e-03f, -1.099516521e-03f, -1.276232884e-03f, -3.757838858e-04f,
+  -1.475204248e-03f, -5.747553078e-04f, -7.514716126e-04f, 1.489773567e-04f,
+  -1.696371124e-03f, -7.959222421e-04f, -9.726385470e-04f, -7.218958490e-05f,
+  -1.171609969e-03f, -2.711609704e-04f, -4.478773044e-04f, 4.525716649e-04f,
+  -1.939452952e-03f, -1.039003953e-03f, -1.215720316e-03f, -3.152713471e-04f,
+  -1.414691680e-03f, -5.142427399e-04f, -6.909590447e-04f, 2.094898955e-04f,
+  -1.635858673e-03f, -7.354096742e-04f, -9.121259791e-04f, -1.167704067e-05f,
+  -1.111097401e-03f, -2.106484317e-04f, -3.873647365e-04f, 5.130842328e-04f
+},
+{
+  9.562282823e-03f, 8.445385844e-03f, 8.105535991e-03f, 6.988639478e-03f,
+  7.750742137e-03f, 6.633845158e-03f, 6.293995306e-03f, 5.177098326e-03f,
+  7.383114658e-03f, 6.266217679e-03f, 5.926367827e-03f, 4.809471313e-03f,
+  5.571573507e-03f, 4.454676528e-03f, 4.114827141e-03f, 2.997930162e-03f,
+  7.005044259e-03f, 5.888147280e-03f, 5.548297893e-03f, 4.431400914e-03f,
+  5.193503108e-03f, 4.076606594e-03f, 3.736756742e-03f, 2.619859762e-03f,
+  4.825876094e-03f, 3.708978882e-03f, 3.369129263e-03f, 2.252232516e-03f,
+  3.014334943e-03f, 1.897438080e-03f, 1.557588461e-03f, 4.406915104e-04f,
+  6.619196385e-03f, 5.502299406e-03f, 5.162450019e-03f, 4.045553040e-03f,
+  4.807655700e-03f, 3.690758487e-03f, 3.350908868e-03f, 2.234012121e-03f,
+  4.440028220e-03f, 3.323131241e-03f, 2.983281622e-03f, 1.866384642e-03f,
+  2.628487069e-03f, 1.511590206e-03f, 1.171740587e-03f, 5.484370195e-05f,
+  4.061957821e-03f, 2.945060842e-03f, 2.605211223e-03f, 1.488314243e-03f,
+  2.250416670e-03f, 1.133519923e-03f, 7.936702459e-04f, -3.232266463e-04f,
+  1.882789424e-03f, 7.658925024e-04f, 4.260428250e-04f, -6.908540381e-04f,
+  7.124843978e-05f, -1.045648474e-03f, -1.385498093e-03f, -2.502395073e-03f,
+  6.228506565e-03f, 5.111609586e-03f, 4.771760199e-03f, 3.654862987e-03f,
+  4.416965414e-03f, 3.300068667e-03f, 2.960219048e-03f, 1.843322185e-03f,
+  4.049338400e-03f, 2.932441188e-03f, 2.592591569e-03f, 1.475694706e-03f,
+  2.237797249e-03f, 1.120900386e-03f, 7.810507086e-04f, -3.358461836e-04f,
+  3.671267768e-03f, 2.554371022e-03f, 2.214521170e-03f, 1.097624423e-03f,
+  1.859726850e-03f, 7.428299868e-04f, 4.029803385e-04f, -7.139165537e-04f,
+  1.492099487e-03f, 3.752025659e-04f, 3.535293217e-05f, -1.081543975e-03f,
+  -3.194414603e-04f, -1.436338411e-03f, -1.776188030e-03f, -2.893084893e-03f,
+  3.285419894e-03f, 2.168523148e-03f, 1.828673412e-03f, 7.117765490e-04f,
+  1.473879092e-03f, 3.569821711e-04f, 1.713253550e-05f, -1.099764369e-03f,
+  1.106251613e-03f, -1.064522712e-05f, -3.504948691e-04f, -1.467391732e-03f,
+  -7.052892470e-04f, -1.822186168e-03f, -2.162035787e-03f, -3.278932767e-03f,
+  7.281813305e-04f, -3.887155908e-04f, -7.285652100e-04f, -1.845462131e-03f,
+  -1.083359588e-03f, -2.200256567e-03f, -2.540106187e-03f, -3.657003166e-03f,
+  -1.450987067e-03f, -2.567883814e-03f, -2.907733666e-03f, -4.024630412e-03f,
+  -3.262527985e-03f, -4.379424732e-03f, -4.719274584e-03f, -5.836171564e-03f,
+  5.836171564e-03f, 4.719274584e-03f, 4.379424732e-03f, 3.262527985e-03f,
+  4.024630412e-03f, 2.907733666e-03f, 2.567883814e-03f, 1.450987067e-03f,
+  3.657003166e-03f, 2.540106187e-03f, 2.200256567e-03f, 1.083359588e-03f,
+  1.845462131e-03f, 7.285652100e-04f, 3.887155908e-04f, -7.281813305e-04f,
+  3.278932767e-03f, 2.162035787e-03f, 1.822186168e-03f, 7.052892470e-04f,
+  1.467391732e-03f, 3.504948691e-04f, 1.064522712e-05f, -1.106251613e-03f,
+  1.099764369e-03f, -1.713253550e-05f, -3.569821711e-04f, -1.473879092e-03f,
+  -7.117765490e-04f, -1.828673412e-03f, -2.168523148e-03f, -3.285419894e-03f,
+  2.893084893e-03f, 1.776188030e-03f, 1.436338411e-03f, 3.194414603e-04f,
+  1.081543975e-03f, -3.535293217e-05f, -3.752025659e-04f, -1.492099487e-03f,
+  7.139165537e-04f, -4.029803385e-04f, -7.428299868e-04f, -1.859726850e-03f,
+  -1.097624423e-03f, -2.214521170e-03f, -2.554371022e-03f, -3.671267768e-03f,
+  3.358461836e-04f, -7.810507086e-04f, -1.120900386e-03f, -2.237797249e-03f,
+  -1.475694706e-03f, -2.592591569e-03f, -2.932441188e-03f, -4.049338400e-03f,
+  -1.843322185e-03f, -2.960219048e-03f, -3.300068667e-03f, -4.416965414e-03f,
+  -3.654862987e-03f, -4.771760199e-03f, -5.111609586e-03f, -6.228506565e-03f,
+  2.502395073e-03f, 1.385498093e-03f, 1.045648474e-03f, -7.124843978e-05f,
+  6.908540381e-04f, -4.260428250e-04f, -7.658925024e-04f, -1.882789424e-03f,
+  3.232266463e-04f, -7.936702459e-04f, -1.133519923e-03f, -2.250416670e-03f,
+  -1.488314243e-03f, -2.605211223e-03f, -2.945060842e-03f, -4.061957821e-03f,
+  -5.484370195e-05f, -1.171740587e-03f, -1.511590206e-03f, -2.628487069e-03f,
+  -1.866384642e-03f, -2.983281622e-03f, -3.323131241e-03f, -4.440028220e-03f,
+  -2.234012121e-03f, -3.350908868e-03f, -3.690758487e-03f, -4.807655700e-03f,
+  -4.045553040e-03f, -5.162450019e-03f, -5.502299406e-03f, -6.619196385e-03f,
+  -4.406915104e-04f, -1.557588461e-03f, -1.897438080e-03f, -3.014334943e-03f,
+  -2.252232516e-03f, -3.369129263e-03f, -3.708978882e-03f, -4.825876094e-03f,
+  -2.619859762e-03f, -3.736756742e-03f, -4.076606594e-03f, -5.193503108e-03f,
+  -4.431400914e-03f, -5.548297893e-03f, -5.888147280e-03f, -7.005044259e-03f,
+  -2.997930162e-03f, -4.114827141e-03f, -4.454676528e-03f, -5.571573507e-03f,
+  -4.809471313e-03f, -5.926367827e-03f, -6.266217679e-03f, -7.383114658e-03f,
+  -5.177098326e-03f, -6.293995306e-03f, -6.633845158e-03f, -7.750742137e-03f,
+  -6.988639478e-03f, -8.105535991e-03f, -8.445385844e-03f, -9.562282823e-03f
+},
+{
+  2.144613490e-02f, 1.732949167e-02f, 1.694444381e-02f, 1.282779872e-02f,
+  1.656878553e-02f, 1.245214045e-02f, 1.206709258e-02f, 7.950448431e-03f,
+  1.620661840e-02f, 1.208997425e-02f, 1.170492638e-02f, 7.588281762e-03f,
+  1.132926811e-02f, 7.212623022e-03f, 6.827575620e-03f, 2.710931236e-03f,
+  1.586222462e-02f, 1.174557954e-02f, 1.136053260e-02f, 7.243887987e-03f,
+  1.098487340e-02f, 6.868229248e-03f, 6.483181845e-03f, 2.366537228e-03f,
+  1.062270720e-02f, 6.506062578e-03f, 6.121015176e-03f, 2.004370559e-03f,
+  5.745356437e-03f, 1.628711936e-03f, 1.243664534e-03f, -2.872980200e-03f,
+  1.554003637e-02f, 1.142339129e-02f, 1.103834435e-02f, 6.921699736e-03f,
+  1.066268515e-02f, 6.546040997e-03f, 6.160993595e-03f, 2.044348978e-03f,
+  1.030051894e-02f, 6.183874328e-03f, 5.798826925e-03f, 1.682182308e-03f,
+  5.423168186e-03f, 1.306523685e-03f, 9.214762831e-04f, -3.195168450e-03f,
+  9.956125170e-03f, 5.839480553e-03f, 5.454432685e-03f, 1.337788301e-03f,
+  5.078774411e-03f, 9.621296776e-04f, 5.770822754e-04f, -3.539562225e-03f,
+  4.716607742e-03f, 5.999630666e-04f, 2.149156644e-04f, -3.901728895e-03f,
+  -1.607429149e-04f, -4.277387634e-03f, -4.662435036e-03f, -8.779079653e-03f,
+  1.524461154e-02f, 1.112796739e-02f, 1.074291952e-02f, 6.626274902e-03f,
+  1.036726125e-02f, 6.250616163e-03f, 5.865568761e-03f, 1.748924376e-03f,
+  1.000509411e-02f, 5.888449959e-03f, 5.503402557e-03f, 1.386757707e-03f,
+  5.127743818e-03f, 1.011099201e-03f, 6.260517403e-04f, -3.490592819e-03f,
+  9.660700336e-03f, 5.544055719e-03f, 5.159008317e-03f, 1.042363700e-03f,
+  4.783349577e-03f, 6.667051348e-04f, 2.816577326e-04f, -3.834986826e-03f,
+  4.421183374e-03f, 3.045385529e-04f, -8.050887845e-05f, -4.197153263e-03f,
+  -4.561674723e-04f, -4.572812002e-03f, -4.957859404e-03f, -9.074504487e-03f,
+  9.338512085e-03f, 5.221867468e-03f, 4.836820066e-03f, 7.201755070e-04f,
+  4.461161327e-03f, 3.445169132e-04f, -4.053051816e-05f, -4.157175310e-03f,
+  4.098995123e-03f, -1.764969966e-05f, -4.026971292e-04f, -4.519341514e-03f,
+  -7.783556939e-04f, -4.895000253e-03f, -5.280047655e-03f, -9.396692738e-03f,
+  3.754600883e-03f, -3.620437055e-04f, -7.470911369e-04f, -4.863735754e-03f,
+  -1.122749760e-03f, -5.239394493e-03f, -5.624441896e-03f, -9.741086513e-03f,
+  -1.484916313e-03f, -5.601560697e-03f, -5.986608565e-03f, -1.010325272e-02f,
+  -6.362266839e-03f, -1.047891192e-02f, -1.086395886e-02f, -1.498060394e-02f,
+  1.498060394e-02f, 1.086395886e-02f, 1.047891192e-02f, 6.362266839e-03f,
+  1.010325272e-02f, 5.986608565e-03f, 5.601560697e-03f, 1.484916313e-03f,
+  9.741086513e-03f, 5.624441896e-03f, 5.239394493e-03f, 1.122749760e-03f,
+  4.863735754e-03f, 7.470911369e-04f, 3.620437055e-04f, -3.754600883e-03f,
+  9.396692738e-03f, 5.280047655e-03f, 4.895000253e-03f, 7.783556939e-04f,
+  4.519341514e-03f, 4.026971292e-04f, 1.764969966e-05f, -4.098995123e-03f,
+  4.157175310e-03f, 4.053051816e-05f, -3.445169132e-04f, -4.461161327e-03f,
+  -7.201755070e-04f, -4.836820066e-03f, -5.221867468e-03f, -9.338512085e-03f,
+  9.074504487e-03f, 4.957859404e-03f, 4.572812002e-03f, 4.561674723e-04f,
+  4.197153263e-03f, 8.050887845e-05f, -3.045385529e-04f, -4.421183374e-03f,
+  3.834986826e-03f, -2.816577326e-04f, -6.667051348e-04f, -4.783349577e-03f,
+  -1.042363700e-03f, -5.159008317e-03f, -5.544055719e-03f, -9.660700336e-03f,
+  3.490592819e-03f, -6.260517403e-04f, -1.011099201e-03f, -5.127743818e-03f,
+  -1.386757707e-03f, -5.503402557e-03f, -5.888449959e-03f, -1.000509411e-02f,
+  -1.748924376e-03f, -5.865568761e-03f, -6.250616163e-03f, -1.036726125e-02f,
+  -6.626274902e-03f, -1.074291952e-02f, -1.112796739e-02f, -1.524461154e-02f,
+  8.779079653e-03f, 4.662435036e-03f, 4.277387634e-03f, 1.607429149e-04f,
+  3.901728895e-03f, -2.149156644e-04f, -5.999630666e-04f, -4.716607742e-03f,
+  3.539562225e-03f, -5.770822754e-04f, -9.621296776e-04f, -5.078774411e-03f,
+  -1.337788301e-03f, -5.454432685e-03f, -5.839480553e-03f, -9.956125170e-03f,
+  3.195168450e-03f, -9.214762831e-04f, -1.306523685e-03f, -5.423168186e-03f,
+  -1.682182308e-03f, -5.798826925e-03f, -6.183874328e-03f, -1.030051894e-02f,
+  -2.044348978e-03f, -6.160993595e-03f, -6.546040997e-03f, -1.066268515e-02f,
+  -6.921699736e-03f, -1.103834435e-02f, -1.142339129e-02f, -1.554003637e-02f,
+  2.872980200e-03f, -1.243664534e-03f, -1.628711936e-03f, -5.745356437e-03f,
+  -2.004370559e-03f, -6.121015176e-03f, -6.506062578e-03f, -1.062270720e-02f,
+  -2.366537228e-03f, -6.483181845e-03f, -6.868229248e-03f, -1.098487340e-02f,
+  -7.243887987e-03f, -1.136053260e-02f, -1.174557954e-02f, -1.586222462e-02f,
+  -2.710931236e-03f, -6.827575620e-03f, -7.212623022e-03f, -1.132926811e-02f,
+  -7.588281762e-03f, -1.170492638e-02f, -1.208997425e-02f, -1.620661840e-02f,
+  -7.950448431e-03f, -1.206709258e-02f, -1.245214045e-02f, -1.656878553e-02f,
+  -1.282779872e-02f, -1.694444381e-02f, -1.732949167e-02f, -2.144613490e-02f
+},
+{
+  2.795328014e-02f, 2.125987224e-02f, 2.107287012e-02f, 1.437946223e-02f,
+  2.093148232e-02f, 1.423807349e-02f, 1.405107230e-02f, 7.357664406e-03f,
+  2.084039338e-02f, 1.414698549e-02f, 1.395998523e-02f, 7.266576868e-03f,
+  1.381859556e-02f, 7.125187665e-03f, 6.938186940e-03f, 2.447788720e-04f,
+  2.080421522e-02f, 1.411080640e-02f, 1.392380521e-02f, 7.230397314e-03f,
+  1.378241647e-02f, 7.089008112e-03f, 6.902007386e-03f, 2.085992601e-04f,
+  1.369132847e-02f, 6.997920573e-03f, 6.810919847e-03f, 1.175117650e-04f,
+  6.669530645e-03f, -2.387751738e-05f, -2.108781628e-04f, -6.904286332e-03f,
+  2.082742378e-02f, 1.413401682e-02f, 1.394701563e-02f, 7.253607735e-03f,
+  1.380562689e-02f, 7.112218533e-03f, 6.925217807e-03f, 2.318095067e-04f,
+  1.371453889e-02f, 7.021130994e-03f, 6.834130269e-03f, 1.407220116e-04f,
+  6.692741066e-03f, -6.672730706e-07f, -1.876679162e-04f, -6.881075911e-03f,
+  1.367835980e-02f, 6.984951440e-03f, 6.797950715e-03f, 1.045423924e-04f,
+  6.656561513e-03f, -3.684689000e-05f, -2.238475281e-04f, -6.917255931e-03f,
+  6.565473974e-03f, -1.279343851e-04f, -3.149350232e-04f, -7.008343469e-03f,
+  -4.563243128e-04f, -7.149732672e-03f, -7.336732931e-03f, -1.403014176e-02f,
+  2.091434225e-02f, 1.422093436e-02f, 1.403393317e-02f, 7.340525277e-03f,
+  1.389254443e-02f, 7.199135609e-03f, 7.012135349e-03f, 3.187269904e-04f,
+  1.380145643e-02f, 7.108048536e-03f, 6.921047810e-03f, 2.276394807e-04f,
+  6.779658608e-03f, 8.625019836e-05f, -1.007504397e-04f, -6.794158835e-03f,
+  1.376527734e-02f, 7.071868517e-03f, 6.884868257e-03f, 1.914598688e-04f,
+  6.743478589e-03f, 5.007058644e-05f, -1.369300589e-04f, -6.830338389e-03f,
+  6.652391516e-03f, -4.101691593e-05f, -2.280175540e-04f, -6.921425927e-03f,
+  -3.694068291e-04f, -7.062815130e-03f, -7.249815855e-03f, -1.394322421e-02f,
+  1.378848683e-02f, 7.095078938e-03f, 6.908078212e-03f, 2.146701154e-04f,
+  6.766689010e-03f, 7.328082575e-05f, -1.137198124e-04f, -6.807127967e-03f,
+  6.675601471e-03f, -1.780667299e-05f, -2.048073220e-04f, -6.898215506e-03f,
+  -3.461965825e-04f, -7.039604709e-03f, -7.226605434e-03f, -1.392001379e-02f,
+  6.639421917e-03f, -5.398628855e-05f, -2.409869339e-04f, -6.934395060e-03f,
+  -3.823762236e-04f, -7.075784262e-03f, -7.262784988e-03f, -1.395619288e-02f,
+  -4.734637041e-04f, -7.166871801e-03f, -7.353872526e-03f, -1.404728089e-02f,
+  -7.495261729e-03f, -1.418866962e-02f, -1.437567081e-02f, -2.106907964e-02f,
+  2.106907964e-02f, 1.437567081e-02f, 1.418866962e-02f, 7.495261729e-03f,
+  1.404728089e-02f, 7.353872526e-03f, 7.166871801e-03f, 4.734637041e-04f,
+  1.395619288e-02f, 7.262784988e-03f, 7.075784262e-03f, 3.823762236e-04f,
+  6.934395060e-03f, 2.409869339e-04f, 5.398628855e-05f, -6.639421917e-03f,
+  1.392001379e-02f, 7.226605434e-03f, 7.039604709e-03f, 3.461965825e-04f,
+  6.898215506e-03f, 2.048073220e-04f, 1.780667299e-05f, -6.675601471e-03f,
+  6.807127967e-03f, 1.137198124e-04f, -7.328082575e-05f, -6.766689010e-03f,
+  -2.146701154e-04f, -6.908078212e-03f, -7.095078938e-03f, -1.378848683e-02f,
+  1.394322421e-02f, 7.249815855e-03f, 7.062815130e-03f, 3.694068291e-04f,
+  6.921425927e-03f, 2.280175540e-04f, 4.101691593e-05f, -6.652391516e-03f,
+  6.830338389e-03f, 1.369300589e-04f, -5.007058644e-05f, -6.743478589e-03f,
+  -1.914598688e-04f, -6.884868257e-03f, -7.071868517e-03f, -1.376527734e-02f,
+  6.794158835e-03f, 1.007504397e-04f, -8.625019836e-05f, -6.779658608e-03f,
+  -2.276394807e-04f, -6.921047810e-03f, -7.108048536e-03f, -1.380145643e-02f,
+  -3.187269904e-04f, -7.012135349e-03f, -7.199135609e-03f, -1.389254443e-02f,
+  -7.340525277e-03f, -1.403393317e-02f, -1.422093436e-02f, -2.091434225e-02f,
+  1.403014176e-02f, 7.336732931e-03f, 7.149732672e-03f, 4.563243128e-04f,
+  7.008343469e-03f, 3.149350232e-04f, 1.279343851e-04f, -6.565473974e-03f,
+  6.917255931e-03f, 2.238475281e-04f, 3.684689000e-05f, -6.656561513e-03f,
+  -1.045423924e-04f, -6.797950715e-03f, -6.984951440e-03f, -1.367835980e-02f,
+  6.881075911e-03f, 1.876679162e-04f, 6.672730706e-07f, -6.692741066e-03f,
+  -1.407220116e-04f, -6.834130269e-03f, -7.021130994e-03f, -1.371453889e-02f,
+  -2.318095067e-04f, -6.925217807e-03f, -7.112218533e-03f, -1.380562689e-02f,
+  -7.253607735e-03f, -1.394701563e-02f, -1.413401682e-02f, -2.082742378e-02f,
+  6.904286332e-03f, 2.108781628e-04f, 2.387751738e-05f, -6.669530645e-03f,
+  -1.175117650e-04f, -6.810919847e-03f, -6.997920573e-03f, -1.369132847e-02f,
+  -2.085992601e-04f, -6.902007386e-03f, -7.089008112e-03f, -1.378241647e-02f,
+  -7.230397314e-03f, -1.392380521e-02f, -1.411080640e-02f, -2.080421522e-02f,
+  -2.447788720e-04f, -6.938186940e-03f, -7.125187665e-03f, -1.381859556e-02f,
+  -7.266576868e-03f, -1.395998523e-02f, -1.414698549e-02f, -2.084039338e-02f,
+  -7.357664406e-03f, -1.405107230e-02f, -1.423807349e-02f, -2.093148232e-02f,
+  -1.437946223e-02f, -2.107287012e-02f, -2.125987224e-02f, -2.795328014e-02f
+},
+{
+  2.011950687e-02f, 1.346172672e-02f, 1.376341376e-02f, 7.105635479e-03f,
+  1.414361969e-02f, 7.485841401e-03f, 7.787528448e-03f, 1.129749464e-03f,
+  1.460523531e-02f, 7.947456092e-03f, 8.249143139e-03f, 1.591364504e-03f,
+  8.629349060e-03f, 1.971570542e-03f, 2.273257589e-03f, -4.384521395e-03f,
+  1.515074912e-02f, 8.492969908e-03f, 8.794656955e-03f, 2.136878204e-03f,
+  9.174862877e-03f, 2.517084125e-03f, 2.818771172e-03f, -3.839007579e-03f,
+  9.636478499e-03f, 2.978699282e-03f, 3.280386329e-03f, -3.377392422e-03f,
+  3.660592251e-03f, -2.997186501e-03f, -2.695499454e-03f, -9.353278205e-03f,
+  1.578221470e-02f, 9.124436416e-03f, 9.426123463e-03f, 2.768344712e-03f,
+  9.806329384e-03f, 3.148550633e-03f, 3.450237680e-03f, -3.207541304e-03f,
+  1.026794501e-02f, 3.610165790e-03f, 3.911852837e-03f, -2.745926147e-03f,
+  4.292058758e-03f, -2.365720225e-03f, -2.064033179e-03f, -8.721811697e-03f,
+  1.081345789e-02f, 4.155679606e-03f, 4.457366187e-03f, -2.200412331e-03f,
+  4.837572575e-03f, -1.820206409e-03f, -1.518519479e-03f, -8.176297881e-03f,
+  5.299187265e-03f, -1.358591369e-03f, -1.056904322e-03f, -7.714683190e-03f,
+  -6.766984006e-04f, -7.334477268e-03f, -7.032790221e-03f, -1.369056944e-02f,
+  1.650121994e-02f, 9.843441658e-03f, 1.014512870e-02f, 3.487350186e-03f,
+  1.052533463e-02f, 3.867556108e-03f, 4.169242922e-03f, -2.488535829e-03f,
+  1.098695025e-02f, 4.329171032e-03f, 4.630858079e-03f, -2.026920673e-03f,
+  5.011064000e-03f, -1.646714634e-03f, -1.345027704e-03f, -8.002806455e-03f,
+  1.153246406e-02f, 4.874684848e-03f, 5.176371895e-03f, -1.481406973e-03f,
+  5.556577817e-03f, -1.101200934e-03f, -7.995140040e-04f, -7.457292639e-03f,
+  6.018192973e-03f, -6.395858363e-04f, -3.378988768e-04f, -6.995677482e-03f,
+  4.230711056e-05f, -6.615471561e-03f, -6.313784514e-03f, -1.297156326e-02f,
+  1.216393057e-02f, 5.506151356e-03f, 5.807838403e-03f, -8.499405230e-04f,
+  6.188044325e-03f, -4.697345430e-04f, -1.680475834e-04f, -6.825826596e-03f,
+  6.649659481e-03f, -8.119446647e-06f, 2.935675147e-04f, -6.364211440e-03f,
+  6.737735239e-04f, -5.984005518e-03f, -5.682318471e-03f, -1.234009676e-02f,
+  7.195172831e-03f, 5.373942549e-04f, 8.390811854e-04f, -5.818697624e-03f,
+  1.219287165e-03f, -5.438491702e-03f, -5.136804655e-03f, -1.179458387e-02f,
+  1.680902322e-03f, -4.976876546e-03f, -4.675189499e-03f, -1.133296825e-02f,
+  -4.294983577e-03f, -1.095276233e-02f, -1.065107528e-02f, -1.730885357e-02f,
+  1.730885357e-02f, 1.065107528e-02f, 1.095276233e-02f, 4.294983577e-03f,
+  1.133296825e-02f, 4.675189499e-03f, 4.976876546e-03f, -1.680902322e-03f,
+  1.179458387e-02f, 5.136804655e-03f, 5.438491702e-03f, -1.219287165e-03f,
+  5.818697624e-03f, -8.390811854e-04f, -5.373942549e-04f, -7.195172831e-03f,
+  1.234009676e-02f, 5.682318471e-03f, 5.984005518e-03f, -6.737735239e-04f,
+  6.364211440e-03f, -2.935675147e-04f, 8.119446647e-06f, -6.649659481e-03f,
+  6.825826596e-03f, 1.680475834e-04f, 4.697345430e-04f, -6.188044325e-03f,
+  8.499405230e-04f, -5.807838403e-03f, -5.506151356e-03f, -1.216393057e-02f,
+  1.297156326e-02f, 6.313784514e-03f, 6.615471561e-03f, -4.230711056e-05f,
+  6.995677482e-03f, 3.378988768e-04f, 6.395858363e-04f, -6.018192973e-03f,
+  7.457292639e-03f, 7.995140040e-04f, 1.101200934e-03f, -5.556577817e-03f,
+  1.481406973e-03f, -5.176371895e-03f, -4.874684848e-03f, -1.153246406e-02f,
+  8.002806455e-03f, 1.345027704e-03f, 1.646714634e-03f, -5.011064000e-03f,
+  2.026920673e-03f, -4.630858079e-03f, -4.329171032e-03f, -1.098695025e-02f,
+  2.488535829e-03f, -4.169242922e-03f, -3.867556108e-03f, -1.052533463e-02f,
+  -3.487350186e-03f, -1.014512870e-02f, -9.843441658e-03f, -1.650121994e-02f,
+  1.369056944e-02f, 7.032790221e-03f, 7.334477268e-03f, 6.766984006e-04f,
+  7.714683190e-03f, 1.056904322e-03f, 1.358591369e-03f, -5.299187265e-03f,
+  8.176297881e-03f, 1.518519479e-03f, 1.820206409e-03f, -4.837572575e-03f,
+  2.200412331e-03f, -4.457366187e-03f, -4.155679606e-03f, -1.081345789e-02f,
+  8.721811697e-03f, 2.064033179e-03f, 2.365720225e-03f, -4.292058758e-03f,
+  2.745926147e-03f, -3.911852837e-03f, -3.610165790e-03f, -1.026794501e-02f,
+  3.207541304e-03f, -3.450237680e-03f, -3.148550633e-03f, -9.806329384e-03f,
+  -2.768344712e-03f, -9.426123463e-03f, -9.124436416e-03f, -1.578221470e-02f,
+  9.353278205e-03f, 2.695499454e-03f, 2.997186501e-03f, -3.660592251e-03f,
+  3.377392422e-03f, -3.280386329e-03f, -2.978699282e-03f, -9.636478499e-03f,
+  3.839007579e-03f, -2.818771172e-03f, -2.517084125e-03f, -9.174862877e-03f,
+  -2.136878204e-03f, -8.794656955e-03f, -8.492969908e-03f, -1.515074912e-02f,
+  4.384521395e-03f, -2.273257589e-03f, -1.971570542e-03f, -8.629349060e-03f,
+  -1.591364504e-03f, -8.249143139e-03f, -7.947456092e-03f, -1.460523531e-02f,
+  -1.129749464e-03f, -7.787528448e-03f, -7.485841401e-03f, -1.414361969e-02f,
+  -7.105635479e-03f, -1.376341376e-02f, -1.346172672e-02f, -2.011950687e-02f
+},
+{
+  -8.575226180e-03f, -1.048905123e-02f, -9.503016248e-03f, -1.141684223e-02f,
+  -8.428321220e-03f, -1.034214720e-02f, -9.356111288e-03f, -1.126993727e-02f,
+  -7.266101427e-03f, -9.179927409e-03f, -8.193891495e-03f, -1.010771748e-02f,
+  -7.119196933e-03f, -9.033023380e-03f, -8.046987467e-03f, -9.960813448e-03f,
+  -6.018084940e-03f, -7.931910455e-03f, -6.945875008e-03f, -8.859700523e-03f,
+  -5.871180445e-03f, -7.785006426e-03f, -6.798970513e-03f, -8.712796494e-03f,
+  -4.708960652e-03f, -6.622786168e-03f, -5.636750720e-03f, -7.550576702e-03f,
+  -4.562056158e-03f, -6.475882139e-03f, -5.489846691e-03f, -7.403672207e-03f,
+  -4.686602391e-03f, -6.600427907e-03f, -5.614392459e-03f, -7.528218441e-03f,
+  -4.539697897e-03f, -6.453523878e-03f, -5.467488430e-03f, -7.381313946e-03f,
+  -3.377478104e-03f, -5.291303620e-03f, -4.305268172e-03f, -6.219094153e-03f,
+  -3.230573609e-03f, -5.144399591e-03f, -4.158364143e-03f, -6.072189659e-03f,
+  -2.129461383e-03f, -4.043287132e-03f, -3.057251684e-03f, -4.971077200e-03f,
+  -1.982557122e-03f, -3.896382870e-03f, -2.910347190e-03f, -4.824173171e-03f,
+  -8.203370380e-04f, -2.734162845e-03f, -1.748127281e-03f, -3.661953146e-03f,
+  -6.734327180e-04f, -2.587258583e-03f, -1.601223019e-03f, -3.515048884e-03f,
+  -3.274590010e-03f, -5.188415758e-03f, -4.202380311e-03f, -6.116205826e-03f,
+  -3.127685748e-03f, -5.041511264e-03f, -4.055475816e-03f, -5.969301797e-03f,
+  -1.965465723e-03f, -3.879291471e-03f, -2.893256024e-03f, -4.807081539e-03f,
+  -1.818561344e-03f, -3.732387209e-03f, -2.746351762e-03f, -4.660177510e-03f,
+  -7.174490020e-04f, -2.631274750e-03f, -1.645239303e-03f, -3.559065051e-03f,
+  -5.705446820e-04f, -2.484370489e-03f, -1.498334925e-03f, -3.412160790e-03f,
+  5.916752852e-04f, -1.322150463e-03f, -3.361150157e-04f, -2.249940764e-03f,
+  7.385795470e-04f, -1.175246201e-03f, -1.892106957e-04f, -2.103036502e-03f,
+  6.140334881e-04f, -1.299792319e-03f, -3.137567837e-04f, -2.227582503e-03f,
+  7.609378081e-04f, -1.152887940e-03f, -1.668524783e-04f, -2.080678241e-03f,
+  1.923157717e-03f, 9.331982255e-06f, 9.953675326e-04f, -9.184582741e-04f,
+  2.070062095e-03f, 1.562362886e-04f, 1.142271794e-03f, -7.715539541e-04f,
+  3.171174554e-03f, 1.257348689e-03f, 2.243384253e-03f, 3.295584174e-04f,
+  3.318078816e-03f, 1.404252951e-03f, 2.390288515e-03f, 4.764627083e-04f,
+  4.480298609e-03f, 2.566472860e-03f, 3.552508540e-03f, 1.638682676e-03f,
+  4.627203103e-03f, 2.713377355e-03f, 3.699412802e-03f, 1.785586937e-03f,
+  -1.785586937e-03f, -3.699412802e-03f, -2.713377355e-03f, -4.627203103e-03f,
+  -1.638682676e-03f, -3.552508540e-03f, -2.566472860e-03f, -4.480298609e-03f,
+  -4.764627083e-04f, -2.390288515e-03f, -1.404252951e-03f, -3.318078816e-03f,
+  -3.295584174e-04f, -2.243384253e-03f, -1.257348689e-03f, -3.171174554e-03f,
+  7.715539541e-04f, -1.142271794e-03f, -1.562362886e-04f, -2.070062095e-03f,
+  9.184582741e-04f, -9.953675326e-04f, -9.331982255e-06f, -1.923157717e-03f,
+  2.080678241e-03f, 1.668524783e-04f, 1.152887940e-03f, -7.609378081e-04f,
+  2.227582503e-03f, 3.137567837e-04f, 1.299792319e-03f, -6.140334881e-04f,
+  2.103036502e-03f, 1.892106957e-04f, 1.175246201e-03f, -7.385795470e-04f,
+  2.249940764e-03f, 3.361150157e-04f, 1.322150463e-03f, -5.916752852e-04f,
+  3.412160790e-03f, 1.498334925e-03f, 2.484370489e-03f, 5.705446820e-04f,
+  3.559065051e-03f, 1.645239303e-03f, 2.631274750e-03f, 7.174490020e-04f,
+  4.660177510e-03f, 2.746351762e-03f, 3.732387209e-03f, 1.818561344e-03f,
+  4.807081539e-03f, 2.893256024e-03f, 3.879291471e-03f, 1.965465723e-03f,
+  5.969301797e-03f, 4.055475816e-03f, 5.041511264e-03f, 3.127685748e-03f,
+  6.116205826e-03f, 4.202380311e-03f, 5.188415758e-03f, 3.274590010e-03f,
+  3.515048884e-03f, 1.601223019e-03f, 2.587258583e-03f, 6.734327180e-04f,
+  3.661953146e-03f, 1.748127281e-03f, 2.734162845e-03f, 8.203370380e-04f,
+  4.824173171e-03f, 2.910347190e-03f, 3.896382870e-03f, 1.982557122e-03f,
+  4.971077200e-03f, 3.057251684e-03f, 4.043287132e-03f, 2.129461383e-03f,
+  6.072189659e-03f, 4.158364143e-03f, 5.144399591e-03f, 3.230573609e-03f,
+  6.219094153e-03f, 4.305268172e-03f, 5.291303620e-03f, 3.377478104e-03f,
+  7.381313946e-03f, 5.467488430e-03f, 6.453523878e-03f, 4.539697897e-03f,
+  7.528218441e-03f, 5.614392459e-03f, 6.600427907e-03f, 4.686602391e-03f,
+  7.403672207e-03f, 5.489846691e-03f, 6.475882139e-03f, 4.562056158e-03f,
+  7.550576702e-03f, 5.636750720e-03f, 6.622786168e-03f, 4.708960652e-03f,
+  8.712796494e-03f, 6.798970513e-03f, 7.785006426e-03f, 5.871180445e-03f,
+  8.859700523e-03f, 6.945875008e-03f, 7.931910455e-03f, 6.018084940e-03f,
+  9.960813448e-03f, 8.046987467e-03f, 9.033023380e-03f, 7.119196933e-03f,
+  1.010771748e-02f, 8.193891495e-03f, 9.179927409e-03f, 7.266101427e-03f,
+  1.126993727e-02f, 9.356111288e-03f, 1.034214720e-02f, 8.428321220e-03f,
+  1.141684223e-02f, 9.503016248e-03f, 1.048905123e-02f, 8.575226180e-03f
+},
+{
+  -5.776714161e-02f, -4.941564426e-02f, -4.778565094e-02f, -3.943415359e-02f,
+  -4.609281197e-02f, -3.774131835e-02f, -3.611132503e-02f, -2.775982767e-02f,
+  -4.434296489e-02f, -3.599146754e-02f, -3.436147794e-02f, -2.600998059e-02f,
+  -3.266863897e-02f, -2.431714162e-02f, -2.268714830e-02f, -1.433565188e-02f,
+  -4.254246503e-02f, -3.419097140e-02f, -3.256097808e-02f, -2.420948073e-02f,
+  -3.086813912e-02f, -2.251664177e-02f, -2.088664845e-02f, -1.253515296e-02f,
+  -2.911829203e-02f, -2.076679468e-02f, -1.913680136e-02f, -1.078530494e-02f,
+  -1.744396426e-02f, -9.092466906e-03f, -7.462474052e-03f, 8.890229510e-04f,
+  -4.069816321e-02f, -3.234666586e-02f, -3.071667440e-02f, -2.236517705e-02f,
+  -2.902383544e-02f, -2.067233995e-02f, -1.904234663e-02f, -1.069085021e-02f,
+  -2.727398835e-02f, -1.892249100e-02f, -1.729249954e-02f, -8.941002190e-03f,
+  -1.559966058e-02f, -7.248163689e-03f, -5.618171301e-03f, 2.733325586e-03f,
+  -2.547348849e-02f, -1.712199301e-02f, -1.549199969e-02f, -7.140502799e-03f,
+  -1.379916165e-02f, -5.447664298e-03f, -3.817671910e-03f, 4.533824977e-03f,
+  -1.204931363e-02f, -3.697816981e-03f, -2.067824127e-03f, 6.283672526e-03f,
+  -3.749858879e-04f, 7.976510562e-03f, 9.606503882e-03f, 1.795800030e-02f,
+  -3.881736100e-02f, -3.046586551e-02f, -2.883587219e-02f, -2.048437484e-02f,
+  -2.714303322e-02f, -1.879153773e-02f, -1.716154441e-02f, -8.810047992e-03f,
+  -2.539318614e-02f, -1.704168878e-02f, -1.541169640e-02f, -7.060199976e-03f,
+  -1.371885836e-02f, -5.367361475e-03f, -3.737368854e-03f, 4.614127800e-03f,
+  -2.359268628e-02f, -1.524118986e-02f, -1.361119747e-02f, -5.259700585e-03f,
+  -1.191835944e-02f, -3.566862317e-03f, -1.936869579e-03f, 6.414627191e-03f,
+  -1.016851142e-02f, -1.817014650e-03f, -1.870219712e-04f, 8.164474741e-03f,
+  1.505816355e-03f, 9.857312776e-03f, 1.148730610e-02f, 1.983880252e-02f,
+  -2.174838446e-02f, -1.339688711e-02f, -1.176689472e-02f, -3.415397834e-03f,
+  -1.007405668e-02f, -1.722559566e-03f, -9.256685007e-05f, 8.258930407e-03f,
+  -8.324208669e-03f, 2.728806248e-05f, 1.657280722e-03f, 1.000877749e-02f,
+  3.350119106e-03f, 1.170161553e-02f, 1.333160885e-02f, 2.168310620e-02f,
+  -6.523709279e-03f, 1.827787375e-03f, 3.457779996e-03f, 1.180927735e-02f,
+  5.150618497e-03f, 1.350211538e-02f, 1.513210777e-02f, 2.348360419e-02f,
+  6.900466047e-03f, 1.525196247e-02f, 1.688195579e-02f, 2.523345314e-02f,
+  1.857479475e-02f, 2.692629024e-02f, 2.855628356e-02f, 3.690778092e-02f,
+  -3.690778092e-02f, -2.855628356e-02f, -2.692629024e-02f, -1.857479475e-02f,
+  -2.523345314e-02f, -1.688195579e-02f, -1.525196247e-02f, -6.900466047e-03f,
+  -2.348360419e-02f, -1.513210777e-02f, -1.350211538e-02f, -5.150618497e-03f,
+  -1.180927735e-02f, -3.457779996e-03f, -1.827787375e-03f, 6.523709279e-03f,
+  -2.168310620e-02f, -1.333160885e-02f, -1.170161553e-02f, -3.350119106e-03f,
+  -1.000877749e-02f, -1.657280722e-03f, -2.728806248e-05f, 8.324208669e-03f,
+  -8.258930407e-03f, 9.256685007e-05f, 1.722559566e-03f, 1.007405668e-02f,
+  3.415397834e-03f, 1.176689472e-02f, 1.339688711e-02f, 2.174838446e-02f,
+  -1.983880252e-02f, -1.148730610e-02f, -9.857312776e-03f, -1.505816355e-03f,
+  -8.164474741e-03f, 1.870219712e-04f, 1.817014650e-03f, 1.016851142e-02f,
+  -6.414627191e-03f, 1.936869579e-03f, 3.566862317e-03f, 1.191835944e-02f,
+  5.259700585e-03f, 1.361119747e-02f, 1.524118986e-02f, 2.359268628e-02f,
+  -4.614127800e-03f, 3.737368854e-03f, 5.367361475e-03f, 1.371885836e-02f,
+  7.060199976e-03f, 1.541169640e-02f, 1.704168878e-02f, 2.539318614e-02f,
+  8.810047992e-03f, 1.716154441e-02f, 1.879153773e-02f, 2.714303322e-02f,
+  2.048437484e-02f, 2.883587219e-02f, 3.046586551e-02f, 3.881736100e-02f,
+  -1.795800030e-02f, -9.606503882e-03f, -7.976510562e-03f, 3.749858879e-04f,
+  -6.283672526e-03f, 2.067824127e-03f, 3.697816981e-03f, 1.204931363e-02f,
+  -4.533824977e-03f, 3.817671910e-03f, 5.447664298e-03f, 1.379916165e-02f,
+  7.140502799e-03f, 1.549199969e-02f, 1.712199301e-02f, 2.547348849e-02f,
+  -2.733325586e-03f, 5.618171301e-03f, 7.248163689e-03f, 1.559966058e-02f,
+  8.941002190e-03f, 1.729249954e-02f, 1.892249100e-02f, 2.727398835e-02f,
+  1.069085021e-02f, 1.904234663e-02f, 2.067233995e-02f, 2.902383544e-02f,
+  2.236517705e-02f, 3.071667440e-02f, 3.234666586e-02f, 4.069816321e-02f,
+  -8.890229510e-04f, 7.462474052e-03f, 9.092466906e-03f, 1.744396426e-02f,
+  1.078530494e-02f, 1.913680136e-02f, 2.076679468e-02f, 2.911829203e-02f,
+  1.253515296e-02f, 2.088664845e-02f, 2.251664177e-02f, 3.086813912e-02f,
+  2.420948073e-02f, 3.256097808e-02f, 3.419097140e-02f, 4.254246503e-02f,
+  1.433565188e-02f, 2.268714830e-02f, 2.431714162e-02f, 3.266863897e-02f,
+  2.600998059e-02f, 3.436147794e-02f, 3.599146754e-02f, 4.434296489e-02f,
+  2.775982767e-02f, 3.611132503e-02f, 3.774131835e-02f, 4.609281197e-02f,
+  3.943415359e-02f, 4.778565094e-02f, 4.941564426e-02f, 5.776714161e-02f
+},
+{
+  -1.181381494e-01f, -9.534852207e-02f, -9.340598434e-02f, -7.061635703e-02f,
+  -9.145987779e-02f, -6.867025048e-02f, -6.672771275e-02f, -4.393808544e-02f,
+  -8.951911330e-02f, -6.672948599e-02f, -6.478694826e-02f, -4.199732095e-02f,
+  -6.284084171e-02f, -4.005121440e-02f, -3.810868040e-02f, -1.531905029e-02f,
+  -8.759277314e-02f, -6.480314583e-02f, -6.286061555e-02f, -4.007098451e-02f,
+  -6.091450527e-02f, -3.812487423e-02f, -3.618234023e-02f, -1.339271199e-02f,
+  -5.897374079e-02f, -3.618410975e-02f, -3.424157575e-02f, -1.145194750e-02f,
+  -3.229546919e-02f, -9.505840018e-03f, -7.563305087e-03f, 1.522632409e-02f,
+  -8.569005132e-02f, -6.290042400e-02f, -6.095789000e-02f, -3.816825897e-02f,
+  -5.901177973e-02f, -3.622215241e-02f, -3.427961841e-02f, -1.148998830e-02f,
+  -5.707101896e-02f, -3.428138793e-02f, -3.233885393e-02f, -9.549224749e-03f,
+  -3.039274551e-02f, -7.603116799e-03f, -5.660581868e-03f, 1.712904684e-02f,
+  -5.514467880e-02f, -3.235505149e-02f, -3.041251563e-02f, -7.622885983e-03f,
+  -2.846640721e-02f, -5.676778499e-03f, -3.734243568e-03f, 1.905538514e-02f,
+  -2.652564272e-02f, -3.736014245e-03f, -1.793479430e-03f, 2.099614963e-02f,
+  1.526282431e-04f, 2.294225805e-02f, 2.488479204e-02f, 4.767442122e-02f,
+  -8.382017910e-02f, -6.103055552e-02f, -5.908801779e-02f, -3.629839048e-02f,
+  -5.714191124e-02f, -3.435228392e-02f, -3.240974620e-02f, -9.620117955e-03f,
+  -5.520114675e-02f, -3.241151944e-02f, -3.046898358e-02f, -7.679353934e-03f,
+  -2.852287516e-02f, -5.733246449e-03f, -3.790711518e-03f, 1.899891719e-02f,
+  -5.327481031e-02f, -3.048517928e-02f, -2.854264528e-02f, -5.753015634e-03f,
+  -2.659653686e-02f, -3.806908149e-03f, -1.864373218e-03f, 2.092525549e-02f,
+  -2.465577237e-02f, -1.866144012e-03f, 7.639089745e-05f, 2.286601998e-02f,
+  2.022498520e-03f, 2.481212839e-02f, 2.675466239e-02f, 4.954428971e-02f,
+  -5.137208477e-02f, -2.858245745e-02f, -2.663992159e-02f, -3.850292880e-03f,
+  -2.469381504e-02f, -1.904185163e-03f, 3.834974996e-05f, 2.282797918e-02f,
+  -2.275305055e-02f, 3.657898560e-05f, 1.979113789e-03f, 2.476874366e-02f,
+  3.925221507e-03f, 2.671485022e-02f, 2.865738608e-02f, 5.144701526e-02f,
+  -2.082671225e-02f, 1.962917391e-03f, 3.905452322e-03f, 2.669508196e-02f,
+  5.851559807e-03f, 2.864118852e-02f, 3.058372438e-02f, 5.337335169e-02f,
+  7.792323828e-03f, 3.058195300e-02f, 3.252448887e-02f, 5.531411618e-02f,
+  3.447059542e-02f, 5.726022273e-02f, 5.920276046e-02f, 8.199238777e-02f,
+  -8.199238777e-02f, -5.920276046e-02f, -5.726022273e-02f, -3.447059542e-02f,
+  -5.531411618e-02f, -3.252448887e-02f, -3.058195300e-02f, -7.792323828e-03f,
+  -5.337335169e-02f, -3.058372438e-02f, -2.864118852e-02f, -5.851559807e-03f,
+  -2.669508196e-02f, -3.905452322e-03f, -1.962917391e-03f, 2.082671225e-02f,
+  -5.144701526e-02f, -2.865738608e-02f, -2.671485022e-02f, -3.925221507e-03f,
+  -2.476874366e-02f, -1.979113789e-03f, -3.657898560e-05f, 2.275305055e-02f,
+  -2.282797918e-02f, -3.834974996e-05f, 1.904185163e-03f, 2.469381504e-02f,
+  3.850292880e-03f, 2.663992159e-02f, 2.858245745e-02f, 5.137208477e-02f,
+  -4.954428971e-02f, -2.675466239e-02f, -2.481212839e-02f, -2.022498520e-03f,
+  -2.286601998e-02f, -7.639089745e-05f, 1.866144012e-03f, 2.465577237e-02f,
+  -2.092525549e-02f, 1.864373218e-03f, 3.806908149e-03f, 2.659653686e-02f,
+  5.753015634e-03f, 2.854264528e-02f, 3.048517928e-02f, 5.327481031e-02f,
+  -1.899891719e-02f, 3.790711518e-03f, 5.733246449e-03f, 2.852287516e-02f,
+  7.679353934e-03f, 3.046898358e-02f, 3.241151944e-02f, 5.520114675e-02f,
+  9.620117955e-03f, 3.240974620e-02f, 3.435228392e-02f, 5.714191124e-02f,
+  3.629839048e-02f, 5.908801779e-02f, 6.103055552e-02f, 8.382017910e-02f,
+  -4.767442122e-02f, -2.488479204e-02f, -2.294225805e-02f, -1.526282431e-04f,
+  -2.099614963e-02f, 1.793479430e-03f, 3.736014245e-03f, 2.652564272e-02f,
+  -1.905538514e-02f, 3.734243568e-03f, 5.676778499e-03f, 2.846640721e-02f,
+  7.622885983e-03f, 3.041251563e-02f, 3.235505149e-02f, 5.514467880e-02f,
+  -1.712904684e-02f, 5.660581868e-03f, 7.603116799e-03f, 3.039274551e-02f,
+  9.549224749e-03f, 3.233885393e-02f, 3.428138793e-02f, 5.707101896e-02f,
+  1.148998830e-02f, 3.427961841e-02f, 3.622215241e-02f, 5.901177973e-02f,
+  3.816825897e-02f, 6.095789000e-02f, 6.290042400e-02f, 8.569005132e-02f,
+  -1.522632409e-02f, 7.563305087e-03f, 9.505840018e-03f, 3.229546919e-02f,
+  1.145194750e-02f, 3.424157575e-02f, 3.618410975e-02f, 5.897374079e-02f,
+  1.339271199e-02f, 3.618234023e-02f, 3.812487423e-02f, 6.091450527e-02f,
+  4.007098451e-02f, 6.286061555e-02f, 6.480314583e-02f, 8.759277314e-02f,
+  1.531905029e-02f, 3.810868040e-02f, 4.005121440e-02f, 6.284084171e-02f,
+  4.199732095e-02f, 6.478694826e-02f, 6.672948599e-02f, 8.951911330e-02f,
+  4.393808544e-02f, 6.672771275e-02f, 6.867025048e-02f, 9.145987779e-02f,
+  7.061635703e-02f, 9.340598434e-02f, 9.534852207e-02f, 1.181381494e-01f
+},
+{
+  -1.734955311e-01f, -1.355731934e-01f, -1.338568628e-01f, -9.593452513e-02f,
+  -1.322095543e-01f, -9.428723156e-02f, -9.257089347e-02f, -5.464855954e-02f,
+  -1.306398511e-01f, -9.271752089e-02f, -9.100118279e-02f, -5.307885259e-02f,
+  -8.935388923e-02f, -5.143155903e-02f, -4.971522093e-02f, -1.179288793e-02f,
+  -1.291559637e-01f, -9.123363346e-02f, -8.951729536e-02f, -5.159496143e-02f,
+  -8.787000179e-02f, -4.994766787e-02f, -4.823132977e-02f, -1.030899771e-02f,
+  -8.630029112e-02f, -4.837796092e-02f, -4.666162282e-02f, -8.739291690e-03f,
+  -4.501432925e-02f, -7.091996260e-03f, -5.375658628e-03f, 3.254667297e-02f,
+  -1.277657300e-01f, -8.984339982e-02f, -8.812706918e-02f, -5.020473152e-02f,
+  -8.647976816e-02f, -4.855743796e-02f, -4.684109986e-02f, -8.918768726e-03f,
+  -8.491006494e-02f, -4.698773101e-02f, -4.527139291e-02f, -7.349062711e-03f,
+  -4.362409934e-02f, -5.701767281e-03f, -3.985429648e-03f, 3.393690288e-02f,
+  -8.342617750e-02f, -4.550384358e-02f, -4.378750548e-02f, -5.865172017e-03f,
+  -4.214020818e-02f, -4.217876587e-03f, -2.501539188e-03f, 3.542079404e-02f,
+  -4.057050124e-02f, -2.648170805e-03f, -9.318334050e-04f, 3.699049726e-02f,
+  7.154620253e-04f, 3.863779455e-02f, 4.035413265e-02f, 7.827646285e-02f,
+  -1.264765710e-01f, -8.855424821e-02f, -8.683791012e-02f, -4.891557619e-02f,
+  -8.519060910e-02f, -4.726827890e-02f, -4.555194452e-02f, -7.629610598e-03f,
+  -8.362090588e-02f, -4.569857568e-02f, -4.398223758e-02f, -6.059904583e-03f,
+  -4.233494028e-02f, -4.412609152e-03f, -2.696271753e-03f, 3.522606194e-02f,
+  -8.213701844e-02f, -4.421468452e-02f, -4.249834642e-02f, -4.576014355e-03f,
+  -4.085105285e-02f, -2.928718925e-03f, -1.212381409e-03f, 3.670994937e-02f,
+  -3.928134590e-02f, -1.359013142e-03f, 3.573243739e-04f, 3.827965632e-02f,
+  2.004619688e-03f, 3.992695361e-02f, 4.164328799e-02f, 7.956562191e-02f,
+  -8.074678481e-02f, -4.282445461e-02f, -4.110811651e-02f, -3.185785376e-03f,
+  -3.946082294e-02f, -1.538489945e-03f, 1.778476289e-04f, 3.810017928e-02f,
+  -3.789111599e-02f, 3.121589907e-05f, 1.747553470e-03f, 3.966988623e-02f,
+  3.394848900e-03f, 4.131717980e-02f, 4.303351790e-02f, 8.095584810e-02f,
+  -3.640722483e-02f, 1.515106298e-03f, 3.231443930e-03f, 4.115377739e-02f,
+  4.878739361e-03f, 4.280107096e-02f, 4.451740906e-02f, 8.243974298e-02f,
+  6.448444910e-03f, 4.437077790e-02f, 4.608711600e-02f, 8.400944620e-02f,
+  4.773440957e-02f, 8.565673977e-02f, 8.737307787e-02f, 1.252954155e-01f,
+  -1.252954155e-01f, -8.737307787e-02f, -8.565673977e-02f, -4.773440957e-02f,
+  -8.400944620e-02f, -4.608711600e-02f, -4.437077790e-02f, -6.448444910e-03f,
+  -8.243974298e-02f, -4.451740906e-02f, -4.280107096e-02f, -4.878739361e-03f,
+  -4.115377739e-02f, -3.231443930e-03f, -1.515106298e-03f, 3.640722483e-02f,
+  -8.095584810e-02f, -4.303351790e-02f, -4.131717980e-02f, -3.394848900e-03f,
+  -3.966988623e-02f, -1.747553470e-03f, -3.121589907e-05f, 3.789111599e-02f,
+  -3.810017928e-02f, -1.778476289e-04f, 1.538489945e-03f, 3.946082294e-02f,
+  3.185785376e-03f, 4.110811651e-02f, 4.282445461e-02f, 8.074678481e-02f,
+  -7.956562191e-02f, -4.164328799e-02f, -3.992695361e-02f, -2.004619688e-03f,
+  -3.827965632e-02f, -3.573243739e-04f, 1.359013142e-03f, 3.928134590e-02f,
+  -3.670994937e-02f, 1.212381409e-03f, 2.928718925e-03f, 4.085105285e-02f,
+  4.576014355e-03f, 4.249834642e-02f, 4.421468452e-02f, 8.213701844e-02f,
+  -3.522606194e-02f, 2.696271753e-03f, 4.412609152e-03f, 4.233494028e-02f,
+  6.059904583e-03f, 4.398223758e-02f, 4.569857568e-02f, 8.362090588e-02f,
+  7.629610598e-03f, 4.555194452e-02f, 4.726827890e-02f, 8.519060910e-02f,
+  4.891557619e-02f, 8.683791012e-02f, 8.855424821e-02f, 1.264765710e-01f,
+  -7.827646285e-02f, -4.035413265e-02f, -3.863779455e-02f, -7.154620253e-04f,
+  -3.699049726e-02f, 9.318334050e-04f, 2.648170805e-03f, 4.057050124e-02f,
+  -3.542079404e-02f, 2.501539188e-03f, 4.217876587e-03f, 4.214020818e-02f,
+  5.865172017e-03f, 4.378750548e-02f, 4.550384358e-02f, 8.342617750e-02f,
+  -3.393690288e-02f, 3.985429648e-03f, 5.701767281e-03f, 4.362409934e-02f,
+  7.349062711e-03f, 4.527139291e-02f, 4.698773101e-02f, 8.491006494e-02f,
+  8.918768726e-03f, 4.684109986e-02f, 4.855743796e-02f, 8.647976816e-02f,
+  5.020473152e-02f, 8.812706918e-02f, 8.984339982e-02f, 1.277657300e-01f,
+  -3.254667297e-02f, 5.375658628e-03f, 7.091996260e-03f, 4.501432925e-02f,
+  8.739291690e-03f, 4.666162282e-02f, 4.837796092e-02f, 8.630029112e-02f,
+  1.030899771e-02f, 4.823132977e-02f, 4.994766787e-02f, 8.787000179e-02f,
+  5.159496143e-02f, 8.951729536e-02f, 9.123363346e-02f, 1.291559637e-01f,
+  1.179288793e-02f, 4.971522093e-02f, 5.143155903e-02f, 8.935388923e-02f,
+  5.307885259e-02f, 9.100118279e-02f, 9.271752089e-02f, 1.306398511e-01f,
+  5.464855954e-02f, 9.257089347e-02f, 9.428723156e-02f, 1.322095543e-01f,
+  9.593452513e-02f, 1.338568628e-01f, 1.355731934e-01f, 1.734955311e-01f
+},
+{
+  -2.066731453e-01f, -1.574062407e-01f, -1.564596146e-01f, -1.071927100e-01f,
+  -1.556383371e-01f, -1.063714325e-01f, -1.054248065e-01f, -5.615790188e-02f,
+  -1.549468935e-01f, -1.056799889e-01f, -1.047333702e-01f, -5.546646193e-02f,
+  -1.039120853e-01f, -5.464518070e-02f, -5.369855836e-02f, -4.431654699e-03f,
+  -1.543890983e-01f, -1.051221937e-01f, -1.041755751e-01f, -5.490867049e-02f,
+  -1.033542901e-01f, -5.408738926e-02f, -5.314076692e-02f, -3.873861860e-03f,
+  -1.026628539e-01f, -5.339594930e-02f, -5.244932696e-02f, -3.182422137e-03f,
+  -5.162804574e-02f, -2.361140214e-03f, -1.414519036e-03f, 4.785238579e-02f,
+  -1.539680362e-01f, -1.047011316e-01f, -1.037545055e-01f, -5.448760092e-02f,
+  -1.029332280e-01f, -5.366631970e-02f, -5.271969736e-02f, -3.452793695e-03f,
+  -1.022417843e-01f, -5.297487974e-02f, -5.202825740e-02f, -2.761353971e-03f,
+  -5.120697618e-02f, -1.940071932e-03f, -9.934508707e-04f, 4.827345535e-02f,
+  -1.016839892e-01f, -5.241708830e-02f, -5.147046596e-02f, -2.203561133e-03f,
+  -5.064918473e-02f, -1.382278977e-03f, -4.356578866e-04f, 4.883124679e-02f,
+  -4.995774478e-02f, -6.908392534e-04f, 2.557818952e-04f, 4.952268675e-02f,
+  1.077063964e-03f, 5.034396797e-02f, 5.129059032e-02f, 1.005574986e-01f,
+  -1.536860168e-01f, -1.044191122e-01f, -1.034724936e-01f, -5.420558900e-02f,
+  -1.026512086e-01f, -5.338430405e-02f, -5.243768543e-02f, -3.170778975e-03f,
+  -1.019597724e-01f, -5.269286409e-02f, -5.174624547e-02f, -2.479339251e-03f,
+  -5.092496052e-02f, -1.658057212e-03f, -7.114360342e-04f, 4.855546728e-02f,
+  -1.014019772e-01f, -5.213507265e-02f, -5.118845031e-02f, -1.921546296e-03f,
+  -5.036716908e-02f, -1.100264257e-03f, -1.536430937e-04f, 4.911326244e-02f,
+  -4.967572913e-02f, -4.088244459e-04f, 5.377967027e-04f, 4.980470240e-02f,
+  1.359078684e-03f, 5.062598363e-02f, 5.157260597e-02f, 1.008395106e-01f,
+  -1.009809077e-01f, -5.171400309e-02f, -5.076738447e-02f, -1.500478131e-03f,
+  -4.994609952e-02f, -6.791960332e-04f, 2.674250863e-04f, 4.953433201e-02f,
+  -4.925465956e-02f, 1.224373409e-05f, 9.588648682e-04f, 5.022576824e-02f,
+  1.780146849e-03f, 5.104705319e-02f, 5.199367180e-02f, 1.012605801e-01f,
+  -4.869686812e-02f, 5.700367037e-04f, 1.516657765e-03f, 5.078356341e-02f,
+  2.337939804e-03f, 5.160484463e-02f, 5.255146697e-02f, 1.018183678e-01f,
+  3.029379528e-03f, 5.229628459e-02f, 5.324290693e-02f, 1.025098115e-01f,
+  5.406418815e-02f, 1.033310965e-01f, 1.042777151e-01f, 1.535446197e-01f,
+  -1.535446197e-01f, -1.042777151e-01f, -1.033310965e-01f, -5.406418815e-02f,
+  -1.025098115e-01f, -5.324290693e-02f, -5.229628459e-02f, -3.029379528e-03f,
+  -1.018183678e-01f, -5.255146697e-02f, -5.160484463e-02f, -2.337939804e-03f,
+  -5.078356341e-02f, -1.516657765e-03f, -5.700367037e-04f, 4.869686812e-02f,
+  -1.012605801e-01f, -5.199367180e-02f, -5.104705319e-02f, -1.780146849e-03f,
+  -5.022576824e-02f, -9.588648682e-04f, -1.224373409e-05f, 4.925465956e-02f,
+  -4.953433201e-02f, -2.674250863e-04f, 6.791960332e-04f, 4.994609952e-02f,
+  1.500478131e-03f, 5.076738447e-02f, 5.171400309e-02f, 1.009809077e-01f,
+  -1.008395106e-01f, -5.157260597e-02f, -5.062598363e-02f, -1.359078684e-03f,
+  -4.980470240e-02f, -5.377967027e-04f, 4.088244459e-04f, 4.967572913e-02f,
+  -4.911326244e-02f, 1.536430937e-04f, 1.100264257e-03f, 5.036716908e-02f,
+  1.921546296e-03f, 5.118845031e-02f, 5.213507265e-02f, 1.014019772e-01f,
+  -4.855546728e-02f, 7.114360342e-04f, 1.658057212e-03f, 5.092496052e-02f,
+  2.479339251e-03f, 5.174624547e-02f, 5.269286409e-02f, 1.019597724e-01f,
+  3.170778975e-03f, 5.243768543e-02f, 5.338430405e-02f, 1.026512086e-01f,
+  5.420558900e-02f, 1.034724936e-01f, 1.044191122e-01f, 1.536860168e-01f,
+  -1.005574986e-01f, -5.129059032e-02f, -5.034396797e-02f, -1.077063964e-03f,
+  -4.952268675e-02f, -2.557818952e-04f, 6.908392534e-04f, 4.995774478e-02f,
+  -4.883124679e-02f, 4.356578866e-04f, 1.382278977e-03f, 5.064918473e-02f,
+  2.203561133e-03f, 5.147046596e-02f, 5.241708830e-02f, 1.016839892e-01f,
+  -4.827345535e-02f, 9.934508707e-04f, 1.940071932e-03f, 5.120697618e-02f,
+  2.761353971e-03f, 5.202825740e-02f, 5.297487974e-02f, 1.022417843e-01f,
+  3.452793695e-03f, 5.271969736e-02f, 5.366631970e-02f, 1.029332280e-01f,
+  5.448760092e-02f, 1.037545055e-01f, 1.047011316e-01f, 1.539680362e-01f,
+  -4.785238579e-02f, 1.414519036e-03f, 2.361140214e-03f, 5.162804574e-02f,
+  3.182422137e-03f, 5.244932696e-02f, 5.339594930e-02f, 1.026628539e-01f,
+  3.873861860e-03f, 5.314076692e-02f, 5.408738926e-02f, 1.033542901e-01f,
+  5.490867049e-02f, 1.041755751e-01f, 1.051221937e-01f, 1.543890983e-01f,
+  4.431654699e-03f, 5.369855836e-02f, 5.464518070e-02f, 1.039120853e-01f,
+  5.546646193e-02f, 1.047333702e-01f, 1.056799889e-01f, 1.549468935e-01f,
+  5.615790188e-02f, 1.054248065e-01f, 1.063714325e-01f, 1.556383371e-01f,
+  1.071927100e-01f, 1.564596146e-01f, 1.574062407e-01f, 2.066731453e-01f
+}
+};
+
+static const float ctables512[48][256] = {
+{
+  3.207920329e-08f, 2.216717476e-08f, 2.149578116e-08f, 1.158375174e-08f,
+  2.128900256e-08f, 1.137697314e-08f, 1.070557865e-08f, 7.935499480e-10f,
+  2.165223734e-08f, 1.174020881e-08f, 1.106881431e-08f, 1.156785556e-09f,
+  1.086203572e-08f, 9.500070730e-10f, 2.786123554e-10f, -9.633416731e-09f,
+  2.270047261e-08f, 1.278844408e-08f, 1.211704959e-08f, 2.205020611e-09f,
+  1.191027099e-08f, 1.998242238e-09f, 1.326847521e-09f, -8.585181455e-09f,
+  1.227350666e-08f, 2.361477680e-09f, 1.690083073e-09f, -8.221945791e-09f,
+  1.483304590e-09f, -8.428724385e-09f, -9.100118881e-09f, -1.901214830e-08f,
+  2.455842640e-08f, 1.464639787e-08f, 1.397500249e-08f, 4.062973957e-09f,
+  1.376822478e-08f, 3.856195807e-09f, 3.184800867e-09f, -6.727227664e-09f,
+  1.413145956e-08f, 4.219431027e-09f, 3.548036531e-09f, -6.363992444e-09f,
+  3.341257937e-09f, -6.570770594e-09f, -7.242165534e-09f, -1.715419451e-08f,
+  1.517969572e-08f, 5.267666303e-09f, 4.596271808e-09f, -5.315757168e-09f,
+  4.389493213e-09f, -5.522535762e-09f, -6.193930258e-09f, -1.610595923e-08f,
+  4.752728877e-09f, -5.159300098e-09f, -5.830694594e-09f, -1.574272268e-08f,
+  -6.037473188e-09f, -1.594950128e-08f, -1.662089666e-08f, -2.653292519e-08f,
+  2.736063820e-08f, 1.744860967e-08f, 1.677721428e-08f, 6.865185309e-09f,
+  1.657043569e-08f, 6.658407159e-09f, 5.987012219e-09f, -3.925016312e-09f,
+  1.693367047e-08f, 7.021642379e-09f, 6.350247883e-09f, -3.561780870e-09f,
+  6.143469289e-09f, -3.768559242e-09f, -4.439954182e-09f, -1.435198271e-08f,
+  1.798190574e-08f, 8.069878099e-09f, 7.398483159e-09f, -2.513545816e-09f,
+  7.191704565e-09f, -2.720324188e-09f, -3.391718906e-09f, -1.330374744e-08f,
+  7.554939785e-09f, -2.357088746e-09f, -3.028483242e-09f, -1.294051177e-08f,
+  -3.235261836e-09f, -1.314729037e-08f, -1.381868486e-08f, -2.373071339e-08f,
+  1.983985953e-08f, 9.927831002e-09f, 9.256436506e-09f, -6.555922472e-10f,
+  9.049657912e-09f, -8.623707304e-10f, -1.533765448e-09f, -1.144579453e-08f,
+  9.412893576e-09f, -4.991351776e-10f, -1.170529895e-09f, -1.108255887e-08f,
+  -1.377308378e-09f, -1.128933746e-08f, -1.196073196e-08f, -2.187276138e-08f,
+  1.046112885e-08f, 5.490999322e-10f, -1.222947438e-10f, -1.003432359e-08f,
+  -3.290732131e-10f, -1.024110219e-08f, -1.091249668e-08f, -2.082452610e-08f,
+  3.416233962e-11f, -9.877866525e-09f, -1.054926102e-08f, -2.046128955e-08f,
+  -1.075603961e-08f, -2.066806815e-08f, -2.133946353e-08f, -3.125149206e-08f,
+  3.125149206e-08f, 2.133946353e-08f, 2.066806815e-08f, 1.075603961e-08f,
+  2.046128955e-08f, 1.054926102e-08f, 9.877866525e-09f, -3.416233962e-11f,
+  2.082452610e-08f, 1.091249668e-08f, 1.024110219e-08f, 3.290732131e-10f,
+  1.003432359e-08f, 1.222947438e-10f, -5.490999322e-10f, -1.046112885e-08f,
+  2.187276138e-08f, 1.196073196e-08f, 1.128933746e-08f, 1.377308378e-09f,
+  1.108255887e-08f, 1.170529895e-09f, 4.991351776e-10f, -9.412893576e-09f,
+  1.144579453e-08f, 1.533765448e-09f, 8.623707304e-10f, -9.049657912e-09f,
+  6.555922472e-10f, -9.256436506e-09f, -9.927831002e-09f, -1.983985953e-08f,
+  2.373071339e-08f, 1.381868486e-08f, 1.314729037e-08f, 3.235261836e-09f,
+  1.294051177e-08f, 3.028483242e-09f, 2.357088746e-09f, -7.554939785e-09f,
+  1.330374744e-08f, 3.391718906e-09f, 2.720324188e-09f, -7.191704565e-09f,
+  2.513545816e-09f, -7.398483159e-09f, -8.069878099e-09f, -1.798190574e-08f,
+  1.435198271e-08f, 4.439954182e-09f, 3.768559242e-09f, -6.143469289e-09f,
+  3.561780870e-09f, -6.350247883e-09f, -7.021642379e-09f, -1.693367047e-08f,
+  3.925016312e-09f, -5.987012219e-09f, -6.658407159e-09f, -1.657043569e-08f,
+  -6.865185309e-09f, -1.677721428e-08f, -1.744860967e-08f, -2.736063820e-08f,
+  2.653292519e-08f, 1.662089666e-08f, 1.594950128e-08f, 6.037473188e-09f,
+  1.574272268e-08f, 5.830694594e-09f, 5.159300098e-09f, -4.752728877e-09f,
+  1.610595923e-08f, 6.193930258e-09f, 5.522535762e-09f, -4.389493213e-09f,
+  5.315757168e-09f, -4.596271808e-09f, -5.267666303e-09f, -1.517969572e-08f,
+  1.715419451e-08f, 7.242165534e-09f, 6.570770594e-09f, -3.341257937e-09f,
+  6.363992444e-09f, -3.548036531e-09f, -4.219431027e-09f, -1.413145956e-08f,
+  6.727227664e-09f, -3.184800867e-09f, -3.856195807e-09f, -1.376822478e-08f,
+  -4.062973957e-09f, -1.397500249e-08f, -1.464639787e-08f, -2.455842640e-08f,
+  1.901214830e-08f, 9.100118881e-09f, 8.428724385e-09f, -1.483304590e-09f,
+  8.221945791e-09f, -1.690083073e-09f, -2.361477680e-09f, -1.227350666e-08f,
+  8.585181455e-09f, -1.326847521e-09f, -1.998242238e-09f, -1.191027099e-08f,
+  -2.205020611e-09f, -1.211704959e-08f, -1.278844408e-08f, -2.270047261e-08f,
+  9.633416731e-09f, -2.786123554e-10f, -9.500070730e-10f, -1.086203572e-08f,
+  -1.156785556e-09f, -1.106881431e-08f, -1.174020881e-08f, -2.165223734e-08f,
+  -7.935499480e-10f, -1.070557865e-08f, -1.137697314e-08f, -2.128900256e-08f,
+  -1.158375174e-08f, -2.149578116e-08f, -2.216717476e-08f, -3.207920329e-08f
+},
+{
+  -1.596598906e-07f, -1.553539164e-07f, -1.488135410e-07f, -1.445075668e-07f,
+  -1.406931176e-07f, -1.363871434e-07f, -1.298467680e-07f, -1.255407938e-07f,
+  -1.308100934e-07f, -1.265041192e-07f, -1.199637438e-07f, -1.156577767e-07f,
+  -1.118433204e-07f, -1.075373461e-07f, -1.009969708e-07f, -9.669099654e-08f,
+  -1.189730980e-07f, -1.146671238e-07f, -1.081267484e-07f, -1.038207742e-07f,
+  -1.000063250e-07f, -9.570035076e-08f, -8.915997540e-08f, -8.485400116e-08f,
+  -9.012330082e-08f, -8.581732658e-08f, -7.927695123e-08f, -7.497097698e-08f,
+  -7.115652778e-08f, -6.685055354e-08f, -6.031017818e-08f, -5.600420749e-08f,
+  -1.049823908e-07f, -1.006764236e-07f, -9.413604829e-08f, -8.983007405e-08f,
+  -8.601561774e-08f, -8.170965060e-08f, -7.516926814e-08f, -7.086330100e-08f,
+  -7.613259356e-08f, -7.182662642e-08f, -6.528625107e-08f, -6.098027683e-08f,
+  -5.716582407e-08f, -5.285985338e-08f, -4.631947448e-08f, -4.201350379e-08f,
+  -6.429559818e-08f, -5.998963104e-08f, -5.344925214e-08f, -4.914328144e-08f,
+  -4.532882514e-08f, -4.102285445e-08f, -3.448247909e-08f, -3.017650840e-08f,
+  -3.544580451e-08f, -3.113983382e-08f, -2.459945492e-08f, -2.029348423e-08f,
+  -1.647902970e-08f, -1.217305901e-08f, -5.632680544e-09f, -1.326710630e-09f,
+  -8.863047185e-08f, -8.432450471e-08f, -7.778412225e-08f, -7.347815512e-08f,
+  -6.966369881e-08f, -6.535773167e-08f, -5.881734921e-08f, -5.451137852e-08f,
+  -5.978067463e-08f, -5.547470394e-08f, -4.893432504e-08f, -4.462835790e-08f,
+  -4.081390159e-08f, -3.650793090e-08f, -2.996755200e-08f, -2.566158308e-08f,
+  -4.794367925e-08f, -4.363770856e-08f, -3.709732965e-08f, -3.279135896e-08f,
+  -2.897690443e-08f, -2.467093374e-08f, -1.813055661e-08f, -1.382458592e-08f,
+  -1.909388203e-08f, -1.478791134e-08f, -8.247533323e-09f, -3.941562632e-09f,
+  -1.271074912e-10f, 4.178862589e-09f, 1.071924061e-08f, 1.502521130e-08f,
+  -3.395297554e-08f, -2.964700663e-08f, -2.310662772e-08f, -1.880065881e-08f,
+  -1.498620250e-08f, -1.068023270e-08f, -4.139854681e-09f, 1.661155241e-10f,
+  -5.103180101e-09f, -7.972097982e-10f, 5.743168607e-09f, 1.004913841e-08f,
+  1.386359383e-08f, 1.816956363e-08f, 2.470994254e-08f, 2.901591323e-08f,
+  6.733816615e-09f, 1.103978686e-08f, 1.758016488e-08f, 2.188613557e-08f,
+  2.570059010e-08f, 3.000656079e-08f, 3.654693970e-08f, 4.085291039e-08f,
+  3.558361428e-08f, 3.988958497e-08f, 4.642996387e-08f, 5.073593101e-08f,
+  5.455038732e-08f, 5.885635801e-08f, 6.539673336e-08f, 6.970270761e-08f,
+  -6.970270761e-08f, -6.539673336e-08f, -5.885635801e-08f, -5.455038732e-08f,
+  -5.073593101e-08f, -4.642996387e-08f, -3.988958497e-08f, -3.558361428e-08f,
+  -4.085291039e-08f, -3.654693970e-08f, -3.000656079e-08f, -2.570059010e-08f,
+  -2.188613557e-08f, -1.758016488e-08f, -1.103978686e-08f, -6.733816615e-09f,
+  -2.901591323e-08f, -2.470994254e-08f, -1.816956363e-08f, -1.386359383e-08f,
+  -1.004913841e-08f, -5.743168607e-09f, 7.972097982e-10f, 5.103180101e-09f,
+  -1.661155241e-10f, 4.139854681e-09f, 1.068023270e-08f, 1.498620250e-08f,
+  1.880065881e-08f, 2.310662772e-08f, 2.964700663e-08f, 3.395297554e-08f,
+  -1.502521130e-08f, -1.071924061e-08f, -4.178862589e-09f, 1.271074912e-10f,
+  3.941562632e-09f, 8.247533323e-09f, 1.478791134e-08f, 1.909388203e-08f,
+  1.382458592e-08f, 1.813055661e-08f, 2.467093374e-08f, 2.897690443e-08f,
+  3.279135896e-08f, 3.709732965e-08f, 4.363770856e-08f, 4.794367925e-08f,
+  2.566158308e-08f, 2.996755200e-08f, 3.650793090e-08f, 4.081390159e-08f,
+  4.462835790e-08f, 4.893432504e-08f, 5.547470394e-08f, 5.978067463e-08f,
+  5.451137852e-08f, 5.881734921e-08f, 6.535773167e-08f, 6.966369881e-08f,
+  7.347815512e-08f, 7.778412225e-08f, 8.432450471e-08f, 8.863047185e-08f,
+  1.326710630e-09f, 5.632680544e-09f, 1.217305901e-08f, 1.647902970e-08f,
+  2.029348423e-08f, 2.459945492e-08f, 3.113983382e-08f, 3.544580451e-08f,
+  3.017650840e-08f, 3.448247909e-08f, 4.102285445e-08f, 4.532882514e-08f,
+  4.914328144e-08f, 5.344925214e-08f, 5.998963104e-08f, 6.429559818e-08f,
+  4.201350379e-08f, 4.631947448e-08f, 5.285985338e-08f, 5.716582407e-08f,
+  6.098027683e-08f, 6.528625107e-08f, 7.182662642e-08f, 7.613259356e-08f,
+  7.086330100e-08f, 7.516926814e-08f, 8.170965060e-08f, 8.601561774e-08f,
+  8.983007405e-08f, 9.413604829e-08f, 1.006764236e-07f, 1.049823908e-07f,
+  5.600420749e-08f, 6.031017818e-08f, 6.685055354e-08f, 7.115652778e-08f,
+  7.497097698e-08f, 7.927695123e-08f, 8.581732658e-08f, 9.012330082e-08f,
+  8.485400116e-08f, 8.915997540e-08f, 9.570035076e-08f, 1.000063250e-07f,
+  1.038207742e-07f, 1.081267484e-07f, 1.146671238e-07f, 1.189730980e-07f,
+  9.669099654e-08f, 1.009969708e-07f, 1.075373461e-07f, 1.118433204e-07f,
+  1.156577767e-07f, 1.199637438e-07f, 1.265041192e-07f, 1.308100934e-07f,
+  1.255407938e-07f, 1.298467680e-07f, 1.363871434e-07f, 1.406931176e-07f,
+  1.445075668e-07f, 1.488135410e-07f, 1.553539164e-07f, 1.596598906e-07f
+},
+{
+  -8.925325687e-07f, -7.808508258e-07f, -7.561030770e-07f, -6.444213341e-07f,
+  -7.281014405e-07f, -6.164196975e-07f, -5.916720056e-07f, -4.799902626e-07f,
+  -6.966118349e-07f, -5.849300919e-07f, -5.601823432e-07f, -4.485006286e-07f,
+  -5.321807066e-07f, -4.204989921e-07f, -3.957512718e-07f, -2.840695288e-07f,
+  -6.613981895e-07f, -5.497164466e-07f, -5.249687547e-07f, -4.132870117e-07f,
+  -4.969671181e-07f, -3.852853467e-07f, -3.605376264e-07f, -2.488558835e-07f,
+  -4.654774841e-07f, -3.537957411e-07f, -3.290480208e-07f, -2.173662779e-07f,
+  -3.010463558e-07f, -1.893646271e-07f, -1.646169068e-07f, -5.293517447e-08f,
+  -6.222238653e-07f, -5.105421792e-07f, -4.857944305e-07f, -3.741126875e-07f,
+  -4.577927939e-07f, -3.461110509e-07f, -3.213633306e-07f, -2.096816019e-07f,
+  -4.263031599e-07f, -3.146214169e-07f, -2.898737250e-07f, -1.781919821e-07f,
+  -2.618720600e-07f, -1.501903313e-07f, -1.254426110e-07f, -1.376087333e-08f,
+  -3.910895430e-07f, -2.794078000e-07f, -2.546600797e-07f, -1.429783367e-07f,
+  -2.266584289e-07f, -1.149766931e-07f, -9.022897984e-08f, 2.145275957e-08f,
+  -1.951688091e-07f, -8.348707325e-08f, -5.873936004e-08f, 5.294237937e-08f,
+  -3.073771282e-08f, 8.094402659e-08f, 1.056917398e-07f, 2.173734828e-07f,
+  -5.788531894e-07f, -4.671714464e-07f, -4.424237261e-07f, -3.307419831e-07f,
+  -4.144220611e-07f, -3.027403466e-07f, -2.779926263e-07f, -1.663108833e-07f,
+  -3.829324555e-07f, -2.712507126e-07f, -2.465029922e-07f, -1.348212635e-07f,
+  -2.185013557e-07f, -1.068196127e-07f, -8.207189950e-08f, 2.960984169e-08f,
+  -3.477188102e-07f, -2.360370814e-07f, -2.112893611e-07f, -9.960762526e-08f,
+  -1.832877246e-07f, -7.160598159e-08f, -4.685826482e-08f, 6.482347459e-08f,
+  -1.517981048e-07f, -4.011635824e-08f, -1.536864502e-08f, 9.631309439e-08f,
+  1.263300398e-08f, 1.243147381e-07f, 1.490624584e-07f, 2.607442013e-07f,
+  -3.085445144e-07f, -1.968627856e-07f, -1.721150653e-07f, -6.043332945e-08f,
+  -1.441134145e-07f, -3.243167868e-08f, -7.683964576e-09f, 1.039977775e-07f,
+  -1.126238018e-07f, -9.420598746e-10f, 2.380565611e-08f, 1.354873973e-07f,
+  5.180730511e-08f, 1.634890481e-07f, 1.882367542e-07f, 2.999184971e-07f,
+  -7.741016361e-08f, 3.427157225e-08f, 5.901928901e-08f, 1.707010284e-07f,
+  8.702093623e-08f, 1.987026792e-07f, 2.234503853e-07f, 3.351321425e-07f,
+  1.185105560e-07f, 2.301922990e-07f, 2.549400051e-07f, 3.666217481e-07f,
+  2.829416701e-07f, 3.946233846e-07f, 4.193711050e-07f, 5.310528763e-07f,
+  -5.310528763e-07f, -4.193711050e-07f, -3.946233846e-07f, -2.829416701e-07f,
+  -3.666217481e-07f, -2.549400051e-07f, -2.301922990e-07f, -1.185105560e-07f,
+  -3.351321425e-07f, -2.234503853e-07f, -1.987026792e-07f, -8.702093623e-08f,
+  -1.707010284e-07f, -5.901928901e-08f, -3.427157225e-08f, 7.741016361e-08f,
+  -2.999184971e-07f, -1.882367542e-07f, -1.634890481e-07f, -5.180730511e-08f,
+  -1.354873973e-07f, -2.380565611e-08f, 9.420598746e-10f, 1.126238018e-07f,
+  -1.039977775e-07f, 7.683964576e-09f, 3.243167868e-08f, 1.441134145e-07f,
+  6.043332945e-08f, 1.721150653e-07f, 1.968627856e-07f, 3.085445144e-07f,
+  -2.607442013e-07f, -1.490624584e-07f, -1.243147381e-07f, -1.263300398e-08f,
+  -9.631309439e-08f, 1.536864502e-08f, 4.011635824e-08f, 1.517981048e-07f,
+  -6.482347459e-08f, 4.685826482e-08f, 7.160598159e-08f, 1.832877246e-07f,
+  9.960762526e-08f, 2.112893611e-07f, 2.360370814e-07f, 3.477188102e-07f,
+  -2.960984169e-08f, 8.207189950e-08f, 1.068196127e-07f, 2.185013557e-07f,
+  1.348212635e-07f, 2.465029922e-07f, 2.712507126e-07f, 3.829324555e-07f,
+  1.663108833e-07f, 2.779926263e-07f, 3.027403466e-07f, 4.144220611e-07f,
+  3.307419831e-07f, 4.424237261e-07f, 4.671714464e-07f, 5.788531894e-07f,
+  -2.173734828e-07f, -1.056917398e-07f, -8.094402659e-08f, 3.073771282e-08f,
+  -5.294237937e-08f, 5.873936004e-08f, 8.348707325e-08f, 1.951688091e-07f,
+  -2.145275957e-08f, 9.022897984e-08f, 1.149766931e-07f, 2.266584289e-07f,
+  1.429783367e-07f, 2.546600797e-07f, 2.794078000e-07f, 3.910895430e-07f,
+  1.376087333e-08f, 1.254426110e-07f, 1.501903313e-07f, 2.618720600e-07f,
+  1.781919821e-07f, 2.898737250e-07f, 3.146214169e-07f, 4.263031599e-07f,
+  2.096816019e-07f, 3.213633306e-07f, 3.461110509e-07f, 4.577927939e-07f,
+  3.741126875e-07f, 4.857944305e-07f, 5.105421792e-07f, 6.222238653e-07f,
+  5.293517447e-08f, 1.646169068e-07f, 1.893646271e-07f, 3.010463558e-07f,
+  2.173662779e-07f, 3.290480208e-07f, 3.537957411e-07f, 4.654774841e-07f,
+  2.488558835e-07f, 3.605376264e-07f, 3.852853467e-07f, 4.969671181e-07f,
+  4.132870117e-07f, 5.249687547e-07f, 5.497164466e-07f, 6.613981895e-07f,
+  2.840695288e-07f, 3.957512718e-07f, 4.204989921e-07f, 5.321807066e-07f,
+  4.485006286e-07f, 5.601823432e-07f, 5.849300919e-07f, 6.966118349e-07f,
+  4.799902626e-07f, 5.916720056e-07f, 6.164196975e-07f, 7.281014405e-07f,
+  6.444213341e-07f, 7.561030770e-07f, 7.808508258e-07f, 8.925325687e-07f
+},
+{
+  -2.607928309e-06f, -2.193989758e-06f, -2.136649982e-06f, -1.722711545e-06f,
+  -2.074214763e-06f, -1.660276212e-06f, -1.602936322e-06f, -1.188997771e-06f,
+  -2.006480145e-06f, -1.592541594e-06f, -1.535201704e-06f, -1.121263267e-06f,
+  -1.472766485e-06f, -1.058827934e-06f, -1.001488044e-06f, -5.875495503e-07f,
+  -1.933255135e-06f, -1.519316584e-06f, -1.461976694e-06f, -1.048038257e-06f,
+  -1.399541361e-06f, -9.856029237e-07f, -9.282630344e-07f, -5.143245403e-07f,
+  -1.331806857e-06f, -9.178683058e-07f, -8.605284734e-07f, -4.465899792e-07f,
+  -7.980931400e-07f, -3.841546743e-07f, -3.268147850e-07f, 8.712369493e-08f,
+  -1.854363632e-06f, -1.440425194e-06f, -1.383085305e-06f, -9.691468676e-07f,
+  -1.320649972e-06f, -9.067115343e-07f, -8.493716450e-07f, -4.354331509e-07f,
+  -1.252915467e-06f, -8.389769164e-07f, -7.816370271e-07f, -3.676985614e-07f,
+  -7.192017506e-07f, -3.052632565e-07f, -2.479233956e-07f, 1.660150986e-07f,
+  -1.179690457e-06f, -7.657519063e-07f, -7.084120170e-07f, -2.944735513e-07f,
+  -6.459767405e-07f, -2.320382606e-07f, -1.746983713e-07f, 2.392401086e-07f,
+  -5.782421795e-07f, -1.643036569e-07f, -1.069637818e-07f, 3.069746981e-07f,
+  -4.452849112e-08f, 3.694100030e-07f, 4.267498639e-07f, 8.406883580e-07f,
+  -1.769647611e-06f, -1.355709173e-06f, -1.298369284e-06f, -8.844307899e-07f,
+  -1.235933951e-06f, -8.219954566e-07f, -7.646556242e-07f, -3.507171300e-07f,
+  -1.168199333e-06f, -7.542608955e-07f, -6.969210062e-07f, -2.829825405e-07f,
+  -6.344857297e-07f, -2.205472356e-07f, -1.632073605e-07f, 2.507311478e-07f,
+  -1.094974323e-06f, -6.810358855e-07f, -6.236959962e-07f, -2.097575162e-07f,
+  -5.612607197e-07f, -1.473222113e-07f, -8.998233625e-08f, 3.239561579e-07f,
+  -4.935261018e-07f, -7.958762183e-08f, -2.224774676e-08f, 3.916907474e-07f,
+  4.018754751e-08f, 4.541260239e-07f, 5.114659416e-07f, 9.254043789e-07f,
+  -1.016082933e-06f, -6.021444960e-07f, -5.448046068e-07f, -1.308661126e-07f,
+  -4.823693303e-07f, -6.843081479e-08f, -1.109093617e-08f, 4.028475473e-07f,
+  -4.146347123e-07f, -6.962234123e-10f, 5.664365332e-08f, 4.705821368e-07f,
+  1.190789476e-07f, 5.330174417e-07f, 5.903573310e-07f, 1.004295768e-06f,
+  -3.414097023e-07f, 7.252879186e-08f, 1.298686669e-07f, 5.438071753e-07f,
+  1.923039719e-07f, 6.062424518e-07f, 6.635823411e-07f, 1.077520778e-06f,
+  2.600385471e-07f, 6.739770697e-07f, 7.313169021e-07f, 1.145255396e-06f,
+  7.937522355e-07f, 1.207690730e-06f, 1.265030619e-06f, 1.678969056e-06f,
+  -1.678969056e-06f, -1.265030619e-06f, -1.207690730e-06f, -7.937522355e-07f,
+  -1.145255396e-06f, -7.313169021e-07f, -6.739770697e-07f, -2.600385471e-07f,
+  -1.077520778e-06f, -6.635823411e-07f, -6.062424518e-07f, -1.923039719e-07f,
+  -5.438071753e-07f, -1.298686669e-07f, -7.252879186e-08f, 3.414097023e-07f,
+  -1.004295768e-06f, -5.903573310e-07f, -5.330174417e-07f, -1.190789476e-07f,
+  -4.705821368e-07f, -5.664365332e-08f, 6.962234123e-10f, 4.146347123e-07f,
+  -4.028475473e-07f, 1.109093617e-08f, 6.843081479e-08f, 4.823693303e-07f,
+  1.308661126e-07f, 5.448046068e-07f, 6.021444960e-07f, 1.016082933e-06f,
+  -9.254043789e-07f, -5.114659416e-07f, -4.541260239e-07f, -4.018754751e-08f,
+  -3.916907474e-07f, 2.224774676e-08f, 7.958762183e-08f, 4.935261018e-07f,
+  -3.239561579e-07f, 8.998233625e-08f, 1.473222113e-07f, 5.612607197e-07f,
+  2.097575162e-07f, 6.236959962e-07f, 6.810358855e-07f, 1.094974323e-06f,
+  -2.507311478e-07f, 1.632073605e-07f, 2.205472356e-07f, 6.344857297e-07f,
+  2.829825405e-07f, 6.969210062e-07f, 7.542608955e-07f, 1.168199333e-06f,
+  3.507171300e-07f, 7.646556242e-07f, 8.219954566e-07f, 1.235933951e-06f,
+  8.844307899e-07f, 1.298369284e-06f, 1.355709173e-06f, 1.769647611e-06f,
+  -8.406883580e-07f, -4.267498639e-07f, -3.694100030e-07f, 4.452849112e-08f,
+  -3.069746981e-07f, 1.069637818e-07f, 1.643036569e-07f, 5.782421795e-07f,
+  -2.392401086e-07f, 1.746983713e-07f, 2.320382606e-07f, 6.459767405e-07f,
+  2.944735513e-07f, 7.084120170e-07f, 7.657519063e-07f, 1.179690457e-06f,
+  -1.660150986e-07f, 2.479233956e-07f, 3.052632565e-07f, 7.192017506e-07f,
+  3.676985614e-07f, 7.816370271e-07f, 8.389769164e-07f, 1.252915467e-06f,
+  4.354331509e-07f, 8.493716450e-07f, 9.067115343e-07f, 1.320649972e-06f,
+  9.691468676e-07f, 1.383085305e-06f, 1.440425194e-06f, 1.854363632e-06f,
+  -8.712369493e-08f, 3.268147850e-07f, 3.841546743e-07f, 7.980931400e-07f,
+  4.465899792e-07f, 8.605284734e-07f, 9.178683058e-07f, 1.331806857e-06f,
+  5.143245403e-07f, 9.282630344e-07f, 9.856029237e-07f, 1.399541361e-06f,
+  1.048038257e-06f, 1.461976694e-06f, 1.519316584e-06f, 1.933255135e-06f,
+  5.875495503e-07f, 1.001488044e-06f, 1.058827934e-06f, 1.472766485e-06f,
+  1.121263267e-06f, 1.535201704e-06f, 1.592541594e-06f, 2.006480145e-06f,
+  1.188997771e-06f, 1.602936322e-06f, 1.660276212e-06f, 2.074214763e-06f,
+  1.722711545e-06f, 2.136649982e-06f, 2.193989758e-06f, 2.607928309e-06f
+},
+{
+  -5.718034117e-06f, -4.692319180e-06f, -4.589397122e-06f, -3.563681958e-06f,
+  -4.480249572e-06f, -3.454534180e-06f, -3.351612349e-06f, -2.325897185e-06f,
+  -4.364847882e-06f, -3.339132945e-06f, -3.236211114e-06f, -2.210495950e-06f,
+  -3.127063337e-06f, -2.101348173e-06f, -1.998426342e-06f, -9.727111774e-07f,
+  -4.243200237e-06f, -3.217485300e-06f, -3.114563469e-06f, -2.088848305e-06f,
+  -3.005415692e-06f, -1.979700528e-06f, -1.876778697e-06f, -8.510635894e-07f,
+  -2.890014230e-06f, -1.864299179e-06f, -1.761377348e-06f, -7.356622405e-07f,
+  -1.652229571e-06f, -6.265145203e-07f, -5.235926324e-07f, 5.021224752e-07f,
+  -4.115352112e-06f, -3.089637175e-06f, -2.986715117e-06f, -1.961000180e-06f,
+  -2.877567567e-06f, -1.851852403e-06f, -1.748930458e-06f, -7.232153507e-07f,
+  -2.762166105e-06f, -1.736450940e-06f, -1.633529109e-06f, -6.078140018e-07f,
+  -1.524381332e-06f, -4.986662816e-07f, -3.957443937e-07f, 6.299707138e-07f,
+  -2.640518460e-06f, -1.614803409e-06f, -1.511881464e-06f, -4.861663569e-07f,
+  -1.402733801e-06f, -3.770186368e-07f, -2.740967489e-07f, 7.516183587e-07f,
+  -1.287332339e-06f, -2.616172878e-07f, -1.586953999e-07f, 8.670197076e-07f,
+  -4.954766908e-08f, 9.761674846e-07f, 1.079089316e-06f, 2.104804480e-06f,
+  -3.981390819e-06f, -2.955675427e-06f, -2.852753596e-06f, -1.827038545e-06f,
+  -2.743605819e-06f, -1.717890768e-06f, -1.614968937e-06f, -5.892538297e-07f,
+  -2.628204584e-06f, -1.602489419e-06f, -1.499567588e-06f, -4.738524524e-07f,
+  -1.390419811e-06f, -3.647047322e-07f, -2.617828443e-07f, 7.639322916e-07f,
+  -2.506556939e-06f, -1.480841775e-06f, -1.377919943e-06f, -3.522048075e-07f,
+  -1.268772166e-06f, -2.430570873e-07f, -1.401351994e-07f, 8.855798797e-07f,
+  -1.153370818e-06f, -1.276557384e-07f, -2.473384875e-08f, 1.000981229e-06f,
+  8.441387678e-08f, 1.110129006e-06f, 1.213050837e-06f, 2.238766001e-06f,
+  -2.378708587e-06f, -1.352993536e-06f, -1.250071705e-06f, -2.243565831e-07f,
+  -1.140923928e-06f, -1.152088629e-07f, -1.228697943e-08f, 1.013428118e-06f,
+  -1.025522579e-06f, 1.924917864e-10f, 1.031143739e-07f, 1.128829467e-06f,
+  2.122621083e-07f, 1.237977244e-06f, 1.340899075e-06f, 2.366614126e-06f,
+  -9.038749909e-07f, 1.218401309e-07f, 2.247620046e-07f, 1.250477112e-06f,
+  3.339097248e-07f, 1.359624889e-06f, 1.462546720e-06f, 2.488261771e-06f,
+  4.493111021e-07f, 1.475026238e-06f, 1.577948069e-06f, 2.603663233e-06f,
+  1.687095846e-06f, 2.712811010e-06f, 2.815732842e-06f, 3.841447779e-06f,
+  -3.841447779e-06f, -2.815732842e-06f, -2.712811010e-06f, -1.687095846e-06f,
+  -2.603663233e-06f, -1.577948069e-06f, -1.475026238e-06f, -4.493111021e-07f,
+  -2.488261771e-06f, -1.462546720e-06f, -1.359624889e-06f, -3.339097248e-07f,
+  -1.250477112e-06f, -2.247620046e-07f, -1.218401309e-07f, 9.038749909e-07f,
+  -2.366614126e-06f, -1.340899075e-06f, -1.237977244e-06f, -2.122621083e-07f,
+  -1.128829467e-06f, -1.031143739e-07f, -1.924917864e-10f, 1.025522579e-06f,
+  -1.013428118e-06f, 1.228697943e-08f, 1.152088629e-07f, 1.140923928e-06f,
+  2.243565831e-07f, 1.250071705e-06f, 1.352993536e-06f, 2.378708587e-06f,
+  -2.238766001e-06f, -1.213050837e-06f, -1.110129006e-06f, -8.441387678e-08f,
+  -1.000981229e-06f, 2.473384875e-08f, 1.276557384e-07f, 1.153370818e-06f,
+  -8.855798797e-07f, 1.401351994e-07f, 2.430570873e-07f, 1.268772166e-06f,
+  3.522048075e-07f, 1.377919943e-06f, 1.480841775e-06f, 2.506556939e-06f,
+  -7.639322916e-07f, 2.617828443e-07f, 3.647047322e-07f, 1.390419811e-06f,
+  4.738524524e-07f, 1.499567588e-06f, 1.602489419e-06f, 2.628204584e-06f,
+  5.892538297e-07f, 1.614968937e-06f, 1.717890768e-06f, 2.743605819e-06f,
+  1.827038545e-06f, 2.852753596e-06f, 2.955675427e-06f, 3.981390819e-06f,
+  -2.104804480e-06f, -1.079089316e-06f, -9.761674846e-07f, 4.954766908e-08f,
+  -8.670197076e-07f, 1.586953999e-07f, 2.616172878e-07f, 1.287332339e-06f,
+  -7.516183587e-07f, 2.740967489e-07f, 3.770186368e-07f, 1.402733801e-06f,
+  4.861663569e-07f, 1.511881464e-06f, 1.614803409e-06f, 2.640518460e-06f,
+  -6.299707138e-07f, 3.957443937e-07f, 4.986662816e-07f, 1.524381332e-06f,
+  6.078140018e-07f, 1.633529109e-06f, 1.736450940e-06f, 2.762166105e-06f,
+  7.232153507e-07f, 1.748930458e-06f, 1.851852403e-06f, 2.877567567e-06f,
+  1.961000180e-06f, 2.986715117e-06f, 3.089637175e-06f, 4.115352112e-06f,
+  -5.021224752e-07f, 5.235926324e-07f, 6.265145203e-07f, 1.652229571e-06f,
+  7.356622405e-07f, 1.761377348e-06f, 1.864299179e-06f, 2.890014230e-06f,
+  8.510635894e-07f, 1.876778697e-06f, 1.979700528e-06f, 3.005415692e-06f,
+  2.088848305e-06f, 3.114563469e-06f, 3.217485300e-06f, 4.243200237e-06f,
+  9.727111774e-07f, 1.998426342e-06f, 2.101348173e-06f, 3.127063337e-06f,
+  2.210495950e-06f, 3.236211114e-06f, 3.339132945e-06f, 4.364847882e-06f,
+  2.325897185e-06f, 3.351612349e-06f, 3.454534180e-06f, 4.480249572e-06f,
+  3.563681958e-06f, 4.589397122e-06f, 4.692319180e-06f, 5.718034117e-06f
+},
+{
+  -1.034175421e-05f, -8.319424524e-06f, -8.168111890e-06f, -6.145782208e-06f,
+  -8.011516911e-06f, -5.989187684e-06f, -5.837875051e-06f, -3.815545369e-06f,
+  -7.849985195e-06f, -5.827655514e-06f, -5.676343335e-06f, -3.654013653e-06f,
+  -5.519748811e-06f, -3.497418902e-06f, -3.346106496e-06f, -1.323776814e-06f,
+  -7.683923286e-06f, -5.661593150e-06f, -5.510280516e-06f, -3.487951062e-06f,
+  -5.353685992e-06f, -3.331356311e-06f, -3.180043905e-06f, -1.157714223e-06f,
+  -5.192154276e-06f, -3.169824595e-06f, -3.018512189e-06f, -9.961823935e-07f,
+  -2.861917437e-06f, -8.395877558e-07f, -6.882752928e-07f, 1.334054446e-06f,
+  -7.513800483e-06f, -5.491470802e-06f, -5.340158623e-06f, -3.317828714e-06f,
+  -5.183563644e-06f, -3.161234190e-06f, -3.009921784e-06f, -9.875919886e-07f,
+  -5.022031928e-06f, -2.999702247e-06f, -2.848389840e-06f, -8.260601589e-07f,
+  -2.691795316e-06f, -6.694655212e-07f, -5.181531151e-07f, 1.504176680e-06f,
+  -4.855969564e-06f, -2.833639655e-06f, -2.682327249e-06f, -6.599975677e-07f,
+  -2.525732725e-06f, -5.034029300e-07f, -3.520904954e-07f, 1.670239271e-06f,
+  -2.364200782e-06f, -3.418711572e-07f, -1.905586942e-07f, 1.831770987e-06f,
+  -3.396408133e-08f, 1.988365739e-06f, 2.139678145e-06f, 4.162007826e-06f,
+  -7.340157936e-06f, -5.317828254e-06f, -5.166515621e-06f, -3.144185939e-06f,
+  -5.009921097e-06f, -2.987591188e-06f, -2.836278782e-06f, -8.139491001e-07f,
+  -4.848389381e-06f, -2.826059472e-06f, -2.674747066e-06f, -6.524172704e-07f,
+  -2.518152314e-06f, -4.958226327e-07f, -3.445101981e-07f, 1.677819569e-06f,
+  -4.682326562e-06f, -2.659996881e-06f, -2.508684474e-06f, -4.863546792e-07f,
+  -2.352089723e-06f, -3.297600699e-07f, -1.784476211e-07f, 1.843882160e-06f,
+  -2.190558007e-06f, -1.682282544e-07f, -1.691580742e-08f, 2.005413990e-06f,
+  1.396788036e-07f, 2.162008514e-06f, 2.313320920e-06f, 4.335650829e-06f,
+  -4.512204214e-06f, -2.489874532e-06f, -2.338562126e-06f, -3.162324447e-07f,
+  -2.181967602e-06f, -1.596378496e-07f, -8.325392820e-09f, 2.014004394e-06f,
+  -2.020435659e-06f, 1.893967427e-09f, 1.532064147e-07f, 2.175536110e-06f,
+  3.098010382e-07f, 2.332130862e-06f, 2.483443268e-06f, 4.505772722e-06f,
+  -1.854373181e-06f, 1.679565571e-07f, 3.192689917e-07f, 2.341598702e-06f,
+  4.758636010e-07f, 2.498193453e-06f, 2.649505859e-06f, 4.671835541e-06f,
+  6.373954307e-07f, 2.659725169e-06f, 2.811037575e-06f, 4.833367257e-06f,
+  2.967632327e-06f, 4.989961781e-06f, 5.141274414e-06f, 7.163604096e-06f,
+  -7.163604096e-06f, -5.141274414e-06f, -4.989961781e-06f, -2.967632327e-06f,
+  -4.833367257e-06f, -2.811037575e-06f, -2.659725169e-06f, -6.373954307e-07f,
+  -4.671835541e-06f, -2.649505859e-06f, -2.498193453e-06f, -4.758636010e-07f,
+  -2.341598702e-06f, -3.192689917e-07f, -1.679565571e-07f, 1.854373181e-06f,
+  -4.505772722e-06f, -2.483443268e-06f, -2.332130862e-06f, -3.098010382e-07f,
+  -2.175536110e-06f, -1.532064147e-07f, -1.893967427e-09f, 2.020435659e-06f,
+  -2.014004394e-06f, 8.325392820e-09f, 1.596378496e-07f, 2.181967602e-06f,
+  3.162324447e-07f, 2.338562126e-06f, 2.489874532e-06f, 4.512204214e-06f,
+  -4.335650829e-06f, -2.313320920e-06f, -2.162008514e-06f, -1.396788036e-07f,
+  -2.005413990e-06f, 1.691580742e-08f, 1.682282544e-07f, 2.190558007e-06f,
+  -1.843882160e-06f, 1.784476211e-07f, 3.297600699e-07f, 2.352089723e-06f,
+  4.863546792e-07f, 2.508684474e-06f, 2.659996881e-06f, 4.682326562e-06f,
+  -1.677819569e-06f, 3.445101981e-07f, 4.958226327e-07f, 2.518152314e-06f,
+  6.524172704e-07f, 2.674747066e-06f, 2.826059472e-06f, 4.848389381e-06f,
+  8.139491001e-07f, 2.836278782e-06f, 2.987591188e-06f, 5.009921097e-06f,
+  3.144185939e-06f, 5.166515621e-06f, 5.317828254e-06f, 7.340157936e-06f,
+  -4.162007826e-06f, -2.139678145e-06f, -1.988365739e-06f, 3.396408133e-08f,
+  -1.831770987e-06f, 1.905586942e-07f, 3.418711572e-07f, 2.364200782e-06f,
+  -1.670239271e-06f, 3.520904954e-07f, 5.034029300e-07f, 2.525732725e-06f,
+  6.599975677e-07f, 2.682327249e-06f, 2.833639655e-06f, 4.855969564e-06f,
+  -1.504176680e-06f, 5.181531151e-07f, 6.694655212e-07f, 2.691795316e-06f,
+  8.260601589e-07f, 2.848389840e-06f, 2.999702247e-06f, 5.022031928e-06f,
+  9.875919886e-07f, 3.009921784e-06f, 3.161234190e-06f, 5.183563644e-06f,
+  3.317828714e-06f, 5.340158623e-06f, 5.491470802e-06f, 7.513800483e-06f,
+  -1.334054446e-06f, 6.882752928e-07f, 8.395877558e-07f, 2.861917437e-06f,
+  9.961823935e-07f, 3.018512189e-06f, 3.169824595e-06f, 5.192154276e-06f,
+  1.157714223e-06f, 3.180043905e-06f, 3.331356311e-06f, 5.353685992e-06f,
+  3.487951062e-06f, 5.510280516e-06f, 5.661593150e-06f, 7.683923286e-06f,
+  1.323776814e-06f, 3.346106496e-06f, 3.497418902e-06f, 5.519748811e-06f,
+  3.654013653e-06f, 5.676343335e-06f, 5.827655514e-06f, 7.849985195e-06f,
+  3.815545369e-06f, 5.837875051e-06f, 5.989187684e-06f, 8.011516911e-06f,
+  6.145782208e-06f, 8.168111890e-06f, 8.319424524e-06f, 1.034175421e-05f
+},
+{
+  -1.593410707e-05f, -1.257717668e-05f, -1.239692938e-05f, -9.039998986e-06f,
+  -1.221605544e-05f, -8.859124137e-06f, -8.678876839e-06f, -5.321946446e-06f,
+  -1.203547527e-05f, -8.678544873e-06f, -8.498297575e-06f, -5.141366728e-06f,
+  -8.317423635e-06f, -4.960492788e-06f, -4.780245490e-06f, -1.423314757e-06f,
+  -1.185619567e-05f, -8.499265277e-06f, -8.319017979e-06f, -4.962087132e-06f,
+  -8.138144040e-06f, -4.781213192e-06f, -4.600965894e-06f, -1.244035161e-06f,
+  -7.957563867e-06f, -4.600633474e-06f, -4.420386176e-06f, -1.063455557e-06f,
+  -4.239511782e-06f, -8.825813893e-07f, -7.023340913e-07f, 2.654596528e-06f,
+  -1.167930805e-05f, -8.322376743e-06f, -8.142129445e-06f, -4.785199053e-06f,
+  -7.961255506e-06f, -4.604325113e-06f, -4.424077815e-06f, -1.067147082e-06f,
+  -7.780676242e-06f, -4.423745395e-06f, -4.243498097e-06f, -8.865674772e-07f,
+  -4.062623702e-06f, -7.056933100e-07f, -5.254460120e-07f, 2.831484608e-06f,
+  -7.601396192e-06f, -4.244465799e-06f, -4.064218501e-06f, -7.072878816e-07f,
+  -3.883344107e-06f, -5.264137144e-07f, -3.461664164e-07f, 3.010764203e-06f,
+  -3.702764616e-06f, -3.458340814e-07f, -1.655867834e-07f, 3.191343922e-06f,
+  1.528740334e-08f, 3.372218089e-06f, 3.552465387e-06f, 6.909395779e-06f,
+  -1.150599019e-05f, -8.149059795e-06f, -7.968812497e-06f, -4.611882105e-06f,
+  -7.787938557e-06f, -4.431007710e-06f, -4.250760412e-06f, -8.938298492e-07f,
+  -7.607358839e-06f, -4.250427992e-06f, -4.070180694e-06f, -7.132502446e-07f,
+  -3.889306754e-06f, -5.323760206e-07f, -3.521287510e-07f, 3.004801783e-06f,
+  -7.428079243e-06f, -4.071148396e-06f, -3.890901098e-06f, -5.339706490e-07f,
+  -3.710027158e-06f, -3.530964534e-07f, -1.728491696e-07f, 3.184081379e-06f,
+  -3.529447440e-06f, -1.725168062e-07f, 7.730470486e-09f, 3.364661097e-06f,
+  1.886046590e-07f, 3.545535264e-06f, 3.725782562e-06f, 7.082713182e-06f,
+  -7.251191164e-06f, -3.894260317e-06f, -3.714013246e-06f, -3.570825697e-07f,
+  -3.533139079e-06f, -1.762083741e-07f, 4.038908319e-09f, 3.360969458e-06f,
+  -3.352559361e-06f, 4.371258466e-09f, 1.846185427e-07f, 3.541549177e-06f,
+  3.654927241e-07f, 3.722423344e-06f, 3.902670414e-06f, 7.259601261e-06f,
+  -3.173279765e-06f, 1.836508545e-07f, 3.638981525e-07f, 3.720828772e-06f,
+  5.447723197e-07f, 3.901703167e-06f, 4.081950010e-06f, 7.438880857e-06f,
+  7.253519811e-07f, 4.082282430e-06f, 4.262529728e-06f, 7.619460575e-06f,
+  4.443404123e-06f, 7.800334970e-06f, 7.980582268e-06f, 1.133751266e-05f,
+  -1.133751266e-05f, -7.980582268e-06f, -7.800334970e-06f, -4.443404123e-06f,
+  -7.619460575e-06f, -4.262529728e-06f, -4.082282430e-06f, -7.253519811e-07f,
+  -7.438880857e-06f, -4.081950010e-06f, -3.901703167e-06f, -5.447723197e-07f,
+  -3.720828772e-06f, -3.638981525e-07f, -1.836508545e-07f, 3.173279765e-06f,
+  -7.259601261e-06f, -3.902670414e-06f, -3.722423344e-06f, -3.654927241e-07f,
+  -3.541549177e-06f, -1.846185427e-07f, -4.371258466e-09f, 3.352559361e-06f,
+  -3.360969458e-06f, -4.038908319e-09f, 1.762083741e-07f, 3.533139079e-06f,
+  3.570825697e-07f, 3.714013246e-06f, 3.894260317e-06f, 7.251191164e-06f,
+  -7.082713182e-06f, -3.725782562e-06f, -3.545535264e-06f, -1.886046590e-07f,
+  -3.364661097e-06f, -7.730470486e-09f, 1.725168062e-07f, 3.529447440e-06f,
+  -3.184081379e-06f, 1.728491696e-07f, 3.530964534e-07f, 3.710027158e-06f,
+  5.339706490e-07f, 3.890901098e-06f, 4.071148396e-06f, 7.428079243e-06f,
+  -3.004801783e-06f, 3.521287510e-07f, 5.323760206e-07f, 3.889306754e-06f,
+  7.132502446e-07f, 4.070180694e-06f, 4.250427992e-06f, 7.607358839e-06f,
+  8.938298492e-07f, 4.250760412e-06f, 4.431007710e-06f, 7.787938557e-06f,
+  4.611882105e-06f, 7.968812497e-06f, 8.149059795e-06f, 1.150599019e-05f,
+  -6.909395779e-06f, -3.552465387e-06f, -3.372218089e-06f, -1.528740334e-08f,
+  -3.191343922e-06f, 1.655867834e-07f, 3.458340814e-07f, 3.702764616e-06f,
+  -3.010764203e-06f, 3.461664164e-07f, 5.264137144e-07f, 3.883344107e-06f,
+  7.072878816e-07f, 4.064218501e-06f, 4.244465799e-06f, 7.601396192e-06f,
+  -2.831484608e-06f, 5.254460120e-07f, 7.056933100e-07f, 4.062623702e-06f,
+  8.865674772e-07f, 4.243498097e-06f, 4.423745395e-06f, 7.780676242e-06f,
+  1.067147082e-06f, 4.424077815e-06f, 4.604325113e-06f, 7.961255506e-06f,
+  4.785199053e-06f, 8.142129445e-06f, 8.322376743e-06f, 1.167930805e-05f,
+  -2.654596528e-06f, 7.023340913e-07f, 8.825813893e-07f, 4.239511782e-06f,
+  1.063455557e-06f, 4.420386176e-06f, 4.600633474e-06f, 7.957563867e-06f,
+  1.244035161e-06f, 4.600965894e-06f, 4.781213192e-06f, 8.138144040e-06f,
+  4.962087132e-06f, 8.319017979e-06f, 8.499265277e-06f, 1.185619567e-05f,
+  1.423314757e-06f, 4.780245490e-06f, 4.960492788e-06f, 8.317423635e-06f,
+  5.141366728e-06f, 8.498297575e-06f, 8.678544873e-06f, 1.203547527e-05f,
+  5.321946446e-06f, 8.678876839e-06f, 8.859124137e-06f, 1.221605544e-05f,
+  9.039998986e-06f, 1.239692938e-05f, 1.257717668e-05f, 1.593410707e-05f
+},
+{
+  -2.088326983e-05f, -1.612439701e-05f, -1.596976472e-05f, -1.121089099e-05f,
+  -1.582432378e-05f, -1.106545005e-05f, -1.091081958e-05f, -6.151944945e-06f,
+  -1.568970765e-05f, -1.093083392e-05f, -1.077620254e-05f, -6.017328815e-06f,
+  -1.063076252e-05f, -5.871887879e-06f, -5.717256954e-06f, -9.583828842e-07f,
+  -1.556764073e-05f, -1.080876700e-05f, -1.065413562e-05f, -5.895261438e-06f,
+  -1.050869469e-05f, -5.749820957e-06f, -5.595190032e-06f, -8.363157349e-07f,
+  -1.037407856e-05f, -5.615204373e-06f, -5.460573448e-06f, -7.016993209e-07f,
+  -5.315132967e-06f, -5.562587262e-07f, -4.016276307e-07f, 4.357246326e-06f,
+  -1.545993837e-05f, -1.070106464e-05f, -1.054643417e-05f, -5.787559530e-06f,
+  -1.040099323e-05f, -5.642119049e-06f, -5.487488124e-06f, -7.286139407e-07f,
+  -1.026637710e-05f, -5.507502919e-06f, -5.352871540e-06f, -5.939974699e-07f,
+  -5.207431059e-06f, -4.485568752e-07f, -2.939258081e-07f, 4.464948233e-06f,
+  -1.014431018e-05f, -5.385435543e-06f, -5.230804618e-06f, -4.719304059e-07f,
+  -5.085364137e-06f, -3.264897828e-07f, -1.718587157e-07f, 4.587015610e-06f,
+  -4.950747552e-06f, -1.918733403e-07f, -3.724227682e-08f, 4.721631740e-06f,
+  1.081983356e-07f, 4.867072676e-06f, 5.021703601e-06f, 9.780577784e-06f,
+  -1.536850868e-05f, -1.060963405e-05f, -1.045500267e-05f, -5.696128483e-06f,
+  -1.030956173e-05f, -5.550688002e-06f, -5.396056622e-06f, -6.371826089e-07f,
+  -1.017494560e-05f, -5.416071417e-06f, -5.261440492e-06f, -5.025661949e-07f,
+  -5.115999556e-06f, -3.571255718e-07f, -2.024945189e-07f, 4.556379736e-06f,
+  -1.005287868e-05f, -5.294004495e-06f, -5.139373116e-06f, -3.804991024e-07f,
+  -4.993932635e-06f, -2.350585078e-07f, -8.042743360e-08f, 4.678446658e-06f,
+  -4.859316050e-06f, -1.004420653e-07f, 5.418900173e-08f, 4.813063242e-06f,
+  1.996296106e-07f, 4.958503723e-06f, 5.113134648e-06f, 9.872009286e-06f,
+  -9.945176316e-06f, -5.186302587e-06f, -5.031671208e-06f, -2.727972799e-07f,
+  -4.886230727e-06f, -1.273566568e-07f, 2.727440851e-08f, 4.786148565e-06f,
+  -4.751614142e-06f, 7.259782109e-09f, 1.618908527e-07f, 4.920765150e-06f,
+  3.073314474e-07f, 5.066205631e-06f, 5.220836556e-06f, 9.979710740e-06f,
+  -4.629547220e-06f, 1.293268639e-07f, 2.839579167e-07f, 5.042832072e-06f,
+  4.293985398e-07f, 5.188272553e-06f, 5.342903933e-06f, 1.010177766e-05f,
+  5.640149539e-07f, 5.322889137e-06f, 5.477520062e-06f, 1.023639470e-05f,
+  5.622960998e-06f, 1.038183473e-05f, 1.053646611e-05f, 1.529533984e-05f,
+  -1.529533984e-05f, -1.053646611e-05f, -1.038183473e-05f, -5.622960998e-06f,
+  -1.023639470e-05f, -5.477520062e-06f, -5.322889137e-06f, -5.640149539e-07f,
+  -1.010177766e-05f, -5.342903933e-06f, -5.188272553e-06f, -4.293985398e-07f,
+  -5.042832072e-06f, -2.839579167e-07f, -1.293268639e-07f, 4.629547220e-06f,
+  -9.979710740e-06f, -5.220836556e-06f, -5.066205631e-06f, -3.073314474e-07f,
+  -4.920765150e-06f, -1.618908527e-07f, -7.259782109e-09f, 4.751614142e-06f,
+  -4.786148565e-06f, -2.727440851e-08f, 1.273566568e-07f, 4.886230727e-06f,
+  2.727972799e-07f, 5.031671208e-06f, 5.186302587e-06f, 9.945176316e-06f,
+  -9.872009286e-06f, -5.113134648e-06f, -4.958503723e-06f, -1.996296106e-07f,
+  -4.813063242e-06f, -5.418900173e-08f, 1.004420653e-07f, 4.859316050e-06f,
+  -4.678446658e-06f, 8.042743360e-08f, 2.350585078e-07f, 4.993932635e-06f,
+  3.804991024e-07f, 5.139373116e-06f, 5.294004495e-06f, 1.005287868e-05f,
+  -4.556379736e-06f, 2.024945189e-07f, 3.571255718e-07f, 5.115999556e-06f,
+  5.025661949e-07f, 5.261440492e-06f, 5.416071417e-06f, 1.017494560e-05f,
+  6.371826089e-07f, 5.396056622e-06f, 5.550688002e-06f, 1.030956173e-05f,
+  5.696128483e-06f, 1.045500267e-05f, 1.060963405e-05f, 1.536850868e-05f,
+  -9.780577784e-06f, -5.021703601e-06f, -4.867072676e-06f, -1.081983356e-07f,
+  -4.721631740e-06f, 3.724227682e-08f, 1.918733403e-07f, 4.950747552e-06f,
+  -4.587015610e-06f, 1.718587157e-07f, 3.264897828e-07f, 5.085364137e-06f,
+  4.719304059e-07f, 5.230804618e-06f, 5.385435543e-06f, 1.014431018e-05f,
+  -4.464948233e-06f, 2.939258081e-07f, 4.485568752e-07f, 5.207431059e-06f,
+  5.939974699e-07f, 5.352871540e-06f, 5.507502919e-06f, 1.026637710e-05f,
+  7.286139407e-07f, 5.487488124e-06f, 5.642119049e-06f, 1.040099323e-05f,
+  5.787559530e-06f, 1.054643417e-05f, 1.070106464e-05f, 1.545993837e-05f,
+  -4.357246326e-06f, 4.016276307e-07f, 5.562587262e-07f, 5.315132967e-06f,
+  7.016993209e-07f, 5.460573448e-06f, 5.615204373e-06f, 1.037407856e-05f,
+  8.363157349e-07f, 5.595190032e-06f, 5.749820957e-06f, 1.050869469e-05f,
+  5.895261438e-06f, 1.065413562e-05f, 1.080876700e-05f, 1.556764073e-05f,
+  9.583828842e-07f, 5.717256954e-06f, 5.871887879e-06f, 1.063076252e-05f,
+  6.017328815e-06f, 1.077620254e-05f, 1.093083392e-05f, 1.568970765e-05f,
+  6.151944945e-06f, 1.091081958e-05f, 1.106545005e-05f, 1.582432378e-05f,
+  1.121089099e-05f, 1.596976472e-05f, 1.612439701e-05f, 2.088326983e-05f
+},
+{
+  -2.221171417e-05f, -1.657095891e-05f, -1.654063635e-05f, -1.089988018e-05f,
+  -1.653505751e-05f, -1.089430225e-05f, -1.086398061e-05f, -5.223224889e-06f,
+  -1.655653978e-05f, -1.091578542e-05f, -1.088546287e-05f, -5.244707609e-06f,
+  -1.087988494e-05f, -5.239129678e-06f, -5.208807579e-06f, 4.319480240e-07f,
+  -1.660747148e-05f, -1.096671531e-05f, -1.093639275e-05f, -5.295637493e-06f,
+  -1.093081482e-05f, -5.290059562e-06f, -5.259737463e-06f, 3.810179976e-07f,
+  -1.095229800e-05f, -5.311542282e-06f, -5.281220183e-06f, 3.595355054e-07f,
+  -5.275642252e-06f, 3.651133511e-07f, 3.954353645e-07f, 6.036190825e-06f,
+  -1.669030098e-05f, -1.104954572e-05f, -1.101922408e-05f, -5.378467904e-06f,
+  -1.101364614e-05f, -5.372890428e-06f, -5.342568329e-06f, 2.981873592e-07f,
+  -1.103512841e-05f, -5.394372693e-06f, -5.364050594e-06f, 2.767048670e-07f,
+  -5.358472663e-06f, 2.822827128e-07f, 3.126047261e-07f, 5.953360414e-06f,
+  -1.108605829e-05f, -5.445302577e-06f, -5.414980933e-06f, 2.257748406e-07f,
+  -5.409403002e-06f, 2.313526863e-07f, 2.616746997e-07f, 5.902430075e-06f,
+  -5.430885267e-06f, 2.098701941e-07f, 2.401922075e-07f, 5.880947811e-06f,
+  2.457700532e-07f, 5.886525742e-06f, 5.916847840e-06f, 1.155760310e-05f,
+  -1.680754576e-05f, -1.116679050e-05f, -1.113646795e-05f, -5.495712685e-06f,
+  -1.113089002e-05f, -5.490134754e-06f, -5.459812655e-06f, 1.809428909e-07f,
+  -1.115237319e-05f, -5.511617019e-06f, -5.481295375e-06f, 1.594603845e-07f,
+  -5.475717444e-06f, 1.650382444e-07f, 1.953602435e-07f, 5.836115633e-06f,
+  -1.120330307e-05f, -5.562547358e-06f, -5.532225259e-06f, 1.085303651e-07f,
+  -5.526647328e-06f, 1.141082180e-07f, 1.444302171e-07f, 5.785185749e-06f,
+  -5.548130048e-06f, 9.262571865e-08f, 1.229477249e-07f, 5.763703484e-06f,
+  1.285255706e-07f, 5.769280961e-06f, 5.799603059e-06f, 1.144035923e-05f,
+  -1.128613349e-05f, -5.645377769e-06f, -5.615055670e-06f, 2.569972857e-08f,
+  -5.609478194e-06f, 3.127757964e-08f, 6.159957877e-08f, 5.702355338e-06f,
+  -5.630960459e-06f, 9.795084743e-09f, 4.011709009e-08f, 5.680872619e-06f,
+  4.569493939e-08f, 5.686450550e-06f, 5.716772648e-06f, 1.135752791e-05f,
+  -5.681890343e-06f, -4.113493901e-08f, -1.081293632e-08f, 5.629942734e-06f,
+  -5.235087031e-09f, 5.635520665e-06f, 5.665842309e-06f, 1.130659803e-05f,
+  -2.671757926e-08f, 5.614037946e-06f, 5.644360044e-06f, 1.128511576e-05f,
+  5.649937975e-06f, 1.129069369e-05f, 1.132101534e-05f, 1.696177060e-05f,
+  -1.696177060e-05f, -1.132101534e-05f, -1.129069369e-05f, -5.649937975e-06f,
+  -1.128511576e-05f, -5.644360044e-06f, -5.614037946e-06f, 2.671757926e-08f,
+  -1.130659803e-05f, -5.665842309e-06f, -5.635520665e-06f, 5.235087031e-09f,
+  -5.629942734e-06f, 1.081293632e-08f, 4.113493901e-08f, 5.681890343e-06f,
+  -1.135752791e-05f, -5.716772648e-06f, -5.686450550e-06f, -4.569493939e-08f,
+  -5.680872619e-06f, -4.011709009e-08f, -9.795084743e-09f, 5.630960459e-06f,
+  -5.702355338e-06f, -6.159957877e-08f, -3.127757964e-08f, 5.609478194e-06f,
+  -2.569972857e-08f, 5.615055670e-06f, 5.645377769e-06f, 1.128613349e-05f,
+  -1.144035923e-05f, -5.799603059e-06f, -5.769280961e-06f, -1.285255706e-07f,
+  -5.763703484e-06f, -1.229477249e-07f, -9.262571865e-08f, 5.548130048e-06f,
+  -5.785185749e-06f, -1.444302171e-07f, -1.141082180e-07f, 5.526647328e-06f,
+  -1.085303651e-07f, 5.532225259e-06f, 5.562547358e-06f, 1.120330307e-05f,
+  -5.836115633e-06f, -1.953602435e-07f, -1.650382444e-07f, 5.475717444e-06f,
+  -1.594603845e-07f, 5.481295375e-06f, 5.511617019e-06f, 1.115237319e-05f,
+  -1.809428909e-07f, 5.459812655e-06f, 5.490134754e-06f, 1.113089002e-05f,
+  5.495712685e-06f, 1.113646795e-05f, 1.116679050e-05f, 1.680754576e-05f,
+  -1.155760310e-05f, -5.916847840e-06f, -5.886525742e-06f, -2.457700532e-07f,
+  -5.880947811e-06f, -2.401922075e-07f, -2.098701941e-07f, 5.430885267e-06f,
+  -5.902430075e-06f, -2.616746997e-07f, -2.313526863e-07f, 5.409403002e-06f,
+  -2.257748406e-07f, 5.414980933e-06f, 5.445302577e-06f, 1.108605829e-05f,
+  -5.953360414e-06f, -3.126047261e-07f, -2.822827128e-07f, 5.358472663e-06f,
+  -2.767048670e-07f, 5.364050594e-06f, 5.394372693e-06f, 1.103512841e-05f,
+  -2.981873592e-07f, 5.342568329e-06f, 5.372890428e-06f, 1.101364614e-05f,
+  5.378467904e-06f, 1.101922408e-05f, 1.104954572e-05f, 1.669030098e-05f,
+  -6.036190825e-06f, -3.954353645e-07f, -3.651133511e-07f, 5.275642252e-06f,
+  -3.595355054e-07f, 5.281220183e-06f, 5.311542282e-06f, 1.095229800e-05f,
+  -3.810179976e-07f, 5.259737463e-06f, 5.290059562e-06f, 1.093081482e-05f,
+  5.295637493e-06f, 1.093639275e-05f, 1.096671531e-05f, 1.660747148e-05f,
+  -4.319480240e-07f, 5.208807579e-06f, 5.239129678e-06f, 1.087988494e-05f,
+  5.244707609e-06f, 1.088546287e-05f, 1.091578542e-05f, 1.655653978e-05f,
+  5.223224889e-06f, 1.086398061e-05f, 1.089430225e-05f, 1.653505751e-05f,
+  1.089988018e-05f, 1.654063635e-05f, 1.657095891e-05f, 2.221171417e-05f
+},
+{
+  -1.556664574e-05f, -1.051052277e-05f, -1.074659031e-05f, -5.690467788e-06f,
+  -1.102758779e-05f, -5.971465271e-06f, -6.207532351e-06f, -1.151409606e-06f,
+  -1.135622097e-05f, -6.300098448e-06f, -6.536165074e-06f, -1.480042556e-06f,
+  -6.817163012e-06f, -1.761040267e-06f, -1.997107347e-06f, 3.059015398e-06f,
+  -1.173520559e-05f, -6.679083072e-06f, -6.915150152e-06f, -1.859027634e-06f,
+  -7.196148090e-06f, -2.140025344e-06f, -2.376092425e-06f, 2.680030320e-06f,
+  -7.524780813e-06f, -2.468658295e-06f, -2.704725375e-06f, 2.351397370e-06f,
+  -2.985722858e-06f, 2.070399660e-06f, 1.834332693e-06f, 6.890455552e-06f,
+  -1.216726105e-05f, -7.111138075e-06f, -7.347205155e-06f, -2.291082637e-06f,
+  -7.628203093e-06f, -2.572080348e-06f, -2.808147428e-06f, 2.247975317e-06f,
+  -7.956836271e-06f, -2.900713298e-06f, -3.136780379e-06f, 1.919342367e-06f,
+  -3.417778089e-06f, 1.638344656e-06f, 1.402277576e-06f, 6.458400094e-06f,
+  -8.335820894e-06f, -3.279698376e-06f, -3.515765457e-06f, 1.540357289e-06f,
+  -3.796762940e-06f, 1.259359692e-06f, 1.023292612e-06f, 6.079415471e-06f,
+  -4.125396117e-06f, 9.307266282e-07f, 6.946595477e-07f, 5.750782293e-06f,
+  4.136619509e-07f, 5.469784810e-06f, 5.233717729e-06f, 1.028984025e-05f,
+  -1.265509400e-05f, -7.598971479e-06f, -7.835038559e-06f, -2.778915814e-06f,
+  -8.116036042e-06f, -3.059913524e-06f, -3.295980605e-06f, 1.760142140e-06f,
+  -8.444669220e-06f, -3.388546475e-06f, -3.624613555e-06f, 1.431509190e-06f,
+  -3.905611266e-06f, 1.150511480e-06f, 9.144444562e-07f, 5.970567145e-06f,
+  -8.823653843e-06f, -3.767531553e-06f, -4.003598406e-06f, 1.052524112e-06f,
+  -4.284596343e-06f, 7.715264587e-07f, 5.354594350e-07f, 5.591582067e-06f,
+  -4.613229066e-06f, 4.428934801e-07f, 2.068263996e-07f, 5.262948889e-06f,
+  -7.417121139e-08f, 4.981951406e-06f, 4.745884326e-06f, 9.802007298e-06f,
+  -9.255709301e-06f, -4.199586328e-06f, -4.435653409e-06f, 6.204690521e-07f,
+  -4.716651347e-06f, 3.394714554e-07f, 1.034043819e-07f, 5.159527063e-06f,
+  -5.045284070e-06f, 1.083843859e-08f, -2.252286322e-07f, 4.830893886e-06f,
+  -5.062262289e-07f, 4.549896403e-06f, 4.313829322e-06f, 9.369951840e-06f,
+  -5.424269148e-06f, -3.681466012e-07f, -6.042136533e-07f, 4.451908808e-06f,
+  -8.852113069e-07f, 4.170911325e-06f, 3.934844244e-06f, 8.990967217e-06f,
+  -1.213844257e-06f, 3.842278602e-06f, 3.606211294e-06f, 8.662334039e-06f,
+  3.325213811e-06f, 8.381336556e-06f, 8.145269021e-06f, 1.320139199e-05f,
+  -1.320139199e-05f, -8.145269021e-06f, -8.381336556e-06f, -3.325213811e-06f,
+  -8.662334039e-06f, -3.606211294e-06f, -3.842278602e-06f, 1.213844257e-06f,
+  -8.990967217e-06f, -3.934844244e-06f, -4.170911325e-06f, 8.852113069e-07f,
+  -4.451908808e-06f, 6.042136533e-07f, 3.681466012e-07f, 5.424269148e-06f,
+  -9.369951840e-06f, -4.313829322e-06f, -4.549896403e-06f, 5.062262289e-07f,
+  -4.830893886e-06f, 2.252286322e-07f, -1.083843859e-08f, 5.045284070e-06f,
+  -5.159527063e-06f, -1.034043819e-07f, -3.394714554e-07f, 4.716651347e-06f,
+  -6.204690521e-07f, 4.435653409e-06f, 4.199586328e-06f, 9.255709301e-06f,
+  -9.802007298e-06f, -4.745884326e-06f, -4.981951406e-06f, 7.417121139e-08f,
+  -5.262948889e-06f, -2.068263996e-07f, -4.428934801e-07f, 4.613229066e-06f,
+  -5.591582067e-06f, -5.354594350e-07f, -7.715264587e-07f, 4.284596343e-06f,
+  -1.052524112e-06f, 4.003598406e-06f, 3.767531553e-06f, 8.823653843e-06f,
+  -5.970567145e-06f, -9.144444562e-07f, -1.150511480e-06f, 3.905611266e-06f,
+  -1.431509190e-06f, 3.624613555e-06f, 3.388546475e-06f, 8.444669220e-06f,
+  -1.760142140e-06f, 3.295980605e-06f, 3.059913524e-06f, 8.116036042e-06f,
+  2.778915814e-06f, 7.835038559e-06f, 7.598971479e-06f, 1.265509400e-05f,
+  -1.028984025e-05f, -5.233717729e-06f, -5.469784810e-06f, -4.136619509e-07f,
+  -5.750782293e-06f, -6.946595477e-07f, -9.307266282e-07f, 4.125396117e-06f,
+  -6.079415471e-06f, -1.023292612e-06f, -1.259359692e-06f, 3.796762940e-06f,
+  -1.540357289e-06f, 3.515765457e-06f, 3.279698376e-06f, 8.335820894e-06f,
+  -6.458400094e-06f, -1.402277576e-06f, -1.638344656e-06f, 3.417778089e-06f,
+  -1.919342367e-06f, 3.136780379e-06f, 2.900713298e-06f, 7.956836271e-06f,
+  -2.247975317e-06f, 2.808147428e-06f, 2.572080348e-06f, 7.628203093e-06f,
+  2.291082637e-06f, 7.347205155e-06f, 7.111138075e-06f, 1.216726105e-05f,
+  -6.890455552e-06f, -1.834332693e-06f, -2.070399660e-06f, 2.985722858e-06f,
+  -2.351397370e-06f, 2.704725375e-06f, 2.468658295e-06f, 7.524780813e-06f,
+  -2.680030320e-06f, 2.376092425e-06f, 2.140025344e-06f, 7.196148090e-06f,
+  1.859027634e-06f, 6.915150152e-06f, 6.679083072e-06f, 1.173520559e-05f,
+  -3.059015398e-06f, 1.997107347e-06f, 1.761040267e-06f, 6.817163012e-06f,
+  1.480042556e-06f, 6.536165074e-06f, 6.300098448e-06f, 1.135622097e-05f,
+  1.151409606e-06f, 6.207532351e-06f, 5.971465271e-06f, 1.102758779e-05f,
+  5.690467788e-06f, 1.074659031e-05f, 1.051052277e-05f, 1.556664574e-05f
+},
+{
+  4.303673904e-06f, 6.061512977e-06f, 5.390375463e-06f, 7.148214536e-06f,
+  4.652971711e-06f, 6.410810784e-06f, 5.739673725e-06f, 7.497512343e-06f,
+  3.846832897e-06f, 5.604671969e-06f, 4.933534910e-06f, 6.691373528e-06f,
+  4.196131158e-06f, 5.953969776e-06f, 5.282832717e-06f, 7.040671790e-06f,
+  2.969581146e-06f, 4.727419764e-06f, 4.056282705e-06f, 5.814121778e-06f,
+  3.318878953e-06f, 5.076718026e-06f, 4.405580512e-06f, 6.163419584e-06f,
+  2.512740139e-06f, 4.270579211e-06f, 3.599441925e-06f, 5.357280770e-06f,
+  2.862038173e-06f, 4.619877018e-06f, 3.948739959e-06f, 5.706578577e-06f,
+  2.018943860e-06f, 3.776782705e-06f, 3.105645419e-06f, 4.863484264e-06f,
+  2.368241667e-06f, 4.126080512e-06f, 3.454943453e-06f, 5.212782526e-06f,
+  1.562102966e-06f, 3.319941925e-06f, 2.648804639e-06f, 4.406643711e-06f,
+  1.911400886e-06f, 3.669239732e-06f, 2.998102673e-06f, 4.755941518e-06f,
+  6.848509315e-07f, 2.442689947e-06f, 1.771552547e-06f, 3.529391506e-06f,
+  1.034148909e-06f, 2.791987754e-06f, 2.120850468e-06f, 3.878689313e-06f,
+  2.280101086e-07f, 1.985848940e-06f, 1.314711767e-06f, 3.072550726e-06f,
+  5.773080716e-07f, 2.335146974e-06f, 1.664009687e-06f, 3.421848533e-06f,
+  9.927715610e-07f, 2.750610520e-06f, 2.079473234e-06f, 3.837312306e-06f,
+  1.342069481e-06f, 3.099908554e-06f, 2.428771268e-06f, 4.186610113e-06f,
+  5.359307238e-07f, 2.293769739e-06f, 1.622632340e-06f, 3.380471298e-06f,
+  8.852287010e-07f, 2.643067546e-06f, 1.971930260e-06f, 3.729769332e-06f,
+  -3.413212823e-07f, 1.416517648e-06f, 7.453803619e-07f, 2.503219321e-06f,
+  7.976670879e-09f, 1.765815568e-06f, 1.094678282e-06f, 2.852517355e-06f,
+  -7.981620911e-07f, 9.596767541e-07f, 2.885395247e-07f, 2.046378540e-06f,
+  -4.488641707e-07f, 1.308974788e-06f, 6.378375019e-07f, 2.395676347e-06f,
+  -1.291958597e-06f, 4.658803618e-07f, -2.052568959e-07f, 1.552582034e-06f,
+  -9.426606198e-07f, 8.151783391e-07f, 1.440410529e-07f, 1.901879955e-06f,
+  -1.748799377e-06f, 9.039538895e-09f, -6.620977047e-07f, 1.095741140e-06f,
+  -1.399501457e-06f, 3.583375019e-07f, -3.127997843e-07f, 1.445039175e-06f,
+  -2.626051355e-06f, -8.682125099e-07f, -1.539349796e-06f, 2.184891770e-07f,
+  -2.276753548e-06f, -5.189145327e-07f, -1.190051762e-06f, 5.677871400e-07f,
+  -3.082892135e-06f, -1.325053290e-06f, -1.996190576e-06f, -2.383516602e-07f,
+  -2.733594329e-06f, -9.757553698e-07f, -1.646892656e-06f, 1.109462957e-07f,
+  -1.109462957e-07f, 1.646892656e-06f, 9.757553698e-07f, 2.733594329e-06f,
+  2.383516602e-07f, 1.996190576e-06f, 1.325053290e-06f, 3.082892135e-06f,
+  -5.677871400e-07f, 1.190051762e-06f, 5.189145327e-07f, 2.276753548e-06f,
+  -2.184891770e-07f, 1.539349796e-06f, 8.682125099e-07f, 2.626051355e-06f,
+  -1.445039175e-06f, 3.127997843e-07f, -3.583375019e-07f, 1.399501457e-06f,
+  -1.095741140e-06f, 6.620977047e-07f, -9.039538895e-09f, 1.748799377e-06f,
+  -1.901879955e-06f, -1.440410529e-07f, -8.151783391e-07f, 9.426606198e-07f,
+  -1.552582034e-06f, 2.052568959e-07f, -4.658803618e-07f, 1.291958597e-06f,
+  -2.395676347e-06f, -6.378375019e-07f, -1.308974788e-06f, 4.488641707e-07f,
+  -2.046378540e-06f, -2.885395247e-07f, -9.596767541e-07f, 7.981620911e-07f,
+  -2.852517355e-06f, -1.094678282e-06f, -1.765815568e-06f, -7.976670879e-09f,
+  -2.503219321e-06f, -7.453803619e-07f, -1.416517648e-06f, 3.413212823e-07f,
+  -3.729769332e-06f, -1.971930260e-06f, -2.643067546e-06f, -8.852287010e-07f,
+  -3.380471298e-06f, -1.622632340e-06f, -2.293769739e-06f, -5.359307238e-07f,
+  -4.186610113e-06f, -2.428771268e-06f, -3.099908554e-06f, -1.342069481e-06f,
+  -3.837312306e-06f, -2.079473234e-06f, -2.750610520e-06f, -9.927715610e-07f,
+  -3.421848533e-06f, -1.664009687e-06f, -2.335146974e-06f, -5.773080716e-07f,
+  -3.072550726e-06f, -1.314711767e-06f, -1.985848940e-06f, -2.280101086e-07f,
+  -3.878689313e-06f, -2.120850468e-06f, -2.791987754e-06f, -1.034148909e-06f,
+  -3.529391506e-06f, -1.771552547e-06f, -2.442689947e-06f, -6.848509315e-07f,
+  -4.755941518e-06f, -2.998102673e-06f, -3.669239732e-06f, -1.911400886e-06f,
+  -4.406643711e-06f, -2.648804639e-06f, -3.319941925e-06f, -1.562102966e-06f,
+  -5.212782526e-06f, -3.454943453e-06f, -4.126080512e-06f, -2.368241667e-06f,
+  -4.863484264e-06f, -3.105645419e-06f, -3.776782705e-06f, -2.018943860e-06f,
+  -5.706578577e-06f, -3.948739959e-06f, -4.619877018e-06f, -2.862038173e-06f,
+  -5.357280770e-06f, -3.599441925e-06f, -4.270579211e-06f, -2.512740139e-06f,
+  -6.163419584e-06f, -4.405580512e-06f, -5.076718026e-06f, -3.318878953e-06f,
+  -5.814121778e-06f, -4.056282705e-06f, -4.727419764e-06f, -2.969581146e-06f,
+  -7.040671790e-06f, -5.282832717e-06f, -5.953969776e-06f, -4.196131158e-06f,
+  -6.691373528e-06f, -4.933534910e-06f, -5.604671969e-06f, -3.846832897e-06f,
+  -7.497512343e-06f, -5.739673725e-06f, -6.410810784e-06f, -4.652971711e-06f,
+  -7.148214536e-06f, -5.390375463e-06f, -6.061512977e-06f, -4.303673904e-06f
+},
+{
+  4.243975491e-05f, 3.684201874e-05f, 3.557781747e-05f, 2.998008131e-05f,
+  3.423105227e-05f, 2.863331247e-05f, 2.736911301e-05f, 2.177137503e-05f,
+  3.280043529e-05f, 2.720269549e-05f, 2.593849786e-05f, 2.034075806e-05f,
+  2.459172902e-05f, 1.899399103e-05f, 1.772979158e-05f, 1.213205360e-05f,
+  3.128491880e-05f, 2.568718264e-05f, 2.442298319e-05f, 1.882524521e-05f,
+  2.307621435e-05f, 1.747847637e-05f, 1.621427691e-05f, 1.061653893e-05f,
+  2.164559737e-05f, 1.604785939e-05f, 1.478366084e-05f, 9.185922863e-06f,
+  1.343689200e-05f, 7.839154023e-06f, 6.574955478e-06f, 9.772171552e-07f,
+  2.968370609e-05f, 2.408596811e-05f, 2.282176865e-05f, 1.722403067e-05f,
+  2.147500163e-05f, 1.587726365e-05f, 1.461306420e-05f, 9.015325304e-06f,
+  2.004438466e-05f, 1.444664576e-05f, 1.318244722e-05f, 7.584709238e-06f,
+  1.183567929e-05f, 6.237940852e-06f, 4.973741852e-06f, -6.239963568e-07f,
+  1.852886999e-05f, 1.293113201e-05f, 1.166693346e-05f, 6.069195024e-06f,
+  1.032016462e-05f, 4.722426638e-06f, 3.458227638e-06f, -2.139510570e-06f,
+  8.889548553e-06f, 3.291809890e-06f, 2.027611117e-06f, -3.570127092e-06f,
+  6.808426178e-07f, -4.916895705e-06f, -6.181094250e-06f, -1.177883223e-05f,
+  2.799625872e-05f, 2.239852074e-05f, 2.113432129e-05f, 1.553658331e-05f,
+  1.978755427e-05f, 1.418981537e-05f, 1.292561683e-05f, 7.327878393e-06f,
+  1.835693729e-05f, 1.275919840e-05f, 1.149499985e-05f, 5.897261872e-06f,
+  1.014823192e-05f, 4.550493486e-06f, 3.286294486e-06f, -2.311443723e-06f,
+  1.684142262e-05f, 1.124368464e-05f, 9.979486094e-06f, 4.381747658e-06f,
+  8.632717254e-06f, 3.034979045e-06f, 1.770780273e-06f, -3.826957709e-06f,
+  7.202100733e-06f, 1.604362524e-06f, 3.401637230e-07f, -5.257574685e-06f,
+  -1.006604748e-06f, -6.604343071e-06f, -7.868541616e-06f, -1.346627960e-05f,
+  1.524020900e-05f, 9.642471014e-06f, 8.378272469e-06f, 2.780534032e-06f,
+  7.031503628e-06f, 1.433765647e-06f, 1.695667748e-07f, -5.428171335e-06f,
+  5.600887107e-06f, 3.149035921e-09f, -1.261049761e-06f, -6.858787856e-06f,
+  -2.607818260e-06f, -8.205556696e-06f, -9.469755241e-06f, -1.506749322e-05f,
+  4.085372893e-06f, -1.512365202e-06f, -2.776564088e-06f, -8.374302524e-06f,
+  -4.123332474e-06f, -9.721070455e-06f, -1.098526991e-05f, -1.658300789e-05f,
+  -5.553948995e-06f, -1.115168743e-05f, -1.241588598e-05f, -1.801362487e-05f,
+  -1.376265482e-05f, -1.936039189e-05f, -2.062459134e-05f, -2.622232932e-05f,
+  2.622232932e-05f, 2.062459134e-05f, 1.936039189e-05f, 1.376265482e-05f,
+  1.801362487e-05f, 1.241588598e-05f, 1.115168743e-05f, 5.553948995e-06f,
+  1.658300789e-05f, 1.098526991e-05f, 9.721070455e-06f, 4.123332474e-06f,
+  8.374302524e-06f, 2.776564088e-06f, 1.512365202e-06f, -4.085372893e-06f,
+  1.506749322e-05f, 9.469755241e-06f, 8.205556696e-06f, 2.607818260e-06f,
+  6.858787856e-06f, 1.261049761e-06f, -3.149035921e-09f, -5.600887107e-06f,
+  5.428171335e-06f, -1.695667748e-07f, -1.433765647e-06f, -7.031503628e-06f,
+  -2.780534032e-06f, -8.378272469e-06f, -9.642471014e-06f, -1.524020900e-05f,
+  1.346627960e-05f, 7.868541616e-06f, 6.604343071e-06f, 1.006604748e-06f,
+  5.257574685e-06f, -3.401637230e-07f, -1.604362524e-06f, -7.202100733e-06f,
+  3.826957709e-06f, -1.770780273e-06f, -3.034979045e-06f, -8.632717254e-06f,
+  -4.381747658e-06f, -9.979486094e-06f, -1.124368464e-05f, -1.684142262e-05f,
+  2.311443723e-06f, -3.286294486e-06f, -4.550493486e-06f, -1.014823192e-05f,
+  -5.897261872e-06f, -1.149499985e-05f, -1.275919840e-05f, -1.835693729e-05f,
+  -7.327878393e-06f, -1.292561683e-05f, -1.418981537e-05f, -1.978755427e-05f,
+  -1.553658331e-05f, -2.113432129e-05f, -2.239852074e-05f, -2.799625872e-05f,
+  1.177883223e-05f, 6.181094250e-06f, 4.916895705e-06f, -6.808426178e-07f,
+  3.570127092e-06f, -2.027611117e-06f, -3.291809890e-06f, -8.889548553e-06f,
+  2.139510570e-06f, -3.458227638e-06f, -4.722426638e-06f, -1.032016462e-05f,
+  -6.069195024e-06f, -1.166693346e-05f, -1.293113201e-05f, -1.852886999e-05f,
+  6.239963568e-07f, -4.973741852e-06f, -6.237940852e-06f, -1.183567929e-05f,
+  -7.584709238e-06f, -1.318244722e-05f, -1.444664576e-05f, -2.004438466e-05f,
+  -9.015325304e-06f, -1.461306420e-05f, -1.587726365e-05f, -2.147500163e-05f,
+  -1.722403067e-05f, -2.282176865e-05f, -2.408596811e-05f, -2.968370609e-05f,
+  -9.772171552e-07f, -6.574955478e-06f, -7.839154023e-06f, -1.343689200e-05f,
+  -9.185922863e-06f, -1.478366084e-05f, -1.604785939e-05f, -2.164559737e-05f,
+  -1.061653893e-05f, -1.621427691e-05f, -1.747847637e-05f, -2.307621435e-05f,
+  -1.882524521e-05f, -2.442298319e-05f, -2.568718264e-05f, -3.128491880e-05f,
+  -1.213205360e-05f, -1.772979158e-05f, -1.899399103e-05f, -2.459172902e-05f,
+  -2.034075806e-05f, -2.593849786e-05f, -2.720269549e-05f, -3.280043529e-05f,
+  -2.177137503e-05f, -2.736911301e-05f, -2.863331247e-05f, -3.423105227e-05f,
+  -2.998008131e-05f, -3.557781747e-05f, -3.684201874e-05f, -4.243975491e-05f
+},
+{
+  1.019003612e-04f, 8.382258238e-05f, 8.187619096e-05f, 6.379840488e-05f,
+  7.984447439e-05f, 6.176669558e-05f, 5.982030052e-05f, 4.174252172e-05f,
+  7.772853860e-05f, 5.965076343e-05f, 5.770436474e-05f, 3.962658593e-05f,
+  5.567265544e-05f, 3.759487663e-05f, 3.564847793e-05f, 1.757069913e-05f,
+  7.552985335e-05f, 5.745207454e-05f, 5.550567948e-05f, 3.742789704e-05f,
+  5.347396655e-05f, 3.539618774e-05f, 3.344979268e-05f, 1.537201024e-05f,
+  5.135803076e-05f, 3.328025196e-05f, 3.133385690e-05f, 1.325607536e-05f,
+  2.930214578e-05f, 1.122436515e-05f, 9.277969184e-06f, -8.799811440e-06f,
+  7.325028855e-05f, 5.517250611e-05f, 5.322611105e-05f, 3.514833224e-05f,
+  5.119440175e-05f, 3.311661931e-05f, 3.117022425e-05f, 1.309244362e-05f,
+  4.907846596e-05f, 3.100068352e-05f, 2.905428846e-05f, 1.097650875e-05f,
+  2.702257734e-05f, 8.944797628e-06f, 6.998401659e-06f, -1.107937806e-05f,
+  4.687977707e-05f, 2.880199645e-05f, 2.685560139e-05f, 8.777820767e-06f,
+  2.482389027e-05f, 6.746109648e-06f, 4.799713679e-06f, -1.327806604e-05f,
+  2.270795449e-05f, 4.630173862e-06f, 2.683778348e-06f, -1.539400182e-05f,
+  6.520674560e-07f, -1.742571294e-05f, -1.937210800e-05f, -3.744988862e-05f,
+  7.089213614e-05f, 5.281435369e-05f, 5.086795863e-05f, 3.279017619e-05f,
+  4.883624570e-05f, 3.075846689e-05f, 2.881207001e-05f, 1.073429030e-05f,
+  4.672030991e-05f, 2.864253111e-05f, 2.669613423e-05f, 8.618354514e-06f,
+  2.466442311e-05f, 6.586643394e-06f, 4.640247880e-06f, -1.343753229e-05f,
+  4.452162102e-05f, 2.644384222e-05f, 2.449744716e-05f, 6.419666079e-06f,
+  2.246573604e-05f, 4.387955414e-06f, 2.441559673e-06f, -1.563622027e-05f,
+  2.034980025e-05f, 2.272019856e-06f, 3.256241143e-07f, -1.775215605e-05f,
+  -1.706086664e-06f, -1.978386717e-05f, -2.173026223e-05f, -3.980804468e-05f,
+  4.224205622e-05f, 2.416427560e-05f, 2.221787872e-05f, 4.140099009e-06f,
+  2.018616942e-05f, 2.108388344e-06f, 1.619926024e-07f, -1.791578688e-05f,
+  1.807023364e-05f, -7.547306780e-09f, -1.953942956e-06f, -2.003172267e-05f,
+  -3.985653620e-06f, -2.206343379e-05f, -2.400983067e-05f, -4.208760947e-05f,
+  1.587154475e-05f, -2.206235195e-06f, -4.152630936e-06f, -2.223041156e-05f,
+  -6.184341601e-06f, -2.426212268e-05f, -2.620851774e-05f, -4.428629836e-05f,
+  -8.300277841e-06f, -2.637805846e-05f, -2.832445352e-05f, -4.640223415e-05f,
+  -3.035616464e-05f, -4.843394345e-05f, -5.038033851e-05f, -6.845811731e-05f,
+  6.845811731e-05f, 5.038033851e-05f, 4.843394345e-05f, 3.035616464e-05f,
+  4.640223415e-05f, 2.832445352e-05f, 2.637805846e-05f, 8.300277841e-06f,
+  4.428629836e-05f, 2.620851774e-05f, 2.426212268e-05f, 6.184341601e-06f,
+  2.223041156e-05f, 4.152630936e-06f, 2.206235195e-06f, -1.587154475e-05f,
+  4.208760947e-05f, 2.400983067e-05f, 2.206343379e-05f, 3.985653620e-06f,
+  2.003172267e-05f, 1.953942956e-06f, 7.547306780e-09f, -1.807023364e-05f,
+  1.791578688e-05f, -1.619926024e-07f, -2.108388344e-06f, -2.018616942e-05f,
+  -4.140099009e-06f, -2.221787872e-05f, -2.416427560e-05f, -4.224205622e-05f,
+  3.980804468e-05f, 2.173026223e-05f, 1.978386717e-05f, 1.706086664e-06f,
+  1.775215605e-05f, -3.256241143e-07f, -2.272019856e-06f, -2.034980025e-05f,
+  1.563622027e-05f, -2.441559673e-06f, -4.387955414e-06f, -2.246573604e-05f,
+  -6.419666079e-06f, -2.449744716e-05f, -2.644384222e-05f, -4.452162102e-05f,
+  1.343753229e-05f, -4.640247880e-06f, -6.586643394e-06f, -2.466442311e-05f,
+  -8.618354514e-06f, -2.669613423e-05f, -2.864253111e-05f, -4.672030991e-05f,
+  -1.073429030e-05f, -2.881207001e-05f, -3.075846689e-05f, -4.883624570e-05f,
+  -3.279017619e-05f, -5.086795863e-05f, -5.281435369e-05f, -7.089213614e-05f,
+  3.744988862e-05f, 1.937210800e-05f, 1.742571294e-05f, -6.520674560e-07f,
+  1.539400182e-05f, -2.683778348e-06f, -4.630173862e-06f, -2.270795449e-05f,
+  1.327806604e-05f, -4.799713679e-06f, -6.746109648e-06f, -2.482389027e-05f,
+  -8.777820767e-06f, -2.685560139e-05f, -2.880199645e-05f, -4.687977707e-05f,
+  1.107937806e-05f, -6.998401659e-06f, -8.944797628e-06f, -2.702257734e-05f,
+  -1.097650875e-05f, -2.905428846e-05f, -3.100068352e-05f, -4.907846596e-05f,
+  -1.309244362e-05f, -3.117022425e-05f, -3.311661931e-05f, -5.119440175e-05f,
+  -3.514833224e-05f, -5.322611105e-05f, -5.517250611e-05f, -7.325028855e-05f,
+  8.799811440e-06f, -9.277969184e-06f, -1.122436515e-05f, -2.930214578e-05f,
+  -1.325607536e-05f, -3.133385690e-05f, -3.328025196e-05f, -5.135803076e-05f,
+  -1.537201024e-05f, -3.344979268e-05f, -3.539618774e-05f, -5.347396655e-05f,
+  -3.742789704e-05f, -5.550567948e-05f, -5.745207454e-05f, -7.552985335e-05f,
+  -1.757069913e-05f, -3.564847793e-05f, -3.759487663e-05f, -5.567265544e-05f,
+  -3.962658593e-05f, -5.770436474e-05f, -5.965076343e-05f, -7.772853860e-05f,
+  -4.174252172e-05f, -5.982030052e-05f, -6.176669558e-05f, -7.984447439e-05f,
+  -6.379840488e-05f, -8.187619096e-05f, -8.382258238e-05f, -1.019003612e-04f
+},
+{
+  1.814956195e-04f, 1.455466845e-04f, 1.429709664e-04f, 1.070220387e-04f,
+  1.403303759e-04f, 1.043814409e-04f, 1.018057301e-04f, 6.585679512e-05f,
+  1.376295259e-04f, 1.016805982e-04f, 9.910488006e-05f, 6.315595238e-05f,
+  9.646428225e-05f, 6.051535092e-05f, 5.793964010e-05f, 2.199070695e-05f,
+  1.348735823e-04f, 9.892465459e-05f, 9.634893649e-05f, 6.040000881e-05f,
+  9.370833868e-05f, 5.775940735e-05f, 5.518369653e-05f, 1.923476339e-05f,
+  9.100749594e-05f, 5.505856097e-05f, 5.248285015e-05f, 1.653391701e-05f,
+  4.984225234e-05f, 1.389331919e-05f, 1.131760746e-05f, -2.463132478e-05f,
+  1.320682204e-04f, 9.611929272e-05f, 9.354358190e-05f, 5.759464693e-05f,
+  9.090298408e-05f, 5.495404912e-05f, 5.237833830e-05f, 1.642940515e-05f,
+  8.820213407e-05f, 5.225320274e-05f, 4.967749192e-05f, 1.372855786e-05f,
+  4.703689410e-05f, 1.108796005e-05f, 8.512247405e-06f, -2.743668483e-05f,
+  8.544619050e-05f, 4.949725917e-05f, 4.692154835e-05f, 1.097261611e-05f,
+  4.428095053e-05f, 8.332017387e-06f, 5.756305200e-06f, -3.019262658e-05f,
+  4.158010415e-05f, 5.631171007e-06f, 3.055458819e-06f, -3.289347296e-05f,
+  4.148605512e-07f, -3.553407078e-05f, -3.810978524e-05f, -7.405872020e-05f,
+  1.292196685e-04f, 9.327073349e-05f, 9.069502266e-05f, 5.474608770e-05f,
+  8.805442485e-05f, 5.210548989e-05f, 4.952977542e-05f, 1.358084410e-05f,
+  8.535357483e-05f, 4.940464351e-05f, 4.682892904e-05f, 1.087999772e-05f,
+  4.418833123e-05f, 8.239399904e-06f, 5.663687261e-06f, -3.028524588e-05f,
+  8.259763126e-05f, 4.664869994e-05f, 4.407298911e-05f, 8.124055057e-06f,
+  4.143239130e-05f, 5.483457244e-06f, 2.907744829e-06f, -3.304118945e-05f,
+  3.873154492e-05f, 2.782610864e-06f, 2.068985054e-07f, -3.574203583e-05f,
+  -2.433699819e-06f, -3.838263365e-05f, -4.095834447e-05f, -7.690727944e-05f,
+  7.979227667e-05f, 4.384334170e-05f, 4.126762724e-05f, 5.318695457e-06f,
+  3.862702943e-05f, 2.678097417e-06f, 1.023850871e-07f, -3.584654769e-05f,
+  3.592618305e-05f, -2.274897426e-08f, -2.598461151e-06f, -3.854739407e-05f,
+  -5.239059647e-06f, -4.118799188e-05f, -4.376370271e-05f, -7.971263403e-05f,
+  3.317023948e-05f, -2.778691396e-06f, -5.354403584e-06f, -4.130333764e-05f,
+  -7.995002306e-06f, -4.394393545e-05f, -4.651964628e-05f, -8.246857760e-05f,
+  -1.069584869e-05f, -4.664478183e-05f, -4.922049266e-05f, -8.516942762e-05f,
+  -5.186109047e-05f, -8.781002543e-05f, -9.038573626e-05f, -1.263346639e-04f,
+  1.263346639e-04f, 9.038573626e-05f, 8.781002543e-05f, 5.186109047e-05f,
+  8.516942762e-05f, 4.922049266e-05f, 4.664478183e-05f, 1.069584869e-05f,
+  8.246857760e-05f, 4.651964628e-05f, 4.394393545e-05f, 7.995002306e-06f,
+  4.130333764e-05f, 5.354403584e-06f, 2.778691396e-06f, -3.317023948e-05f,
+  7.971263403e-05f, 4.376370271e-05f, 4.118799188e-05f, 5.239059647e-06f,
+  3.854739407e-05f, 2.598461151e-06f, 2.274897426e-08f, -3.592618305e-05f,
+  3.584654769e-05f, -1.023850871e-07f, -2.678097417e-06f, -3.862702943e-05f,
+  -5.318695457e-06f, -4.126762724e-05f, -4.384334170e-05f, -7.979227667e-05f,
+  7.690727944e-05f, 4.095834447e-05f, 3.838263365e-05f, 2.433699819e-06f,
+  3.574203583e-05f, -2.068985054e-07f, -2.782610864e-06f, -3.873154492e-05f,
+  3.304118945e-05f, -2.907744829e-06f, -5.483457244e-06f, -4.143239130e-05f,
+  -8.124055057e-06f, -4.407298911e-05f, -4.664869994e-05f, -8.259763126e-05f,
+  3.028524588e-05f, -5.663687261e-06f, -8.239399904e-06f, -4.418833123e-05f,
+  -1.087999772e-05f, -4.682892904e-05f, -4.940464351e-05f, -8.535357483e-05f,
+  -1.358084410e-05f, -4.952977542e-05f, -5.210548989e-05f, -8.805442485e-05f,
+  -5.474608770e-05f, -9.069502266e-05f, -9.327073349e-05f, -1.292196685e-04f,
+  7.405872020e-05f, 3.810978524e-05f, 3.553407078e-05f, -4.148605512e-07f,
+  3.289347296e-05f, -3.055458819e-06f, -5.631171007e-06f, -4.158010415e-05f,
+  3.019262658e-05f, -5.756305200e-06f, -8.332017387e-06f, -4.428095053e-05f,
+  -1.097261611e-05f, -4.692154835e-05f, -4.949725917e-05f, -8.544619050e-05f,
+  2.743668483e-05f, -8.512247405e-06f, -1.108796005e-05f, -4.703689410e-05f,
+  -1.372855786e-05f, -4.967749192e-05f, -5.225320274e-05f, -8.820213407e-05f,
+  -1.642940515e-05f, -5.237833830e-05f, -5.495404912e-05f, -9.090298408e-05f,
+  -5.759464693e-05f, -9.354358190e-05f, -9.611929272e-05f, -1.320682204e-04f,
+  2.463132478e-05f, -1.131760746e-05f, -1.389331919e-05f, -4.984225234e-05f,
+  -1.653391701e-05f, -5.248285015e-05f, -5.505856097e-05f, -9.100749594e-05f,
+  -1.923476339e-05f, -5.518369653e-05f, -5.775940735e-05f, -9.370833868e-05f,
+  -6.040000881e-05f, -9.634893649e-05f, -9.892465459e-05f, -1.348735823e-04f,
+  -2.199070695e-05f, -5.793964010e-05f, -6.051535092e-05f, -9.646428225e-05f,
+  -6.315595238e-05f, -9.910488006e-05f, -1.016805982e-04f, -1.376295259e-04f,
+  -6.585679512e-05f, -1.018057301e-04f, -1.043814409e-04f, -1.403303759e-04f,
+  -1.070220387e-04f, -1.429709664e-04f, -1.455466845e-04f, -1.814956195e-04f
+},
+{
+  2.734202426e-04f, 2.153451787e-04f, 2.124098392e-04f, 1.543347898e-04f,
+  2.094617375e-04f, 1.513866737e-04f, 1.484513487e-04f, 9.037628479e-05f,
+  2.065098961e-04f, 1.484348322e-04f, 1.454994926e-04f, 8.742444334e-05f,
+  1.425513910e-04f, 8.447633445e-05f, 8.154100215e-05f, 2.346594374e-05f,
+  2.035639191e-04f, 1.454888552e-04f, 1.425535302e-04f, 8.447846631e-05f,
+  1.396054140e-04f, 8.153036470e-05f, 7.859502512e-05f, 2.051997035e-05f,
+  1.366535726e-04f, 7.857852324e-05f, 7.564318366e-05f, 1.756812708e-05f,
+  7.269508205e-05f, 1.462002274e-05f, 1.168468680e-05f, -4.639037070e-05f,
+  2.006339928e-04f, 1.425589435e-04f, 1.396236039e-04f, 8.154854731e-05f,
+  1.366755023e-04f, 7.860044570e-05f, 7.566510612e-05f, 1.759005318e-05f,
+  1.337236608e-04f, 7.564860425e-05f, 7.271326467e-05f, 1.463820900e-05f,
+  6.976516306e-05f, 1.169010375e-05f, 8.754768714e-06f, -4.932028969e-05f,
+  1.307776838e-04f, 7.270262722e-05f, 6.976729492e-05f, 1.169223560e-05f,
+  6.681918603e-05f, 8.744130355e-06f, 5.808794867e-06f, -5.226626308e-05f,
+  6.386734458e-05f, 5.792287538e-06f, 2.856951824e-06f, -5.521810454e-05f,
+  -9.115324673e-08f, -5.816620978e-05f, -6.110154936e-05f, -1.191766059e-04f,
+  1.977309003e-04f, 1.396558364e-04f, 1.367204968e-04f, 7.864544750e-05f,
+  1.337723952e-04f, 7.569733862e-05f, 7.276200631e-05f, 1.468694882e-05f,
+  1.308205537e-04f, 7.274549716e-05f, 6.981016486e-05f, 1.173510555e-05f,
+  6.686205597e-05f, 8.787000297e-06f, 5.851664810e-06f, -5.222339314e-05f,
+  1.278745767e-04f, 6.979952741e-05f, 6.686418783e-05f, 8.789132153e-06f,
+  6.391608622e-05f, 5.841026905e-06f, 2.905691417e-06f, -5.516936653e-05f,
+  6.096424113e-05f, 2.889183861e-06f, -4.615182192e-08f, -5.812120799e-05f,
+  -2.994256874e-06f, -6.106931687e-05f, -6.400464918e-05f, -1.220797130e-04f,
+  1.249446650e-04f, 6.686960842e-05f, 6.393426884e-05f, 5.859213161e-06f,
+  6.098616359e-05f, 2.911108368e-06f, -2.422732415e-08f, -5.809928552e-05f,
+  5.803432214e-05f, -4.073494608e-08f, -2.976070618e-06f, -6.105112698e-05f,
+  -5.924175639e-06f, -6.399923586e-05f, -6.693456817e-05f, -1.250096248e-04f,
+  5.508834874e-05f, -2.986708296e-06f, -5.922043783e-06f, -6.399710401e-05f,
+  -8.870149031e-06f, -6.694520562e-05f, -6.988053792e-05f, -1.279556018e-04f,
+  -1.182199230e-05f, -6.989704707e-05f, -7.283238665e-05f, -1.309074432e-04f,
+  -7.578048826e-05f, -1.338555448e-04f, -1.367908844e-04f, -1.948659337e-04f,
+  1.948659337e-04f, 1.367908844e-04f, 1.338555448e-04f, 7.578048826e-05f,
+  1.309074432e-04f, 7.283238665e-05f, 6.989704707e-05f, 1.182199230e-05f,
+  1.279556018e-04f, 6.988053792e-05f, 6.694520562e-05f, 8.870149031e-06f,
+  6.399710401e-05f, 5.922043783e-06f, 2.986708296e-06f, -5.508834874e-05f,
+  1.250096248e-04f, 6.693456817e-05f, 6.399923586e-05f, 5.924175639e-06f,
+  6.105112698e-05f, 2.976070618e-06f, 4.073494608e-08f, -5.803432214e-05f,
+  5.809928552e-05f, 2.422732415e-08f, -2.911108368e-06f, -6.098616359e-05f,
+  -5.859213161e-06f, -6.393426884e-05f, -6.686960842e-05f, -1.249446650e-04f,
+  1.220797130e-04f, 6.400464918e-05f, 6.106931687e-05f, 2.994256874e-06f,
+  5.812120799e-05f, 4.615182192e-08f, -2.889183861e-06f, -6.096424113e-05f,
+  5.516936653e-05f, -2.905691417e-06f, -5.841026905e-06f, -6.391608622e-05f,
+  -8.789132153e-06f, -6.686418783e-05f, -6.979952741e-05f, -1.278745767e-04f,
+  5.222339314e-05f, -5.851664810e-06f, -8.787000297e-06f, -6.686205597e-05f,
+  -1.173510555e-05f, -6.981016486e-05f, -7.274549716e-05f, -1.308205537e-04f,
+  -1.468694882e-05f, -7.276200631e-05f, -7.569733862e-05f, -1.337723952e-04f,
+  -7.864544750e-05f, -1.367204968e-04f, -1.396558364e-04f, -1.977309003e-04f,
+  1.191766059e-04f, 6.110154936e-05f, 5.816620978e-05f, 9.115324673e-08f,
+  5.521810454e-05f, -2.856951824e-06f, -5.792287538e-06f, -6.386734458e-05f,
+  5.226626308e-05f, -5.808794867e-06f, -8.744130355e-06f, -6.681918603e-05f,
+  -1.169223560e-05f, -6.976729492e-05f, -7.270262722e-05f, -1.307776838e-04f,
+  4.932028969e-05f, -8.754768714e-06f, -1.169010375e-05f, -6.976516306e-05f,
+  -1.463820900e-05f, -7.271326467e-05f, -7.564860425e-05f, -1.337236608e-04f,
+  -1.759005318e-05f, -7.566510612e-05f, -7.860044570e-05f, -1.366755023e-04f,
+  -8.154854731e-05f, -1.396236039e-04f, -1.425589435e-04f, -2.006339928e-04f,
+  4.639037070e-05f, -1.168468680e-05f, -1.462002274e-05f, -7.269508205e-05f,
+  -1.756812708e-05f, -7.564318366e-05f, -7.857852324e-05f, -1.366535726e-04f,
+  -2.051997035e-05f, -7.859502512e-05f, -8.153036470e-05f, -1.396054140e-04f,
+  -8.447846631e-05f, -1.425535302e-04f, -1.454888552e-04f, -2.035639191e-04f,
+  -2.346594374e-05f, -8.154100215e-05f, -8.447633445e-05f, -1.425513910e-04f,
+  -8.742444334e-05f, -1.454994926e-04f, -1.484348322e-04f, -2.065098961e-04f,
+  -9.037628479e-05f, -1.484513487e-04f, -1.513866737e-04f, -2.094617375e-04f,
+  -1.543347898e-04f, -2.124098392e-04f, -2.153451787e-04f, -2.734202426e-04f
+},
+{
+  3.614083107e-04f, 2.800390939e-04f, 2.772866865e-04f, 1.959174842e-04f,
+  2.746097744e-04f, 1.932405721e-04f, 1.904881647e-04f, 1.091189624e-04f,
+  2.720219200e-04f, 1.906527177e-04f, 1.879003103e-04f, 1.065311008e-04f,
+  1.852233981e-04f, 1.038541959e-04f, 1.011017885e-04f, 1.973258077e-05f,
+  2.695371513e-04f, 1.881679491e-04f, 1.854155416e-04f, 1.040463394e-04f,
+  1.827386441e-04f, 1.013694346e-04f, 9.861702711e-05f, 1.724781941e-05f,
+  1.801507751e-04f, 9.878157289e-05f, 9.602916543e-05f, 1.465995774e-05f,
+  9.335225332e-05f, 1.198305290e-05f, 9.230642718e-06f, -7.213855861e-05f,
+  2.671700495e-04f, 1.858008472e-04f, 1.830484398e-04f, 1.016792376e-04f,
+  1.803715422e-04f, 9.900233272e-05f, 9.624992526e-05f, 1.488071848e-05f,
+  1.777836733e-04f, 9.641447105e-05f, 9.366206359e-05f, 1.229285590e-05f,
+  9.098515875e-05f, 9.615951058e-06f, 6.863541330e-06f, -7.450566045e-05f,
+  1.752989192e-04f, 9.392970969e-05f, 9.117730224e-05f, 9.808094546e-06f,
+  8.850039012e-05f, 7.131189705e-06f, 4.378779522e-06f, -7.699042180e-05f,
+  8.591252845e-05f, 4.543327577e-06f, 1.790917622e-06f, -7.957828348e-05f,
+  -8.859875038e-07f, -8.225518832e-05f, -8.500760305e-05f, -1.663768053e-04f,
+  2.649356611e-04f, 1.835664443e-04f, 1.808140369e-04f, 9.944483463e-05f,
+  1.781371393e-04f, 9.676792979e-05f, 9.401552234e-05f, 1.264631646e-05f,
+  1.755492704e-04f, 9.418006812e-05f, 9.142766066e-05f, 1.005845479e-05f,
+  8.875075582e-05f, 7.381549494e-06f, 4.629139767e-06f, -7.674006338e-05f,
+  1.730645163e-04f, 9.169530676e-05f, 8.894289931e-05f, 7.573693438e-06f,
+  8.626599447e-05f, 4.896788141e-06f, 2.144378414e-06f, -7.922482473e-05f,
+  8.367813280e-05f, 2.308926014e-06f, -4.434837990e-07f, -8.181268640e-05f,
+  -3.120389010e-06f, -8.448959125e-05f, -8.724200597e-05f, -1.686112082e-04f,
+  1.706974144e-04f, 8.932820492e-05f, 8.657579747e-05f, 5.206591595e-06f,
+  8.389889263e-05f, 2.529686526e-06f, -2.227233296e-07f, -8.159192657e-05f,
+  8.131103095e-05f, -5.817557280e-08f, -2.810585556e-06f, -8.417978825e-05f,
+  -5.487490398e-06f, -8.685669309e-05f, -8.960910782e-05f, -1.709783101e-04f,
+  7.882626960e-05f, -2.542936954e-06f, -5.295346909e-06f, -8.666454960e-05f,
+  -7.972252206e-06f, -8.934145444e-05f, -9.209386917e-05f, -1.734630641e-04f,
+  -1.056011388e-05f, -9.192931611e-05f, -9.468173084e-05f, -1.760509331e-04f,
+  -9.735863568e-05f, -1.787278306e-04f, -1.814802526e-04f, -2.628494403e-04f,
+  2.628494403e-04f, 1.814802526e-04f, 1.787278306e-04f, 9.735863568e-05f,
+  1.760509331e-04f, 9.468173084e-05f, 9.192931611e-05f, 1.056011388e-05f,
+  1.734630641e-04f, 9.209386917e-05f, 8.934145444e-05f, 7.972252206e-06f,
+  8.666454960e-05f, 5.295346909e-06f, 2.542936954e-06f, -7.882626960e-05f,
+  1.709783101e-04f, 8.960910782e-05f, 8.685669309e-05f, 5.487490398e-06f,
+  8.417978825e-05f, 2.810585556e-06f, 5.817557280e-08f, -8.131103095e-05f,
+  8.159192657e-05f, 2.227233296e-07f, -2.529686526e-06f, -8.389889263e-05f,
+  -5.206591595e-06f, -8.657579747e-05f, -8.932820492e-05f, -1.706974144e-04f,
+  1.686112082e-04f, 8.724200597e-05f, 8.448959125e-05f, 3.120389010e-06f,
+  8.181268640e-05f, 4.434837990e-07f, -2.308926014e-06f, -8.367813280e-05f,
+  7.922482473e-05f, -2.144378414e-06f, -4.896788141e-06f, -8.626599447e-05f,
+  -7.573693438e-06f, -8.894289931e-05f, -9.169530676e-05f, -1.730645163e-04f,
+  7.674006338e-05f, -4.629139767e-06f, -7.381549494e-06f, -8.875075582e-05f,
+  -1.005845479e-05f, -9.142766066e-05f, -9.418006812e-05f, -1.755492704e-04f,
+  -1.264631646e-05f, -9.401552234e-05f, -9.676792979e-05f, -1.781371393e-04f,
+  -9.944483463e-05f, -1.808140369e-04f, -1.835664443e-04f, -2.649356611e-04f,
+  1.663768053e-04f, 8.500760305e-05f, 8.225518832e-05f, 8.859875038e-07f,
+  7.957828348e-05f, -1.790917622e-06f, -4.543327577e-06f, -8.591252845e-05f,
+  7.699042180e-05f, -4.378779522e-06f, -7.131189705e-06f, -8.850039012e-05f,
+  -9.808094546e-06f, -9.117730224e-05f, -9.392970969e-05f, -1.752989192e-04f,
+  7.450566045e-05f, -6.863541330e-06f, -9.615951058e-06f, -9.098515875e-05f,
+  -1.229285590e-05f, -9.366206359e-05f, -9.641447105e-05f, -1.777836733e-04f,
+  -1.488071848e-05f, -9.624992526e-05f, -9.900233272e-05f, -1.803715422e-04f,
+  -1.016792376e-04f, -1.830484398e-04f, -1.858008472e-04f, -2.671700495e-04f,
+  7.213855861e-05f, -9.230642718e-06f, -1.198305290e-05f, -9.335225332e-05f,
+  -1.465995774e-05f, -9.602916543e-05f, -9.878157289e-05f, -1.801507751e-04f,
+  -1.724781941e-05f, -9.861702711e-05f, -1.013694346e-04f, -1.827386441e-04f,
+  -1.040463394e-04f, -1.854155416e-04f, -1.881679491e-04f, -2.695371513e-04f,
+  -1.973258077e-05f, -1.011017885e-04f, -1.038541959e-04f, -1.852233981e-04f,
+  -1.065311008e-04f, -1.879003103e-04f, -1.906527177e-04f, -2.720219200e-04f,
+  -1.091189624e-04f, -1.904881647e-04f, -1.932405721e-04f, -2.746097744e-04f,
+  -1.959174842e-04f, -2.772866865e-04f, -2.800390939e-04f, -3.614083107e-04f
+},
+{
+  4.201810516e-04f, 3.197001352e-04f, 3.179585037e-04f, 2.174775873e-04f,
+  3.164140799e-04f, 2.159331489e-04f, 2.141915465e-04f, 1.137106228e-04f,
+  3.150838602e-04f, 2.146029292e-04f, 2.128613123e-04f, 1.123803959e-04f,
+  2.113168739e-04f, 1.108359575e-04f, 1.090943479e-04f, 8.613425052e-06f,
+  3.139851906e-04f, 2.135042596e-04f, 2.117626573e-04f, 1.112817336e-04f,
+  2.102182189e-04f, 1.097372951e-04f, 1.079956855e-04f, 7.514760000e-06f,
+  2.088879846e-04f, 1.084070682e-04f, 1.066654586e-04f, 6.184534868e-06f,
+  1.051210202e-04f, 4.640095085e-06f, 2.898485263e-06f, -9.758243687e-05f,
+  3.131356789e-04f, 2.126547624e-04f, 2.109131601e-04f, 1.104322364e-04f,
+  2.093687217e-04f, 1.088877907e-04f, 1.071461811e-04f, 6.665261935e-06f,
+  2.080384875e-04f, 1.075575710e-04f, 1.058159614e-04f, 5.335036349e-06f,
+  1.042715157e-04f, 3.790596793e-06f, 2.048986744e-06f, -9.843193402e-05f,
+  2.069398324e-04f, 1.064589014e-04f, 1.047172918e-04f, 4.236371296e-06f,
+  1.031728534e-04f, 2.691931741e-06f, 9.503218052e-07f, -9.953060362e-05f,
+  1.018426265e-04f, 1.361706381e-06f, -3.799034403e-07f, -1.008608233e-04f,
+  -1.924343223e-06f, -1.024052617e-04f, -1.041468786e-04f, -2.046277950e-04f,
+  3.125531948e-04f, 2.120722638e-04f, 2.103306470e-04f, 1.098497232e-04f,
+  2.087862085e-04f, 1.083052848e-04f, 1.065636752e-04f, 6.082755135e-06f,
+  2.074559889e-04f, 1.069750651e-04f, 1.052334555e-04f, 4.752530003e-06f,
+  1.036890098e-04f, 3.208090220e-06f, 1.466480398e-06f, -9.901443991e-05f,
+  2.063573193e-04f, 1.058763955e-04f, 1.041347859e-04f, 3.653864951e-06f,
+  1.025903475e-04f, 2.109425168e-06f, 3.678152609e-07f, -1.001131095e-04f,
+  1.012601206e-04f, 7.791999224e-07f, -9.624098993e-07f, -1.014433292e-04f,
+  -2.506849796e-06f, -1.029877749e-04f, -1.047293845e-04f, -2.052103082e-04f,
+  2.055078221e-04f, 1.050268984e-04f, 1.032852888e-04f, 2.804366659e-06f,
+  1.017408504e-04f, 1.259926876e-06f, -4.816830028e-07f, -1.009626067e-04f,
+  1.004106234e-04f, -7.029836979e-08f, -1.811908191e-06f, -1.022928336e-04f,
+  -3.356348088e-06f, -1.038372720e-04f, -1.055788816e-04f, -2.060598054e-04f,
+  9.931196109e-05f, -1.168963422e-06f, -2.910573357e-06f, -1.033914959e-04f,
+  -4.455012913e-06f, -1.049359344e-04f, -1.066775440e-04f, -2.071584604e-04f,
+  -5.785238500e-06f, -1.062661613e-04f, -1.080077709e-04f, -2.084886946e-04f,
+  -1.095522093e-04f, -2.100331330e-04f, -2.117747354e-04f, -3.122556664e-04f,
+  3.122556664e-04f, 2.117747354e-04f, 2.100331330e-04f, 1.095522093e-04f,
+  2.084886946e-04f, 1.080077709e-04f, 1.062661613e-04f, 5.785238500e-06f,
+  2.071584604e-04f, 1.066775440e-04f, 1.049359344e-04f, 4.455012913e-06f,
+  1.033914959e-04f, 2.910573357e-06f, 1.168963422e-06f, -9.931196109e-05f,
+  2.060598054e-04f, 1.055788816e-04f, 1.038372720e-04f, 3.356348088e-06f,
+  1.022928336e-04f, 1.811908191e-06f, 7.029836979e-08f, -1.004106234e-04f,
+  1.009626067e-04f, 4.816830028e-07f, -1.259926876e-06f, -1.017408504e-04f,
+  -2.804366659e-06f, -1.032852888e-04f, -1.050268984e-04f, -2.055078221e-04f,
+  2.052103082e-04f, 1.047293845e-04f, 1.029877749e-04f, 2.506849796e-06f,
+  1.014433292e-04f, 9.624098993e-07f, -7.791999224e-07f, -1.012601206e-04f,
+  1.001131095e-04f, -3.678152609e-07f, -2.109425168e-06f, -1.025903475e-04f,
+  -3.653864951e-06f, -1.041347859e-04f, -1.058763955e-04f, -2.063573193e-04f,
+  9.901443991e-05f, -1.466480398e-06f, -3.208090220e-06f, -1.036890098e-04f,
+  -4.752530003e-06f, -1.052334555e-04f, -1.069750651e-04f, -2.074559889e-04f,
+  -6.082755135e-06f, -1.065636752e-04f, -1.083052848e-04f, -2.087862085e-04f,
+  -1.098497232e-04f, -2.103306470e-04f, -2.120722638e-04f, -3.125531948e-04f,
+  2.046277950e-04f, 1.041468786e-04f, 1.024052617e-04f, 1.924343223e-06f,
+  1.008608233e-04f, 3.799034403e-07f, -1.361706381e-06f, -1.018426265e-04f,
+  9.953060362e-05f, -9.503218052e-07f, -2.691931741e-06f, -1.031728534e-04f,
+  -4.236371296e-06f, -1.047172918e-04f, -1.064589014e-04f, -2.069398324e-04f,
+  9.843193402e-05f, -2.048986744e-06f, -3.790596793e-06f, -1.042715157e-04f,
+  -5.335036349e-06f, -1.058159614e-04f, -1.075575710e-04f, -2.080384875e-04f,
+  -6.665261935e-06f, -1.071461811e-04f, -1.088877907e-04f, -2.093687217e-04f,
+  -1.104322364e-04f, -2.109131601e-04f, -2.126547624e-04f, -3.131356789e-04f,
+  9.758243687e-05f, -2.898485263e-06f, -4.640095085e-06f, -1.051210202e-04f,
+  -6.184534868e-06f, -1.066654586e-04f, -1.084070682e-04f, -2.088879846e-04f,
+  -7.514760000e-06f, -1.079956855e-04f, -1.097372951e-04f, -2.102182189e-04f,
+  -1.112817336e-04f, -2.117626573e-04f, -2.135042596e-04f, -3.139851906e-04f,
+  -8.613425052e-06f, -1.090943479e-04f, -1.108359575e-04f, -2.113168739e-04f,
+  -1.123803959e-04f, -2.128613123e-04f, -2.146029292e-04f, -3.150838602e-04f,
+  -1.137106228e-04f, -2.141915465e-04f, -2.159331489e-04f, -3.164140799e-04f,
+  -2.174775873e-04f, -3.179585037e-04f, -3.197001352e-04f, -4.201810516e-04f
+},
+{
+  4.169632739e-04f, 3.090434766e-04f, 3.093703999e-04f, 2.014506026e-04f,
+  3.100368194e-04f, 2.021170221e-04f, 2.024439309e-04f, 9.452414088e-05f,
+  3.110609250e-04f, 2.031411423e-04f, 2.034680510e-04f, 9.554826102e-05f,
+  2.041344706e-04f, 9.621468780e-05f, 9.654158930e-05f, -1.137820072e-05f,
+  3.124608484e-04f, 2.045410511e-04f, 2.048679598e-04f, 9.694816254e-05f,
+  2.055343793e-04f, 9.761458932e-05f, 9.794149082e-05f, -9.978296475e-06f,
+  2.065584995e-04f, 9.863871674e-05f, 9.896561824e-05f, -8.954172699e-06f,
+  9.963203775e-05f, -8.287748642e-06f, -7.960846233e-06f, -1.158806335e-04f,
+  3.142544592e-04f, 2.063346619e-04f, 2.066615561e-04f, 9.874177340e-05f,
+  2.073279902e-04f, 9.940820019e-05f, 9.973510168e-05f, -8.184689250e-06f,
+  2.083521103e-04f, 1.004323203e-04f, 1.007592218e-04f, -7.160565929e-06f,
+  1.014256486e-04f, -6.494141417e-06f, -6.167239007e-06f, -1.140870299e-04f,
+  2.097520191e-04f, 1.018322218e-04f, 1.021591306e-04f, -5.760661679e-06f,
+  1.028255501e-04f, -5.094237167e-06f, -4.767335213e-06f, -1.126871211e-04f,
+  1.038496775e-04f, -4.070113391e-06f, -3.743211437e-06f, -1.116630010e-04f,
+  -3.076787152e-06f, -1.109965742e-04f, -1.106696727e-04f, -2.185894555e-04f,
+  3.164594527e-04f, 2.085396700e-04f, 2.088665642e-04f, 1.009467815e-04f,
+  2.095329983e-04f, 1.016132082e-04f, 1.019401097e-04f, -5.979679827e-06f,
+  2.105571184e-04f, 1.026373284e-04f, 1.029642299e-04f, -4.955556051e-06f,
+  1.036306567e-04f, -4.289131994e-06f, -3.962229584e-06f, -1.118820219e-04f,
+  2.119570272e-04f, 1.040372372e-04f, 1.043641387e-04f, -3.555652029e-06f,
+  1.050305582e-04f, -2.889227744e-06f, -2.562325562e-06f, -1.104821131e-04f,
+  1.060546856e-04f, -1.865103968e-06f, -1.538201786e-06f, -1.094579929e-04f,
+  -8.717775017e-07f, -1.087915662e-04f, -1.084646647e-04f, -2.163844474e-04f,
+  2.137506235e-04f, 1.058308408e-04f, 1.061577423e-04f, -1.762045144e-06f,
+  1.068241691e-04f, -1.095620860e-06f, -7.687186212e-07f, -1.086885095e-04f,
+  1.078482892e-04f, -7.149706249e-08f, 2.554051548e-07f, -1.076643821e-04f,
+  9.218294394e-07f, -1.069979626e-04f, -1.066710538e-04f, -2.145908511e-04f,
+  1.092481980e-04f, 1.328407052e-06f, 1.655309234e-06f, -1.062644806e-04f,
+  2.321733518e-06f, -1.055980538e-04f, -1.052711523e-04f, -2.131909423e-04f,
+  3.345857294e-06f, -1.045739336e-04f, -1.042470321e-04f, -2.121668222e-04f,
+  -1.035806054e-04f, -2.115003881e-04f, -2.111734939e-04f, -3.190932912e-04f,
+  3.190932912e-04f, 2.111734939e-04f, 2.115003881e-04f, 1.035806054e-04f,
+  2.121668222e-04f, 1.042470321e-04f, 1.045739336e-04f, -3.345857294e-06f,
+  2.131909423e-04f, 1.052711523e-04f, 1.055980538e-04f, -2.321733518e-06f,
+  1.062644806e-04f, -1.655309234e-06f, -1.328407052e-06f, -1.092481980e-04f,
+  2.145908511e-04f, 1.066710538e-04f, 1.069979626e-04f, -9.218294394e-07f,
+  1.076643821e-04f, -2.554051548e-07f, 7.149706249e-08f, -1.078482892e-04f,
+  1.086885095e-04f, 7.687186212e-07f, 1.095620860e-06f, -1.068241691e-04f,
+  1.762045144e-06f, -1.061577423e-04f, -1.058308408e-04f, -2.137506235e-04f,
+  2.163844474e-04f, 1.084646647e-04f, 1.087915662e-04f, 8.717775017e-07f,
+  1.094579929e-04f, 1.538201786e-06f, 1.865103968e-06f, -1.060546856e-04f,
+  1.104821131e-04f, 2.562325562e-06f, 2.889227744e-06f, -1.050305582e-04f,
+  3.555652029e-06f, -1.043641387e-04f, -1.040372372e-04f, -2.119570272e-04f,
+  1.118820219e-04f, 3.962229584e-06f, 4.289131994e-06f, -1.036306567e-04f,
+  4.955556051e-06f, -1.029642299e-04f, -1.026373284e-04f, -2.105571184e-04f,
+  5.979679827e-06f, -1.019401097e-04f, -1.016132082e-04f, -2.095329983e-04f,
+  -1.009467815e-04f, -2.088665642e-04f, -2.085396700e-04f, -3.164594527e-04f,
+  2.185894555e-04f, 1.106696727e-04f, 1.109965742e-04f, 3.076787152e-06f,
+  1.116630010e-04f, 3.743211437e-06f, 4.070113391e-06f, -1.038496775e-04f,
+  1.126871211e-04f, 4.767335213e-06f, 5.094237167e-06f, -1.028255501e-04f,
+  5.760661679e-06f, -1.021591306e-04f, -1.018322218e-04f, -2.097520191e-04f,
+  1.140870299e-04f, 6.167239007e-06f, 6.494141417e-06f, -1.014256486e-04f,
+  7.160565929e-06f, -1.007592218e-04f, -1.004323203e-04f, -2.083521103e-04f,
+  8.184689250e-06f, -9.973510168e-05f, -9.940820019e-05f, -2.073279902e-04f,
+  -9.874177340e-05f, -2.066615561e-04f, -2.063346619e-04f, -3.142544592e-04f,
+  1.158806335e-04f, 7.960846233e-06f, 8.287748642e-06f, -9.963203775e-05f,
+  8.954172699e-06f, -9.896561824e-05f, -9.863871674e-05f, -2.065584995e-04f,
+  9.978296475e-06f, -9.794149082e-05f, -9.761458932e-05f, -2.055343793e-04f,
+  -9.694816254e-05f, -2.048679598e-04f, -2.045410511e-04f, -3.124608484e-04f,
+  1.137820072e-05f, -9.654158930e-05f, -9.621468780e-05f, -2.041344706e-04f,
+  -9.554826102e-05f, -2.034680510e-04f, -2.031411423e-04f, -3.110609250e-04f,
+  -9.452414088e-05f, -2.024439309e-04f, -2.021170221e-04f, -3.100368194e-04f,
+  -2.014506026e-04f, -3.093703999e-04f, -3.090434766e-04f, -4.169632739e-04f
+},
+{
+  3.156451567e-04f, 2.208548394e-04f, 2.243970230e-04f, 1.296067057e-04f,
+  2.284178045e-04f, 1.336274872e-04f, 1.371696708e-04f, 4.237936082e-05f,
+  2.329327399e-04f, 1.381424227e-04f, 1.416846062e-04f, 4.689429625e-05f,
+  1.457053877e-04f, 5.091508137e-05f, 5.445725765e-05f, -4.033304867e-05f,
+  2.379567159e-04f, 1.431663986e-04f, 1.467085822e-04f, 5.191827222e-05f,
+  1.507293637e-04f, 5.593905735e-05f, 5.948123362e-05f, -3.530907634e-05f,
+  1.552442991e-04f, 6.045399277e-05f, 6.399616541e-05f, -3.079414091e-05f,
+  6.801695417e-05f, -2.677335578e-05f, -2.323117951e-05f, -1.180214895e-04f,
+  2.435038768e-04f, 1.487135742e-04f, 1.522557577e-04f, 5.746544412e-05f,
+  1.562765392e-04f, 6.148622924e-05f, 6.502840552e-05f, -2.976190262e-05f,
+  1.607914746e-04f, 6.600116467e-05f, 6.954334094e-05f, -2.524696720e-05f,
+  7.356412243e-05f, -2.122618389e-05f, -1.768400762e-05f, -1.124743139e-04f,
+  1.658154506e-04f, 7.102514064e-05f, 7.456731691e-05f, -2.022299122e-05f,
+  7.858809840e-05f, -1.620220792e-05f, -1.266003164e-05f, -1.074503380e-04f,
+  8.310303383e-05f, -1.168727249e-05f, -8.145096217e-06f, -1.029354025e-04f,
+  -4.124312454e-06f, -9.891462105e-05f, -9.537244478e-05f, -1.901627547e-04f,
+  2.495876106e-04f, 1.547972934e-04f, 1.583394624e-04f, 6.354915968e-05f,
+  1.623602438e-04f, 6.756994117e-05f, 7.111211744e-05f, -2.367818888e-05f,
+  1.668751793e-04f, 7.208487659e-05f, 7.562705287e-05f, -1.916325346e-05f,
+  7.964783435e-05f, -1.514247015e-05f, -1.160029387e-05f, -1.063906020e-04f,
+  1.718991552e-04f, 7.710885257e-05f, 8.065102884e-05f, -1.413927839e-05f,
+  8.467181033e-05f, -1.011849417e-05f, -6.576318810e-06f, -1.013666260e-04f,
+  8.918674575e-05f, -5.603559202e-06f, -2.061383384e-06f, -9.685169061e-05f,
+  1.959400834e-06f, -9.283090913e-05f, -8.928873285e-05f, -1.840790355e-04f,
+  1.774463308e-04f, 8.265602810e-05f, 8.619819710e-05f, -8.592106497e-06f,
+  9.021898586e-05f, -4.571322734e-06f, -1.029146802e-06f, -9.581945778e-05f,
+  9.473392129e-05f, -5.638725042e-08f, 3.485788511e-06f, -9.130452236e-05f,
+  7.506572729e-06f, -8.728373359e-05f, -8.374155732e-05f, -1.785318600e-04f,
+  9.975789726e-05f, 4.967588211e-06f, 8.509763575e-06f, -8.628054638e-05f,
+  1.253054779e-05f, -8.225975762e-05f, -7.871758135e-05f, -1.735078840e-04f,
+  1.704548413e-05f, -7.774482219e-05f, -7.420264592e-05f, -1.689929486e-04f,
+  -7.018186443e-05f, -1.649721671e-04f, -1.614299981e-04f, -2.562203154e-04f,
+  2.562203154e-04f, 1.614299981e-04f, 1.649721671e-04f, 7.018186443e-05f,
+  1.689929486e-04f, 7.420264592e-05f, 7.774482219e-05f, -1.704548413e-05f,
+  1.735078840e-04f, 7.871758135e-05f, 8.225975762e-05f, -1.253054779e-05f,
+  8.628054638e-05f, -8.509763575e-06f, -4.967588211e-06f, -9.975789726e-05f,
+  1.785318600e-04f, 8.374155732e-05f, 8.728373359e-05f, -7.506572729e-06f,
+  9.130452236e-05f, -3.485788511e-06f, 5.638725042e-08f, -9.473392129e-05f,
+  9.581945778e-05f, 1.029146802e-06f, 4.571322734e-06f, -9.021898586e-05f,
+  8.592106497e-06f, -8.619819710e-05f, -8.265602810e-05f, -1.774463308e-04f,
+  1.840790355e-04f, 8.928873285e-05f, 9.283090913e-05f, -1.959400834e-06f,
+  9.685169061e-05f, 2.061383384e-06f, 5.603559202e-06f, -8.918674575e-05f,
+  1.013666260e-04f, 6.576318810e-06f, 1.011849417e-05f, -8.467181033e-05f,
+  1.413927839e-05f, -8.065102884e-05f, -7.710885257e-05f, -1.718991552e-04f,
+  1.063906020e-04f, 1.160029387e-05f, 1.514247015e-05f, -7.964783435e-05f,
+  1.916325346e-05f, -7.562705287e-05f, -7.208487659e-05f, -1.668751793e-04f,
+  2.367818888e-05f, -7.111211744e-05f, -6.756994117e-05f, -1.623602438e-04f,
+  -6.354915968e-05f, -1.583394624e-04f, -1.547972934e-04f, -2.495876106e-04f,
+  1.901627547e-04f, 9.537244478e-05f, 9.891462105e-05f, 4.124312454e-06f,
+  1.029354025e-04f, 8.145096217e-06f, 1.168727249e-05f, -8.310303383e-05f,
+  1.074503380e-04f, 1.266003164e-05f, 1.620220792e-05f, -7.858809840e-05f,
+  2.022299122e-05f, -7.456731691e-05f, -7.102514064e-05f, -1.658154506e-04f,
+  1.124743139e-04f, 1.768400762e-05f, 2.122618389e-05f, -7.356412243e-05f,
+  2.524696720e-05f, -6.954334094e-05f, -6.600116467e-05f, -1.607914746e-04f,
+  2.976190262e-05f, -6.502840552e-05f, -6.148622924e-05f, -1.562765392e-04f,
+  -5.746544412e-05f, -1.522557577e-04f, -1.487135742e-04f, -2.435038768e-04f,
+  1.180214895e-04f, 2.323117951e-05f, 2.677335578e-05f, -6.801695417e-05f,
+  3.079414091e-05f, -6.399616541e-05f, -6.045399277e-05f, -1.552442991e-04f,
+  3.530907634e-05f, -5.948123362e-05f, -5.593905735e-05f, -1.507293637e-04f,
+  -5.191827222e-05f, -1.467085822e-04f, -1.431663986e-04f, -2.379567159e-04f,
+  4.033304867e-05f, -5.445725765e-05f, -5.091508137e-05f, -1.457053877e-04f,
+  -4.689429625e-05f, -1.416846062e-04f, -1.381424227e-04f, -2.329327399e-04f,
+  -4.237936082e-05f, -1.371696708e-04f, -1.336274872e-04f, -2.284178045e-04f,
+  -1.296067057e-04f, -2.243970230e-04f, -2.208548394e-04f, -3.156451567e-04f
+},
+{
+  8.374063327e-05f, 3.150896373e-05f, 3.927303260e-05f, -1.295863785e-05f,
+  4.761727178e-05f, -4.614398222e-06f, 3.149669510e-06f, -4.908199844e-05f,
+  5.654973938e-05f, 4.318071205e-06f, 1.208213871e-05f, -4.014953083e-05f,
+  2.042637971e-05f, -3.180529166e-05f, -2.404122279e-05f, -7.627288869e-05f,
+  6.607719115e-05f, 1.384552161e-05f, 2.160959048e-05f, -3.062207907e-05f,
+  2.995382965e-05f, -2.227783989e-05f, -1.451377193e-05f, -6.674544420e-05f,
+  3.888629726e-05f, -1.334536955e-05f, -5.581302048e-06f, -5.781297295e-05f,
+  2.762937584e-06f, -4.946873014e-05f, -4.170466491e-05f, -9.393633081e-05f,
+  7.620498218e-05f, 2.397331446e-05f, 3.173738151e-05f, -2.049428622e-05f,
+  4.008162432e-05f, -1.215004613e-05f, -4.385978627e-06f, -5.661764590e-05f,
+  4.901409193e-05f, -3.217576705e-06f, 4.546491255e-06f, -4.768517829e-05f,
+  1.289073134e-05f, -3.934093911e-05f, -3.157687024e-05f, -8.380853978e-05f,
+  5.854154369e-05f, 6.309874152e-06f, 1.407394211e-05f, -3.815772652e-05f,
+  2.241818220e-05f, -2.981348734e-05f, -2.204942029e-05f, -7.428108802e-05f,
+  3.135064981e-05f, -2.088101792e-05f, -1.311694996e-05f, -6.534862041e-05f,
+  -4.772710327e-06f, -5.700438123e-05f, -4.924031236e-05f, -1.014719819e-04f,
+  8.693701238e-05f, 3.470533920e-05f, 4.246940807e-05f, -9.762260561e-06f,
+  5.081364725e-05f, -1.418020588e-06f, 6.346047030e-06f, -4.588562297e-05f,
+  5.974611850e-05f, 7.514448953e-06f, 1.527851600e-05f, -3.695315172e-05f,
+  2.362275700e-05f, -2.860891254e-05f, -2.084484549e-05f, -7.307651686e-05f,
+  6.927357026e-05f, 1.704189890e-05f, 2.480596777e-05f, -2.742570177e-05f,
+  3.315020876e-05f, -1.908146260e-05f, -1.131739464e-05f, -6.354906509e-05f,
+  4.208267637e-05f, -1.014899226e-05f, -2.384924755e-06f, -5.461659384e-05f,
+  5.959315331e-06f, -4.627235467e-05f, -3.850828580e-05f, -9.073995170e-05f,
+  7.940136129e-05f, 2.716969357e-05f, 3.493376062e-05f, -1.729790893e-05f,
+  4.327799979e-05f, -8.953668839e-06f, -1.189600880e-06f, -5.342127042e-05f,
+  5.221047104e-05f, -2.119907805e-08f, 7.742868547e-06f, -4.448879918e-05f,
+  1.608710772e-05f, -3.614456000e-05f, -2.838049295e-05f, -8.061216067e-05f,
+  6.173791917e-05f, 9.506251445e-06f, 1.727031849e-05f, -3.496135105e-05f,
+  2.561455949e-05f, -2.661711005e-05f, -1.885304300e-05f, -7.108470891e-05f,
+  3.454702892e-05f, -1.768464062e-05f, -9.920572666e-06f, -6.215224130e-05f,
+  -1.576332920e-06f, -5.380800212e-05f, -4.604393325e-05f, -9.827560280e-05f,
+  9.827560280e-05f, 4.604393325e-05f, 5.380800212e-05f, 1.576332920e-06f,
+  6.215224130e-05f, 9.920572666e-06f, 1.768464062e-05f, -3.454702892e-05f,
+  7.108470891e-05f, 1.885304300e-05f, 2.661711005e-05f, -2.561455949e-05f,
+  3.496135105e-05f, -1.727031849e-05f, -9.506251445e-06f, -6.173791917e-05f,
+  8.061216067e-05f, 2.838049295e-05f, 3.614456000e-05f, -1.608710772e-05f,
+  4.448879918e-05f, -7.742868547e-06f, 2.119907805e-08f, -5.221047104e-05f,
+  5.342127042e-05f, 1.189600880e-06f, 8.953668839e-06f, -4.327799979e-05f,
+  1.729790893e-05f, -3.493376062e-05f, -2.716969357e-05f, -7.940136129e-05f,
+  9.073995170e-05f, 3.850828580e-05f, 4.627235467e-05f, -5.959315331e-06f,
+  5.461659384e-05f, 2.384924755e-06f, 1.014899226e-05f, -4.208267637e-05f,
+  6.354906509e-05f, 1.131739464e-05f, 1.908146260e-05f, -3.315020876e-05f,
+  2.742570177e-05f, -2.480596777e-05f, -1.704189890e-05f, -6.927357026e-05f,
+  7.307651686e-05f, 2.084484549e-05f, 2.860891254e-05f, -2.362275700e-05f,
+  3.695315172e-05f, -1.527851600e-05f, -7.514448953e-06f, -5.974611850e-05f,
+  4.588562297e-05f, -6.346047030e-06f, 1.418020588e-06f, -5.081364725e-05f,
+  9.762260561e-06f, -4.246940807e-05f, -3.470533920e-05f, -8.693701238e-05f,
+  1.014719819e-04f, 4.924031236e-05f, 5.700438123e-05f, 4.772710327e-06f,
+  6.534862041e-05f, 1.311694996e-05f, 2.088101792e-05f, -3.135064981e-05f,
+  7.428108802e-05f, 2.204942029e-05f, 2.981348734e-05f, -2.241818220e-05f,
+  3.815772652e-05f, -1.407394211e-05f, -6.309874152e-06f, -5.854154369e-05f,
+  8.380853978e-05f, 3.157687024e-05f, 3.934093911e-05f, -1.289073134e-05f,
+  4.768517829e-05f, -4.546491255e-06f, 3.217576705e-06f, -4.901409193e-05f,
+  5.661764590e-05f, 4.385978627e-06f, 1.215004613e-05f, -4.008162432e-05f,
+  2.049428622e-05f, -3.173738151e-05f, -2.397331446e-05f, -7.620498218e-05f,
+  9.393633081e-05f, 4.170466491e-05f, 4.946873014e-05f, -2.762937584e-06f,
+  5.781297295e-05f, 5.581302048e-06f, 1.334536955e-05f, -3.888629726e-05f,
+  6.674544420e-05f, 1.451377193e-05f, 2.227783989e-05f, -2.995382965e-05f,
+  3.062207907e-05f, -2.160959048e-05f, -1.384552161e-05f, -6.607719115e-05f,
+  7.627288869e-05f, 2.404122279e-05f, 3.180529166e-05f, -2.042637971e-05f,
+  4.014953083e-05f, -1.208213871e-05f, -4.318071205e-06f, -5.654973938e-05f,
+  4.908199844e-05f, -3.149669510e-06f, 4.614398222e-06f, -4.761727178e-05f,
+  1.295863785e-05f, -3.927303260e-05f, -3.150896373e-05f, -8.374063327e-05f
+},
+{
+  -2.983305603e-04f, -2.718497126e-04f, -2.592976089e-04f, -2.328167757e-04f,
+  -2.461420372e-04f, -2.196612040e-04f, -2.071090857e-04f, -1.806282671e-04f,
+  -2.323876979e-04f, -2.059068647e-04f, -1.933547610e-04f, -1.668739278e-04f,
+  -1.801991893e-04f, -1.537183562e-04f, -1.411662379e-04f, -1.146854047e-04f,
+  -2.180412121e-04f, -1.915603789e-04f, -1.790082606e-04f, -1.525274274e-04f,
+  -1.658526890e-04f, -1.393718558e-04f, -1.268197375e-04f, -1.003389116e-04f,
+  -1.520983496e-04f, -1.256175165e-04f, -1.130654055e-04f, -8.658457227e-05f,
+  -9.990984108e-05f, -7.342900790e-05f, -6.087689326e-05f, -3.439606007e-05f,
+  -2.031111799e-04f, -1.766303467e-04f, -1.640782284e-04f, -1.375973952e-04f,
+  -1.509226713e-04f, -1.244418381e-04f, -1.118897198e-04f, -8.540888666e-05f,
+  -1.371683320e-04f, -1.106874988e-04f, -9.813538054e-05f, -7.165454736e-05f,
+  -8.497981617e-05f, -5.849898298e-05f, -4.594686834e-05f, -1.946603516e-05f,
+  -1.228218316e-04f, -9.634099843e-05f, -8.378888015e-05f, -5.730805060e-05f,
+  -7.063331577e-05f, -4.415248623e-05f, -3.160037159e-05f, -5.119537946e-06f,
+  -5.687898010e-05f, -3.039814874e-05f, -1.784603228e-05f, 8.634800906e-06f,
+  -4.690467449e-06f, 2.179036528e-05f, 3.434247992e-05f, 6.082331311e-05f,
+  -1.876083406e-04f, -1.611275075e-04f, -1.485753892e-04f, -1.220945560e-04f,
+  -1.354198175e-04f, -1.089389916e-04f, -9.638687334e-05f, -6.990604015e-05f,
+  -1.216654855e-04f, -9.518465231e-05f, -8.263253403e-05f, -5.615170448e-05f,
+  -6.947696966e-05f, -4.299614011e-05f, -3.044402365e-05f, -3.963190920e-06f,
+  -1.073189851e-04f, -8.083815919e-05f, -6.828604091e-05f, -4.180520773e-05f,
+  -5.513047654e-05f, -2.864964335e-05f, -1.609752690e-05f, 1.038330538e-05f,
+  -4.137613723e-05f, -1.489530405e-05f, -2.343188044e-06f, 2.413764378e-05f,
+  1.081237679e-05f, 3.729320815e-05f, 4.984532643e-05f, 7.632615598e-05f,
+  -9.238896018e-05f, -6.590812700e-05f, -5.335601600e-05f, -2.687518099e-05f,
+  -4.020044798e-05f, -1.371961753e-05f, -1.167501182e-06f, 2.531333121e-05f,
+  -2.644611050e-05f, 3.472134225e-08f, 1.258683733e-05f, 3.906766869e-05f,
+  2.574240170e-05f, 5.222323307e-05f, 6.477534771e-05f, 9.125618089e-05f,
+  -1.209961465e-05f, 1.438121762e-05f, 2.693333408e-05f, 5.341416545e-05f,
+  4.008890028e-05f, 6.656972982e-05f, 7.912184810e-05f, 1.056026813e-04f,
+  5.384323595e-05f, 8.032406913e-05f, 9.287618741e-05f, 1.193570206e-04f,
+  1.060317518e-04f, 1.325125777e-04f, 1.450646960e-04f, 1.715455292e-04f,
+  -1.715455292e-04f, -1.450646960e-04f, -1.325125777e-04f, -1.060317518e-04f,
+  -1.193570206e-04f, -9.287618741e-05f, -8.032406913e-05f, -5.384323595e-05f,
+  -1.056026813e-04f, -7.912184810e-05f, -6.656972982e-05f, -4.008890028e-05f,
+  -5.341416545e-05f, -2.693333408e-05f, -1.438121762e-05f, 1.209961465e-05f,
+  -9.125618089e-05f, -6.477534771e-05f, -5.222323307e-05f, -2.574240170e-05f,
+  -3.906766869e-05f, -1.258683733e-05f, -3.472134225e-08f, 2.644611050e-05f,
+  -2.531333121e-05f, 1.167501182e-06f, 1.371961753e-05f, 4.020044798e-05f,
+  2.687518099e-05f, 5.335601600e-05f, 6.590812700e-05f, 9.238896018e-05f,
+  -7.632615598e-05f, -4.984532643e-05f, -3.729320815e-05f, -1.081237679e-05f,
+  -2.413764378e-05f, 2.343188044e-06f, 1.489530405e-05f, 4.137613723e-05f,
+  -1.038330538e-05f, 1.609752690e-05f, 2.864964335e-05f, 5.513047654e-05f,
+  4.180520773e-05f, 6.828604091e-05f, 8.083815919e-05f, 1.073189851e-04f,
+  3.963190920e-06f, 3.044402365e-05f, 4.299614011e-05f, 6.947696966e-05f,
+  5.615170448e-05f, 8.263253403e-05f, 9.518465231e-05f, 1.216654855e-04f,
+  6.990604015e-05f, 9.638687334e-05f, 1.089389916e-04f, 1.354198175e-04f,
+  1.220945560e-04f, 1.485753892e-04f, 1.611275075e-04f, 1.876083406e-04f,
+  -6.082331311e-05f, -3.434247992e-05f, -2.179036528e-05f, 4.690467449e-06f,
+  -8.634800906e-06f, 1.784603228e-05f, 3.039814874e-05f, 5.687898010e-05f,
+  5.119537946e-06f, 3.160037159e-05f, 4.415248623e-05f, 7.063331577e-05f,
+  5.730805060e-05f, 8.378888015e-05f, 9.634099843e-05f, 1.228218316e-04f,
+  1.946603516e-05f, 4.594686834e-05f, 5.849898298e-05f, 8.497981617e-05f,
+  7.165454736e-05f, 9.813538054e-05f, 1.106874988e-04f, 1.371683320e-04f,
+  8.540888666e-05f, 1.118897198e-04f, 1.244418381e-04f, 1.509226713e-04f,
+  1.375973952e-04f, 1.640782284e-04f, 1.766303467e-04f, 2.031111799e-04f,
+  3.439606007e-05f, 6.087689326e-05f, 7.342900790e-05f, 9.990984108e-05f,
+  8.658457227e-05f, 1.130654055e-04f, 1.256175165e-04f, 1.520983496e-04f,
+  1.003389116e-04f, 1.268197375e-04f, 1.393718558e-04f, 1.658526890e-04f,
+  1.525274274e-04f, 1.790082606e-04f, 1.915603789e-04f, 2.180412121e-04f,
+  1.146854047e-04f, 1.411662379e-04f, 1.537183562e-04f, 1.801991893e-04f,
+  1.668739278e-04f, 1.933547610e-04f, 2.059068647e-04f, 2.323876979e-04f,
+  1.806282671e-04f, 2.071090857e-04f, 2.196612040e-04f, 2.461420372e-04f,
+  2.328167757e-04f, 2.592976089e-04f, 2.718497126e-04f, 2.983305603e-04f
+},
+{
+  -8.268476813e-04f, -6.834549131e-04f, -6.663196837e-04f, -5.229269154e-04f,
+  -6.486764760e-04f, -5.052837660e-04f, -4.881484783e-04f, -3.447557683e-04f,
+  -6.305474089e-04f, -4.871546698e-04f, -4.700194113e-04f, -3.266266722e-04f,
+  -4.523762036e-04f, -3.089834936e-04f, -2.918482351e-04f, -1.484554959e-04f,
+  -6.119568134e-04f, -4.685641034e-04f, -4.514288448e-04f, -3.080361348e-04f,
+  -4.337856662e-04f, -2.903929271e-04f, -2.732576686e-04f, -1.298649440e-04f,
+  -4.156565701e-04f, -2.722638601e-04f, -2.551285725e-04f, -1.117358552e-04f,
+  -2.374853939e-04f, -9.409266931e-05f, -7.695740351e-05f, 6.643532106e-05f,
+  -5.929316976e-04f, -4.495389585e-04f, -4.324037000e-04f, -2.890109899e-04f,
+  -4.147605214e-04f, -2.713677823e-04f, -2.542325237e-04f, -1.108397992e-04f,
+  -3.966314252e-04f, -2.532387152e-04f, -2.361034421e-04f, -9.271071031e-05f,
+  -2.184602490e-04f, -7.506752445e-05f, -5.793225864e-05f, 8.546046593e-05f,
+  -3.780408879e-04f, -2.346481488e-04f, -2.175128757e-04f, -7.412015839e-05f,
+  -1.998696971e-04f, -5.647697253e-05f, -3.934170309e-05f, 1.040510251e-04f,
+  -1.817406155e-04f, -3.834788731e-05f, -2.121261605e-05f, 1.221801067e-04f,
+  -3.569431101e-06f, 1.398232998e-04f, 1.569585584e-04f, 3.003512975e-04f,
+  -5.735013401e-04f, -4.301086010e-04f, -4.129733425e-04f, -2.695806033e-04f,
+  -3.953301639e-04f, -2.519374248e-04f, -2.348021517e-04f, -9.140943439e-05f,
+  -3.772010677e-04f, -2.338083432e-04f, -2.166730701e-04f, -7.328034553e-05f,
+  -1.990298915e-04f, -5.563715968e-05f, -3.850189023e-05f, 1.048908307e-04f,
+  -3.586105013e-04f, -2.152177767e-04f, -1.980825182e-04f, -5.468978998e-05f,
+  -1.804393250e-04f, -3.704660412e-05f, -1.991133649e-05f, 1.234813826e-04f,
+  -1.623102435e-04f, -1.891751890e-05f, -1.782250138e-06f, 1.416104787e-04f,
+  1.586093640e-05f, 1.592536573e-04f, 1.763889304e-04f, 3.197816550e-04f,
+  -3.395853564e-04f, -1.961926464e-04f, -1.790573733e-04f, -3.566464511e-05f,
+  -1.614141802e-04f, -1.802146107e-05f, -8.861915148e-07f, 1.425065275e-04f,
+  -1.432850986e-04f, 1.076253255e-07f, 1.724289359e-05f, 1.606356236e-04f,
+  3.488608127e-05f, 1.782788022e-04f, 1.954140753e-04f, 3.388067998e-04f,
+  -1.246945467e-04f, 1.869818152e-05f, 3.583345097e-05f, 1.792261755e-04f,
+  5.347663682e-05f, 1.968693541e-04f, 2.140046272e-04f, 3.573973663e-04f,
+  7.160571840e-05f, 2.149984502e-04f, 2.321337088e-04f, 3.755264333e-04f,
+  2.497769019e-04f, 3.931696119e-04f, 4.103048996e-04f, 5.536976387e-04f,
+  -5.536976387e-04f, -4.103048996e-04f, -3.931696119e-04f, -2.497769019e-04f,
+  -3.755264333e-04f, -2.321337088e-04f, -2.149984502e-04f, -7.160571840e-05f,
+  -3.573973663e-04f, -2.140046272e-04f, -1.968693541e-04f, -5.347663682e-05f,
+  -1.792261755e-04f, -3.583345097e-05f, -1.869818152e-05f, 1.246945467e-04f,
+  -3.388067998e-04f, -1.954140753e-04f, -1.782788022e-04f, -3.488608127e-05f,
+  -1.606356236e-04f, -1.724289359e-05f, -1.076253255e-07f, 1.432850986e-04f,
+  -1.425065275e-04f, 8.861915148e-07f, 1.802146107e-05f, 1.614141802e-04f,
+  3.566464511e-05f, 1.790573733e-04f, 1.961926464e-04f, 3.395853564e-04f,
+  -3.197816550e-04f, -1.763889304e-04f, -1.592536573e-04f, -1.586093640e-05f,
+  -1.416104787e-04f, 1.782250138e-06f, 1.891751890e-05f, 1.623102435e-04f,
+  -1.234813826e-04f, 1.991133649e-05f, 3.704660412e-05f, 1.804393250e-04f,
+  5.468978998e-05f, 1.980825182e-04f, 2.152177767e-04f, 3.586105013e-04f,
+  -1.048908307e-04f, 3.850189023e-05f, 5.563715968e-05f, 1.990298915e-04f,
+  7.328034553e-05f, 2.166730701e-04f, 2.338083432e-04f, 3.772010677e-04f,
+  9.140943439e-05f, 2.348021517e-04f, 2.519374248e-04f, 3.953301639e-04f,
+  2.695806033e-04f, 4.129733425e-04f, 4.301086010e-04f, 5.735013401e-04f,
+  -3.003512975e-04f, -1.569585584e-04f, -1.398232998e-04f, 3.569431101e-06f,
+  -1.221801067e-04f, 2.121261605e-05f, 3.834788731e-05f, 1.817406155e-04f,
+  -1.040510251e-04f, 3.934170309e-05f, 5.647697253e-05f, 1.998696971e-04f,
+  7.412015839e-05f, 2.175128757e-04f, 2.346481488e-04f, 3.780408879e-04f,
+  -8.546046593e-05f, 5.793225864e-05f, 7.506752445e-05f, 2.184602490e-04f,
+  9.271071031e-05f, 2.361034421e-04f, 2.532387152e-04f, 3.966314252e-04f,
+  1.108397992e-04f, 2.542325237e-04f, 2.713677823e-04f, 4.147605214e-04f,
+  2.890109899e-04f, 4.324037000e-04f, 4.495389585e-04f, 5.929316976e-04f,
+  -6.643532106e-05f, 7.695740351e-05f, 9.409266931e-05f, 2.374853939e-04f,
+  1.117358552e-04f, 2.551285725e-04f, 2.722638601e-04f, 4.156565701e-04f,
+  1.298649440e-04f, 2.732576686e-04f, 2.903929271e-04f, 4.337856662e-04f,
+  3.080361348e-04f, 4.514288448e-04f, 4.685641034e-04f, 6.119568134e-04f,
+  1.484554959e-04f, 2.918482351e-04f, 3.089834936e-04f, 4.523762036e-04f,
+  3.266266722e-04f, 4.700194113e-04f, 4.871546698e-04f, 6.305474089e-04f,
+  3.447557683e-04f, 4.881484783e-04f, 5.052837660e-04f, 6.486764760e-04f,
+  5.229269154e-04f, 6.663196837e-04f, 6.834549131e-04f, 8.268476813e-04f
+},
+{
+  -1.465199515e-03f, -1.171906828e-03f, -1.151462202e-03f, -8.581695147e-04f,
+  -1.130755176e-03f, -8.374624304e-04f, -8.170178626e-04f, -5.237251753e-04f,
+  -1.109827659e-03f, -8.165350300e-04f, -7.960904040e-04f, -5.027977168e-04f,
+  -7.753833779e-04f, -4.820906906e-04f, -4.616460938e-04f, -1.683534065e-04f,
+  -1.088724588e-03f, -7.954319008e-04f, -7.749872748e-04f, -4.816946166e-04f,
+  -7.542802487e-04f, -4.609875614e-04f, -4.405429354e-04f, -1.472502627e-04f,
+  -7.333528483e-04f, -4.400601320e-04f, -4.196155351e-04f, -1.263228478e-04f,
+  -3.989084798e-04f, -1.056157998e-04f, -8.517118840e-05f, 2.081214916e-04f,
+  -1.067492878e-03f, -7.742001908e-04f, -7.537556230e-04f, -4.604629066e-04f,
+  -7.330485387e-04f, -4.397558805e-04f, -4.193112545e-04f, -1.260185818e-04f,
+  -7.121211383e-04f, -4.188284511e-04f, -3.983838542e-04f, -1.050911669e-04f,
+  -3.776767990e-04f, -8.438411169e-05f, -6.393950753e-05f, 2.293531725e-04f,
+  -6.910180091e-04f, -3.977253218e-04f, -3.772806958e-04f, -8.398802311e-05f,
+  -3.565736697e-04f, -6.328097516e-05f, -4.283636736e-05f, 2.504563308e-04f,
+  -3.356462403e-04f, -4.235356027e-05f, -2.190895066e-05f, 2.713837312e-04f,
+  -1.201899408e-06f, 2.920907864e-04f, 3.125353833e-04f, 6.058280705e-04f,
+  -1.046182355e-03f, -7.528896676e-04f, -7.324450999e-04f, -4.391523835e-04f,
+  -7.117380155e-04f, -4.184453283e-04f, -3.980007314e-04f, -1.047080514e-04f,
+  -6.908106152e-04f, -3.975179279e-04f, -3.770733310e-04f, -8.378063649e-05f,
+  -3.563662758e-04f, -6.307358126e-05f, -4.262897710e-05f, 2.506636956e-04f,
+  -6.697074859e-04f, -3.764147987e-04f, -3.559701727e-04f, -6.267749268e-05f,
+  -3.352631174e-04f, -4.197044473e-05f, -2.152583693e-05f, 2.717668540e-04f,
+  -3.143357171e-04f, -2.104302985e-05f, -5.984218774e-07f, 2.926942543e-04f,
+  2.010862954e-05f, 3.134013095e-04f, 3.338459064e-04f, 6.271385937e-04f,
+  -6.484757760e-04f, -3.551830887e-04f, -3.347384918e-04f, -4.144581180e-05f,
+  -3.140314366e-04f, -2.073875839e-05f, -2.941514197e-07f, 2.929985349e-04f,
+  -2.931040362e-04f, 1.886556191e-07f, 2.063326247e-05f, 3.139259352e-04f,
+  4.134031406e-05f, 3.346329904e-04f, 3.550776164e-04f, 6.483703037e-04f,
+  -2.720008779e-04f, 2.129179484e-05f, 4.173640264e-05f, 3.350290935e-04f,
+  6.244345423e-05f, 3.557361488e-04f, 3.761807457e-04f, 6.694734329e-04f,
+  8.337086911e-05f, 3.766635491e-04f, 3.971081460e-04f, 6.904008333e-04f,
+  4.178152012e-04f, 7.111079176e-04f, 7.315524854e-04f, 1.024845173e-03f,
+  -1.024845173e-03f, -7.315524854e-04f, -7.111079176e-04f, -4.178152012e-04f,
+  -6.904008333e-04f, -3.971081460e-04f, -3.766635491e-04f, -8.337086911e-05f,
+  -6.694734329e-04f, -3.761807457e-04f, -3.557361488e-04f, -6.244345423e-05f,
+  -3.350290935e-04f, -4.173640264e-05f, -2.129179484e-05f, 2.720008779e-04f,
+  -6.483703037e-04f, -3.550776164e-04f, -3.346329904e-04f, -4.134031406e-05f,
+  -3.139259352e-04f, -2.063326247e-05f, -1.886556191e-07f, 2.931040362e-04f,
+  -2.929985349e-04f, 2.941514197e-07f, 2.073875839e-05f, 3.140314366e-04f,
+  4.144581180e-05f, 3.347384918e-04f, 3.551830887e-04f, 6.484757760e-04f,
+  -6.271385937e-04f, -3.338459064e-04f, -3.134013095e-04f, -2.010862954e-05f,
+  -2.926942543e-04f, 5.984218774e-07f, 2.104302985e-05f, 3.143357171e-04f,
+  -2.717668540e-04f, 2.152583693e-05f, 4.197044473e-05f, 3.352631174e-04f,
+  6.267749268e-05f, 3.559701727e-04f, 3.764147987e-04f, 6.697074859e-04f,
+  -2.506636956e-04f, 4.262897710e-05f, 6.307358126e-05f, 3.563662758e-04f,
+  8.378063649e-05f, 3.770733310e-04f, 3.975179279e-04f, 6.908106152e-04f,
+  1.047080514e-04f, 3.980007314e-04f, 4.184453283e-04f, 7.117380155e-04f,
+  4.391523835e-04f, 7.324450999e-04f, 7.528896676e-04f, 1.046182355e-03f,
+  -6.058280705e-04f, -3.125353833e-04f, -2.920907864e-04f, 1.201899408e-06f,
+  -2.713837312e-04f, 2.190895066e-05f, 4.235356027e-05f, 3.356462403e-04f,
+  -2.504563308e-04f, 4.283636736e-05f, 6.328097516e-05f, 3.565736697e-04f,
+  8.398802311e-05f, 3.772806958e-04f, 3.977253218e-04f, 6.910180091e-04f,
+  -2.293531725e-04f, 6.393950753e-05f, 8.438411169e-05f, 3.776767990e-04f,
+  1.050911669e-04f, 3.983838542e-04f, 4.188284511e-04f, 7.121211383e-04f,
+  1.260185818e-04f, 4.193112545e-04f, 4.397558805e-04f, 7.330485387e-04f,
+  4.604629066e-04f, 7.537556230e-04f, 7.742001908e-04f, 1.067492878e-03f,
+  -2.081214916e-04f, 8.517118840e-05f, 1.056157998e-04f, 3.989084798e-04f,
+  1.263228478e-04f, 4.196155351e-04f, 4.400601320e-04f, 7.333528483e-04f,
+  1.472502627e-04f, 4.405429354e-04f, 4.609875614e-04f, 7.542802487e-04f,
+  4.816946166e-04f, 7.749872748e-04f, 7.954319008e-04f, 1.088724588e-03f,
+  1.683534065e-04f, 4.616460938e-04f, 4.820906906e-04f, 7.753833779e-04f,
+  5.027977168e-04f, 7.960904040e-04f, 8.165350300e-04f, 1.109827659e-03f,
+  5.237251753e-04f, 8.170178626e-04f, 8.374624304e-04f, 1.130755176e-03f,
+  8.581695147e-04f, 1.151462202e-03f, 1.171906828e-03f, 1.465199515e-03f
+},
+{
+  -2.137525240e-03f, -1.675861771e-03f, -1.654637628e-03f, -1.192974159e-03f,
+  -1.633557957e-03f, -1.171894488e-03f, -1.150670345e-03f, -6.890068762e-04f,
+  -1.612684457e-03f, -1.151020988e-03f, -1.129796961e-03f, -6.681334344e-04f,
+  -1.108717290e-03f, -6.470537628e-04f, -6.258296780e-04f, -1.641661947e-04f,
+  -1.592081157e-03f, -1.130417688e-03f, -1.109193545e-03f, -6.475300761e-04f,
+  -1.088113873e-03f, -6.264504627e-04f, -6.052263197e-04f, -1.435628656e-04f,
+  -1.067240490e-03f, -6.055770209e-04f, -5.843528779e-04f, -1.226894092e-04f,
+  -5.632732064e-04f, -1.016097594e-04f, -8.038563828e-05f, 3.812778450e-04f,
+  -1.571814064e-03f, -1.110150595e-03f, -1.088926452e-03f, -6.272629835e-04f,
+  -1.067846781e-03f, -6.061833119e-04f, -5.849592271e-04f, -1.232957438e-04f,
+  -1.046973397e-03f, -5.853098701e-04f, -5.640857271e-04f, -1.024222875e-04f,
+  -5.430061137e-04f, -8.134263771e-05f, -6.011851656e-05f, 4.015449667e-04f,
+  -1.026369981e-03f, -5.647065700e-04f, -5.434824270e-04f, -8.181895100e-05f,
+  -5.224027555e-04f, -6.073930854e-05f, -3.951518738e-05f, 4.221482959e-04f,
+  -5.015293136e-04f, -3.986585216e-05f, -1.864173100e-05f, 4.430217377e-04f,
+  2.437915555e-06f, 4.641013802e-04f, 4.853255232e-04f, 9.469889919e-04f,
+  -1.551951282e-03f, -1.090287813e-03f, -1.069063670e-03f, -6.074002013e-04f,
+  -1.047983998e-03f, -5.863205297e-04f, -5.650964449e-04f, -1.034329543e-04f,
+  -1.027110615e-03f, -5.654470879e-04f, -5.442229449e-04f, -8.255950524e-05f,
+  -5.231433315e-04f, -6.147985550e-05f, -4.025573435e-05f, 4.214077489e-04f,
+  -1.006507198e-03f, -5.448437878e-04f, -5.236196448e-04f, -6.195616879e-05f,
+  -5.025399732e-04f, -4.087652633e-05f, -1.965240335e-05f, 4.420110781e-04f,
+  -4.816665314e-04f, -2.000306995e-05f, 1.221052116e-06f, 4.628845199e-04f,
+  2.230069731e-05f, 4.839641624e-04f, 5.051883054e-04f, 9.668517741e-04f,
+  -9.862401057e-04f, -5.245766370e-04f, -5.033524940e-04f, -4.168905070e-05f,
+  -4.822728806e-04f, -2.060940278e-05f, 6.147192835e-07f, 4.622781998e-04f,
+  -4.613994097e-04f, 2.640522894e-07f, 2.148817475e-05f, 4.831516417e-04f,
+  4.256782267e-05f, 5.042313132e-04f, 5.254553980e-04f, 9.871189250e-04f,
+  -4.407960805e-04f, 2.086738095e-05f, 4.209150575e-05f, 5.037550000e-04f,
+  6.317115185e-05f, 5.248346133e-04f, 5.460587563e-04f, 1.007722225e-03f,
+  8.404460823e-05f, 5.457080551e-04f, 5.669321981e-04f, 1.028595725e-03f,
+  5.880118697e-04f, 1.049675280e-03f, 1.070899423e-03f, 1.532562892e-03f,
+  -1.532562892e-03f, -1.070899423e-03f, -1.049675280e-03f, -5.880118697e-04f,
+  -1.028595725e-03f, -5.669321981e-04f, -5.457080551e-04f, -8.404460823e-05f,
+  -1.007722225e-03f, -5.460587563e-04f, -5.248346133e-04f, -6.317115185e-05f,
+  -5.037550000e-04f, -4.209150575e-05f, -2.086738095e-05f, 4.407960805e-04f,
+  -9.871189250e-04f, -5.254553980e-04f, -5.042313132e-04f, -4.256782267e-05f,
+  -4.831516417e-04f, -2.148817475e-05f, -2.640522894e-07f, 4.613994097e-04f,
+  -4.622781998e-04f, -6.147192835e-07f, 2.060940278e-05f, 4.822728806e-04f,
+  4.168905070e-05f, 5.033524940e-04f, 5.245766370e-04f, 9.862401057e-04f,
+  -9.668517741e-04f, -5.051883054e-04f, -4.839641624e-04f, -2.230069731e-05f,
+  -4.628845199e-04f, -1.221052116e-06f, 2.000306995e-05f, 4.816665314e-04f,
+  -4.420110781e-04f, 1.965240335e-05f, 4.087652633e-05f, 5.025399732e-04f,
+  6.195616879e-05f, 5.236196448e-04f, 5.448437878e-04f, 1.006507198e-03f,
+  -4.214077489e-04f, 4.025573435e-05f, 6.147985550e-05f, 5.231433315e-04f,
+  8.255950524e-05f, 5.442229449e-04f, 5.654470879e-04f, 1.027110615e-03f,
+  1.034329543e-04f, 5.650964449e-04f, 5.863205297e-04f, 1.047983998e-03f,
+  6.074002013e-04f, 1.069063670e-03f, 1.090287813e-03f, 1.551951282e-03f,
+  -9.469889919e-04f, -4.853255232e-04f, -4.641013802e-04f, -2.437915555e-06f,
+  -4.430217377e-04f, 1.864173100e-05f, 3.986585216e-05f, 5.015293136e-04f,
+  -4.221482959e-04f, 3.951518738e-05f, 6.073930854e-05f, 5.224027555e-04f,
+  8.181895100e-05f, 5.434824270e-04f, 5.647065700e-04f, 1.026369981e-03f,
+  -4.015449667e-04f, 6.011851656e-05f, 8.134263771e-05f, 5.430061137e-04f,
+  1.024222875e-04f, 5.640857271e-04f, 5.853098701e-04f, 1.046973397e-03f,
+  1.232957438e-04f, 5.849592271e-04f, 6.061833119e-04f, 1.067846781e-03f,
+  6.272629835e-04f, 1.088926452e-03f, 1.110150595e-03f, 1.571814064e-03f,
+  -3.812778450e-04f, 8.038563828e-05f, 1.016097594e-04f, 5.632732064e-04f,
+  1.226894092e-04f, 5.843528779e-04f, 6.055770209e-04f, 1.067240490e-03f,
+  1.435628656e-04f, 6.052263197e-04f, 6.264504627e-04f, 1.088113873e-03f,
+  6.475300761e-04f, 1.109193545e-03f, 1.130417688e-03f, 1.592081157e-03f,
+  1.641661947e-04f, 6.258296780e-04f, 6.470537628e-04f, 1.108717290e-03f,
+  6.681334344e-04f, 1.129796961e-03f, 1.151020988e-03f, 1.612684457e-03f,
+  6.890068762e-04f, 1.150670345e-03f, 1.171894488e-03f, 1.633557957e-03f,
+  1.192974159e-03f, 1.654637628e-03f, 1.675861771e-03f, 2.137525240e-03f
+},
+{
+  -2.728134394e-03f, -2.104330342e-03f, -2.086108318e-03f, -1.462304033e-03f,
+  -2.068581758e-03f, -1.444777357e-03f, -1.426555449e-03f, -8.027511649e-04f,
+  -2.051827032e-03f, -1.428022864e-03f, -1.409800840e-03f, -7.859966136e-04f,
+  -1.392274280e-03f, -7.684699958e-04f, -7.502480294e-04f, -1.264437742e-04f,
+  -2.035922604e-03f, -1.412118319e-03f, -1.393896411e-03f, -7.700921851e-04f,
+  -1.376369852e-03f, -7.525655092e-04f, -7.343436009e-04f, -1.105393312e-04f,
+  -1.359615242e-03f, -7.358109578e-04f, -7.175890496e-04f, -9.378475806e-05f,
+  -7.000623737e-04f, -7.625812577e-05f, -5.803618478e-05f, 5.657681031e-04f,
+  -2.020947635e-03f, -1.397143351e-03f, -1.378921326e-03f, -7.551171002e-04f,
+  -1.361394767e-03f, -7.375904825e-04f, -7.193685160e-04f, -9.556425357e-05f,
+  -1.344640157e-03f, -7.208358729e-04f, -7.026139647e-04f, -7.880968769e-05f,
+  -6.850873469e-04f, -6.128305540e-05f, -4.306111077e-05f, 5.807431298e-04f,
+  -1.328735729e-03f, -7.049314445e-04f, -6.867095362e-04f, -6.290524470e-05f,
+  -6.691828603e-04f, -4.537861241e-05f, -2.715666960e-05f, 5.966476165e-04f,
+  -6.524283090e-04f, -2.862404108e-05f, -1.040209827e-05f, 6.134021678e-04f,
+  7.124531749e-06f, 6.309287855e-04f, 6.491507520e-04f, 1.272954978e-03f,
+  -2.006982220e-03f, -1.383177820e-03f, -1.364955911e-03f, -7.411516272e-04f,
+  -1.347429235e-03f, -7.236250094e-04f, -7.054030430e-04f, -8.159880963e-05f,
+  -1.330674742e-03f, -7.068704581e-04f, -6.886484916e-04f, -6.484423648e-05f,
+  -6.711218739e-04f, -4.731760419e-05f, -2.909566138e-05f, 5.947086029e-04f,
+  -1.314770314e-03f, -6.909660297e-04f, -6.727440632e-04f, -4.893979349e-05f,
+  -6.552174455e-04f, -3.141316120e-05f, -1.319121930e-05f, 6.106130313e-04f,
+  -6.384628359e-04f, -1.465859168e-05f, 3.563352038e-06f, 6.273676408e-04f,
+  2.108998160e-05f, 6.448942586e-04f, 6.631161668e-04f, 1.286920509e-03f,
+  -1.299795229e-03f, -6.759909447e-04f, -6.577689783e-04f, -3.396471948e-05f,
+  -6.402423605e-04f, -1.643809082e-05f, 1.783852554e-06f, 6.255881162e-04f,
+  -6.234878092e-04f, 3.164805094e-07f, 1.853842332e-05f, 6.423426676e-04f,
+  3.606505561e-05f, 6.598693435e-04f, 6.780912518e-04f, 1.301895478e-03f,
+  -6.075833226e-04f, 1.622092350e-05f, 3.444286631e-05f, 6.582471542e-04f,
+  5.196949496e-05f, 6.757737719e-04f, 6.939956802e-04f, 1.317800023e-03f,
+  6.872406811e-05f, 6.925283233e-04f, 7.107502897e-04f, 1.334554516e-03f,
+  7.282769075e-04f, 1.352081192e-03f, 1.370303100e-03f, 1.994107384e-03f,
+  -1.994107384e-03f, -1.370303100e-03f, -1.352081192e-03f, -7.282769075e-04f,
+  -1.334554516e-03f, -7.107502897e-04f, -6.925283233e-04f, -6.872406811e-05f,
+  -1.317800023e-03f, -6.939956802e-04f, -6.757737719e-04f, -5.196949496e-05f,
+  -6.582471542e-04f, -3.444286631e-05f, -1.622092350e-05f, 6.075833226e-04f,
+  -1.301895478e-03f, -6.780912518e-04f, -6.598693435e-04f, -3.606505561e-05f,
+  -6.423426676e-04f, -1.853842332e-05f, -3.164805094e-07f, 6.234878092e-04f,
+  -6.255881162e-04f, -1.783852554e-06f, 1.643809082e-05f, 6.402423605e-04f,
+  3.396471948e-05f, 6.577689783e-04f, 6.759909447e-04f, 1.299795229e-03f,
+  -1.286920509e-03f, -6.631161668e-04f, -6.448942586e-04f, -2.108998160e-05f,
+  -6.273676408e-04f, -3.563352038e-06f, 1.465859168e-05f, 6.384628359e-04f,
+  -6.106130313e-04f, 1.319121930e-05f, 3.141316120e-05f, 6.552174455e-04f,
+  4.893979349e-05f, 6.727440632e-04f, 6.909660297e-04f, 1.314770314e-03f,
+  -5.947086029e-04f, 2.909566138e-05f, 4.731760419e-05f, 6.711218739e-04f,
+  6.484423648e-05f, 6.886484916e-04f, 7.068704581e-04f, 1.330674742e-03f,
+  8.159880963e-05f, 7.054030430e-04f, 7.236250094e-04f, 1.347429235e-03f,
+  7.411516272e-04f, 1.364955911e-03f, 1.383177820e-03f, 2.006982220e-03f,
+  -1.272954978e-03f, -6.491507520e-04f, -6.309287855e-04f, -7.124531749e-06f,
+  -6.134021678e-04f, 1.040209827e-05f, 2.862404108e-05f, 6.524283090e-04f,
+  -5.966476165e-04f, 2.715666960e-05f, 4.537861241e-05f, 6.691828603e-04f,
+  6.290524470e-05f, 6.867095362e-04f, 7.049314445e-04f, 1.328735729e-03f,
+  -5.807431298e-04f, 4.306111077e-05f, 6.128305540e-05f, 6.850873469e-04f,
+  7.880968769e-05f, 7.026139647e-04f, 7.208358729e-04f, 1.344640157e-03f,
+  9.556425357e-05f, 7.193685160e-04f, 7.375904825e-04f, 1.361394767e-03f,
+  7.551171002e-04f, 1.378921326e-03f, 1.397143351e-03f, 2.020947635e-03f,
+  -5.657681031e-04f, 5.803618478e-05f, 7.625812577e-05f, 7.000623737e-04f,
+  9.378475806e-05f, 7.175890496e-04f, 7.358109578e-04f, 1.359615242e-03f,
+  1.105393312e-04f, 7.343436009e-04f, 7.525655092e-04f, 1.376369852e-03f,
+  7.700921851e-04f, 1.393896411e-03f, 1.412118319e-03f, 2.035922604e-03f,
+  1.264437742e-04f, 7.502480294e-04f, 7.684699958e-04f, 1.392274280e-03f,
+  7.859966136e-04f, 1.409800840e-03f, 1.428022864e-03f, 2.051827032e-03f,
+  8.027511649e-04f, 1.426555449e-03f, 1.444777357e-03f, 2.068581758e-03f,
+  1.462304033e-03f, 2.086108318e-03f, 2.104330342e-03f, 2.728134394e-03f
+},
+{
+  -3.088861238e-03f, -2.343131928e-03f, -2.332684351e-03f, -1.586954924e-03f,
+  -2.323573921e-03f, -1.577844494e-03f, -1.567396917e-03f, -8.216674905e-04f,
+  -2.315883059e-03f, -1.570153749e-03f, -1.559706172e-03f, -8.139767451e-04f,
+  -1.550595742e-03f, -8.048663149e-04f, -7.944186800e-04f, -4.868931137e-05f,
+  -2.309694653e-03f, -1.563965110e-03f, -1.553517533e-03f, -8.077881648e-04f,
+  -1.544407103e-03f, -7.986777346e-04f, -7.882300997e-04f, -4.250070560e-05f,
+  -1.536716358e-03f, -7.909869892e-04f, -7.805393543e-04f, -3.480997475e-05f,
+  -7.714289241e-04f, -2.569952994e-05f, -1.525192238e-05f, 7.304774481e-04f,
+  -2.305090195e-03f, -1.559360768e-03f, -1.548913075e-03f, -8.031837060e-04f,
+  -1.539802644e-03f, -7.940732758e-04f, -7.836256409e-04f, -3.789626862e-05f,
+  -1.532111899e-03f, -7.863825304e-04f, -7.759349537e-04f, -3.020553959e-05f,
+  -7.668244652e-04f, -2.109509478e-05f, -1.064748631e-05f, 7.350819069e-04f,
+  -1.525923377e-03f, -7.801939500e-04f, -7.697463152e-04f, -2.401693564e-05f,
+  -7.606358849e-04f, -1.490648992e-05f, -4.458882358e-06f, 7.412704872e-04f,
+  -7.529451395e-04f, -7.215759979e-06f, 3.231847586e-06f, 7.489612326e-04f,
+  1.234229330e-05f, 7.580716629e-04f, 7.685192977e-04f, 1.514248666e-03f,
+  -2.302151406e-03f, -1.556421863e-03f, -1.545974286e-03f, -8.002449176e-04f,
+  -1.536863856e-03f, -7.911344292e-04f, -7.806868525e-04f, -3.495745477e-05f,
+  -1.529173111e-03f, -7.834437420e-04f, -7.729961071e-04f, -2.726672392e-05f,
+  -7.638856769e-04f, -1.815627729e-05f, -7.708670637e-06f, 7.380206953e-04f,
+  -1.522984472e-03f, -7.772551035e-04f, -7.668075268e-04f, -2.107811997e-05f,
+  -7.576970966e-04f, -1.196767334e-05f, -1.520066007e-06f, 7.442093338e-04f,
+  -7.500063512e-04f, -4.276943855e-06f, 6.170663710e-06f, 7.519000792e-04f,
+  1.528110988e-05f, 7.610105094e-04f, 7.714580861e-04f, 1.517187455e-03f,
+  -1.518380130e-03f, -7.726507029e-04f, -7.622030680e-04f, -1.647368481e-05f,
+  -7.530926378e-04f, -7.363238183e-06f, 3.084369382e-06f, 7.488137926e-04f,
+  -7.454018923e-04f, 3.274918186e-07f, 1.077509933e-05f, 7.565044798e-04f,
+  1.988554504e-05f, 7.656149683e-04f, 7.760625449e-04f, 1.521791914e-03f,
+  -7.392133120e-04f, 6.516096164e-06f, 1.696370418e-05f, 7.626931183e-04f,
+  2.607414899e-05f, 7.718035486e-04f, 7.822511252e-04f, 1.527980552e-03f,
+  3.376487803e-05f, 7.794942940e-04f, 7.899418706e-04f, 1.535671297e-03f,
+  7.990523009e-04f, 1.544781728e-03f, 1.555229304e-03f, 2.300958615e-03f,
+  -2.300958615e-03f, -1.555229304e-03f, -1.544781728e-03f, -7.990523009e-04f,
+  -1.535671297e-03f, -7.899418706e-04f, -7.794942940e-04f, -3.376487803e-05f,
+  -1.527980552e-03f, -7.822511252e-04f, -7.718035486e-04f, -2.607414899e-05f,
+  -7.626931183e-04f, -1.696370418e-05f, -6.516096164e-06f, 7.392133120e-04f,
+  -1.521791914e-03f, -7.760625449e-04f, -7.656149683e-04f, -1.988554504e-05f,
+  -7.565044798e-04f, -1.077509933e-05f, -3.274918186e-07f, 7.454018923e-04f,
+  -7.488137926e-04f, -3.084369382e-06f, 7.363238183e-06f, 7.530926378e-04f,
+  1.647368481e-05f, 7.622030680e-04f, 7.726507029e-04f, 1.518380130e-03f,
+  -1.517187455e-03f, -7.714580861e-04f, -7.610105094e-04f, -1.528110988e-05f,
+  -7.519000792e-04f, -6.170663710e-06f, 4.276943855e-06f, 7.500063512e-04f,
+  -7.442093338e-04f, 1.520066007e-06f, 1.196767334e-05f, 7.576970966e-04f,
+  2.107811997e-05f, 7.668075268e-04f, 7.772551035e-04f, 1.522984472e-03f,
+  -7.380206953e-04f, 7.708670637e-06f, 1.815627729e-05f, 7.638856769e-04f,
+  2.726672392e-05f, 7.729961071e-04f, 7.834437420e-04f, 1.529173111e-03f,
+  3.495745477e-05f, 7.806868525e-04f, 7.911344292e-04f, 1.536863856e-03f,
+  8.002449176e-04f, 1.545974286e-03f, 1.556421863e-03f, 2.302151406e-03f,
+  -1.514248666e-03f, -7.685192977e-04f, -7.580716629e-04f, -1.234229330e-05f,
+  -7.489612326e-04f, -3.231847586e-06f, 7.215759979e-06f, 7.529451395e-04f,
+  -7.412704872e-04f, 4.458882358e-06f, 1.490648992e-05f, 7.606358849e-04f,
+  2.401693564e-05f, 7.697463152e-04f, 7.801939500e-04f, 1.525923377e-03f,
+  -7.350819069e-04f, 1.064748631e-05f, 2.109509478e-05f, 7.668244652e-04f,
+  3.020553959e-05f, 7.759349537e-04f, 7.863825304e-04f, 1.532111899e-03f,
+  3.789626862e-05f, 7.836256409e-04f, 7.940732758e-04f, 1.539802644e-03f,
+  8.031837060e-04f, 1.548913075e-03f, 1.559360768e-03f, 2.305090195e-03f,
+  -7.304774481e-04f, 1.525192238e-05f, 2.569952994e-05f, 7.714289241e-04f,
+  3.480997475e-05f, 7.805393543e-04f, 7.909869892e-04f, 1.536716358e-03f,
+  4.250070560e-05f, 7.882300997e-04f, 7.986777346e-04f, 1.544407103e-03f,
+  8.077881648e-04f, 1.553517533e-03f, 1.563965110e-03f, 2.309694653e-03f,
+  4.868931137e-05f, 7.944186800e-04f, 8.048663149e-04f, 1.550595742e-03f,
+  8.139767451e-04f, 1.559706172e-03f, 1.570153749e-03f, 2.315883059e-03f,
+  8.216674905e-04f, 1.567396917e-03f, 1.577844494e-03f, 2.323573921e-03f,
+  1.586954924e-03f, 2.332684351e-03f, 2.343131928e-03f, 3.088861238e-03f
+},
+{
+  -3.055538051e-03f, -2.268268727e-03f, -2.270805882e-03f, -1.483536442e-03f,
+  -2.275323961e-03f, -1.488054520e-03f, -1.490591792e-03f, -7.033223519e-04f,
+  -2.281897468e-03f, -1.494628028e-03f, -1.497165300e-03f, -7.098959177e-04f,
+  -1.501683262e-03f, -7.144138799e-04f, -7.169511518e-04f, 7.031824498e-05f,
+  -2.290599281e-03f, -1.503329957e-03f, -1.505867112e-03f, -7.185977884e-04f,
+  -1.510385191e-03f, -7.231157506e-04f, -7.256530225e-04f, 6.161635974e-05f,
+  -1.516958699e-03f, -7.296893164e-04f, -7.322265883e-04f, 5.504281216e-05f,
+  -7.367445505e-04f, 5.052483175e-05f, 4.798757072e-05f, 8.352569421e-04f,
+  -2.301499946e-03f, -1.514230506e-03f, -1.516767778e-03f, -7.294984534e-04f,
+  -1.521285740e-03f, -7.340164157e-04f, -7.365536876e-04f, 5.071570922e-05f,
+  -1.527859364e-03f, -7.405899814e-04f, -7.431271952e-04f, 4.414216164e-05f,
+  -7.476452156e-04f, 3.962418123e-05f, 3.708692020e-05f, 8.243562770e-04f,
+  -1.536561176e-03f, -7.492918521e-04f, -7.518291241e-04f, 3.544027277e-05f,
+  -7.563470863e-04f, 3.092229599e-05f, 2.838503315e-05f, 8.156544063e-04f,
+  -7.629206521e-04f, 2.434874841e-05f, 2.181148557e-05f, 8.090808406e-04f,
+  1.729350697e-05f, 8.045628783e-04f, 8.020256064e-04f, 1.589294989e-03f,
+  -2.314667217e-03f, -1.527397777e-03f, -1.529935049e-03f, -7.426656666e-04f,
+  -1.534453011e-03f, -7.471836288e-04f, -7.497209008e-04f, 3.754849240e-05f,
+  -1.541026519e-03f, -7.537571946e-04f, -7.562944666e-04f, 3.097494482e-05f,
+  -7.608124288e-04f, 2.645696622e-05f, 2.391970338e-05f, 8.111890638e-04f,
+  -1.549728448e-03f, -7.624590653e-04f, -7.649963372e-04f, 2.227305777e-05f,
+  -7.695142995e-04f, 1.775507917e-05f, 1.521781633e-05f, 8.024871931e-04f,
+  -7.760878652e-04f, 1.118153159e-05f, 8.644268746e-06f, 7.959136274e-04f,
+  4.126290605e-06f, 7.913956651e-04f, 7.888583932e-04f, 1.576127834e-03f,
+  -1.560629113e-03f, -7.733597304e-04f, -7.758970023e-04f, 1.137240906e-05f,
+  -7.804149645e-04f, 6.854430467e-06f, 4.317167623e-06f, 7.915865281e-04f,
+  -7.869885303e-04f, 2.808827446e-07f, -2.256380185e-06f, 7.850130205e-04f,
+  -6.774358553e-06f, 7.804950001e-04f, 7.779577863e-04f, 1.565227169e-03f,
+  -7.956904010e-04f, -8.421005077e-06f, -1.095826792e-05f, 7.763110916e-04f,
+  -1.547624561e-05f, 7.717931294e-04f, 7.692558574e-04f, 1.556525240e-03f,
+  -2.204979319e-05f, 7.652195636e-04f, 7.626823499e-04f, 1.549951732e-03f,
+  7.581643295e-04f, 1.545433770e-03f, 1.542896498e-03f, 2.330165822e-03f,
+  -2.330165822e-03f, -1.542896498e-03f, -1.545433770e-03f, -7.581643295e-04f,
+  -1.549951732e-03f, -7.626823499e-04f, -7.652195636e-04f, 2.204979319e-05f,
+  -1.556525240e-03f, -7.692558574e-04f, -7.717931294e-04f, 1.547624561e-05f,
+  -7.763110916e-04f, 1.095826792e-05f, 8.421005077e-06f, 7.956904010e-04f,
+  -1.565227169e-03f, -7.779577863e-04f, -7.804950001e-04f, 6.774358553e-06f,
+  -7.850130205e-04f, 2.256380185e-06f, -2.808827446e-07f, 7.869885303e-04f,
+  -7.915865281e-04f, -4.317167623e-06f, -6.854430467e-06f, 7.804149645e-04f,
+  -1.137240906e-05f, 7.758970023e-04f, 7.733597304e-04f, 1.560629113e-03f,
+  -1.576127834e-03f, -7.888583932e-04f, -7.913956651e-04f, -4.126290605e-06f,
+  -7.959136274e-04f, -8.644268746e-06f, -1.118153159e-05f, 7.760878652e-04f,
+  -8.024871931e-04f, -1.521781633e-05f, -1.775507917e-05f, 7.695142995e-04f,
+  -2.227305777e-05f, 7.649963372e-04f, 7.624590653e-04f, 1.549728448e-03f,
+  -8.111890638e-04f, -2.391970338e-05f, -2.645696622e-05f, 7.608124288e-04f,
+  -3.097494482e-05f, 7.562944666e-04f, 7.537571946e-04f, 1.541026519e-03f,
+  -3.754849240e-05f, 7.497209008e-04f, 7.471836288e-04f, 1.534453011e-03f,
+  7.426656666e-04f, 1.529935049e-03f, 1.527397777e-03f, 2.314667217e-03f,
+  -1.589294989e-03f, -8.020256064e-04f, -8.045628783e-04f, -1.729350697e-05f,
+  -8.090808406e-04f, -2.181148557e-05f, -2.434874841e-05f, 7.629206521e-04f,
+  -8.156544063e-04f, -2.838503315e-05f, -3.092229599e-05f, 7.563470863e-04f,
+  -3.544027277e-05f, 7.518291241e-04f, 7.492918521e-04f, 1.536561176e-03f,
+  -8.243562770e-04f, -3.708692020e-05f, -3.962418123e-05f, 7.476452156e-04f,
+  -4.414216164e-05f, 7.431271952e-04f, 7.405899814e-04f, 1.527859364e-03f,
+  -5.071570922e-05f, 7.365536876e-04f, 7.340164157e-04f, 1.521285740e-03f,
+  7.294984534e-04f, 1.516767778e-03f, 1.514230506e-03f, 2.301499946e-03f,
+  -8.352569421e-04f, -4.798757072e-05f, -5.052483175e-05f, 7.367445505e-04f,
+  -5.504281216e-05f, 7.322265883e-04f, 7.296893164e-04f, 1.516958699e-03f,
+  -6.161635974e-05f, 7.256530225e-04f, 7.231157506e-04f, 1.510385191e-03f,
+  7.185977884e-04f, 1.505867112e-03f, 1.503329957e-03f, 2.290599281e-03f,
+  -7.031824498e-05f, 7.169511518e-04f, 7.144138799e-04f, 1.501683262e-03f,
+  7.098959177e-04f, 1.497165300e-03f, 1.494628028e-03f, 2.281897468e-03f,
+  7.033223519e-04f, 1.490591792e-03f, 1.488054520e-03f, 2.275323961e-03f,
+  1.483536442e-03f, 2.270805882e-03f, 2.268268727e-03f, 3.055538051e-03f
+},
+{
+  -2.473290777e-03f, -1.765810535e-03f, -1.786153996e-03f, -1.078673755e-03f,
+  -1.809003646e-03f, -1.101523405e-03f, -1.121866982e-03f, -4.143867409e-04f,
+  -1.834410126e-03f, -1.126929885e-03f, -1.147273346e-03f, -4.397931916e-04f,
+  -1.170122996e-03f, -4.626428417e-04f, -4.829863319e-04f, 2.244938660e-04f,
+  -1.862419653e-03f, -1.154939528e-03f, -1.175282989e-03f, -4.678027763e-04f,
+  -1.198132639e-03f, -4.906524555e-04f, -5.109959166e-04f, 1.964842668e-04f,
+  -1.223539119e-03f, -5.160588771e-04f, -5.364023964e-04f, 1.710778160e-04f,
+  -5.592520465e-04f, 1.482281514e-04f, 1.278846612e-04f, 8.353648591e-04f,
+  -1.893074252e-03f, -1.185594010e-03f, -1.205937588e-03f, -4.984573461e-04f,
+  -1.228787238e-03f, -5.213069962e-04f, -5.416505155e-04f, 1.658297115e-04f,
+  -1.254193601e-03f, -5.467134179e-04f, -5.670569371e-04f, 1.404232607e-04f,
+  -5.899065873e-04f, 1.175735961e-04f, 9.723009862e-05f, 8.047103183e-04f,
+  -1.282203244e-03f, -5.747230607e-04f, -5.950665218e-04f, 1.124136688e-04f,
+  -6.179161719e-04f, 8.956400416e-05f, 6.922050670e-05f, 7.767007337e-04f,
+  -6.433226517e-04f, 6.415755342e-05f, 4.381405961e-05f, 7.512942539e-04f,
+  2.096439493e-05f, 7.284446037e-04f, 7.081010845e-04f, 1.415581326e-03f,
+  -1.926410827e-03f, -1.218930585e-03f, -1.239274046e-03f, -5.317938630e-04f,
+  -1.262123697e-03f, -5.546435132e-04f, -5.749870325e-04f, 1.324931800e-04f,
+  -1.287530176e-03f, -5.800499930e-04f, -6.003934541e-04f, 1.070867293e-04f,
+  -6.232431624e-04f, 8.423706458e-05f, 6.389356713e-05f, 7.713738014e-04f,
+  -1.315539819e-03f, -6.080595776e-04f, -6.284030969e-04f, 7.907713734e-05f,
+  -6.512527470e-04f, 5.622747267e-05f, 3.588397522e-05f, 7.433641586e-04f,
+  -6.766591687e-04f, 3.082102194e-05f, 1.047752630e-05f, 7.179577369e-04f,
+  -1.237213746e-05f, 6.951080868e-04f, 6.747645675e-04f, 1.382244751e-03f,
+  -1.346194302e-03f, -6.387141184e-04f, -6.590576377e-04f, 4.842257840e-05f,
+  -6.819072878e-04f, 2.557291555e-05f, 5.229419003e-06f, 7.127096178e-04f,
+  -7.073137676e-04f, 1.664663358e-07f, -2.017703082e-05f, 6.873031962e-04f,
+  -4.302669549e-05f, 6.644534878e-04f, 6.441100268e-04f, 1.351590268e-03f,
+  -7.353233523e-04f, -2.784312710e-05f, -4.818662273e-05f, 6.592935533e-04f,
+  -7.103628741e-05f, 6.364439032e-04f, 6.161004421e-04f, 1.323580625e-03f,
+  -9.644273814e-05f, 6.110374816e-04f, 5.906939623e-04f, 1.298174146e-03f,
+  5.678443122e-04f, 1.275324496e-03f, 1.254981034e-03f, 1.962461276e-03f,
+  -1.962461276e-03f, -1.254981034e-03f, -1.275324496e-03f, -5.678443122e-04f,
+  -1.298174146e-03f, -5.906939623e-04f, -6.110374816e-04f, 9.644273814e-05f,
+  -1.323580625e-03f, -6.161004421e-04f, -6.364439032e-04f, 7.103628741e-05f,
+  -6.592935533e-04f, 4.818662273e-05f, 2.784312710e-05f, 7.353233523e-04f,
+  -1.351590268e-03f, -6.441100268e-04f, -6.644534878e-04f, 4.302669549e-05f,
+  -6.873031962e-04f, 2.017703082e-05f, -1.664663358e-07f, 7.073137676e-04f,
+  -7.127096178e-04f, -5.229419003e-06f, -2.557291555e-05f, 6.819072878e-04f,
+  -4.842257840e-05f, 6.590576377e-04f, 6.387141184e-04f, 1.346194302e-03f,
+  -1.382244751e-03f, -6.747645675e-04f, -6.951080868e-04f, 1.237213746e-05f,
+  -7.179577369e-04f, -1.047752630e-05f, -3.082102194e-05f, 6.766591687e-04f,
+  -7.433641586e-04f, -3.588397522e-05f, -5.622747267e-05f, 6.512527470e-04f,
+  -7.907713734e-05f, 6.284030969e-04f, 6.080595776e-04f, 1.315539819e-03f,
+  -7.713738014e-04f, -6.389356713e-05f, -8.423706458e-05f, 6.232431624e-04f,
+  -1.070867293e-04f, 6.003934541e-04f, 5.800499930e-04f, 1.287530176e-03f,
+  -1.324931800e-04f, 5.749870325e-04f, 5.546435132e-04f, 1.262123697e-03f,
+  5.317938630e-04f, 1.239274046e-03f, 1.218930585e-03f, 1.926410827e-03f,
+  -1.415581326e-03f, -7.081010845e-04f, -7.284446037e-04f, -2.096439493e-05f,
+  -7.512942539e-04f, -4.381405961e-05f, -6.415755342e-05f, 6.433226517e-04f,
+  -7.767007337e-04f, -6.922050670e-05f, -8.956400416e-05f, 6.179161719e-04f,
+  -1.124136688e-04f, 5.950665218e-04f, 5.747230607e-04f, 1.282203244e-03f,
+  -8.047103183e-04f, -9.723009862e-05f, -1.175735961e-04f, 5.899065873e-04f,
+  -1.404232607e-04f, 5.670569371e-04f, 5.467134179e-04f, 1.254193601e-03f,
+  -1.658297115e-04f, 5.416505155e-04f, 5.213069962e-04f, 1.228787238e-03f,
+  4.984573461e-04f, 1.205937588e-03f, 1.185594010e-03f, 1.893074252e-03f,
+  -8.353648591e-04f, -1.278846612e-04f, -1.482281514e-04f, 5.592520465e-04f,
+  -1.710778160e-04f, 5.364023964e-04f, 5.160588771e-04f, 1.223539119e-03f,
+  -1.964842668e-04f, 5.109959166e-04f, 4.906524555e-04f, 1.198132639e-03f,
+  4.678027763e-04f, 1.175282989e-03f, 1.154939528e-03f, 1.862419653e-03f,
+  -2.244938660e-04f, 4.829863319e-04f, 4.626428417e-04f, 1.170122996e-03f,
+  4.397931916e-04f, 1.147273346e-03f, 1.126929885e-03f, 1.834410126e-03f,
+  4.143867409e-04f, 1.121866982e-03f, 1.101523405e-03f, 1.809003646e-03f,
+  1.078673755e-03f, 1.786153996e-03f, 1.765810535e-03f, 2.473290777e-03f
+},
+{
+  -1.228540903e-03f, -7.565023261e-04f, -7.980547962e-04f, -3.260162484e-04f,
+  -8.423838299e-04f, -3.703452821e-04f, -4.118976940e-04f, 6.014082101e-05f,
+  -8.894984494e-04f, -4.174599308e-04f, -4.590123717e-04f, 1.302616329e-05f,
+  -5.033413763e-04f, -3.130287223e-05f, -7.285529864e-05f, 3.991832200e-04f,
+  -9.394013905e-04f, -4.673628719e-04f, -5.089152837e-04f, -3.687677236e-05f,
+  -5.532443174e-04f, -8.120580605e-05f, -1.227582397e-04f, 3.492802789e-04f,
+  -6.003589951e-04f, -1.283204620e-04f, -1.698728884e-04f, 3.021656303e-04f,
+  -2.142019221e-04f, 2.578365966e-04f, 2.162841702e-04f, 6.883227034e-04f,
+  -9.920886951e-04f, -5.200501764e-04f, -5.616025883e-04f, -8.956405509e-05f,
+  -6.059316220e-04f, -1.338930888e-04f, -1.754455152e-04f, 2.965930034e-04f,
+  -6.530462997e-04f, -1.810077520e-04f, -2.225601784e-04f, 2.494783548e-04f,
+  -2.668891975e-04f, 2.051493211e-04f, 1.635968947e-04f, 6.356353988e-04f,
+  -7.029491826e-04f, -2.309106785e-04f, -2.724631049e-04f, 1.995754137e-04f,
+  -3.167921386e-04f, 1.552463800e-04f, 1.136939536e-04f, 5.857324577e-04f,
+  -3.639067872e-04f, 1.081317241e-04f, 6.657929771e-05f, 5.386178382e-04f,
+  2.225026401e-05f, 4.942888045e-04f, 4.527363635e-04f, 9.247749113e-04f,
+  -1.047549536e-03f, -5.755110178e-04f, -6.170634297e-04f, -1.450249256e-04f,
+  -6.613924634e-04f, -1.893539593e-04f, -2.309063857e-04f, 2.411321475e-04f,
+  -7.085071411e-04f, -2.364686079e-04f, -2.780210343e-04f, 1.940174843e-04f,
+  -3.223500680e-04f, 1.496884506e-04f, 1.081360242e-04f, 5.801745574e-04f,
+  -7.584100822e-04f, -2.863715636e-04f, -3.279239754e-04f, 1.441145578e-04f,
+  -3.722530091e-04f, 9.978551680e-05f, 5.823308675e-05f, 5.302716163e-04f,
+  -4.193676577e-04f, 5.267085726e-05f, 1.111842994e-05f, 4.831569677e-04f,
+  -3.321060649e-05f, 4.388279340e-04f, 3.972754930e-04f, 8.693140117e-04f,
+  -8.110973286e-04f, -3.390588390e-04f, -3.806112509e-04f, 9.142726776e-05f,
+  -4.249402846e-04f, 4.709823406e-05f, 5.545808108e-06f, 4.775843408e-04f,
+  -4.720549623e-04f, -1.642217562e-08f, -4.156884825e-05f, 4.304696922e-04f,
+  -8.589788195e-05f, 3.861406294e-04f, 3.445882176e-04f, 8.166267653e-04f,
+  -5.219578743e-04f, -4.991935930e-05f, -9.147178207e-05f, 3.805667511e-04f,
+  -1.358008158e-04f, 3.362377174e-04f, 2.946852765e-04f, 7.667238242e-04f,
+  -1.829154789e-04f, 2.891230397e-04f, 2.475706278e-04f, 7.196091465e-04f,
+  2.032415796e-04f, 6.752801128e-04f, 6.337277009e-04f, 1.105766161e-03f,
+  -1.105766161e-03f, -6.337277009e-04f, -6.752801128e-04f, -2.032415796e-04f,
+  -7.196091465e-04f, -2.475706278e-04f, -2.891230397e-04f, 1.829154789e-04f,
+  -7.667238242e-04f, -2.946852765e-04f, -3.362377174e-04f, 1.358008158e-04f,
+  -3.805667511e-04f, 9.147178207e-05f, 4.991935930e-05f, 5.219578743e-04f,
+  -8.166267653e-04f, -3.445882176e-04f, -3.861406294e-04f, 8.589788195e-05f,
+  -4.304696922e-04f, 4.156884825e-05f, 1.642217562e-08f, 4.720549623e-04f,
+  -4.775843408e-04f, -5.545808108e-06f, -4.709823406e-05f, 4.249402846e-04f,
+  -9.142726776e-05f, 3.806112509e-04f, 3.390588390e-04f, 8.110973286e-04f,
+  -8.693140117e-04f, -3.972754930e-04f, -4.388279340e-04f, 3.321060649e-05f,
+  -4.831569677e-04f, -1.111842994e-05f, -5.267085726e-05f, 4.193676577e-04f,
+  -5.302716163e-04f, -5.823308675e-05f, -9.978551680e-05f, 3.722530091e-04f,
+  -1.441145578e-04f, 3.279239754e-04f, 2.863715636e-04f, 7.584100822e-04f,
+  -5.801745574e-04f, -1.081360242e-04f, -1.496884506e-04f, 3.223500680e-04f,
+  -1.940174843e-04f, 2.780210343e-04f, 2.364686079e-04f, 7.085071411e-04f,
+  -2.411321475e-04f, 2.309063857e-04f, 1.893539593e-04f, 6.613924634e-04f,
+  1.450249256e-04f, 6.170634297e-04f, 5.755110178e-04f, 1.047549536e-03f,
+  -9.247749113e-04f, -4.527363635e-04f, -4.942888045e-04f, -2.225026401e-05f,
+  -5.386178382e-04f, -6.657929771e-05f, -1.081317241e-04f, 3.639067872e-04f,
+  -5.857324577e-04f, -1.136939536e-04f, -1.552463800e-04f, 3.167921386e-04f,
+  -1.995754137e-04f, 2.724631049e-04f, 2.309106785e-04f, 7.029491826e-04f,
+  -6.356353988e-04f, -1.635968947e-04f, -2.051493211e-04f, 2.668891975e-04f,
+  -2.494783548e-04f, 2.225601784e-04f, 1.810077520e-04f, 6.530462997e-04f,
+  -2.965930034e-04f, 1.754455152e-04f, 1.338930888e-04f, 6.059316220e-04f,
+  8.956405509e-05f, 5.616025883e-04f, 5.200501764e-04f, 9.920886951e-04f,
+  -6.883227034e-04f, -2.162841702e-04f, -2.578365966e-04f, 2.142019221e-04f,
+  -3.021656303e-04f, 1.698728884e-04f, 1.283204620e-04f, 6.003589951e-04f,
+  -3.492802789e-04f, 1.227582397e-04f, 8.120580605e-05f, 5.532443174e-04f,
+  3.687677236e-05f, 5.089152837e-04f, 4.673628719e-04f, 9.394013905e-04f,
+  -3.991832200e-04f, 7.285529864e-05f, 3.130287223e-05f, 5.033413763e-04f,
+  -1.302616329e-05f, 4.590123717e-04f, 4.174599308e-04f, 8.894984494e-04f,
+  -6.014082101e-05f, 4.118976940e-04f, 3.703452821e-04f, 8.423838299e-04f,
+  3.260162484e-04f, 7.980547962e-04f, 7.565023261e-04f, 1.228540903e-03f
+},
+{
+  7.162563852e-04f, 7.780836313e-04f, 7.144379197e-04f, 7.762651658e-04f,
+  6.481340970e-04f, 7.099613431e-04f, 6.463156315e-04f, 7.081428776e-04f,
+  5.792200100e-04f, 6.410472561e-04f, 5.774015444e-04f, 6.392287905e-04f,
+  5.110977218e-04f, 5.729249679e-04f, 5.092792562e-04f, 5.711065023e-04f,
+  5.077516544e-04f, 5.695788423e-04f, 5.059331888e-04f, 5.677604349e-04f,
+  4.396293371e-04f, 5.014565540e-04f, 4.378108715e-04f, 4.996380885e-04f,
+  3.707152500e-04f, 4.325424961e-04f, 3.688968136e-04f, 4.307240306e-04f,
+  3.025929618e-04f, 3.644202079e-04f, 3.007744963e-04f, 3.626017424e-04f,
+  4.337929131e-04f, 4.956201301e-04f, 4.319744476e-04f, 4.938017228e-04f,
+  3.656706249e-04f, 4.274978419e-04f, 3.638521594e-04f, 4.256794055e-04f,
+  2.967565379e-04f, 3.585837840e-04f, 2.949381014e-04f, 3.567653184e-04f,
+  2.286342497e-04f, 2.904614958e-04f, 2.268157987e-04f, 2.886430302e-04f,
+  2.252881532e-04f, 2.871153993e-04f, 2.234697022e-04f, 2.852969337e-04f,
+  1.571658504e-04f, 2.189930965e-04f, 1.553473994e-04f, 2.171746310e-04f,
+  8.825179248e-05f, 1.500790240e-04f, 8.643333422e-05f, 1.482605730e-04f,
+  2.012949153e-05f, 8.195672854e-05f, 1.831103509e-05f, 8.013827028e-05f,
+  3.574161674e-04f, 4.192433844e-04f, 3.555977019e-04f, 4.174249189e-04f,
+  2.892938501e-04f, 3.511210962e-04f, 2.874753845e-04f, 3.493026306e-04f,
+  2.203797922e-04f, 2.822070091e-04f, 2.185613266e-04f, 2.803885727e-04f,
+  1.522574894e-04f, 2.140847209e-04f, 1.504390384e-04f, 2.122662700e-04f,
+  1.489113929e-04f, 2.107386244e-04f, 1.470929419e-04f, 2.089201735e-04f,
+  8.078909013e-05f, 1.426163217e-04f, 7.897063915e-05f, 1.407978707e-04f,
+  1.187502585e-05f, 7.370226376e-05f, 1.005656941e-05f, 7.188380550e-05f,
+  -5.624727419e-05f, 5.579961908e-06f, -5.806572881e-05f, 3.761505695e-06f,
+  7.495268073e-05f, 1.367799123e-04f, 7.313422248e-05f, 1.349614613e-04f,
+  6.830381153e-06f, 6.865761679e-05f, 5.011924713e-06f, 6.683915854e-05f,
+  -6.208368723e-05f, -2.564505905e-07f, -6.390214548e-05f, -2.074906888e-06f,
+  -1.302059827e-04f, -6.837875117e-05f, -1.320244482e-04f, -7.019720942e-05f,
+  -1.335520792e-04f, -7.172484766e-05f, -1.353705447e-04f, -7.354330592e-05f,
+  -2.016743820e-04f, -1.398471504e-04f, -2.034928330e-04f, -1.416656014e-04f,
+  -2.705884399e-04f, -2.087612083e-04f, -2.724069054e-04f, -2.105796739e-04f,
+  -3.387107572e-04f, -2.768835111e-04f, -3.405291936e-04f, -2.787019766e-04f,
+  2.787019766e-04f, 3.405291936e-04f, 2.768835111e-04f, 3.387107572e-04f,
+  2.105796739e-04f, 2.724069054e-04f, 2.087612083e-04f, 2.705884399e-04f,
+  1.416656014e-04f, 2.034928330e-04f, 1.398471504e-04f, 2.016743820e-04f,
+  7.354330592e-05f, 1.353705447e-04f, 7.172484766e-05f, 1.335520792e-04f,
+  7.019720942e-05f, 1.320244482e-04f, 6.837875117e-05f, 1.302059827e-04f,
+  2.074906888e-06f, 6.390214548e-05f, 2.564505905e-07f, 6.208368723e-05f,
+  -6.683915854e-05f, -5.011924713e-06f, -6.865761679e-05f, -6.830381153e-06f,
+  -1.349614613e-04f, -7.313422248e-05f, -1.367799123e-04f, -7.495268073e-05f,
+  -3.761505695e-06f, 5.806572881e-05f, -5.579961908e-06f, 5.624727419e-05f,
+  -7.188380550e-05f, -1.005656941e-05f, -7.370226376e-05f, -1.187502585e-05f,
+  -1.407978707e-04f, -7.897063915e-05f, -1.426163217e-04f, -8.078909013e-05f,
+  -2.089201735e-04f, -1.470929419e-04f, -2.107386244e-04f, -1.489113929e-04f,
+  -2.122662700e-04f, -1.504390384e-04f, -2.140847209e-04f, -1.522574894e-04f,
+  -2.803885727e-04f, -2.185613266e-04f, -2.822070091e-04f, -2.203797922e-04f,
+  -3.493026306e-04f, -2.874753845e-04f, -3.511210962e-04f, -2.892938501e-04f,
+  -4.174249189e-04f, -3.555977019e-04f, -4.192433844e-04f, -3.574161674e-04f,
+  -8.013827028e-05f, -1.831103509e-05f, -8.195672854e-05f, -2.012949153e-05f,
+  -1.482605730e-04f, -8.643333422e-05f, -1.500790240e-04f, -8.825179248e-05f,
+  -2.171746310e-04f, -1.553473994e-04f, -2.189930965e-04f, -1.571658504e-04f,
+  -2.852969337e-04f, -2.234697022e-04f, -2.871153993e-04f, -2.252881532e-04f,
+  -2.886430302e-04f, -2.268157987e-04f, -2.904614958e-04f, -2.286342497e-04f,
+  -3.567653184e-04f, -2.949381014e-04f, -3.585837840e-04f, -2.967565379e-04f,
+  -4.256794055e-04f, -3.638521594e-04f, -4.274978419e-04f, -3.656706249e-04f,
+  -4.938017228e-04f, -4.319744476e-04f, -4.956201301e-04f, -4.337929131e-04f,
+  -3.626017424e-04f, -3.007744963e-04f, -3.644202079e-04f, -3.025929618e-04f,
+  -4.307240306e-04f, -3.688968136e-04f, -4.325424961e-04f, -3.707152500e-04f,
+  -4.996380885e-04f, -4.378108715e-04f, -5.014565540e-04f, -4.396293371e-04f,
+  -5.677604349e-04f, -5.059331888e-04f, -5.695788423e-04f, -5.077516544e-04f,
+  -5.711065023e-04f, -5.092792562e-04f, -5.729249679e-04f, -5.110977218e-04f,
+  -6.392287905e-04f, -5.774015444e-04f, -6.410472561e-04f, -5.792200100e-04f,
+  -7.081428776e-04f, -6.463156315e-04f, -7.099613431e-04f, -6.481340970e-04f,
+  -7.762651658e-04f, -7.144379197e-04f, -7.780836313e-04f, -7.162563852e-04f
+},
+{
+  3.290626919e-03f, 2.772109816e-03f, 2.688996727e-03f, 2.170479856e-03f,
+  2.603839152e-03f, 2.085322281e-03f, 2.002209192e-03f, 1.483692206e-03f,
+  2.516752342e-03f, 1.998235239e-03f, 1.915122150e-03f, 1.396605279e-03f,
+  1.829964691e-03f, 1.311447704e-03f, 1.228334499e-03f, 7.098176284e-04f,
+  2.427859465e-03f, 1.909342594e-03f, 1.826229505e-03f, 1.307712519e-03f,
+  1.741071930e-03f, 1.222555060e-03f, 1.139441854e-03f, 6.209249259e-04f,
+  1.653985004e-03f, 1.135468134e-03f, 1.052354928e-03f, 5.338379997e-04f,
+  9.671973530e-04f, 4.486804537e-04f, 3.655672772e-04f, -1.529496367e-04f,
+  2.337293467e-03f, 1.818776596e-03f, 1.735663507e-03f, 1.217146521e-03f,
+  1.650505932e-03f, 1.131988945e-03f, 1.048875856e-03f, 5.303588696e-04f,
+  1.563419006e-03f, 1.044902019e-03f, 9.617888718e-04f, 4.432719434e-04f,
+  8.766313549e-04f, 3.581143974e-04f, 2.750012500e-04f, -2.435156784e-04f,
+  1.474526245e-03f, 9.560093749e-04f, 8.728961693e-04f, 3.543792700e-04f,
+  7.877386524e-04f, 2.692217240e-04f, 1.861085620e-04f, -3.324083809e-04f,
+  7.006517262e-04f, 1.821347687e-04f, 9.902160673e-05f, -4.194953071e-04f,
+  1.386407257e-05f, -5.046528531e-04f, -5.877660005e-04f, -1.106282929e-03f,
+  2.245195210e-03f, 1.726678340e-03f, 1.643565134e-03f, 1.125048264e-03f,
+  1.558407675e-03f, 1.039890689e-03f, 9.567775414e-04f, 4.382606130e-04f,
+  1.471320633e-03f, 9.528037626e-04f, 8.696906152e-04f, 3.511736577e-04f,
+  7.845330401e-04f, 2.660161408e-04f, 1.829029643e-04f, -3.356139641e-04f,
+  1.382427989e-03f, 8.639110602e-04f, 7.807979127e-04f, 2.622809843e-04f,
+  6.956403377e-04f, 1.771234383e-04f, 9.401027637e-05f, -4.245066666e-04f,
+  6.085534114e-04f, 9.003649029e-05f, 6.923326964e-06f, -5.115935928e-04f,
+  -7.823421038e-05f, -5.967511097e-04f, -6.798643153e-04f, -1.198381186e-03f,
+  1.291861990e-03f, 7.733450038e-04f, 6.902318564e-04f, 1.717149280e-04f,
+  6.050743395e-04f, 8.655739657e-05f, 3.444235062e-06f, -5.150726647e-04f,
+  5.179873551e-04f, -5.295505048e-07f, -8.364271343e-05f, -6.021596491e-04f,
+  -1.688002521e-04f, -6.873171660e-04f, -7.704303134e-04f, -1.288947300e-03f,
+  4.290946817e-04f, -8.942223940e-05f, -1.725354086e-04f, -6.910523516e-04f,
+  -2.576929401e-04f, -7.762098685e-04f, -8.593230159e-04f, -1.377839944e-03f,
+  -3.447798954e-04f, -8.632967947e-04f, -9.464100003e-04f, -1.464926871e-03f,
+  -1.031567459e-03f, -1.550084446e-03f, -1.633197651e-03f, -2.151714638e-03f,
+  2.151714638e-03f, 1.633197651e-03f, 1.550084446e-03f, 1.031567459e-03f,
+  1.464926871e-03f, 9.464100003e-04f, 8.632967947e-04f, 3.447798954e-04f,
+  1.377839944e-03f, 8.593230159e-04f, 7.762098685e-04f, 2.576929401e-04f,
+  6.910523516e-04f, 1.725354086e-04f, 8.942223940e-05f, -4.290946817e-04f,
+  1.288947300e-03f, 7.704303134e-04f, 6.873171660e-04f, 1.688002521e-04f,
+  6.021596491e-04f, 8.364271343e-05f, 5.295505048e-07f, -5.179873551e-04f,
+  5.150726647e-04f, -3.444235062e-06f, -8.655739657e-05f, -6.050743395e-04f,
+  -1.717149280e-04f, -6.902318564e-04f, -7.733450038e-04f, -1.291861990e-03f,
+  1.198381186e-03f, 6.798643153e-04f, 5.967511097e-04f, 7.823421038e-05f,
+  5.115935928e-04f, -6.923326964e-06f, -9.003649029e-05f, -6.085534114e-04f,
+  4.245066666e-04f, -9.401027637e-05f, -1.771234383e-04f, -6.956403377e-04f,
+  -2.622809843e-04f, -7.807979127e-04f, -8.639110602e-04f, -1.382427989e-03f,
+  3.356139641e-04f, -1.829029643e-04f, -2.660161408e-04f, -7.845330401e-04f,
+  -3.511736577e-04f, -8.696906152e-04f, -9.528037626e-04f, -1.471320633e-03f,
+  -4.382606130e-04f, -9.567775414e-04f, -1.039890689e-03f, -1.558407675e-03f,
+  -1.125048264e-03f, -1.643565134e-03f, -1.726678340e-03f, -2.245195210e-03f,
+  1.106282929e-03f, 5.877660005e-04f, 5.046528531e-04f, -1.386407257e-05f,
+  4.194953071e-04f, -9.902160673e-05f, -1.821347687e-04f, -7.006517262e-04f,
+  3.324083809e-04f, -1.861085620e-04f, -2.692217240e-04f, -7.877386524e-04f,
+  -3.543792700e-04f, -8.728961693e-04f, -9.560093749e-04f, -1.474526245e-03f,
+  2.435156784e-04f, -2.750012500e-04f, -3.581143974e-04f, -8.766313549e-04f,
+  -4.432719434e-04f, -9.617888718e-04f, -1.044902019e-03f, -1.563419006e-03f,
+  -5.303588696e-04f, -1.048875856e-03f, -1.131988945e-03f, -1.650505932e-03f,
+  -1.217146521e-03f, -1.735663507e-03f, -1.818776596e-03f, -2.337293467e-03f,
+  1.529496367e-04f, -3.655672772e-04f, -4.486804537e-04f, -9.671973530e-04f,
+  -5.338379997e-04f, -1.052354928e-03f, -1.135468134e-03f, -1.653985004e-03f,
+  -6.209249259e-04f, -1.139441854e-03f, -1.222555060e-03f, -1.741071930e-03f,
+  -1.307712519e-03f, -1.826229505e-03f, -1.909342594e-03f, -2.427859465e-03f,
+  -7.098176284e-04f, -1.228334499e-03f, -1.311447704e-03f, -1.829964691e-03f,
+  -1.396605279e-03f, -1.915122150e-03f, -1.998235239e-03f, -2.516752342e-03f,
+  -1.483692206e-03f, -2.002209192e-03f, -2.085322281e-03f, -2.603839152e-03f,
+  -2.170479856e-03f, -2.688996727e-03f, -2.772109816e-03f, -3.290626919e-03f
+},
+{
+  6.293148268e-03f, 5.059531424e-03f, 4.963769577e-03f, 3.730152734e-03f,
+  4.867126700e-03f, 3.633509623e-03f, 3.537747776e-03f, 2.304130699e-03f,
+  4.769785795e-03f, 3.536168719e-03f, 3.440407105e-03f, 2.206790028e-03f,
+  3.343763761e-03f, 2.110146917e-03f, 2.014385071e-03f, 7.807681104e-04f,
+  4.671939649e-03f, 3.438322572e-03f, 3.342560725e-03f, 2.108943881e-03f,
+  3.245917615e-03f, 2.012300538e-03f, 1.916538924e-03f, 6.829218473e-04f,
+  3.148576943e-03f, 1.914959867e-03f, 1.819198136e-03f, 5.855811178e-04f,
+  1.722554909e-03f, 4.889379488e-04f, 3.931762185e-04f, -8.404407999e-04f,
+  4.573788028e-03f, 3.340171184e-03f, 3.244409338e-03f, 2.010792261e-03f,
+  3.147766227e-03f, 1.914149150e-03f, 1.818387536e-03f, 5.847704597e-04f,
+  3.050425556e-03f, 1.816808479e-03f, 1.721046749e-03f, 4.874296719e-04f,
+  1.624403521e-03f, 3.907865030e-04f, 2.950248017e-04f, -9.385922458e-04f,
+  2.952579176e-03f, 1.718962216e-03f, 1.623200485e-03f, 3.895834670e-04f,
+  1.526557375e-03f, 2.929402981e-04f, 1.971785823e-04f, -1.036438509e-03f,
+  1.429216587e-03f, 1.955995249e-04f, 9.983782365e-05f, -1.133779180e-03f,
+  3.194641749e-06f, -1.230422407e-03f, -1.326184138e-03f, -2.559801098e-03f,
+  4.475539550e-03f, 3.241922706e-03f, 3.146160860e-03f, 1.912543899e-03f,
+  3.049517749e-03f, 1.815900672e-03f, 1.720138942e-03f, 4.865219526e-04f,
+  2.952177078e-03f, 1.718559884e-03f, 1.622798271e-03f, 3.891811939e-04f,
+  1.526155043e-03f, 2.925379958e-04f, 1.967762946e-04f, -1.036840724e-03f,
+  2.854330698e-03f, 1.620713738e-03f, 1.524952007e-03f, 2.913349599e-04f,
+  1.428308780e-03f, 1.946917910e-04f, 9.893008973e-05f, -1.134686987e-03f,
+  1.330968109e-03f, 9.735103231e-05f, 1.589324484e-06f, -1.232027658e-03f,
+  -9.505385242e-05f, -1.328670885e-03f, -1.424432616e-03f, -2.658049576e-03f,
+  2.756179310e-03f, 1.522562234e-03f, 1.426800620e-03f, 1.931835432e-04f,
+  1.330157393e-03f, 9.654036694e-05f, 7.786583751e-07f, -1.232838375e-03f,
+  1.232816605e-03f, -8.003984249e-07f, -9.656210750e-05f, -1.330179162e-03f,
+  -1.932052837e-04f, -1.426822273e-03f, -1.522584003e-03f, -2.756200964e-03f,
+  1.134970458e-03f, -9.864661115e-05f, -1.944083197e-04f, -1.428025309e-03f,
+  -2.910514886e-04f, -1.524668536e-03f, -1.620430266e-03f, -2.854047343e-03f,
+  -3.883922473e-04f, -1.622009324e-03f, -1.717771054e-03f, -2.951388014e-03f,
+  -1.814414165e-03f, -3.048031125e-03f, -3.143792972e-03f, -4.377409816e-03f,
+  4.377409816e-03f, 3.143792972e-03f, 3.048031125e-03f, 1.814414165e-03f,
+  2.951388014e-03f, 1.717771054e-03f, 1.622009324e-03f, 3.883922473e-04f,
+  2.854047343e-03f, 1.620430266e-03f, 1.524668536e-03f, 2.910514886e-04f,
+  1.428025309e-03f, 1.944083197e-04f, 9.864661115e-05f, -1.134970458e-03f,
+  2.756200964e-03f, 1.522584003e-03f, 1.426822273e-03f, 1.932052837e-04f,
+  1.330179162e-03f, 9.656210750e-05f, 8.003984249e-07f, -1.232816605e-03f,
+  1.232838375e-03f, -7.786583751e-07f, -9.654036694e-05f, -1.330157393e-03f,
+  -1.931835432e-04f, -1.426800620e-03f, -1.522562234e-03f, -2.756179310e-03f,
+  2.658049576e-03f, 1.424432616e-03f, 1.328670885e-03f, 9.505385242e-05f,
+  1.232027658e-03f, -1.589324484e-06f, -9.735103231e-05f, -1.330968109e-03f,
+  1.134686987e-03f, -9.893008973e-05f, -1.946917910e-04f, -1.428308780e-03f,
+  -2.913349599e-04f, -1.524952007e-03f, -1.620713738e-03f, -2.854330698e-03f,
+  1.036840724e-03f, -1.967762946e-04f, -2.925379958e-04f, -1.526155043e-03f,
+  -3.891811939e-04f, -1.622798271e-03f, -1.718559884e-03f, -2.952177078e-03f,
+  -4.865219526e-04f, -1.720138942e-03f, -1.815900672e-03f, -3.049517749e-03f,
+  -1.912543899e-03f, -3.146160860e-03f, -3.241922706e-03f, -4.475539550e-03f,
+  2.559801098e-03f, 1.326184138e-03f, 1.230422407e-03f, -3.194641749e-06f,
+  1.133779180e-03f, -9.983782365e-05f, -1.955995249e-04f, -1.429216587e-03f,
+  1.036438509e-03f, -1.971785823e-04f, -2.929402981e-04f, -1.526557375e-03f,
+  -3.895834670e-04f, -1.623200485e-03f, -1.718962216e-03f, -2.952579176e-03f,
+  9.385922458e-04f, -2.950248017e-04f, -3.907865030e-04f, -1.624403521e-03f,
+  -4.874296719e-04f, -1.721046749e-03f, -1.816808479e-03f, -3.050425556e-03f,
+  -5.847704597e-04f, -1.818387536e-03f, -1.914149150e-03f, -3.147766227e-03f,
+  -2.010792261e-03f, -3.244409338e-03f, -3.340171184e-03f, -4.573788028e-03f,
+  8.404407999e-04f, -3.931762185e-04f, -4.889379488e-04f, -1.722554909e-03f,
+  -5.855811178e-04f, -1.819198136e-03f, -1.914959867e-03f, -3.148576943e-03f,
+  -6.829218473e-04f, -1.916538924e-03f, -2.012300538e-03f, -3.245917615e-03f,
+  -2.108943881e-03f, -3.342560725e-03f, -3.438322572e-03f, -4.671939649e-03f,
+  -7.807681104e-04f, -2.014385071e-03f, -2.110146917e-03f, -3.343763761e-03f,
+  -2.206790028e-03f, -3.440407105e-03f, -3.536168719e-03f, -4.769785795e-03f,
+  -2.304130699e-03f, -3.537747776e-03f, -3.633509623e-03f, -4.867126700e-03f,
+  -3.730152734e-03f, -4.963769577e-03f, -5.059531424e-03f, -6.293148268e-03f
+},
+{
+  9.383690543e-03f, 7.370164152e-03f, 7.272949442e-03f, 5.259423517e-03f,
+  7.176544983e-03f, 5.163019057e-03f, 5.065804347e-03f, 3.052278422e-03f,
+  7.081195712e-03f, 5.067669787e-03f, 4.970455077e-03f, 2.956929151e-03f,
+  4.874050617e-03f, 2.860524924e-03f, 2.763310215e-03f, 7.497841143e-04f,
+  6.987151690e-03f, 4.973625764e-03f, 4.876411054e-03f, 2.862885129e-03f,
+  4.780007061e-03f, 2.766480902e-03f, 2.669266192e-03f, 6.557402667e-04f,
+  4.684657324e-03f, 2.671131631e-03f, 2.573916921e-03f, 5.603908212e-04f,
+  2.477512695e-03f, 4.639865947e-04f, 3.667719138e-04f, -1.646754099e-03f,
+  6.894670427e-03f, 4.881144501e-03f, 4.783929791e-03f, 2.770403633e-03f,
+  4.687525332e-03f, 2.673999406e-03f, 2.576784696e-03f, 5.632587709e-04f,
+  4.592176061e-03f, 2.578650136e-03f, 2.481435426e-03f, 4.679093254e-04f,
+  2.385031199e-03f, 3.715050989e-04f, 2.742904180e-04f, -1.739235595e-03f,
+  4.498132039e-03f, 2.484606113e-03f, 2.387391403e-03f, 3.738654777e-04f,
+  2.290987177e-03f, 2.774612512e-04f, 1.802465558e-04f, -1.833279501e-03f,
+  2.195637906e-03f, 1.821118058e-04f, 8.489712491e-05f, -1.928628888e-03f,
+  -1.150709977e-05f, -2.025033114e-03f, -2.122247824e-03f, -4.135773983e-03f,
+  6.804013625e-03f, 4.790487699e-03f, 4.693272989e-03f, 2.679747064e-03f,
+  4.596868996e-03f, 2.583342837e-03f, 2.486128127e-03f, 4.726022016e-04f,
+  4.501519259e-03f, 2.487993566e-03f, 2.390778856e-03f, 3.772527562e-04f,
+  2.294374630e-03f, 2.808485297e-04f, 1.836338633e-04f, -1.829892164e-03f,
+  4.407475702e-03f, 2.393949544e-03f, 2.296734834e-03f, 2.832089085e-04f,
+  2.200330608e-03f, 1.868046675e-04f, 8.958998660e-05f, -1.923936070e-03f,
+  2.104981337e-03f, 9.145524382e-05f, -5.759437954e-06f, -2.019285457e-03f,
+  -1.021636635e-04f, -2.115689684e-03f, -2.212904394e-03f, -4.226430319e-03f,
+  4.314993974e-03f, 2.301468048e-03f, 2.204253338e-03f, 1.907274127e-04f,
+  2.107849112e-03f, 9.432317893e-05f, -2.891505801e-06f, -2.016417449e-03f,
+  2.012499841e-03f, -1.026246082e-06f, -9.824093286e-05f, -2.111766953e-03f,
+  -1.946451521e-04f, -2.208171180e-03f, -2.305385889e-03f, -4.318912048e-03f,
+  1.918455935e-03f, -9.507011418e-05f, -1.922848023e-04f, -2.205810742e-03f,
+  -2.886890434e-04f, -2.302214969e-03f, -2.399429679e-03f, -4.412955604e-03f,
+  -3.840384597e-04f, -2.397564473e-03f, -2.494779183e-03f, -4.508305341e-03f,
+  -2.591183409e-03f, -4.604709335e-03f, -4.701924045e-03f, -6.715449970e-03f,
+  6.715449970e-03f, 4.701924045e-03f, 4.604709335e-03f, 2.591183409e-03f,
+  4.508305341e-03f, 2.494779183e-03f, 2.397564473e-03f, 3.840384597e-04f,
+  4.412955604e-03f, 2.399429679e-03f, 2.302214969e-03f, 2.886890434e-04f,
+  2.205810742e-03f, 1.922848023e-04f, 9.507011418e-05f, -1.918455935e-03f,
+  4.318912048e-03f, 2.305385889e-03f, 2.208171180e-03f, 1.946451521e-04f,
+  2.111766953e-03f, 9.824093286e-05f, 1.026246082e-06f, -2.012499841e-03f,
+  2.016417449e-03f, 2.891505801e-06f, -9.432317893e-05f, -2.107849112e-03f,
+  -1.907274127e-04f, -2.204253338e-03f, -2.301468048e-03f, -4.314993974e-03f,
+  4.226430319e-03f, 2.212904394e-03f, 2.115689684e-03f, 1.021636635e-04f,
+  2.019285457e-03f, 5.759437954e-06f, -9.145524382e-05f, -2.104981337e-03f,
+  1.923936070e-03f, -8.958998660e-05f, -1.868046675e-04f, -2.200330608e-03f,
+  -2.832089085e-04f, -2.296734834e-03f, -2.393949544e-03f, -4.407475702e-03f,
+  1.829892164e-03f, -1.836338633e-04f, -2.808485297e-04f, -2.294374630e-03f,
+  -3.772527562e-04f, -2.390778856e-03f, -2.487993566e-03f, -4.501519259e-03f,
+  -4.726022016e-04f, -2.486128127e-03f, -2.583342837e-03f, -4.596868996e-03f,
+  -2.679747064e-03f, -4.693272989e-03f, -4.790487699e-03f, -6.804013625e-03f,
+  4.135773983e-03f, 2.122247824e-03f, 2.025033114e-03f, 1.150709977e-05f,
+  1.928628888e-03f, -8.489712491e-05f, -1.821118058e-04f, -2.195637906e-03f,
+  1.833279501e-03f, -1.802465558e-04f, -2.774612512e-04f, -2.290987177e-03f,
+  -3.738654777e-04f, -2.387391403e-03f, -2.484606113e-03f, -4.498132039e-03f,
+  1.739235595e-03f, -2.742904180e-04f, -3.715050989e-04f, -2.385031199e-03f,
+  -4.679093254e-04f, -2.481435426e-03f, -2.578650136e-03f, -4.592176061e-03f,
+  -5.632587709e-04f, -2.576784696e-03f, -2.673999406e-03f, -4.687525332e-03f,
+  -2.770403633e-03f, -4.783929791e-03f, -4.881144501e-03f, -6.894670427e-03f,
+  1.646754099e-03f, -3.667719138e-04f, -4.639865947e-04f, -2.477512695e-03f,
+  -5.603908212e-04f, -2.573916921e-03f, -2.671131631e-03f, -4.684657324e-03f,
+  -6.557402667e-04f, -2.669266192e-03f, -2.766480902e-03f, -4.780007061e-03f,
+  -2.862885129e-03f, -4.876411054e-03f, -4.973625764e-03f, -6.987151690e-03f,
+  -7.497841143e-04f, -2.763310215e-03f, -2.860524924e-03f, -4.874050617e-03f,
+  -2.956929151e-03f, -4.970455077e-03f, -5.067669787e-03f, -7.081195712e-03f,
+  -3.052278422e-03f, -5.065804347e-03f, -5.163019057e-03f, -7.176544983e-03f,
+  -5.259423517e-03f, -7.272949442e-03f, -7.370164152e-03f, -9.383690543e-03f
+},
+{
+  1.209556963e-02f, 9.341130964e-03f, 9.257576428e-03f, 6.503138226e-03f,
+  9.176946245e-03f, 6.422507577e-03f, 6.338952575e-03f, 3.584514605e-03f,
+  9.099525400e-03f, 6.345087197e-03f, 6.261532195e-03f, 3.507093992e-03f,
+  6.180902012e-03f, 3.426463809e-03f, 3.342908807e-03f, 5.884706625e-04f,
+  9.025602601e-03f, 6.271164864e-03f, 6.187609863e-03f, 3.433171660e-03f,
+  6.106979214e-03f, 3.352541244e-03f, 3.268986242e-03f, 5.145482137e-04f,
+  6.029558834e-03f, 3.275120631e-03f, 3.191565629e-03f, 4.371276591e-04f,
+  3.110935446e-03f, 3.564973013e-04f, 2.729423286e-04f, -2.481495729e-03f,
+  8.955469355e-03f, 6.201031618e-03f, 6.117476616e-03f, 3.363038413e-03f,
+  6.036845967e-03f, 3.282407997e-03f, 3.198853228e-03f, 4.444150545e-04f,
+  5.959425587e-03f, 3.204987617e-03f, 3.121432615e-03f, 3.669944708e-04f,
+  3.040802199e-03f, 2.863641130e-04f, 2.028091258e-04f, -2.551628975e-03f,
+  5.885503255e-03f, 3.131065052e-03f, 3.047510050e-03f, 2.930720511e-04f,
+  2.966879867e-03f, 2.124416787e-04f, 1.288867061e-04f, -2.625551308e-03f,
+  2.889459254e-03f, 1.350210950e-04f, 5.146612602e-05f, -2.702971920e-03f,
+  -2.916423909e-05f, -2.783602336e-03f, -2.867157338e-03f, -5.621595308e-03f,
+  8.889419027e-03f, 6.134980824e-03f, 6.051425822e-03f, 3.296987852e-03f,
+  5.970795639e-03f, 3.216357436e-03f, 3.132802434e-03f, 3.783643479e-04f,
+  5.893374793e-03f, 3.138936823e-03f, 3.055381821e-03f, 3.009437642e-04f,
+  2.974751405e-03f, 2.203134063e-04f, 1.367584482e-04f, -2.617679536e-03f,
+  5.819452461e-03f, 3.065014491e-03f, 2.981459489e-03f, 2.270213445e-04f,
+  2.900829073e-03f, 1.463909866e-04f, 6.283602124e-05f, -2.691602102e-03f,
+  2.823408460e-03f, 6.897041021e-05f, -1.458456245e-05f, -2.769022714e-03f,
+  -9.521492757e-05f, -2.849652898e-03f, -2.933207899e-03f, -5.687646102e-03f,
+  5.749319214e-03f, 2.994881244e-03f, 2.911326243e-03f, 1.568881562e-04f,
+  2.830695827e-03f, 7.625779108e-05f, -7.297176126e-06f, -2.761735348e-03f,
+  2.753275214e-03f, -1.162786816e-06f, -8.471775800e-05f, -2.839155728e-03f,
+  -1.653481158e-04f, -2.919786144e-03f, -3.003341146e-03f, -5.757779349e-03f,
+  2.679352881e-03f, -7.508521230e-05f, -1.586401777e-04f, -2.913078293e-03f,
+  -2.392705501e-04f, -2.993708709e-03f, -3.077263711e-03f, -5.831701681e-03f,
+  -3.166911192e-04f, -3.071129089e-03f, -3.154684091e-03f, -5.909122061e-03f,
+  -3.235314507e-03f, -5.989752710e-03f, -6.073307712e-03f, -8.827745914e-03f,
+  8.827745914e-03f, 6.073307712e-03f, 5.989752710e-03f, 3.235314507e-03f,
+  5.909122061e-03f, 3.154684091e-03f, 3.071129089e-03f, 3.166911192e-04f,
+  5.831701681e-03f, 3.077263711e-03f, 2.993708709e-03f, 2.392705501e-04f,
+  2.913078293e-03f, 1.586401777e-04f, 7.508521230e-05f, -2.679352881e-03f,
+  5.757779349e-03f, 3.003341146e-03f, 2.919786144e-03f, 1.653481158e-04f,
+  2.839155728e-03f, 8.471775800e-05f, 1.162786816e-06f, -2.753275214e-03f,
+  2.761735348e-03f, 7.297176126e-06f, -7.625779108e-05f, -2.830695827e-03f,
+  -1.568881562e-04f, -2.911326243e-03f, -2.994881244e-03f, -5.749319214e-03f,
+  5.687646102e-03f, 2.933207899e-03f, 2.849652898e-03f, 9.521492757e-05f,
+  2.769022714e-03f, 1.458456245e-05f, -6.897041021e-05f, -2.823408460e-03f,
+  2.691602102e-03f, -6.283602124e-05f, -1.463909866e-04f, -2.900829073e-03f,
+  -2.270213445e-04f, -2.981459489e-03f, -3.065014491e-03f, -5.819452461e-03f,
+  2.617679536e-03f, -1.367584482e-04f, -2.203134063e-04f, -2.974751405e-03f,
+  -3.009437642e-04f, -3.055381821e-03f, -3.138936823e-03f, -5.893374793e-03f,
+  -3.783643479e-04f, -3.132802434e-03f, -3.216357436e-03f, -5.970795639e-03f,
+  -3.296987852e-03f, -6.051425822e-03f, -6.134980824e-03f, -8.889419027e-03f,
+  5.621595308e-03f, 2.867157338e-03f, 2.783602336e-03f, 2.916423909e-05f,
+  2.702971920e-03f, -5.146612602e-05f, -1.350210950e-04f, -2.889459254e-03f,
+  2.625551308e-03f, -1.288867061e-04f, -2.124416787e-04f, -2.966879867e-03f,
+  -2.930720511e-04f, -3.047510050e-03f, -3.131065052e-03f, -5.885503255e-03f,
+  2.551628975e-03f, -2.028091258e-04f, -2.863641130e-04f, -3.040802199e-03f,
+  -3.669944708e-04f, -3.121432615e-03f, -3.204987617e-03f, -5.959425587e-03f,
+  -4.444150545e-04f, -3.198853228e-03f, -3.282407997e-03f, -6.036845967e-03f,
+  -3.363038413e-03f, -6.117476616e-03f, -6.201031618e-03f, -8.955469355e-03f,
+  2.481495729e-03f, -2.729423286e-04f, -3.564973013e-04f, -3.110935446e-03f,
+  -4.371276591e-04f, -3.191565629e-03f, -3.275120631e-03f, -6.029558834e-03f,
+  -5.145482137e-04f, -3.268986242e-03f, -3.352541244e-03f, -6.106979214e-03f,
+  -3.433171660e-03f, -6.187609863e-03f, -6.271164864e-03f, -9.025602601e-03f,
+  -5.884706625e-04f, -3.342908807e-03f, -3.426463809e-03f, -6.180902012e-03f,
+  -3.507093992e-03f, -6.261532195e-03f, -6.345087197e-03f, -9.099525400e-03f,
+  -3.584514605e-03f, -6.338952575e-03f, -6.422507577e-03f, -9.176946245e-03f,
+  -6.503138226e-03f, -9.257576428e-03f, -9.341130964e-03f, -1.209556963e-02f
+},
+{
+  1.386990491e-02f, 1.054508239e-02f, 1.049305219e-02f, 7.168229204e-03f,
+  1.044629049e-02f, 7.121467032e-03f, 7.069437299e-03f, 3.744614311e-03f,
+  1.040509064e-02f, 7.080267649e-03f, 7.028237917e-03f, 3.703414928e-03f,
+  6.981475744e-03f, 3.656652290e-03f, 3.604623023e-03f, 2.797997440e-04f,
+  1.036974974e-02f, 7.044926286e-03f, 6.992897019e-03f, 3.668073565e-03f,
+  6.946134381e-03f, 3.621311160e-03f, 3.569281660e-03f, 2.444584679e-04f,
+  6.904934999e-03f, 3.580111777e-03f, 3.528082278e-03f, 2.032590855e-04f,
+  3.481319873e-03f, 1.564965933e-04f, 1.044671444e-04f, -3.220356070e-03f,
+  1.034055930e-02f, 7.015736308e-03f, 6.963707041e-03f, 3.638883820e-03f,
+  6.916944403e-03f, 3.592121182e-03f, 3.540091915e-03f, 2.152686211e-04f,
+  6.875745021e-03f, 3.550921800e-03f, 3.498892533e-03f, 1.740692242e-04f,
+  3.452129895e-03f, 1.273067319e-04f, 7.527728303e-05f, -3.249545814e-03f,
+  6.840403657e-03f, 3.515580669e-03f, 3.463551169e-03f, 1.387279626e-04f,
+  3.416788764e-03f, 9.196546307e-05f, 3.993602149e-05f, -3.284887178e-03f,
+  3.375589382e-03f, 5.076607340e-05f, -1.263370450e-06f, -3.326086560e-03f,
+  -4.802586773e-05f, -3.372848965e-03f, -3.424878465e-03f, -6.749701686e-03f,
+  1.031781174e-02f, 6.992988754e-03f, 6.940959487e-03f, 3.616136266e-03f,
+  6.894196849e-03f, 3.569373861e-03f, 3.517344361e-03f, 1.925210963e-04f,
+  6.852997467e-03f, 3.528174479e-03f, 3.476144979e-03f, 1.513217139e-04f,
+  3.429382341e-03f, 1.045592144e-04f, 5.252976916e-05f, -3.272293368e-03f,
+  6.817656104e-03f, 3.492833115e-03f, 3.440803615e-03f, 1.159804451e-04f,
+  3.394041210e-03f, 6.921794557e-05f, 1.718850399e-05f, -3.307634732e-03f,
+  3.352841828e-03f, 2.801855589e-05f, -2.401088750e-05f, -3.348834114e-03f,
+  -7.077338523e-05f, -3.395596519e-03f, -3.447626019e-03f, -6.772449240e-03f,
+  6.788466591e-03f, 3.463643137e-03f, 3.411613870e-03f, 8.679058374e-05f,
+  3.364851233e-03f, 4.002808782e-05f, -1.200135466e-05f, -3.336824477e-03f,
+  3.323651850e-03f, -1.171301960e-06f, -5.320074706e-05f, -3.378023859e-03f,
+  -9.996323934e-05f, -3.424786497e-03f, -3.476815997e-03f, -6.801639218e-03f,
+  3.288310720e-03f, -3.651256702e-05f, -8.854200860e-05f, -3.413365223e-03f,
+  -1.353045081e-04f, -3.460127627e-03f, -3.512157127e-03f, -6.836980581e-03f,
+  -1.765039051e-04f, -3.501327010e-03f, -3.553356510e-03f, -6.878179964e-03f,
+  -3.600119147e-03f, -6.924942136e-03f, -6.976971868e-03f, -1.030179486e-02f,
+  1.030179486e-02f, 6.976971868e-03f, 6.924942136e-03f, 3.600119147e-03f,
+  6.878179964e-03f, 3.553356510e-03f, 3.501327010e-03f, 1.765039051e-04f,
+  6.836980581e-03f, 3.512157127e-03f, 3.460127627e-03f, 1.353045081e-04f,
+  3.413365223e-03f, 8.854200860e-05f, 3.651256702e-05f, -3.288310720e-03f,
+  6.801639218e-03f, 3.476815997e-03f, 3.424786497e-03f, 9.996323934e-05f,
+  3.378023859e-03f, 5.320074706e-05f, 1.171301960e-06f, -3.323651850e-03f,
+  3.336824477e-03f, 1.200135466e-05f, -4.002808782e-05f, -3.364851233e-03f,
+  -8.679058374e-05f, -3.411613870e-03f, -3.463643137e-03f, -6.788466591e-03f,
+  6.772449240e-03f, 3.447626019e-03f, 3.395596519e-03f, 7.077338523e-05f,
+  3.348834114e-03f, 2.401088750e-05f, -2.801855589e-05f, -3.352841828e-03f,
+  3.307634732e-03f, -1.718850399e-05f, -6.921794557e-05f, -3.394041210e-03f,
+  -1.159804451e-04f, -3.440803615e-03f, -3.492833115e-03f, -6.817656104e-03f,
+  3.272293368e-03f, -5.252976916e-05f, -1.045592144e-04f, -3.429382341e-03f,
+  -1.513217139e-04f, -3.476144979e-03f, -3.528174479e-03f, -6.852997467e-03f,
+  -1.925210963e-04f, -3.517344361e-03f, -3.569373861e-03f, -6.894196849e-03f,
+  -3.616136266e-03f, -6.940959487e-03f, -6.992988754e-03f, -1.031781174e-02f,
+  6.749701686e-03f, 3.424878465e-03f, 3.372848965e-03f, 4.802586773e-05f,
+  3.326086560e-03f, 1.263370450e-06f, -5.076607340e-05f, -3.375589382e-03f,
+  3.284887178e-03f, -3.993602149e-05f, -9.196546307e-05f, -3.416788764e-03f,
+  -1.387279626e-04f, -3.463551169e-03f, -3.515580669e-03f, -6.840403657e-03f,
+  3.249545814e-03f, -7.527728303e-05f, -1.273067319e-04f, -3.452129895e-03f,
+  -1.740692242e-04f, -3.498892533e-03f, -3.550921800e-03f, -6.875745021e-03f,
+  -2.152686211e-04f, -3.540091915e-03f, -3.592121182e-03f, -6.916944403e-03f,
+  -3.638883820e-03f, -6.963707041e-03f, -7.015736308e-03f, -1.034055930e-02f,
+  3.220356070e-03f, -1.044671444e-04f, -1.564965933e-04f, -3.481319873e-03f,
+  -2.032590855e-04f, -3.528082278e-03f, -3.580111777e-03f, -6.904934999e-03f,
+  -2.444584679e-04f, -3.569281660e-03f, -3.621311160e-03f, -6.946134381e-03f,
+  -3.668073565e-03f, -6.992897019e-03f, -7.044926286e-03f, -1.036974974e-02f,
+  -2.797997440e-04f, -3.604623023e-03f, -3.656652290e-03f, -6.981475744e-03f,
+  -3.703414928e-03f, -7.028237917e-03f, -7.080267649e-03f, -1.040509064e-02f,
+  -3.744614311e-03f, -7.069437299e-03f, -7.121467032e-03f, -1.044629049e-02f,
+  -7.168229204e-03f, -1.049305219e-02f, -1.054508239e-02f, -1.386990491e-02f
+},
+{
+  1.411112864e-02f, 1.053401548e-02f, 1.053230744e-02f, 6.955194753e-03f,
+  1.053817011e-02f, 6.961057428e-03f, 6.959349848e-03f, 3.382236930e-03f,
+  1.055187266e-02f, 6.974759977e-03f, 6.973052397e-03f, 3.395939711e-03f,
+  6.978915073e-03f, 3.401802154e-03f, 3.400094574e-03f, -1.770183299e-04f,
+  1.057367958e-02f, 6.996566430e-03f, 6.994858850e-03f, 3.417745931e-03f,
+  7.000721525e-03f, 3.423608607e-03f, 3.421901027e-03f, -1.552119356e-04f,
+  7.014424074e-03f, 3.437311156e-03f, 3.435603576e-03f, -1.415093138e-04f,
+  3.441466251e-03f, -1.356467401e-04f, -1.373543637e-04f, -3.714467166e-03f,
+  1.060384698e-02f, 7.026733831e-03f, 7.025026251e-03f, 3.447913099e-03f,
+  7.030888461e-03f, 3.453775775e-03f, 3.452068195e-03f, -1.250447967e-04f,
+  7.044591010e-03f, 3.467478324e-03f, 3.465770744e-03f, -1.113421677e-04f,
+  3.471633187e-03f, -1.054795939e-04f, -1.071872248e-04f, -3.684299998e-03f,
+  7.066397462e-03f, 3.489284776e-03f, 3.487577196e-03f, -8.953577344e-05f,
+  3.493439639e-03f, -8.367319970e-05f, -8.538082329e-05f, -3.662493778e-03f,
+  3.507142421e-03f, -6.997057790e-05f, -7.167820149e-05f, -3.648790997e-03f,
+  -6.581562775e-05f, -3.642928554e-03f, -3.644636134e-03f, -7.221749052e-03f,
+  1.064262446e-02f, 7.065511309e-03f, 7.063803263e-03f, 3.486690577e-03f,
+  7.069665939e-03f, 3.492553253e-03f, 3.490845440e-03f, -8.626733324e-05f,
+  7.083368488e-03f, 3.506255802e-03f, 3.504548222e-03f, -7.256471145e-05f,
+  3.510410665e-03f, -6.670213043e-05f, -6.840976130e-05f, -3.645522753e-03f,
+  7.105174940e-03f, 3.528062254e-03f, 3.526354674e-03f, -5.075831359e-05f,
+  3.532217117e-03f, -4.489573621e-05f, -4.660336344e-05f, -3.623716300e-03f,
+  3.545919666e-03f, -3.119311441e-05f, -3.290074164e-05f, -3.610013518e-03f,
+  -2.703816608e-05f, -3.604151076e-03f, -3.605858656e-03f, -7.182971574e-03f,
+  7.135342341e-03f, 3.558229422e-03f, 3.556521609e-03f, -2.059117287e-05f,
+  3.562384285e-03f, -1.472859822e-05f, -1.643622454e-05f, -3.593549132e-03f,
+  3.576086834e-03f, -1.025975962e-06f, -2.733602287e-06f, -3.579846583e-03f,
+  3.128973276e-06f, -3.573983908e-03f, -3.575691488e-03f, -7.152804639e-03f,
+  3.597893286e-03f, 2.078041871e-05f, 1.907279329e-05f, -3.558040131e-03f,
+  2.493536886e-05f, -3.552177455e-03f, -3.553885035e-03f, -7.130998187e-03f,
+  3.863799066e-05f, -3.538474906e-03f, -3.540182486e-03f, -7.117295638e-03f,
+  -3.534320043e-03f, -7.111432962e-03f, -7.113140542e-03f, -1.069025323e-02f,
+  1.069025323e-02f, 7.113140542e-03f, 7.111432962e-03f, 3.534320043e-03f,
+  7.117295638e-03f, 3.540182486e-03f, 3.538474906e-03f, -3.863799066e-05f,
+  7.130998187e-03f, 3.553885035e-03f, 3.552177455e-03f, -2.493536886e-05f,
+  3.558040131e-03f, -1.907279329e-05f, -2.078041871e-05f, -3.597893286e-03f,
+  7.152804639e-03f, 3.575691488e-03f, 3.573983908e-03f, -3.128973276e-06f,
+  3.579846583e-03f, 2.733602287e-06f, 1.025975962e-06f, -3.576086834e-03f,
+  3.593549132e-03f, 1.643622454e-05f, 1.472859822e-05f, -3.562384285e-03f,
+  2.059117287e-05f, -3.556521609e-03f, -3.558229422e-03f, -7.135342341e-03f,
+  7.182971574e-03f, 3.605858656e-03f, 3.604151076e-03f, 2.703816608e-05f,
+  3.610013518e-03f, 3.290074164e-05f, 3.119311441e-05f, -3.545919666e-03f,
+  3.623716300e-03f, 4.660336344e-05f, 4.489573621e-05f, -3.532217117e-03f,
+  5.075831359e-05f, -3.526354674e-03f, -3.528062254e-03f, -7.105174940e-03f,
+  3.645522753e-03f, 6.840976130e-05f, 6.670213043e-05f, -3.510410665e-03f,
+  7.256471145e-05f, -3.504548222e-03f, -3.506255802e-03f, -7.083368488e-03f,
+  8.626733324e-05f, -3.490845440e-03f, -3.492553253e-03f, -7.069665939e-03f,
+  -3.486690577e-03f, -7.063803263e-03f, -7.065511309e-03f, -1.064262446e-02f,
+  7.221749052e-03f, 3.644636134e-03f, 3.642928554e-03f, 6.581562775e-05f,
+  3.648790997e-03f, 7.167820149e-05f, 6.997057790e-05f, -3.507142421e-03f,
+  3.662493778e-03f, 8.538082329e-05f, 8.367319970e-05f, -3.493439639e-03f,
+  8.953577344e-05f, -3.487577196e-03f, -3.489284776e-03f, -7.066397462e-03f,
+  3.684299998e-03f, 1.071872248e-04f, 1.054795939e-04f, -3.471633187e-03f,
+  1.113421677e-04f, -3.465770744e-03f, -3.467478324e-03f, -7.044591010e-03f,
+  1.250447967e-04f, -3.452068195e-03f, -3.453775775e-03f, -7.030888461e-03f,
+  -3.447913099e-03f, -7.025026251e-03f, -7.026733831e-03f, -1.060384698e-02f,
+  3.714467166e-03f, 1.373543637e-04f, 1.356467401e-04f, -3.441466251e-03f,
+  1.415093138e-04f, -3.435603576e-03f, -3.437311156e-03f, -7.014424074e-03f,
+  1.552119356e-04f, -3.421901027e-03f, -3.423608607e-03f, -7.000721525e-03f,
+  -3.417745931e-03f, -6.994858850e-03f, -6.996566430e-03f, -1.057367958e-02f,
+  1.770183299e-04f, -3.400094574e-03f, -3.401802154e-03f, -6.978915073e-03f,
+  -3.395939711e-03f, -6.973052397e-03f, -6.974759977e-03f, -1.055187266e-02f,
+  -3.382236930e-03f, -6.959349848e-03f, -6.961057428e-03f, -1.053817011e-02f,
+  -6.955194753e-03f, -1.053230744e-02f, -1.053401548e-02f, -1.411112864e-02f
+},
+{
+  1.225891430e-02f, 8.894753642e-03f, 8.960776031e-03f, 5.596614908e-03f,
+  9.036320262e-03f, 5.672159605e-03f, 5.738181993e-03f, 2.374021336e-03f,
+  9.121590294e-03f, 5.757429637e-03f, 5.823452026e-03f, 2.459291369e-03f,
+  5.898996722e-03f, 2.534836065e-03f, 2.600858454e-03f, -7.633023779e-04f,
+  9.216777980e-03f, 5.852617323e-03f, 5.918639712e-03f, 2.554478822e-03f,
+  5.994184408e-03f, 2.630023519e-03f, 2.696046140e-03f, -6.681148079e-04f,
+  6.079454441e-03f, 2.715293551e-03f, 2.781315940e-03f, -5.828448338e-04f,
+  2.856860636e-03f, -5.073001375e-04f, -4.412776325e-04f, -3.805438522e-03f,
+  9.322063066e-03f, 5.957902875e-03f, 6.023925263e-03f, 2.659764374e-03f,
+  6.099469960e-03f, 2.735309070e-03f, 2.801331459e-03f, -5.628293729e-04f,
+  6.184739992e-03f, 2.820579102e-03f, 2.886601491e-03f, -4.775593407e-04f,
+  2.962146187e-03f, -4.020147026e-04f, -3.359921684e-04f, -3.700152971e-03f,
+  6.279927213e-03f, 2.915766556e-03f, 2.981788944e-03f, -3.823718289e-04f,
+  3.057333641e-03f, -3.068271617e-04f, -2.408046566e-04f, -3.604965517e-03f,
+  3.142603673e-03f, -2.215571585e-04f, -1.555346389e-04f, -3.519695485e-03f,
+  -7.998997899e-05f, -3.444150789e-03f, -3.378128400e-03f, -6.742289290e-03f,
+  9.437615052e-03f, 6.073454395e-03f, 6.139476784e-03f, 2.775315894e-03f,
+  6.215021480e-03f, 2.850860590e-03f, 2.916883212e-03f, -4.472777655e-04f,
+  6.300291512e-03f, 2.936130622e-03f, 3.002153011e-03f, -3.620077332e-04f,
+  3.077697707e-03f, -2.864630951e-04f, -2.204405610e-04f, -3.584601451e-03f,
+  6.395479199e-03f, 3.031318076e-03f, 3.097340697e-03f, -2.668202214e-04f,
+  3.172885394e-03f, -1.912755688e-04f, -1.252530492e-04f, -3.489413997e-03f,
+  3.258155426e-03f, -1.060055438e-04f, -3.998302782e-05f, -3.404143965e-03f,
+  3.556162847e-05f, -3.328599269e-03f, -3.262576647e-03f, -6.626737770e-03f,
+  6.500764284e-03f, 3.136603627e-03f, 3.202626016e-03f, -1.615347574e-04f,
+  3.278170712e-03f, -8.599009743e-05f, -1.996757965e-05f, -3.384128446e-03f,
+  3.363440745e-03f, -7.200810614e-07f, 6.530243991e-05f, -3.298858413e-03f,
+  1.408470998e-04f, -3.223313717e-03f, -3.157291329e-03f, -6.521452218e-03f,
+  3.458628198e-03f, 9.446743934e-05f, 1.604899589e-04f, -3.203670960e-03f,
+  2.360346116e-04f, -3.128126264e-03f, -3.062103642e-03f, -6.426264532e-03f,
+  3.213046293e-04f, -3.042856231e-03f, -2.976833610e-03f, -6.340994500e-03f,
+  -2.901289146e-03f, -6.265449803e-03f, -6.199427415e-03f, -9.563588537e-03f,
+  9.563588537e-03f, 6.199427415e-03f, 6.265449803e-03f, 2.901289146e-03f,
+  6.340994500e-03f, 2.976833610e-03f, 3.042856231e-03f, -3.213046293e-04f,
+  6.426264532e-03f, 3.062103642e-03f, 3.128126264e-03f, -2.360346116e-04f,
+  3.203670960e-03f, -1.604899589e-04f, -9.446743934e-05f, -3.458628198e-03f,
+  6.521452218e-03f, 3.157291329e-03f, 3.223313717e-03f, -1.408470998e-04f,
+  3.298858413e-03f, -6.530243991e-05f, 7.200810614e-07f, -3.363440745e-03f,
+  3.384128446e-03f, 1.996757965e-05f, 8.599009743e-05f, -3.278170712e-03f,
+  1.615347574e-04f, -3.202626016e-03f, -3.136603627e-03f, -6.500764284e-03f,
+  6.626737770e-03f, 3.262576647e-03f, 3.328599269e-03f, -3.556162847e-05f,
+  3.404143965e-03f, 3.998302782e-05f, 1.060055438e-04f, -3.258155426e-03f,
+  3.489413997e-03f, 1.252530492e-04f, 1.912755688e-04f, -3.172885394e-03f,
+  2.668202214e-04f, -3.097340697e-03f, -3.031318076e-03f, -6.395479199e-03f,
+  3.584601451e-03f, 2.204405610e-04f, 2.864630951e-04f, -3.077697707e-03f,
+  3.620077332e-04f, -3.002153011e-03f, -2.936130622e-03f, -6.300291512e-03f,
+  4.472777655e-04f, -2.916883212e-03f, -2.850860590e-03f, -6.215021480e-03f,
+  -2.775315894e-03f, -6.139476784e-03f, -6.073454395e-03f, -9.437615052e-03f,
+  6.742289290e-03f, 3.378128400e-03f, 3.444150789e-03f, 7.998997899e-05f,
+  3.519695485e-03f, 1.555346389e-04f, 2.215571585e-04f, -3.142603673e-03f,
+  3.604965517e-03f, 2.408046566e-04f, 3.068271617e-04f, -3.057333641e-03f,
+  3.823718289e-04f, -2.981788944e-03f, -2.915766556e-03f, -6.279927213e-03f,
+  3.700152971e-03f, 3.359921684e-04f, 4.020147026e-04f, -2.962146187e-03f,
+  4.775593407e-04f, -2.886601491e-03f, -2.820579102e-03f, -6.184739992e-03f,
+  5.628293729e-04f, -2.801331459e-03f, -2.735309070e-03f, -6.099469960e-03f,
+  -2.659764374e-03f, -6.023925263e-03f, -5.957902875e-03f, -9.322063066e-03f,
+  3.805438522e-03f, 4.412776325e-04f, 5.073001375e-04f, -2.856860636e-03f,
+  5.828448338e-04f, -2.781315940e-03f, -2.715293551e-03f, -6.079454441e-03f,
+  6.681148079e-04f, -2.696046140e-03f, -2.630023519e-03f, -5.994184408e-03f,
+  -2.554478822e-03f, -5.918639712e-03f, -5.852617323e-03f, -9.216777980e-03f,
+  7.633023779e-04f, -2.600858454e-03f, -2.534836065e-03f, -5.898996722e-03f,
+  -2.459291369e-03f, -5.823452026e-03f, -5.757429637e-03f, -9.121590294e-03f,
+  -2.374021336e-03f, -5.738181993e-03f, -5.672159605e-03f, -9.036320262e-03f,
+  -5.596614908e-03f, -8.960776031e-03f, -8.894753642e-03f, -1.225891430e-02f
+},
+{
+  7.868383080e-03f, 5.309593864e-03f, 5.456821993e-03f, 2.898032777e-03f,
+  5.614855792e-03f, 3.056066576e-03f, 3.203294938e-03f, 6.445056642e-04f,
+  5.783793982e-03f, 3.225004766e-03f, 3.372233128e-03f, 8.134437376e-04f,
+  3.530266695e-03f, 9.714775370e-04f, 1.118705841e-03f, -1.440083375e-03f,
+  5.963719916e-03f, 3.404930700e-03f, 3.552159062e-03f, 9.933697293e-04f,
+  3.710192628e-03f, 1.151403412e-03f, 1.298631774e-03f, -1.260157442e-03f,
+  3.879130818e-03f, 1.320341602e-03f, 1.467569848e-03f, -1.091219368e-03f,
+  1.625603647e-03f, -9.331855690e-04f, -7.859572652e-04f, -3.344746539e-03f,
+  6.154701579e-03f, 3.595912131e-03f, 3.743140493e-03f, 1.184351277e-03f,
+  3.901174292e-03f, 1.342384960e-03f, 1.489613322e-03f, -1.069175894e-03f,
+  4.070112482e-03f, 1.511323033e-03f, 1.658551395e-03f, -9.002378210e-04f,
+  1.816585194e-03f, -7.422040799e-04f, -5.949757178e-04f, -3.153764876e-03f,
+  4.250038415e-03f, 1.691249083e-03f, 1.838477328e-03f, -7.203118876e-04f,
+  1.996511128e-03f, -5.622781464e-04f, -4.150497844e-04f, -2.973838942e-03f,
+  2.165449318e-03f, -3.933400440e-04f, -2.461116819e-04f, -2.804900985e-03f,
+  -8.807789709e-05f, -2.646867186e-03f, -2.499638824e-03f, -5.058428273e-03f,
+  6.356790196e-03f, 3.798000747e-03f, 3.945229109e-03f, 1.386439893e-03f,
+  4.103262909e-03f, 1.544473693e-03f, 1.691702055e-03f, -8.670872194e-04f,
+  4.272201099e-03f, 1.713411766e-03f, 1.860640128e-03f, -6.981491460e-04f,
+  2.018674044e-03f, -5.401153467e-04f, -3.928869846e-04f, -2.951676259e-03f,
+  4.452127032e-03f, 1.893337700e-03f, 2.040566178e-03f, -5.182232126e-04f,
+  2.198599977e-03f, -3.601894132e-04f, -2.129610657e-04f, -2.771750325e-03f,
+  2.367537934e-03f, -1.912513253e-04f, -4.402297418e-05f, -2.602812136e-03f,
+  1.140108070e-04f, -2.444778569e-03f, -2.297550207e-03f, -4.856339190e-03f,
+  4.643108696e-03f, 2.084319247e-03f, 2.231547609e-03f, -3.272416652e-04f,
+  2.389581408e-03f, -1.692078658e-04f, -2.197952199e-05f, -2.580768894e-03f,
+  2.558519598e-03f, -2.697825323e-07f, 1.469585695e-04f, -2.411830705e-03f,
+  3.049923398e-04f, -2.253796905e-03f, -2.106568543e-03f, -4.665357992e-03f,
+  2.738445532e-03f, 1.796561555e-04f, 3.268845030e-04f, -2.231904771e-03f,
+  4.849182733e-04f, -2.073870972e-03f, -1.926642610e-03f, -4.485432059e-03f,
+  6.538563757e-04f, -1.904932898e-03f, -1.757704536e-03f, -4.316493869e-03f,
+  -1.599670737e-03f, -4.158460069e-03f, -4.011231475e-03f, -6.570021156e-03f,
+  6.570021156e-03f, 4.011231475e-03f, 4.158460069e-03f, 1.599670737e-03f,
+  4.316493869e-03f, 1.757704536e-03f, 1.904932898e-03f, -6.538563757e-04f,
+  4.485432059e-03f, 1.926642610e-03f, 2.073870972e-03f, -4.849182733e-04f,
+  2.231904771e-03f, -3.268845030e-04f, -1.796561555e-04f, -2.738445532e-03f,
+  4.665357992e-03f, 2.106568543e-03f, 2.253796905e-03f, -3.049923398e-04f,
+  2.411830705e-03f, -1.469585695e-04f, 2.697825323e-07f, -2.558519598e-03f,
+  2.580768894e-03f, 2.197952199e-05f, 1.692078658e-04f, -2.389581408e-03f,
+  3.272416652e-04f, -2.231547609e-03f, -2.084319247e-03f, -4.643108696e-03f,
+  4.856339190e-03f, 2.297550207e-03f, 2.444778569e-03f, -1.140108070e-04f,
+  2.602812136e-03f, 4.402297418e-05f, 1.912513253e-04f, -2.367537934e-03f,
+  2.771750325e-03f, 2.129610657e-04f, 3.601894132e-04f, -2.198599977e-03f,
+  5.182232126e-04f, -2.040566178e-03f, -1.893337700e-03f, -4.452127032e-03f,
+  2.951676259e-03f, 3.928869846e-04f, 5.401153467e-04f, -2.018674044e-03f,
+  6.981491460e-04f, -1.860640128e-03f, -1.713411766e-03f, -4.272201099e-03f,
+  8.670872194e-04f, -1.691702055e-03f, -1.544473693e-03f, -4.103262909e-03f,
+  -1.386439893e-03f, -3.945229109e-03f, -3.798000747e-03f, -6.356790196e-03f,
+  5.058428273e-03f, 2.499638824e-03f, 2.646867186e-03f, 8.807789709e-05f,
+  2.804900985e-03f, 2.461116819e-04f, 3.933400440e-04f, -2.165449318e-03f,
+  2.973838942e-03f, 4.150497844e-04f, 5.622781464e-04f, -1.996511128e-03f,
+  7.203118876e-04f, -1.838477328e-03f, -1.691249083e-03f, -4.250038415e-03f,
+  3.153764876e-03f, 5.949757178e-04f, 7.422040799e-04f, -1.816585194e-03f,
+  9.002378210e-04f, -1.658551395e-03f, -1.511323033e-03f, -4.070112482e-03f,
+  1.069175894e-03f, -1.489613322e-03f, -1.342384960e-03f, -3.901174292e-03f,
+  -1.184351277e-03f, -3.743140493e-03f, -3.595912131e-03f, -6.154701579e-03f,
+  3.344746539e-03f, 7.859572652e-04f, 9.331855690e-04f, -1.625603647e-03f,
+  1.091219368e-03f, -1.467569848e-03f, -1.320341602e-03f, -3.879130818e-03f,
+  1.260157442e-03f, -1.298631774e-03f, -1.151403412e-03f, -3.710192628e-03f,
+  -9.933697293e-04f, -3.552159062e-03f, -3.404930700e-03f, -5.963719916e-03f,
+  1.440083375e-03f, -1.118705841e-03f, -9.714775370e-04f, -3.530266695e-03f,
+  -8.134437376e-04f, -3.372233128e-03f, -3.225004766e-03f, -5.783793982e-03f,
+  -6.445056642e-04f, -3.203294938e-03f, -3.056066576e-03f, -5.614855792e-03f,
+  -2.898032777e-03f, -5.456821993e-03f, -5.309593864e-03f, -7.868383080e-03f
+},
+{
+  6.878519198e-04f, -3.861191217e-04f, -1.505672408e-04f, -1.224538311e-03f,
+  9.612866415e-05f, -9.778423700e-04f, -7.422904600e-04f, -1.816261443e-03f,
+  3.539338359e-04f, -7.200372056e-04f, -4.844853247e-04f, -1.558456337e-03f,
+  -2.377894125e-04f, -1.311760396e-03f, -1.076208544e-03f, -2.150179585e-03f,
+  6.227953709e-04f, -4.511756415e-04f, -2.156237606e-04f, -1.289594802e-03f,
+  3.107214070e-05f, -1.042898861e-03f, -8.073470090e-04f, -1.881318050e-03f,
+  2.888773161e-04f, -7.850936963e-04f, -5.495418445e-04f, -1.623512828e-03f,
+  -3.028459323e-04f, -1.376817003e-03f, -1.141265035e-03f, -2.215236193e-03f,
+  9.026420885e-04f, -1.713289093e-04f, 6.422297156e-05f, -1.009748084e-03f,
+  3.109188692e-04f, -7.630521432e-04f, -5.275002914e-04f, -1.601471333e-03f,
+  5.687240628e-04f, -5.052469787e-04f, -2.696950978e-04f, -1.343666110e-03f,
+  -2.299920197e-05f, -1.096970169e-03f, -8.614183171e-04f, -1.935389359e-03f,
+  8.375855978e-04f, -2.363854292e-04f, -8.335481994e-07f, -1.074804575e-03f,
+  2.458623494e-04f, -8.281086921e-04f, -5.925567821e-04f, -1.666527824e-03f,
+  5.036675138e-04f, -5.703035276e-04f, -3.347516176e-04f, -1.408722601e-03f,
+  -8.805571997e-05f, -1.162026776e-03f, -9.264748660e-04f, -2.000445966e-03f,
+  1.193384291e-03f, 1.194132637e-04f, 3.549651592e-04f, -7.190058823e-04f,
+  6.016610423e-04f, -4.723099701e-04f, -2.367580892e-04f, -1.310729072e-03f,
+  8.594662067e-04f, -2.145048202e-04f, 2.104707346e-05f, -1.052923966e-03f,
+  2.677429875e-04f, -8.062280249e-04f, -5.706761731e-04f, -1.644647215e-03f,
+  1.128327800e-03f, 5.435674029e-05f, 2.899086394e-04f, -7.840623730e-04f,
+  5.366045516e-04f, -5.373664899e-04f, -3.018146090e-04f, -1.375785680e-03f,
+  7.944097160e-04f, -2.795613254e-04f, -4.400944817e-05f, -1.117980457e-03f,
+  2.026864531e-04f, -8.712845738e-04f, -6.357326638e-04f, -1.709703705e-03f,
+  1.408174518e-03f, 3.342034761e-04f, 5.697553861e-04f, -5.042156554e-04f,
+  8.164512692e-04f, -2.575197723e-04f, -2.196788046e-05f, -1.095938962e-03f,
+  1.074256375e-03f, 2.853958563e-07f, 2.358372876e-04f, -8.381337393e-04f,
+  4.825331853e-04f, -5.914378562e-04f, -3.558859462e-04f, -1.429856988e-03f,
+  1.343118027e-03f, 2.691469563e-04f, 5.046988372e-04f, -5.692722043e-04f,
+  7.513947203e-04f, -3.225762921e-04f, -8.702440391e-05f, -1.160995453e-03f,
+  1.009199885e-03f, -6.477112765e-05f, 1.707807678e-04f, -9.031902882e-04f,
+  4.174766655e-04f, -6.564943469e-04f, -4.209424660e-04f, -1.494913478e-03f,
+  1.494913478e-03f, 4.209424660e-04f, 6.564943469e-04f, -4.174766655e-04f,
+  9.031902882e-04f, -1.707807678e-04f, 6.477112765e-05f, -1.009199885e-03f,
+  1.160995453e-03f, 8.702440391e-05f, 3.225762921e-04f, -7.513947203e-04f,
+  5.692722043e-04f, -5.046988372e-04f, -2.691469563e-04f, -1.343118027e-03f,
+  1.429856988e-03f, 3.558859462e-04f, 5.914378562e-04f, -4.825331853e-04f,
+  8.381337393e-04f, -2.358372876e-04f, -2.853958563e-07f, -1.074256375e-03f,
+  1.095938962e-03f, 2.196788046e-05f, 2.575197723e-04f, -8.164512692e-04f,
+  5.042156554e-04f, -5.697553861e-04f, -3.342034761e-04f, -1.408174518e-03f,
+  1.709703705e-03f, 6.357326638e-04f, 8.712845738e-04f, -2.026864531e-04f,
+  1.117980457e-03f, 4.400944817e-05f, 2.795613254e-04f, -7.944097160e-04f,
+  1.375785680e-03f, 3.018146090e-04f, 5.373664899e-04f, -5.366045516e-04f,
+  7.840623730e-04f, -2.899086394e-04f, -5.435674029e-05f, -1.128327800e-03f,
+  1.644647215e-03f, 5.706761731e-04f, 8.062280249e-04f, -2.677429875e-04f,
+  1.052923966e-03f, -2.104707346e-05f, 2.145048202e-04f, -8.594662067e-04f,
+  1.310729072e-03f, 2.367580892e-04f, 4.723099701e-04f, -6.016610423e-04f,
+  7.190058823e-04f, -3.549651592e-04f, -1.194132637e-04f, -1.193384291e-03f,
+  2.000445966e-03f, 9.264748660e-04f, 1.162026776e-03f, 8.805571997e-05f,
+  1.408722601e-03f, 3.347516176e-04f, 5.703035276e-04f, -5.036675138e-04f,
+  1.666527824e-03f, 5.925567821e-04f, 8.281086921e-04f, -2.458623494e-04f,
+  1.074804575e-03f, 8.335481994e-07f, 2.363854292e-04f, -8.375855978e-04f,
+  1.935389359e-03f, 8.614183171e-04f, 1.096970169e-03f, 2.299920197e-05f,
+  1.343666110e-03f, 2.696950978e-04f, 5.052469787e-04f, -5.687240628e-04f,
+  1.601471333e-03f, 5.275002914e-04f, 7.630521432e-04f, -3.109188692e-04f,
+  1.009748084e-03f, -6.422297156e-05f, 1.713289093e-04f, -9.026420885e-04f,
+  2.215236193e-03f, 1.141265035e-03f, 1.376817003e-03f, 3.028459323e-04f,
+  1.623512828e-03f, 5.495418445e-04f, 7.850936963e-04f, -2.888773161e-04f,
+  1.881318050e-03f, 8.073470090e-04f, 1.042898861e-03f, -3.107214070e-05f,
+  1.289594802e-03f, 2.156237606e-04f, 4.511756415e-04f, -6.227953709e-04f,
+  2.150179585e-03f, 1.076208544e-03f, 1.311760396e-03f, 2.377894125e-04f,
+  1.558456337e-03f, 4.844853247e-04f, 7.200372056e-04f, -3.539338359e-04f,
+  1.816261443e-03f, 7.422904600e-04f, 9.778423700e-04f, -9.612866415e-05f,
+  1.224538311e-03f, 1.505672408e-04f, 3.861191217e-04f, -6.878519198e-04f
+},
+{
+  -9.277648292e-03f, -8.158397861e-03f, -7.835694589e-03f, -6.716444157e-03f,
+  -7.502642926e-03f, -6.383392029e-03f, -6.060689222e-03f, -4.941438790e-03f,
+  -7.159426343e-03f, -6.040175445e-03f, -5.717472639e-03f, -4.598221742e-03f,
+  -5.384420976e-03f, -4.265170079e-03f, -3.942467272e-03f, -2.823216608e-03f,
+  -6.806247402e-03f, -5.686996505e-03f, -5.364293698e-03f, -4.245042801e-03f,
+  -5.031242035e-03f, -3.911991138e-03f, -3.589288332e-03f, -2.470037667e-03f,
+  -4.688024987e-03f, -3.568774555e-03f, -3.246071748e-03f, -2.126820851e-03f,
+  -2.913019853e-03f, -1.793769188e-03f, -1.471066382e-03f, -3.518156882e-04f,
+  -6.443327293e-03f, -5.324076861e-03f, -5.001374055e-03f, -3.882123390e-03f,
+  -4.668322392e-03f, -3.549071494e-03f, -3.226368688e-03f, -2.107118024e-03f,
+  -4.325105343e-03f, -3.205854911e-03f, -2.883151872e-03f, -1.763901324e-03f,
+  -2.550100209e-03f, -1.430849545e-03f, -1.108146738e-03f, 1.110398080e-05f,
+  -3.971926402e-03f, -2.852675971e-03f, -2.529972931e-03f, -1.410722267e-03f,
+  -2.196921268e-03f, -1.077670604e-03f, -7.549677393e-04f, 3.642829543e-04f,
+  -1.853704569e-03f, -7.344538462e-04f, -4.117509816e-04f, 7.074996829e-04f,
+  -7.869926048e-05f, 1.040551462e-03f, 1.363254269e-03f, 2.482505050e-03f,
+  -6.070907228e-03f, -4.951656796e-03f, -4.628953990e-03f, -3.509703092e-03f,
+  -4.295902327e-03f, -3.176651429e-03f, -2.853948623e-03f, -1.734697958e-03f,
+  -3.952685278e-03f, -2.833434846e-03f, -2.510731807e-03f, -1.391481142e-03f,
+  -2.177680144e-03f, -1.058429480e-03f, -7.357266149e-04f, 3.835240786e-04f,
+  -3.599506337e-03f, -2.480255673e-03f, -2.157552866e-03f, -1.038302202e-03f,
+  -1.824501203e-03f, -7.052504807e-04f, -3.825476160e-04f, 7.367030485e-04f,
+  -1.481284387e-03f, -3.620337811e-04f, -3.933089101e-05f, 1.079919748e-03f,
+  2.937208337e-04f, 1.412971527e-03f, 1.735674334e-03f, 2.854925115e-03f,
+  -3.236586694e-03f, -2.117336029e-03f, -1.794633223e-03f, -6.753825583e-04f,
+  -1.461581443e-03f, -3.423308081e-04f, -1.962794522e-05f, 1.099622692e-03f,
+  -1.118364744e-03f, 8.859003060e-07f, 3.235887852e-04f, 1.442839392e-03f,
+  6.566405063e-04f, 1.775891171e-03f, 2.098594094e-03f, 3.217844758e-03f,
+  -7.651858032e-04f, 3.540648613e-04f, 6.767677260e-04f, 1.796018449e-03f,
+  1.009819447e-03f, 2.129070228e-03f, 2.451773034e-03f, 3.571023699e-03f,
+  1.353036147e-03f, 2.472286811e-03f, 2.794989850e-03f, 3.914240282e-03f,
+  3.128041513e-03f, 4.247291945e-03f, 4.569995217e-03f, 5.689245649e-03f,
+  -5.689245649e-03f, -4.569995217e-03f, -4.247291945e-03f, -3.128041513e-03f,
+  -3.914240282e-03f, -2.794989850e-03f, -2.472286811e-03f, -1.353036147e-03f,
+  -3.571023699e-03f, -2.451773034e-03f, -2.129070228e-03f, -1.009819447e-03f,
+  -1.796018449e-03f, -6.767677260e-04f, -3.540648613e-04f, 7.651858032e-04f,
+  -3.217844758e-03f, -2.098594094e-03f, -1.775891171e-03f, -6.566405063e-04f,
+  -1.442839392e-03f, -3.235887852e-04f, -8.859003060e-07f, 1.118364744e-03f,
+  -1.099622692e-03f, 1.962794522e-05f, 3.423308081e-04f, 1.461581443e-03f,
+  6.753825583e-04f, 1.794633223e-03f, 2.117336029e-03f, 3.236586694e-03f,
+  -2.854925115e-03f, -1.735674334e-03f, -1.412971527e-03f, -2.937208337e-04f,
+  -1.079919748e-03f, 3.933089101e-05f, 3.620337811e-04f, 1.481284387e-03f,
+  -7.367030485e-04f, 3.825476160e-04f, 7.052504807e-04f, 1.824501203e-03f,
+  1.038302202e-03f, 2.157552866e-03f, 2.480255673e-03f, 3.599506337e-03f,
+  -3.835240786e-04f, 7.357266149e-04f, 1.058429480e-03f, 2.177680144e-03f,
+  1.391481142e-03f, 2.510731807e-03f, 2.833434846e-03f, 3.952685278e-03f,
+  1.734697958e-03f, 2.853948623e-03f, 3.176651429e-03f, 4.295902327e-03f,
+  3.509703092e-03f, 4.628953990e-03f, 4.951656796e-03f, 6.070907228e-03f,
+  -2.482505050e-03f, -1.363254269e-03f, -1.040551462e-03f, 7.869926048e-05f,
+  -7.074996829e-04f, 4.117509816e-04f, 7.344538462e-04f, 1.853704569e-03f,
+  -3.642829543e-04f, 7.549677393e-04f, 1.077670604e-03f, 2.196921268e-03f,
+  1.410722267e-03f, 2.529972931e-03f, 2.852675971e-03f, 3.971926402e-03f,
+  -1.110398080e-05f, 1.108146738e-03f, 1.430849545e-03f, 2.550100209e-03f,
+  1.763901324e-03f, 2.883151872e-03f, 3.205854911e-03f, 4.325105343e-03f,
+  2.107118024e-03f, 3.226368688e-03f, 3.549071494e-03f, 4.668322392e-03f,
+  3.882123390e-03f, 5.001374055e-03f, 5.324076861e-03f, 6.443327293e-03f,
+  3.518156882e-04f, 1.471066382e-03f, 1.793769188e-03f, 2.913019853e-03f,
+  2.126820851e-03f, 3.246071748e-03f, 3.568774555e-03f, 4.688024987e-03f,
+  2.470037667e-03f, 3.589288332e-03f, 3.911991138e-03f, 5.031242035e-03f,
+  4.245042801e-03f, 5.364293698e-03f, 5.686996505e-03f, 6.806247402e-03f,
+  2.823216608e-03f, 3.942467272e-03f, 4.265170079e-03f, 5.384420976e-03f,
+  4.598221742e-03f, 5.717472639e-03f, 6.040175445e-03f, 7.159426343e-03f,
+  4.941438790e-03f, 6.060689222e-03f, 6.383392029e-03f, 7.502642926e-03f,
+  6.716444157e-03f, 7.835694589e-03f, 8.158397861e-03f, 9.277648292e-03f
+},
+{
+  -2.172814868e-02f, -1.774911955e-02f, -1.734982431e-02f, -1.337079611e-02f,
+  -1.694217324e-02f, -1.296314504e-02f, -1.256384980e-02f, -8.584821597e-03f,
+  -1.652649790e-02f, -1.254746877e-02f, -1.214817446e-02f, -8.169145323e-03f,
+  -1.174052339e-02f, -7.761494722e-03f, -7.362199482e-03f, -3.383170813e-03f,
+  -1.610314474e-02f, -1.212411653e-02f, -1.172482129e-02f, -7.745793089e-03f,
+  -1.131717023e-02f, -7.338142022e-03f, -6.938846782e-03f, -2.959818346e-03f,
+  -1.090149488e-02f, -6.922466215e-03f, -6.523170974e-03f, -2.544142539e-03f,
+  -6.115520373e-03f, -2.136491705e-03f, -1.737196464e-03f, 2.241832204e-03f,
+  -1.567248069e-02f, -1.169345248e-02f, -1.129415724e-02f, -7.315129042e-03f,
+  -1.088650618e-02f, -6.907477975e-03f, -6.508182734e-03f, -2.529154299e-03f,
+  -1.047083084e-02f, -6.491802167e-03f, -6.092506927e-03f, -2.113478491e-03f,
+  -5.684855860e-03f, -1.705827541e-03f, -1.306532300e-03f, 2.672496252e-03f,
+  -1.004747860e-02f, -6.068449467e-03f, -5.669154692e-03f, -1.690125908e-03f,
+  -5.261503626e-03f, -1.282474957e-03f, -8.831798332e-04f, 3.095848719e-03f,
+  -4.845827818e-03f, -8.667992079e-04f, -4.675040545e-04f, 3.511524526e-03f,
+  -5.985314783e-05f, 3.919175360e-03f, 4.318470601e-03f, 8.297499269e-03f,
+  -1.523488667e-02f, -1.125585847e-02f, -1.085656323e-02f, -6.877534557e-03f,
+  -1.044891216e-02f, -6.469883956e-03f, -6.070588715e-03f, -2.091560047e-03f,
+  -1.003323682e-02f, -6.054208148e-03f, -5.654912908e-03f, -1.675884239e-03f,
+  -5.247261841e-03f, -1.268233289e-03f, -8.689381648e-04f, 3.110090503e-03f,
+  -9.609883651e-03f, -5.630855449e-03f, -5.231560208e-03f, -1.252531772e-03f,
+  -4.823909607e-03f, -8.448808221e-04f, -4.455856688e-04f, 3.533442970e-03f,
+  -4.408233799e-03f, -4.292050435e-04f, -2.990988651e-05f, 3.949118778e-03f,
+  3.777410311e-04f, 4.356769379e-03f, 4.756064620e-03f, 8.735093288e-03f,
+  -9.179219604e-03f, -5.200191401e-03f, -4.800896160e-03f, -8.218676085e-04f,
+  -4.393245094e-03f, -4.142167163e-04f, -1.492155025e-05f, 3.964107018e-03f,
+  -3.977569286e-03f, 1.459082114e-06f, 4.007542448e-04f, 4.379782826e-03f,
+  8.084051660e-04f, 4.787433892e-03f, 5.186728667e-03f, 9.165757336e-03f,
+  -3.554217052e-03f, 4.248115874e-04f, 8.241067408e-04f, 4.803135525e-03f,
+  1.231757691e-03f, 5.210786127e-03f, 5.610081367e-03f, 9.589109570e-03f,
+  1.647433382e-03f, 5.626461934e-03f, 6.025757175e-03f, 1.000478584e-02f,
+  6.433408242e-03f, 1.041243691e-02f, 1.081173215e-02f, 1.479076035e-02f,
+  -1.479076035e-02f, -1.081173215e-02f, -1.041243691e-02f, -6.433408242e-03f,
+  -1.000478584e-02f, -6.025757175e-03f, -5.626461934e-03f, -1.647433382e-03f,
+  -9.589109570e-03f, -5.610081367e-03f, -5.210786127e-03f, -1.231757691e-03f,
+  -4.803135525e-03f, -8.241067408e-04f, -4.248115874e-04f, 3.554217052e-03f,
+  -9.165757336e-03f, -5.186728667e-03f, -4.787433892e-03f, -8.084051660e-04f,
+  -4.379782826e-03f, -4.007542448e-04f, -1.459082114e-06f, 3.977569286e-03f,
+  -3.964107018e-03f, 1.492155025e-05f, 4.142167163e-04f, 4.393245094e-03f,
+  8.218676085e-04f, 4.800896160e-03f, 5.200191401e-03f, 9.179219604e-03f,
+  -8.735093288e-03f, -4.756064620e-03f, -4.356769379e-03f, -3.777410311e-04f,
+  -3.949118778e-03f, 2.990988651e-05f, 4.292050435e-04f, 4.408233799e-03f,
+  -3.533442970e-03f, 4.455856688e-04f, 8.448808221e-04f, 4.823909607e-03f,
+  1.252531772e-03f, 5.231560208e-03f, 5.630855449e-03f, 9.609883651e-03f,
+  -3.110090503e-03f, 8.689381648e-04f, 1.268233289e-03f, 5.247261841e-03f,
+  1.675884239e-03f, 5.654912908e-03f, 6.054208148e-03f, 1.003323682e-02f,
+  2.091560047e-03f, 6.070588715e-03f, 6.469883956e-03f, 1.044891216e-02f,
+  6.877534557e-03f, 1.085656323e-02f, 1.125585847e-02f, 1.523488667e-02f,
+  -8.297499269e-03f, -4.318470601e-03f, -3.919175360e-03f, 5.985314783e-05f,
+  -3.511524526e-03f, 4.675040545e-04f, 8.667992079e-04f, 4.845827818e-03f,
+  -3.095848719e-03f, 8.831798332e-04f, 1.282474957e-03f, 5.261503626e-03f,
+  1.690125908e-03f, 5.669154692e-03f, 6.068449467e-03f, 1.004747860e-02f,
+  -2.672496252e-03f, 1.306532300e-03f, 1.705827541e-03f, 5.684855860e-03f,
+  2.113478491e-03f, 6.092506927e-03f, 6.491802167e-03f, 1.047083084e-02f,
+  2.529154299e-03f, 6.508182734e-03f, 6.907477975e-03f, 1.088650618e-02f,
+  7.315129042e-03f, 1.129415724e-02f, 1.169345248e-02f, 1.567248069e-02f,
+  -2.241832204e-03f, 1.737196464e-03f, 2.136491705e-03f, 6.115520373e-03f,
+  2.544142539e-03f, 6.523170974e-03f, 6.922466215e-03f, 1.090149488e-02f,
+  2.959818346e-03f, 6.938846782e-03f, 7.338142022e-03f, 1.131717023e-02f,
+  7.745793089e-03f, 1.172482129e-02f, 1.212411653e-02f, 1.610314474e-02f,
+  3.383170813e-03f, 7.362199482e-03f, 7.761494722e-03f, 1.174052339e-02f,
+  8.169145323e-03f, 1.214817446e-02f, 1.254746877e-02f, 1.652649790e-02f,
+  8.584821597e-03f, 1.256384980e-02f, 1.296314504e-02f, 1.694217324e-02f,
+  1.337079611e-02f, 1.734982431e-02f, 1.774911955e-02f, 2.172814868e-02f
+},
+{
+  -3.606424481e-02f, -2.867661230e-02f, -2.822067589e-02f, -2.083304152e-02f,
+  -2.775949053e-02f, -2.037185617e-02f, -1.991591975e-02f, -1.252828632e-02f,
+  -2.729351446e-02f, -1.990588009e-02f, -1.944994368e-02f, -1.206231024e-02f,
+  -1.898875833e-02f, -1.160112582e-02f, -1.114518847e-02f, -3.757555271e-03f,
+  -2.682321705e-02f, -1.943558268e-02f, -1.897964627e-02f, -1.159201283e-02f,
+  -1.851846091e-02f, -1.113082841e-02f, -1.067489106e-02f, -3.287257859e-03f,
+  -1.805248484e-02f, -1.066485234e-02f, -1.020891499e-02f, -2.821281552e-03f,
+  -9.747730568e-03f, -2.360096900e-03f, -1.904160134e-03f, 5.483473651e-03f,
+  -2.634908073e-02f, -1.896144636e-02f, -1.850550994e-02f, -1.111787651e-02f,
+  -1.804432645e-02f, -1.065669209e-02f, -1.020075567e-02f, -2.813121770e-03f,
+  -1.757835038e-02f, -1.019071601e-02f, -9.734779596e-03f, -2.347145695e-03f,
+  -9.273594245e-03f, -1.885960810e-03f, -1.430024044e-03f, 5.957609508e-03f,
+  -1.710805111e-02f, -9.720418602e-03f, -9.264481254e-03f, -1.876848051e-03f,
+  -8.803296834e-03f, -1.415663282e-03f, -9.597265744e-04f, 6.427906919e-03f,
+  -8.337320760e-03f, -9.496870916e-04f, -4.937504418e-04f, 6.893882994e-03f,
+  -3.256560740e-05f, 7.355067879e-03f, 7.811004762e-03f, 1.519863866e-02f,
+  -2.587160096e-02f, -1.848396659e-02f, -1.802803017e-02f, -1.064039674e-02f,
+  -1.756684482e-02f, -1.017921232e-02f, -9.723274969e-03f, -2.335641766e-03f,
+  -1.710086875e-02f, -9.713236243e-03f, -9.257298894e-03f, -1.869665692e-03f,
+  -8.796114475e-03f, -1.408480806e-03f, -9.525441565e-04f, 6.435089279e-03f,
+  -1.663057134e-02f, -9.242938831e-03f, -8.787001483e-03f, -1.399368164e-03f,
+  -8.325817063e-03f, -9.381833370e-04f, -4.822466581e-04f, 6.905387156e-03f,
+  -7.859840989e-03f, -4.722071753e-04f, -1.627048550e-05f, 7.371363230e-03f,
+  4.449143307e-04f, 7.832547650e-03f, 8.288484998e-03f, 1.567611843e-02f,
+  -1.615643688e-02f, -8.768802509e-03f, -8.312866092e-03f, -9.252320742e-04f,
+  -7.851680741e-03f, -4.640472762e-04f, -8.110589988e-06f, 7.379523013e-03f,
+  -7.385704666e-03f, 1.928890242e-06f, 4.578655935e-04f, 7.845499553e-03f,
+  9.190504206e-04f, 8.306683972e-03f, 8.762620389e-03f, 1.615025476e-02f,
+  -6.915407255e-03f, 4.722263839e-04f, 9.281630628e-04f, 8.315796964e-03f,
+  1.389347832e-03f, 8.776981384e-03f, 9.232917801e-03f, 1.662055217e-02f,
+  1.855324022e-03f, 9.242957458e-03f, 9.698894806e-03f, 1.708652824e-02f,
+  1.016007923e-02f, 1.754771359e-02f, 1.800365001e-02f, 2.539128251e-02f,
+  -2.539128251e-02f, -1.800365001e-02f, -1.754771359e-02f, -1.016007923e-02f,
+  -1.708652824e-02f, -9.698894806e-03f, -9.242957458e-03f, -1.855324022e-03f,
+  -1.662055217e-02f, -9.232917801e-03f, -8.776981384e-03f, -1.389347832e-03f,
+  -8.315796964e-03f, -9.281630628e-04f, -4.722263839e-04f, 6.915407255e-03f,
+  -1.615025476e-02f, -8.762620389e-03f, -8.306683972e-03f, -9.190504206e-04f,
+  -7.845499553e-03f, -4.578655935e-04f, -1.928890242e-06f, 7.385704666e-03f,
+  -7.379523013e-03f, 8.110589988e-06f, 4.640472762e-04f, 7.851680741e-03f,
+  9.252320742e-04f, 8.312866092e-03f, 8.768802509e-03f, 1.615643688e-02f,
+  -1.567611843e-02f, -8.288484998e-03f, -7.832547650e-03f, -4.449143307e-04f,
+  -7.371363230e-03f, 1.627048550e-05f, 4.722071753e-04f, 7.859840989e-03f,
+  -6.905387156e-03f, 4.822466581e-04f, 9.381833370e-04f, 8.325817063e-03f,
+  1.399368164e-03f, 8.787001483e-03f, 9.242938831e-03f, 1.663057134e-02f,
+  -6.435089279e-03f, 9.525441565e-04f, 1.408480806e-03f, 8.796114475e-03f,
+  1.869665692e-03f, 9.257298894e-03f, 9.713236243e-03f, 1.710086875e-02f,
+  2.335641766e-03f, 9.723274969e-03f, 1.017921232e-02f, 1.756684482e-02f,
+  1.064039674e-02f, 1.802803017e-02f, 1.848396659e-02f, 2.587160096e-02f,
+  -1.519863866e-02f, -7.811004762e-03f, -7.355067879e-03f, 3.256560740e-05f,
+  -6.893882994e-03f, 4.937504418e-04f, 9.496870916e-04f, 8.337320760e-03f,
+  -6.427906919e-03f, 9.597265744e-04f, 1.415663282e-03f, 8.803296834e-03f,
+  1.876848051e-03f, 9.264481254e-03f, 9.720418602e-03f, 1.710805111e-02f,
+  -5.957609508e-03f, 1.430024044e-03f, 1.885960810e-03f, 9.273594245e-03f,
+  2.347145695e-03f, 9.734779596e-03f, 1.019071601e-02f, 1.757835038e-02f,
+  2.813121770e-03f, 1.020075567e-02f, 1.065669209e-02f, 1.804432645e-02f,
+  1.111787651e-02f, 1.850550994e-02f, 1.896144636e-02f, 2.634908073e-02f,
+  -5.483473651e-03f, 1.904160134e-03f, 2.360096900e-03f, 9.747730568e-03f,
+  2.821281552e-03f, 1.020891499e-02f, 1.066485234e-02f, 1.805248484e-02f,
+  3.287257859e-03f, 1.067489106e-02f, 1.113082841e-02f, 1.851846091e-02f,
+  1.159201283e-02f, 1.897964627e-02f, 1.943558268e-02f, 2.682321705e-02f,
+  3.757555271e-03f, 1.114518847e-02f, 1.160112582e-02f, 1.898875833e-02f,
+  1.206231024e-02f, 1.944994368e-02f, 1.990588009e-02f, 2.729351446e-02f,
+  1.252828632e-02f, 1.991591975e-02f, 2.037185617e-02f, 2.775949053e-02f,
+  2.083304152e-02f, 2.822067589e-02f, 2.867661230e-02f, 3.606424481e-02f
+},
+{
+  -5.142053217e-02f, -4.026493058e-02f, -3.978049755e-02f, -2.862489596e-02f,
+  -3.929480165e-02f, -2.813920192e-02f, -2.765476704e-02f, -1.649916545e-02f,
+  -3.880839422e-02f, -2.765279263e-02f, -2.716835774e-02f, -1.601275615e-02f,
+  -2.668266371e-02f, -1.552706305e-02f, -1.504262909e-02f, -3.887027269e-03f,
+  -3.832181916e-02f, -2.716621757e-02f, -2.668178268e-02f, -1.552618202e-02f,
+  -2.619609050e-02f, -1.504048798e-02f, -1.455605403e-02f, -3.400452668e-03f,
+  -2.570967935e-02f, -1.455407869e-02f, -1.406964473e-02f, -2.914043143e-03f,
+  -1.358395070e-02f, -2.428349573e-03f, -1.943915500e-03f, 9.211686440e-03f,
+  -3.783563524e-02f, -2.668003552e-02f, -2.619560063e-02f, -1.503999904e-02f,
+  -2.570990659e-02f, -1.455430593e-02f, -1.406987198e-02f, -2.914270153e-03f,
+  -2.522349730e-02f, -1.406789571e-02f, -1.358346175e-02f, -2.427860629e-03f,
+  -1.309776865e-02f, -1.942167059e-03f, -1.457733102e-03f, 9.697868489e-03f,
+  -2.473692223e-02f, -1.358132157e-02f, -1.309688762e-02f, -1.941285911e-03f,
+  -1.261119358e-02f, -1.455592341e-03f, -9.711583843e-04f, 1.018444356e-02f,
+  -1.212478429e-02f, -9.691827581e-04f, -4.847487726e-04f, 1.067085285e-02f,
+  9.447629168e-07f, 1.115654595e-02f, 1.164097991e-02f, 2.279658243e-02f,
+  -3.735040873e-02f, -2.619480714e-02f, -2.571037412e-02f, -1.455477253e-02f,
+  -2.522468008e-02f, -1.406907849e-02f, -1.358464453e-02f, -2.429042943e-03f,
+  -2.473827079e-02f, -1.358266920e-02f, -1.309823524e-02f, -1.942633418e-03f,
+  -1.261254121e-02f, -1.456939848e-03f, -9.725058335e-04f, 1.018309593e-02f,
+  -2.425169572e-02f, -1.309609413e-02f, -1.261166018e-02f, -1.456058701e-03f,
+  -1.212596707e-02f, -9.703651303e-04f, -4.859311448e-04f, 1.066967007e-02f,
+  -1.163955685e-02f, -4.839555477e-04f, 4.784275234e-07f, 1.115608029e-02f,
+  4.861719790e-04f, 1.164177340e-02f, 1.212620735e-02f, 2.328180894e-02f,
+  -2.376551367e-02f, -1.260991208e-02f, -1.212547813e-02f, -9.698761860e-04f,
+  -1.163978409e-02f, -4.841826740e-04f, 2.513153561e-07f, 1.115585305e-02f,
+  -1.115337480e-02f, 2.226914148e-06f, 4.866608942e-04f, 1.164226234e-02f,
+  9.723544354e-04f, 1.212795638e-02f, 1.261239033e-02f, 2.376799099e-02f,
+  -1.066679973e-02f, 4.888016265e-04f, 9.732355829e-04f, 1.212883741e-02f,
+  1.458929153e-03f, 1.261453051e-02f, 1.309896447e-02f, 2.425456606e-02f,
+  1.945338678e-03f, 1.310094073e-02f, 1.358537469e-02f, 2.474097535e-02f,
+  1.407106780e-02f, 2.522666939e-02f, 2.571110427e-02f, 3.686670586e-02f,
+  -3.686670586e-02f, -2.571110427e-02f, -2.522666939e-02f, -1.407106780e-02f,
+  -2.474097535e-02f, -1.358537469e-02f, -1.310094073e-02f, -1.945338678e-03f,
+  -2.425456606e-02f, -1.309896447e-02f, -1.261453051e-02f, -1.458929153e-03f,
+  -1.212883741e-02f, -9.732355829e-04f, -4.888016265e-04f, 1.066679973e-02f,
+  -2.376799099e-02f, -1.261239033e-02f, -1.212795638e-02f, -9.723544354e-04f,
+  -1.164226234e-02f, -4.866608942e-04f, -2.226914148e-06f, 1.115337480e-02f,
+  -1.115585305e-02f, -2.513153561e-07f, 4.841826740e-04f, 1.163978409e-02f,
+  9.698761860e-04f, 1.212547813e-02f, 1.260991208e-02f, 2.376551367e-02f,
+  -2.328180894e-02f, -1.212620735e-02f, -1.164177340e-02f, -4.861719790e-04f,
+  -1.115608029e-02f, -4.784275234e-07f, 4.839555477e-04f, 1.163955685e-02f,
+  -1.066967007e-02f, 4.859311448e-04f, 9.703651303e-04f, 1.212596707e-02f,
+  1.456058701e-03f, 1.261166018e-02f, 1.309609413e-02f, 2.425169572e-02f,
+  -1.018309593e-02f, 9.725058335e-04f, 1.456939848e-03f, 1.261254121e-02f,
+  1.942633418e-03f, 1.309823524e-02f, 1.358266920e-02f, 2.473827079e-02f,
+  2.429042943e-03f, 1.358464453e-02f, 1.406907849e-02f, 2.522468008e-02f,
+  1.455477253e-02f, 2.571037412e-02f, 2.619480714e-02f, 3.735040873e-02f,
+  -2.279658243e-02f, -1.164097991e-02f, -1.115654595e-02f, -9.447629168e-07f,
+  -1.067085285e-02f, 4.847487726e-04f, 9.691827581e-04f, 1.212478429e-02f,
+  -1.018444356e-02f, 9.711583843e-04f, 1.455592341e-03f, 1.261119358e-02f,
+  1.941285911e-03f, 1.309688762e-02f, 1.358132157e-02f, 2.473692223e-02f,
+  -9.697868489e-03f, 1.457733102e-03f, 1.942167059e-03f, 1.309776865e-02f,
+  2.427860629e-03f, 1.358346175e-02f, 1.406789571e-02f, 2.522349730e-02f,
+  2.914270153e-03f, 1.406987198e-02f, 1.455430593e-02f, 2.570990659e-02f,
+  1.503999904e-02f, 2.619560063e-02f, 2.668003552e-02f, 3.783563524e-02f,
+  -9.211686440e-03f, 1.943915500e-03f, 2.428349573e-03f, 1.358395070e-02f,
+  2.914043143e-03f, 1.406964473e-02f, 1.455407869e-02f, 2.570967935e-02f,
+  3.400452668e-03f, 1.455605403e-02f, 1.504048798e-02f, 2.619609050e-02f,
+  1.552618202e-02f, 2.668178268e-02f, 2.716621757e-02f, 3.832181916e-02f,
+  3.887027269e-03f, 1.504262909e-02f, 1.552706305e-02f, 2.668266371e-02f,
+  1.601275615e-02f, 2.716835774e-02f, 2.765279263e-02f, 3.880839422e-02f,
+  1.649916545e-02f, 2.765476704e-02f, 2.813920192e-02f, 3.929480165e-02f,
+  2.862489596e-02f, 3.978049755e-02f, 4.026493058e-02f, 5.142053217e-02f
+},
+{
+  -6.673585624e-02f, -5.170041695e-02f, -5.122147873e-02f, -3.618603945e-02f,
+  -5.074578151e-02f, -3.571034595e-02f, -3.523140401e-02f, -2.019596659e-02f,
+  -5.027391016e-02f, -3.523847088e-02f, -3.475953266e-02f, -1.972409338e-02f,
+  -3.428383544e-02f, -1.924839802e-02f, -1.876945794e-02f, -3.734020749e-03f,
+  -4.980643466e-02f, -3.477099910e-02f, -3.429205716e-02f, -1.925662160e-02f,
+  -3.381636366e-02f, -1.878092624e-02f, -1.830198430e-02f, -3.266548039e-03f,
+  -3.334448859e-02f, -1.830905303e-02f, -1.783011295e-02f, -2.794675296e-03f,
+  -1.735441759e-02f, -2.318979707e-03f, -1.840039040e-03f, 1.319539826e-02f,
+  -4.934393987e-02f, -3.430850431e-02f, -3.382956237e-02f, -1.879412495e-02f,
+  -3.335386515e-02f, -1.831842959e-02f, -1.783948950e-02f, -2.804051852e-03f,
+  -3.288199380e-02f, -1.784655638e-02f, -1.736761630e-02f, -2.332179109e-03f,
+  -1.689192094e-02f, -1.856483635e-03f, -1.377542852e-03f, 1.365789399e-02f,
+  -3.241452202e-02f, -1.737908460e-02f, -1.690014265e-02f, -1.864706399e-03f,
+  -1.642444730e-02f, -1.389010926e-03f, -9.100701427e-04f, 1.412536670e-02f,
+  -1.595257595e-02f, -9.171381244e-04f, -4.381973122e-04f, 1.459723990e-02f,
+  3.749815369e-05f, 1.507293526e-02f, 1.555187628e-02f, 3.058731370e-02f,
+  -4.888699576e-02f, -3.385155648e-02f, -3.337261826e-02f, -1.833718084e-02f,
+  -3.289692104e-02f, -1.786148548e-02f, -1.738254353e-02f, -2.347106813e-03f,
+  -3.242504969e-02f, -1.738961227e-02f, -1.691067033e-02f, -1.875234069e-03f,
+  -1.643497497e-02f, -1.399538596e-03f, -9.205978713e-04f, 1.411483902e-02f,
+  -3.195757791e-02f, -1.692213863e-02f, -1.644319855e-02f, -1.407761360e-03f,
+  -1.596750319e-02f, -9.320659447e-04f, -4.531251325e-04f, 1.458231173e-02f,
+  -1.549562998e-02f, -4.601931141e-04f, 1.874766531e-05f, 1.505418494e-02f,
+  4.944431130e-04f, 1.552988030e-02f, 1.600882038e-02f, 3.104425780e-02f,
+  -3.149507940e-02f, -1.645964384e-02f, -1.598070189e-02f, -9.452652303e-04f,
+  -1.550500654e-02f, -4.695697571e-04f, 9.371012311e-06f, 1.504480839e-02f,
+  -1.503313426e-02f, 2.303031351e-06f, 4.812438274e-04f, 1.551668067e-02f,
+  9.569393005e-04f, 1.599237695e-02f, 1.647131704e-02f, 3.150675446e-02f,
+  -1.456566155e-02f, 4.697757540e-04f, 9.487165371e-04f, 1.598415338e-02f,
+  1.424412010e-03f, 1.645984873e-02f, 1.693879068e-02f, 3.197422624e-02f,
+  1.896284753e-03f, 1.693172194e-02f, 1.741066203e-02f, 3.244610131e-02f,
+  1.788635738e-02f, 3.292179480e-02f, 3.340073675e-02f, 4.843617231e-02f,
+  -4.843617231e-02f, -3.340073675e-02f, -3.292179480e-02f, -1.788635738e-02f,
+  -3.244610131e-02f, -1.741066203e-02f, -1.693172194e-02f, -1.896284753e-03f,
+  -3.197422624e-02f, -1.693879068e-02f, -1.645984873e-02f, -1.424412010e-03f,
+  -1.598415338e-02f, -9.487165371e-04f, -4.697757540e-04f, 1.456566155e-02f,
+  -3.150675446e-02f, -1.647131704e-02f, -1.599237695e-02f, -9.569393005e-04f,
+  -1.551668067e-02f, -4.812438274e-04f, -2.303031351e-06f, 1.503313426e-02f,
+  -1.504480839e-02f, -9.371012311e-06f, 4.695697571e-04f, 1.550500654e-02f,
+  9.452652303e-04f, 1.598070189e-02f, 1.645964384e-02f, 3.149507940e-02f,
+  -3.104425780e-02f, -1.600882038e-02f, -1.552988030e-02f, -4.944431130e-04f,
+  -1.505418494e-02f, -1.874766531e-05f, 4.601931141e-04f, 1.549562998e-02f,
+  -1.458231173e-02f, 4.531251325e-04f, 9.320659447e-04f, 1.596750319e-02f,
+  1.407761360e-03f, 1.644319855e-02f, 1.692213863e-02f, 3.195757791e-02f,
+  -1.411483902e-02f, 9.205978713e-04f, 1.399538596e-03f, 1.643497497e-02f,
+  1.875234069e-03f, 1.691067033e-02f, 1.738961227e-02f, 3.242504969e-02f,
+  2.347106813e-03f, 1.738254353e-02f, 1.786148548e-02f, 3.289692104e-02f,
+  1.833718084e-02f, 3.337261826e-02f, 3.385155648e-02f, 4.888699576e-02f,
+  -3.058731370e-02f, -1.555187628e-02f, -1.507293526e-02f, -3.749815369e-05f,
+  -1.459723990e-02f, 4.381973122e-04f, 9.171381244e-04f, 1.595257595e-02f,
+  -1.412536670e-02f, 9.100701427e-04f, 1.389010926e-03f, 1.642444730e-02f,
+  1.864706399e-03f, 1.690014265e-02f, 1.737908460e-02f, 3.241452202e-02f,
+  -1.365789399e-02f, 1.377542852e-03f, 1.856483635e-03f, 1.689192094e-02f,
+  2.332179109e-03f, 1.736761630e-02f, 1.784655638e-02f, 3.288199380e-02f,
+  2.804051852e-03f, 1.783948950e-02f, 1.831842959e-02f, 3.335386515e-02f,
+  1.879412495e-02f, 3.382956237e-02f, 3.430850431e-02f, 4.934393987e-02f,
+  -1.319539826e-02f, 1.840039040e-03f, 2.318979707e-03f, 1.735441759e-02f,
+  2.794675296e-03f, 1.783011295e-02f, 1.830905303e-02f, 3.334448859e-02f,
+  3.266548039e-03f, 1.830198430e-02f, 1.878092624e-02f, 3.381636366e-02f,
+  1.925662160e-02f, 3.429205716e-02f, 3.477099910e-02f, 4.980643466e-02f,
+  3.734020749e-03f, 1.876945794e-02f, 1.924839802e-02f, 3.428383544e-02f,
+  1.972409338e-02f, 3.475953266e-02f, 3.523847088e-02f, 5.027391016e-02f,
+  2.019596659e-02f, 3.523140401e-02f, 3.571034595e-02f, 5.074578151e-02f,
+  3.618603945e-02f, 5.122147873e-02f, 5.170041695e-02f, 6.673585624e-02f
+},
+{
+  -8.085379004e-02f, -6.210997328e-02f, -6.167309731e-02f, -4.292928427e-02f,
+  -6.124402955e-02f, -4.250021651e-02f, -4.206334054e-02f, -2.331952564e-02f,
+  -6.082332507e-02f, -4.207951203e-02f, -4.164263606e-02f, -2.289882116e-02f,
+  -4.121356830e-02f, -2.246975526e-02f, -2.203287743e-02f, -3.289063927e-03f,
+  -6.041152403e-02f, -4.166771099e-02f, -4.123083502e-02f, -2.248702012e-02f,
+  -4.080176726e-02f, -2.205795422e-02f, -2.162107639e-02f, -2.877263818e-03f,
+  -4.038106278e-02f, -2.163724974e-02f, -2.120037191e-02f, -2.456559101e-03f,
+  -2.077130601e-02f, -2.027492737e-03f, -1.590615138e-03f, 1.715319790e-02f,
+  -6.000916287e-02f, -4.126534984e-02f, -4.082847387e-02f, -2.208465897e-02f,
+  -4.039940611e-02f, -2.165559307e-02f, -2.121871524e-02f, -2.474902198e-03f,
+  -3.997870162e-02f, -2.123488858e-02f, -2.079801075e-02f, -2.054197481e-03f,
+  -2.036894485e-02f, -1.625131001e-03f, -1.188253518e-03f, 1.755555905e-02f,
+  -3.956690058e-02f, -2.082308754e-02f, -2.038620971e-02f, -1.642397139e-03f,
+  -1.995714381e-02f, -1.213330775e-03f, -7.764532929e-04f, 1.796736009e-02f,
+  -1.953643933e-02f, -7.926260587e-04f, -3.557485761e-04f, 1.838806458e-02f,
+  7.331780944e-05f, 1.881713048e-02f, 1.925400831e-02f, 3.799782321e-02f,
+  -5.961676687e-02f, -4.087295011e-02f, -4.043607414e-02f, -2.169226110e-02f,
+  -4.000700638e-02f, -2.126319520e-02f, -2.082631737e-02f, -2.082503866e-03f,
+  -3.958630189e-02f, -2.084249072e-02f, -2.040561289e-02f, -1.661799033e-03f,
+  -1.997654699e-02f, -1.232732669e-03f, -7.958551869e-04f, 1.794795878e-02f,
+  -3.917450458e-02f, -2.043068968e-02f, -1.999381185e-02f, -1.249998808e-03f,
+  -1.956474595e-02f, -8.209324442e-04f, -3.840549325e-04f, 1.835975796e-02f,
+  -1.914404146e-02f, -4.002277274e-04f, 3.664978431e-05f, 1.878046244e-02f,
+  4.657161771e-04f, 1.920953020e-02f, 1.964640617e-02f, 3.839021921e-02f,
+  -3.877213970e-02f, -2.002832852e-02f, -1.959145069e-02f, -8.476372459e-04f,
+  -1.916238479e-02f, -4.185708531e-04f, 1.830664769e-05f, 1.876211911e-02f,
+  -1.874168031e-02f, 2.133871249e-06f, 4.390113754e-04f, 1.918282546e-02f,
+  8.680777391e-04f, 1.961189136e-02f, 2.004876919e-02f, 3.879258037e-02f,
+  -1.832987927e-02f, 4.139341181e-04f, 8.508116007e-04f, 1.959462464e-02f,
+  1.279877964e-03f, 2.002369054e-02f, 2.046056837e-02f, 3.920438141e-02f,
+  1.700582681e-03f, 2.044439688e-02f, 2.088127285e-02f, 3.962508589e-02f,
+  2.131034061e-02f, 4.005415365e-02f, 4.049102962e-02f, 5.923484266e-02f,
+  -5.923484266e-02f, -4.049102962e-02f, -4.005415365e-02f, -2.131034061e-02f,
+  -3.962508589e-02f, -2.088127285e-02f, -2.044439688e-02f, -1.700582681e-03f,
+  -3.920438141e-02f, -2.046056837e-02f, -2.002369054e-02f, -1.279877964e-03f,
+  -1.959462464e-02f, -8.508116007e-04f, -4.139341181e-04f, 1.832987927e-02f,
+  -3.879258037e-02f, -2.004876919e-02f, -1.961189136e-02f, -8.680777391e-04f,
+  -1.918282546e-02f, -4.390113754e-04f, -2.133871249e-06f, 1.874168031e-02f,
+  -1.876211911e-02f, -1.830664769e-05f, 4.185708531e-04f, 1.916238479e-02f,
+  8.476372459e-04f, 1.959145069e-02f, 2.002832852e-02f, 3.877213970e-02f,
+  -3.839021921e-02f, -1.964640617e-02f, -1.920953020e-02f, -4.657161771e-04f,
+  -1.878046244e-02f, -3.664978431e-05f, 4.002277274e-04f, 1.914404146e-02f,
+  -1.835975796e-02f, 3.840549325e-04f, 8.209324442e-04f, 1.956474595e-02f,
+  1.249998808e-03f, 1.999381185e-02f, 2.043068968e-02f, 3.917450458e-02f,
+  -1.794795878e-02f, 7.958551869e-04f, 1.232732669e-03f, 1.997654699e-02f,
+  1.661799033e-03f, 2.040561289e-02f, 2.084249072e-02f, 3.958630189e-02f,
+  2.082503866e-03f, 2.082631737e-02f, 2.126319520e-02f, 4.000700638e-02f,
+  2.169226110e-02f, 4.043607414e-02f, 4.087295011e-02f, 5.961676687e-02f,
+  -3.799782321e-02f, -1.925400831e-02f, -1.881713048e-02f, -7.331780944e-05f,
+  -1.838806458e-02f, 3.557485761e-04f, 7.926260587e-04f, 1.953643933e-02f,
+  -1.796736009e-02f, 7.764532929e-04f, 1.213330775e-03f, 1.995714381e-02f,
+  1.642397139e-03f, 2.038620971e-02f, 2.082308754e-02f, 3.956690058e-02f,
+  -1.755555905e-02f, 1.188253518e-03f, 1.625131001e-03f, 2.036894485e-02f,
+  2.054197481e-03f, 2.079801075e-02f, 2.123488858e-02f, 3.997870162e-02f,
+  2.474902198e-03f, 2.121871524e-02f, 2.165559307e-02f, 4.039940611e-02f,
+  2.208465897e-02f, 4.082847387e-02f, 4.126534984e-02f, 6.000916287e-02f,
+  -1.715319790e-02f, 1.590615138e-03f, 2.027492737e-03f, 2.077130601e-02f,
+  2.456559101e-03f, 2.120037191e-02f, 2.163724974e-02f, 4.038106278e-02f,
+  2.877263818e-03f, 2.162107639e-02f, 2.205795422e-02f, 4.080176726e-02f,
+  2.248702012e-02f, 4.123083502e-02f, 4.166771099e-02f, 6.041152403e-02f,
+  3.289063927e-03f, 2.203287743e-02f, 2.246975526e-02f, 4.121356830e-02f,
+  2.289882116e-02f, 4.164263606e-02f, 4.207951203e-02f, 6.082332507e-02f,
+  2.331952564e-02f, 4.206334054e-02f, 4.250021651e-02f, 6.124402955e-02f,
+  4.292928427e-02f, 6.167309731e-02f, 6.210997328e-02f, 8.085379004e-02f
+},
+{
+  -9.264183044e-02f, -7.065194100e-02f, -7.029247284e-02f, -4.830258712e-02f,
+  -6.994494796e-02f, -4.795506224e-02f, -4.759559408e-02f, -2.560570836e-02f,
+  -6.960983574e-02f, -4.761995003e-02f, -4.726047814e-02f, -2.527059428e-02f,
+  -4.691295698e-02f, -2.492307127e-02f, -2.456359938e-02f, -2.573715756e-03f,
+  -6.928758323e-02f, -4.729769379e-02f, -4.693822563e-02f, -2.494833991e-02f,
+  -4.659070075e-02f, -2.460081689e-02f, -2.424134500e-02f, -2.251461148e-03f,
+  -4.625558853e-02f, -2.426570281e-02f, -2.390623279e-02f, -1.916347886e-03f,
+  -2.355870791e-02f, -1.568824286e-03f, -1.209353330e-03f, 2.078053169e-02f,
+  -6.897861511e-02f, -4.698873311e-02f, -4.662926123e-02f, -2.463937737e-02f,
+  -4.628173634e-02f, -2.429185249e-02f, -2.393238246e-02f, -1.942497445e-03f,
+  -4.594662413e-02f, -2.395674028e-02f, -2.359726839e-02f, -1.607384300e-03f,
+  -2.324974537e-02f, -1.259860583e-03f, -9.003896848e-04f, 2.108949423e-02f,
+  -4.562436789e-02f, -2.363448404e-02f, -2.327501401e-02f, -1.285129576e-03f,
+  -2.292749099e-02f, -9.376059170e-04f, -5.781350192e-04f, 2.141174860e-02f,
+  -2.259237692e-02f, -6.024927134e-04f, -2.430217573e-04f, 2.174686268e-02f,
+  1.045018580e-04f, 2.209438570e-02f, 2.245385759e-02f, 4.444374144e-02f,
+  -6.868335605e-02f, -4.669347405e-02f, -4.633400589e-02f, -2.434412017e-02f,
+  -4.598648101e-02f, -2.399659529e-02f, -2.363712527e-02f, -1.647240832e-03f,
+  -4.565136880e-02f, -2.366148308e-02f, -2.330201119e-02f, -1.312127570e-03f,
+  -2.295448817e-02f, -9.646040271e-04f, -6.051330711e-04f, 2.138475142e-02f,
+  -4.532911256e-02f, -2.333922870e-02f, -2.297975682e-02f, -9.898729622e-04f,
+  -2.263223380e-02f, -6.423493032e-04f, -2.828783763e-04f, 2.170700580e-02f,
+  -2.229711972e-02f, -3.072360705e-04f, 5.223486369e-05f, 2.204211988e-02f,
+  3.997584863e-04f, 2.238964289e-02f, 2.274911292e-02f, 4.473899677e-02f,
+  -4.502014816e-02f, -2.303026430e-02f, -2.267079428e-02f, -6.809092592e-04f,
+  -2.232326940e-02f, -3.333856585e-04f, 2.608528484e-05f, 2.201597020e-02f,
+  -2.198815718e-02f, 1.727585754e-06f, 3.611985303e-04f, 2.235108241e-02f,
+  7.087221602e-04f, 2.269860730e-02f, 2.305807732e-02f, 4.504796118e-02f,
+  -2.166590281e-02f, 3.239822690e-04f, 6.834532251e-04f, 2.267333679e-02f,
+  1.030976884e-03f, 2.302086167e-02f, 2.338033170e-02f, 4.537021741e-02f,
+  1.366090029e-03f, 2.335597388e-02f, 2.371544577e-02f, 4.570532963e-02f,
+  2.406296879e-02f, 4.605285451e-02f, 4.641232267e-02f, 6.840220839e-02f,
+  -6.840220839e-02f, -4.641232267e-02f, -4.605285451e-02f, -2.406296879e-02f,
+  -4.570532963e-02f, -2.371544577e-02f, -2.335597388e-02f, -1.366090029e-03f,
+  -4.537021741e-02f, -2.338033170e-02f, -2.302086167e-02f, -1.030976884e-03f,
+  -2.267333679e-02f, -6.834532251e-04f, -3.239822690e-04f, 2.166590281e-02f,
+  -4.504796118e-02f, -2.305807732e-02f, -2.269860730e-02f, -7.087221602e-04f,
+  -2.235108241e-02f, -3.611985303e-04f, -1.727585754e-06f, 2.198815718e-02f,
+  -2.201597020e-02f, -2.608528484e-05f, 3.333856585e-04f, 2.232326940e-02f,
+  6.809092592e-04f, 2.267079428e-02f, 2.303026430e-02f, 4.502014816e-02f,
+  -4.473899677e-02f, -2.274911292e-02f, -2.238964289e-02f, -3.997584863e-04f,
+  -2.204211988e-02f, -5.223486369e-05f, 3.072360705e-04f, 2.229711972e-02f,
+  -2.170700580e-02f, 2.828783763e-04f, 6.423493032e-04f, 2.263223380e-02f,
+  9.898729622e-04f, 2.297975682e-02f, 2.333922870e-02f, 4.532911256e-02f,
+  -2.138475142e-02f, 6.051330711e-04f, 9.646040271e-04f, 2.295448817e-02f,
+  1.312127570e-03f, 2.330201119e-02f, 2.366148308e-02f, 4.565136880e-02f,
+  1.647240832e-03f, 2.363712527e-02f, 2.399659529e-02f, 4.598648101e-02f,
+  2.434412017e-02f, 4.633400589e-02f, 4.669347405e-02f, 6.868335605e-02f,
+  -4.444374144e-02f, -2.245385759e-02f, -2.209438570e-02f, -1.045018580e-04f,
+  -2.174686268e-02f, 2.430217573e-04f, 6.024927134e-04f, 2.259237692e-02f,
+  -2.141174860e-02f, 5.781350192e-04f, 9.376059170e-04f, 2.292749099e-02f,
+  1.285129576e-03f, 2.327501401e-02f, 2.363448404e-02f, 4.562436789e-02f,
+  -2.108949423e-02f, 9.003896848e-04f, 1.259860583e-03f, 2.324974537e-02f,
+  1.607384300e-03f, 2.359726839e-02f, 2.395674028e-02f, 4.594662413e-02f,
+  1.942497445e-03f, 2.393238246e-02f, 2.429185249e-02f, 4.628173634e-02f,
+  2.463937737e-02f, 4.662926123e-02f, 4.698873311e-02f, 6.897861511e-02f,
+  -2.078053169e-02f, 1.209353330e-03f, 1.568824286e-03f, 2.355870791e-02f,
+  1.916347886e-03f, 2.390623279e-02f, 2.426570281e-02f, 4.625558853e-02f,
+  2.251461148e-03f, 2.424134500e-02f, 2.460081689e-02f, 4.659070075e-02f,
+  2.494833991e-02f, 4.693822563e-02f, 4.729769379e-02f, 6.928758323e-02f,
+  2.573715756e-03f, 2.456359938e-02f, 2.492307127e-02f, 4.691295698e-02f,
+  2.527059428e-02f, 4.726047814e-02f, 4.761995003e-02f, 6.960983574e-02f,
+  2.560570836e-02f, 4.759559408e-02f, 4.795506224e-02f, 6.994494796e-02f,
+  4.830258712e-02f, 7.029247284e-02f, 7.065194100e-02f, 9.264183044e-02f
+},
+{
+  -1.011144519e-01f, -7.660816610e-02f, -7.635635138e-02f, -5.185006931e-02f,
+  -7.611972839e-02f, -5.161344633e-02f, -5.136163160e-02f, -2.685534954e-02f,
+  -7.589861751e-02f, -5.139233917e-02f, -5.114052445e-02f, -2.663424052e-02f,
+  -5.090390146e-02f, -2.639761753e-02f, -2.614580281e-02f, -1.639520517e-03f,
+  -7.569333166e-02f, -5.118704587e-02f, -5.093523115e-02f, -2.642894909e-02f,
+  -5.069860816e-02f, -2.619232610e-02f, -2.594051138e-02f, -1.434228965e-03f,
+  -5.047750100e-02f, -2.597121708e-02f, -2.571940236e-02f, -1.213120180e-03f,
+  -2.548277937e-02f, -9.764967253e-04f, -7.246814785e-04f, 2.378160134e-02f,
+  -7.550413907e-02f, -5.099785328e-02f, -5.074603856e-02f, -2.623975649e-02f,
+  -5.050941557e-02f, -2.600313351e-02f, -2.575131878e-02f, -1.245036023e-03f,
+  -5.028830841e-02f, -2.578202449e-02f, -2.553020976e-02f, -1.023927238e-03f,
+  -2.529358678e-02f, -7.873037830e-04f, -5.354885361e-04f, 2.397079393e-02f,
+  -5.008301511e-02f, -2.557673305e-02f, -2.532491833e-02f, -8.186357445e-04f,
+  -2.508829348e-02f, -5.820122315e-04f, -3.301970137e-04f, 2.417608537e-02f,
+  -2.486718632e-02f, -3.609035339e-04f, -1.090882724e-04f, 2.439719439e-02f,
+  1.275352115e-04f, 2.463381737e-02f, 2.488563210e-02f, 4.939191416e-02f,
+  -7.533130050e-02f, -5.082501844e-02f, -5.057320371e-02f, -2.606692165e-02f,
+  -5.033658072e-02f, -2.583029866e-02f, -2.557848394e-02f, -1.072201412e-03f,
+  -5.011547357e-02f, -2.560918964e-02f, -2.535737492e-02f, -8.510926855e-04f,
+  -2.512075193e-02f, -6.144692306e-04f, -3.626539838e-04f, 2.414362878e-02f,
+  -4.991018027e-02f, -2.540389821e-02f, -2.515208349e-02f, -6.458011921e-04f,
+  -2.491546050e-02f, -4.091776791e-04f, -1.573624468e-04f, 2.434892021e-02f,
+  -2.469435148e-02f, -1.880689524e-04f, 6.374629447e-05f, 2.457002923e-02f,
+  3.003697784e-04f, 2.480665222e-02f, 2.505846694e-02f, 4.956474900e-02f,
+  -4.972098768e-02f, -2.521470562e-02f, -2.496289089e-02f, -4.566082207e-04f,
+  -2.472626604e-02f, -2.199847513e-04f, 3.183050649e-05f, 2.453811280e-02f,
+  -2.450515889e-02f, 1.123989023e-06f, 2.529392368e-04f, 2.475922182e-02f,
+  4.895626917e-04f, 2.499584481e-02f, 2.524765953e-02f, 4.975394160e-02f,
+  -2.429986745e-02f, 2.064155269e-04f, 4.582307593e-04f, 2.496451326e-02f,
+  6.948542432e-04f, 2.520113625e-02f, 2.545295097e-02f, 4.995923489e-02f,
+  9.159629699e-04f, 2.542224526e-02f, 2.567405999e-02f, 5.018034205e-02f,
+  2.591068298e-02f, 5.041696504e-02f, 5.066877976e-02f, 7.517506182e-02f,
+  -7.517506182e-02f, -5.066877976e-02f, -5.041696504e-02f, -2.591068298e-02f,
+  -5.018034205e-02f, -2.567405999e-02f, -2.542224526e-02f, -9.159629699e-04f,
+  -4.995923489e-02f, -2.545295097e-02f, -2.520113625e-02f, -6.948542432e-04f,
+  -2.496451326e-02f, -4.582307593e-04f, -2.064155269e-04f, 2.429986745e-02f,
+  -4.975394160e-02f, -2.524765953e-02f, -2.499584481e-02f, -4.895626917e-04f,
+  -2.475922182e-02f, -2.529392368e-04f, -1.123989023e-06f, 2.450515889e-02f,
+  -2.453811280e-02f, -3.183050649e-05f, 2.199847513e-04f, 2.472626604e-02f,
+  4.566082207e-04f, 2.496289089e-02f, 2.521470562e-02f, 4.972098768e-02f,
+  -4.956474900e-02f, -2.505846694e-02f, -2.480665222e-02f, -3.003697784e-04f,
+  -2.457002923e-02f, -6.374629447e-05f, 1.880689524e-04f, 2.469435148e-02f,
+  -2.434892021e-02f, 1.573624468e-04f, 4.091776791e-04f, 2.491546050e-02f,
+  6.458011921e-04f, 2.515208349e-02f, 2.540389821e-02f, 4.991018027e-02f,
+  -2.414362878e-02f, 3.626539838e-04f, 6.144692306e-04f, 2.512075193e-02f,
+  8.510926855e-04f, 2.535737492e-02f, 2.560918964e-02f, 5.011547357e-02f,
+  1.072201412e-03f, 2.557848394e-02f, 2.583029866e-02f, 5.033658072e-02f,
+  2.606692165e-02f, 5.057320371e-02f, 5.082501844e-02f, 7.533130050e-02f,
+  -4.939191416e-02f, -2.488563210e-02f, -2.463381737e-02f, -1.275352115e-04f,
+  -2.439719439e-02f, 1.090882724e-04f, 3.609035339e-04f, 2.486718632e-02f,
+  -2.417608537e-02f, 3.301970137e-04f, 5.820122315e-04f, 2.508829348e-02f,
+  8.186357445e-04f, 2.532491833e-02f, 2.557673305e-02f, 5.008301511e-02f,
+  -2.397079393e-02f, 5.354885361e-04f, 7.873037830e-04f, 2.529358678e-02f,
+  1.023927238e-03f, 2.553020976e-02f, 2.578202449e-02f, 5.028830841e-02f,
+  1.245036023e-03f, 2.575131878e-02f, 2.600313351e-02f, 5.050941557e-02f,
+  2.623975649e-02f, 5.074603856e-02f, 5.099785328e-02f, 7.550413907e-02f,
+  -2.378160134e-02f, 7.246814785e-04f, 9.764967253e-04f, 2.548277937e-02f,
+  1.213120180e-03f, 2.571940236e-02f, 2.597121708e-02f, 5.047750100e-02f,
+  1.434228965e-03f, 2.594051138e-02f, 2.619232610e-02f, 5.069860816e-02f,
+  2.642894909e-02f, 5.093523115e-02f, 5.118704587e-02f, 7.569333166e-02f,
+  1.639520517e-03f, 2.614580281e-02f, 2.639761753e-02f, 5.090390146e-02f,
+  2.663424052e-02f, 5.114052445e-02f, 5.139233917e-02f, 7.589861751e-02f,
+  2.685534954e-02f, 5.136163160e-02f, 5.161344633e-02f, 7.611972839e-02f,
+  5.185006931e-02f, 7.635635138e-02f, 7.660816610e-02f, 1.011144519e-01f
+},
+{
+  -1.055439264e-01f, -7.946511358e-02f, -7.934268564e-02f, -5.326387286e-02f,
+  -7.923743874e-02f, -5.315862224e-02f, -5.303620175e-02f, -2.695738524e-02f,
+  -7.914950699e-02f, -5.307069048e-02f, -5.294826627e-02f, -2.686945349e-02f,
+  -5.284301564e-02f, -2.676420286e-02f, -2.664177865e-02f, -5.629653460e-04f,
+  -7.907900959e-02f, -5.300020054e-02f, -5.287777632e-02f, -2.679896168e-02f,
+  -5.277252570e-02f, -2.669371106e-02f, -2.657128684e-02f, -4.924727255e-04f,
+  -5.268459022e-02f, -2.660577744e-02f, -2.648335509e-02f, -4.045402748e-04f,
+  -2.637810446e-02f, -2.992895606e-04f, -1.768661023e-04f, 2.590194717e-02f,
+  -7.902605832e-02f, -5.294724181e-02f, -5.282482132e-02f, -2.674600668e-02f,
+  -5.271957070e-02f, -2.664075606e-02f, -2.651833184e-02f, -4.395176657e-04f,
+  -5.263163522e-02f, -2.655282244e-02f, -2.643040009e-02f, -3.515851859e-04f,
+  -2.632514946e-02f, -2.463344717e-04f, -1.239110279e-04f, 2.595490403e-02f,
+  -5.256114528e-02f, -2.648233064e-02f, -2.635990642e-02f, -2.810926235e-04f,
+  -2.625465579e-02f, -1.758418948e-04f, -5.341844735e-05f, 2.602539584e-02f,
+  -2.616672404e-02f, -8.790941502e-05f, 3.451403245e-05f, 2.611332759e-02f,
+  1.397647575e-04f, 2.621857822e-02f, 2.634100243e-02f, 5.241981521e-02f,
+  -7.899071276e-02f, -5.291189998e-02f, -5.278947577e-02f, -2.671066113e-02f,
+  -5.268422514e-02f, -2.660541050e-02f, -2.648298815e-02f, -4.041734501e-04f,
+  -5.259629339e-02f, -2.651747875e-02f, -2.639505453e-02f, -3.162409703e-04f,
+  -2.628980391e-02f, -2.109902707e-04f, -8.856681961e-05f, 2.599024773e-02f,
+  -5.252579972e-02f, -2.644698508e-02f, -2.632456273e-02f, -2.457484079e-04f,
+  -2.621931210e-02f, -1.404976792e-04f, -1.807423541e-05f, 2.606073953e-02f,
+  -2.613137849e-02f, -5.256520308e-05f, 6.985824439e-05f, 2.614867315e-02f,
+  1.751089585e-04f, 2.625392377e-02f, 2.637634613e-02f, 5.245516077e-02f,
+  -5.247284472e-02f, -2.639403008e-02f, -2.627160773e-02f, -1.927933190e-04f,
+  -2.616635710e-02f, -8.754260489e-05f, 3.488084258e-05f, 2.611369453e-02f,
+  -2.607842349e-02f, 3.898728380e-07f, 1.228133187e-04f, 2.620162815e-02f,
+  2.280640329e-04f, 2.630687878e-02f, 2.642930113e-02f, 5.250811577e-02f,
+  -2.600793168e-02f, 7.088245184e-05f, 1.933058957e-04f, 2.627211995e-02f,
+  2.985566098e-04f, 2.637737058e-02f, 2.649979480e-02f, 5.257860944e-02f,
+  3.864890896e-04f, 2.646530233e-02f, 2.658772655e-02f, 5.266654119e-02f,
+  2.669297718e-02f, 5.277179182e-02f, 5.289421603e-02f, 7.897303253e-02f,
+  -7.897303253e-02f, -5.289421603e-02f, -5.277179182e-02f, -2.669297718e-02f,
+  -5.266654119e-02f, -2.658772655e-02f, -2.646530233e-02f, -3.864890896e-04f,
+  -5.257860944e-02f, -2.649979480e-02f, -2.637737058e-02f, -2.985566098e-04f,
+  -2.627211995e-02f, -1.933058957e-04f, -7.088245184e-05f, 2.600793168e-02f,
+  -5.250811577e-02f, -2.642930113e-02f, -2.630687878e-02f, -2.280640329e-04f,
+  -2.620162815e-02f, -1.228133187e-04f, -3.898728380e-07f, 2.607842349e-02f,
+  -2.611369453e-02f, -3.488084258e-05f, 8.754260489e-05f, 2.616635710e-02f,
+  1.927933190e-04f, 2.627160773e-02f, 2.639403008e-02f, 5.247284472e-02f,
+  -5.245516077e-02f, -2.637634613e-02f, -2.625392377e-02f, -1.751089585e-04f,
+  -2.614867315e-02f, -6.985824439e-05f, 5.256520308e-05f, 2.613137849e-02f,
+  -2.606073953e-02f, 1.807423541e-05f, 1.404976792e-04f, 2.621931210e-02f,
+  2.457484079e-04f, 2.632456273e-02f, 2.644698508e-02f, 5.252579972e-02f,
+  -2.599024773e-02f, 8.856681961e-05f, 2.109902707e-04f, 2.628980391e-02f,
+  3.162409703e-04f, 2.639505453e-02f, 2.651747875e-02f, 5.259629339e-02f,
+  4.041734501e-04f, 2.648298815e-02f, 2.660541050e-02f, 5.268422514e-02f,
+  2.671066113e-02f, 5.278947577e-02f, 5.291189998e-02f, 7.899071276e-02f,
+  -5.241981521e-02f, -2.634100243e-02f, -2.621857822e-02f, -1.397647575e-04f,
+  -2.611332759e-02f, -3.451403245e-05f, 8.790941502e-05f, 2.616672404e-02f,
+  -2.602539584e-02f, 5.341844735e-05f, 1.758418948e-04f, 2.625465579e-02f,
+  2.810926235e-04f, 2.635990642e-02f, 2.648233064e-02f, 5.256114528e-02f,
+  -2.595490403e-02f, 1.239110279e-04f, 2.463344717e-04f, 2.632514946e-02f,
+  3.515851859e-04f, 2.643040009e-02f, 2.655282244e-02f, 5.263163522e-02f,
+  4.395176657e-04f, 2.651833184e-02f, 2.664075606e-02f, 5.271957070e-02f,
+  2.674600668e-02f, 5.282482132e-02f, 5.294724181e-02f, 7.902605832e-02f,
+  -2.590194717e-02f, 1.768661023e-04f, 2.992895606e-04f, 2.637810446e-02f,
+  4.045402748e-04f, 2.648335509e-02f, 2.660577744e-02f, 5.268459022e-02f,
+  4.924727255e-04f, 2.657128684e-02f, 2.669371106e-02f, 5.277252570e-02f,
+  2.679896168e-02f, 5.287777632e-02f, 5.300020054e-02f, 7.907900959e-02f,
+  5.629653460e-04f, 2.664177865e-02f, 2.676420286e-02f, 5.284301564e-02f,
+  2.686945349e-02f, 5.294826627e-02f, 5.307069048e-02f, 7.914950699e-02f,
+  2.695738524e-02f, 5.303620175e-02f, 5.315862224e-02f, 7.923743874e-02f,
+  5.326387286e-02f, 7.934268564e-02f, 7.946511358e-02f, 1.055439264e-01f
+}
+};
+
@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+# Checks that dsdbatch converts like dsdplay: every DSF/DSDIFF file given
+# is converted by both with the same options and the outputs compared.
+#
+#   make check CHECK="some.dsf other.dff"
+#
+
+BUILD=${BUILD:-build}
+
+if [ $# -eq 0 ]; then
+  echo "usage: $0 file.dsf|file.dff ..." >&2
+  exit 2
+fi
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+failed=0
+
+check() {
+  file=$1 type=$2
+  shift 2
+  name=$(basename "$file")
+  name=${name%.*}.$type
+
+  rm -rf "$tmp/batch"
+  if ! "$BUILD/dsdbatch" -f $type "$@" -o "$tmp/batch" "$file" >/dev/null 2>&1 ||
+     ! "$BUILD/dsdplay" -f $type "$@" -o "$tmp/play.$type" "$file" ||
+     ! cmp -s "$tmp/batch/$name" "$tmp/play.$type"; then
+    echo "FAIL $file -f $type $*"
+    failed=1
+  else
+    echo "ok   $file -f $type $*"
+  fi
+}
+
+for f in "$@"; do
+  check "$f" wav -r 48000 -b 16
+  check "$f" wav -r 48000 -b 24 -q medium
+  check "$f" wav -b 24
+  check "$f" flac -r 96000 -b 24
+done
+
+exit $failed
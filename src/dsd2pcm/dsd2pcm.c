@@ -32,128 +32,76 @@ or implied, of Sebastian Gesemann.
 #include <string.h>
 
 #include "dsd2pcm.h"
+#include "ctables.h"            /* ctables and bitreverse, see mkctables.c */
 
-#define HTAPS    48             /* number of FIR constants */
-#define FIFOSIZE 16             /* must be a power of two */
-#define FIFOMASK (FIFOSIZE-1)   /* bit mask for FIFO offsets */
-#define CTABLES ((HTAPS+7)/8)   /* number of "8 MACs" lookup tables */
-
-#if FIFOSIZE*8 < HTAPS*2
-#error "FIFOSIZE too small"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(DSD_NO_SIMD)
+#define DSD2PCM_X86_SIMD
+#include <immintrin.h>
 #endif
 
+#define MAXHISTORY (CTABLES_MAX*2-1) /* past octets needed for one output */
+#define BLOCK    4096           /* octets per channel per block */
+#define PAD      3              /* strided kernels read 3 octets past the end */
+
 /*
- * Properties of this 96-tap lowpass filter when applied on a signal
- * with sampling rate of 44100*64 Hz:
- *
- * () has a delay of 17 microseconds.
- *
- * () flat response up to 48 kHz
- *
- * () if you downsample afterwards by a factor of 8, the
- *    spectrum below 70 kHz is practically alias-free.
- *
- * () stopband rejection is about 160 dB
- *
- * The coefficient tables ("ctables") take only 6 Kibi Bytes and
- * should fit into a modern processor's fast cache.
+ * One filter per DSD rate (see mkctables.c). The filter for
+ * 44100*64*step Hz is 96*step taps long and only every step-th
+ * output is computed, so every rate is decimated to 352.8 kHz.
  */
+typedef struct {
+	unsigned step;                  /* input octets per output sample */
+	unsigned count;                 /* number of ctables */
+	const float (*ctables)[256];
+} filter;
+
+static const filter filters[] = {
+	{ 1, sizeof(ctables64)/sizeof(ctables64[0]), ctables64 },
+	{ 2, sizeof(ctables128)/sizeof(ctables128[0]), ctables128 },
+	{ 4, sizeof(ctables256)/sizeof(ctables256[0]), ctables256 },
+	{ 8, sizeof(ctables512)/sizeof(ctables512[0]), ctables512 }
+};
 
 /*
- * The 2nd half (48 coeffs) of a 96-tap symmetric lowpass filter
+ * The context keeps the input as one contiguous history-plus-block
+ * buffer instead of a ring FIFO: lin[] holds the octets msb first and
+ * rev[] holds the same octets bit-reversed, so the reversed half of the
+ * symmetric filter is prepared once per block. With H = 2*count-1,
+ * output sample t is
+ *
+ *   sum over i of ctables[i][lin[t-i]] + ctables[i][rev[t-H+i]]
+ *
+ * Neighbouring output samples read octets that are step apart, which
+ * is what lets the SIMD kernels compute several of them side by side.
+ * Every lane adds its terms in the same order as the scalar loop, so
+ * all kernels produce bit-identical output.
  */
-static const double htaps[HTAPS] = {
-  0.09950731974056658,
-  0.09562845727714668,
-  0.08819647126516944,
-  0.07782552527068175,
-  0.06534876523171299,
-  0.05172629311427257,
-  0.0379429484910187,
-  0.02490921351762261,
-  0.0133774746265897,
-  0.003883043418804416,
- -0.003284703416210726,
- -0.008080250212687497,
- -0.01067241812471033,
- -0.01139427235000863,
- -0.0106813877974587,
- -0.009007905078766049,
- -0.006828859761015335,
- -0.004535184322001496,
- -0.002425035959059578,
- -0.0006922187080790708,
-  0.0005700762133516592,
-  0.001353838005269448,
-  0.001713709169690937,
-  0.001742046839472948,
-  0.001545601648013235,
-  0.001226696225277855,
-  0.0008704322683580222,
-  0.0005381636200535649,
-  0.000266446345425276,
-  7.002968738383528e-05,
- -5.279407053811266e-05,
- -0.0001140625650874684,
- -0.0001304796361231895,
- -0.0001189970287491285,
- -9.396247155265073e-05,
- -6.577634378272832e-05,
- -4.07492895872535e-05,
- -2.17407957554587e-05,
- -9.163058931391722e-06,
- -2.017460145032201e-06,
-  1.249721855219005e-06,
-  2.166655190537392e-06,
-  1.930520892991082e-06,
-  1.319400334374195e-06,
-  7.410039764949091e-07,
-  3.423230509967409e-07,
-  1.244182214744588e-07,
-  3.130441005359396e-08
+struct dsd2pcm_ctx_s
+{
+	const filter *flt;
+	unsigned phase;                 /* offset of the next output */
+	unsigned char lin[MAXHISTORY+BLOCK+PAD];
+	unsigned char rev[MAXHISTORY+BLOCK+PAD];
 };
 
-static float ctables[CTABLES][256];
-static unsigned char bitreverse[256];
-static int precalculated = 0;
-
-static void precalc(void)
+extern dsd2pcm_ctx* dsd2pcm_init_rate(int multiple)
 {
-	int t, e, m, k;
-	double acc;
-	if (precalculated) return;
-	for (t=0, e=0; t<256; ++t) {
-		bitreverse[t] = e;
-		for (m=128; m && !((e^=m)&m); m>>=1)
-			;
+	dsd2pcm_ctx* ptr;
+	unsigned i;
+	for (i=0; i<sizeof(filters)/sizeof(filters[0]); ++i) {
+		if (filters[i].step == (unsigned)multiple) break;
 	}
-	for (t=0; t<CTABLES; ++t) {
-		k = HTAPS - t*8;
-		if (k>8) k=8;
-		for (e=0; e<256; ++e) {
-			acc = 0.0;
-			for (m=0; m<k; ++m) {
-				acc += (((e >> (7-m)) & 1)*2-1) * htaps[t*8+m];
-			}
-			ctables[CTABLES-1-t][e] = (float)acc;
-		}
+	if (i == sizeof(filters)/sizeof(filters[0])) return 0;
+	ptr = (dsd2pcm_ctx*) malloc(sizeof(dsd2pcm_ctx));
+	if (ptr) {
+		ptr->flt = &filters[i];
+		dsd2pcm_reset(ptr);
 	}
-	precalculated = 1;
+	return ptr;
 }
 
-struct dsd2pcm_ctx_s
-{
-	unsigned char fifo[FIFOSIZE];
-	unsigned fifopos;
-};
-
 extern dsd2pcm_ctx* dsd2pcm_init()
 {
-	dsd2pcm_ctx* ptr;
-	if (!precalculated) precalc();
-	ptr = (dsd2pcm_ctx*) malloc(sizeof(dsd2pcm_ctx));
-	if (ptr) dsd2pcm_reset(ptr);
-	return ptr;
+	return dsd2pcm_init_rate(1);
 }
 
 extern void dsd2pcm_destroy(dsd2pcm_ctx* ptr)
@@ -174,9 +122,15 @@ extern dsd2pcm_ctx* dsd2pcm_clone(dsd2pcm_ctx* ptr)
 extern void dsd2pcm_reset(dsd2pcm_ctx* ptr)
 {
 	int i;
-	for (i=0; i<FIFOSIZE; ++i)
-		ptr->fifo[i] = 0x69; /* my favorite silence pattern */
-	ptr->fifopos = 0;
+	for (i=0; i<MAXHISTORY; ++i) {
+		/* my favorite silence pattern, the older half a nibble
+		 * out of phase just like the old ring FIFO started out */
+		ptr->lin[i] = MAXHISTORY-i > (int)ptr->flt->count ? 0x96 : 0x69;
+		ptr->rev[i] = bitreverse[ptr->lin[i]];
+	}
+	memset(ptr->lin + MAXHISTORY, 0, BLOCK+PAD);
+	memset(ptr->rev + MAXHISTORY, 0, BLOCK+PAD);
+	ptr->phase = ptr->flt->step - 1;
 	/* 0x69 = 01101001
 	 * This pattern "on repeat" makes a low energy 352.8 kHz tone
 	 * and a high energy 1.0584 MHz tone which should be filtered
@@ -184,35 +138,241 @@ extern void dsd2pcm_reset(dsd2pcm_ctx* ptr)
 	 */
 }
 
-extern void dsd2pcm_translate(
-	dsd2pcm_ctx* ptr,
-	size_t samples,
-	const unsigned char *src, ptrdiff_t src_stride,
-	int lsbf,
+extern size_t dsd2pcm_history(dsd2pcm_ctx* ptr)
+{
+	return ptr->flt->count * 2 - 1;
+}
+
+static float* translate_linear(const filter *f, size_t t, size_t samples,
+	const unsigned char *lin, const unsigned char *rev,
 	float *dst, ptrdiff_t dst_stride)
 {
-	unsigned ffp;
+	const unsigned history = f->count*2-1;
 	unsigned i;
-	unsigned bite1, bite2;
-	unsigned char* p;
 	double acc;
-	ffp = ptr->fifopos;
-	lsbf = lsbf ? 1 : 0;
-	while (samples-- > 0) {
-		bite1 = *src & 0xFFu;
-		if (lsbf) bite1 = bitreverse[bite1];
-		ptr->fifo[ffp] = bite1; src += src_stride;
-		p = ptr->fifo + ((ffp-CTABLES) & FIFOMASK);
-		*p = bitreverse[*p & 0xFF];
+	for (; t<samples; t+=f->step) {
 		acc = 0;
-		for (i=0; i<CTABLES; ++i) {
-			bite1 = ptr->fifo[(ffp              -i) & FIFOMASK] & 0xFF;
-			bite2 = ptr->fifo[(ffp-(CTABLES*2-1)+i) & FIFOMASK] & 0xFF;
-			acc += ctables[i][bite1] + ctables[i][bite2];
+		for (i=0; i<f->count; ++i) {
+			acc += f->ctables[i][*(lin + t - i)]
+				+ f->ctables[i][*(rev + t - history + i)];
 		}
 		*dst = (float)acc; dst += dst_stride;
-		ffp = (ffp + 1) & FIFOMASK;
 	}
-	ptr->fifopos = ffp;
+	return dst;
+}
+
+/* returns the first output sample t left for translate_linear */
+typedef size_t (*linear_kernel)(const filter *f, size_t t, size_t samples,
+	const unsigned char *lin, const unsigned char *rev,
+	float **dst, ptrdiff_t dst_stride);
+
+#ifdef DSD2PCM_X86_SIMD
+
+__attribute__((target("sse4.1")))
+static size_t translate_linear_sse41(const filter *f, size_t t, size_t samples,
+	const unsigned char *lin, const unsigned char *rev,
+	float **dstp, ptrdiff_t dst_stride)
+{
+	const unsigned history = f->count*2-1, s = f->step;
+	unsigned i;
+	const unsigned char *p1, *p2;
+	float out[4], *dst = *dstp;
+	for (; t+3*s<samples; t+=4*s) {
+		__m128d lo = _mm_setzero_pd(), hi = _mm_setzero_pd();
+		for (i=0; i<f->count; ++i) {
+			const float *c = f->ctables[i];
+			__m128 sum;
+			p1 = lin + t - i;
+			p2 = rev + t - history + i;
+			sum = _mm_add_ps(
+				_mm_setr_ps(c[p1[0]], c[p1[s]], c[p1[2*s]], c[p1[3*s]]),
+				_mm_setr_ps(c[p2[0]], c[p2[s]], c[p2[2*s]], c[p2[3*s]]));
+			lo = _mm_add_pd(lo, _mm_cvtps_pd(sum));
+			hi = _mm_add_pd(hi, _mm_cvtps_pd(_mm_movehl_ps(sum, sum)));
+		}
+		if (dst_stride == 1) {
+			_mm_storeu_ps(dst, _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi)));
+			dst += 4;
+		} else {
+			_mm_storeu_ps(out, _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi)));
+			for (i=0; i<4; ++i) {
+				*dst = out[i]; dst += dst_stride;
+			}
+		}
+	}
+	*dstp = dst;
+	return t;
+}
+
+/* zero-extends the 8 octets p[0], p[s], ..., p[7*s] */
+__attribute__((target("avx2")))
+static inline __m256i octets_avx2(const unsigned char *p, unsigned s, __m256i offs)
+{
+	if (s == 1)
+		return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)p));
+	return _mm256_and_si256(_mm256_i32gather_epi32((const int*)p, offs, 1),
+		_mm256_set1_epi32(0xFF));
+}
+
+__attribute__((target("avx2")))
+static size_t translate_linear_avx2(const filter *f, size_t t, size_t samples,
+	const unsigned char *lin, const unsigned char *rev,
+	float **dstp, ptrdiff_t dst_stride)
+{
+	const unsigned history = f->count*2-1, s = f->step;
+	const __m256i offs = _mm256_mullo_epi32(
+		_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(s));
+	unsigned i;
+	float out[8], *dst = *dstp;
+	for (; t+7*s<samples; t+=8*s) {
+		__m256d lo = _mm256_setzero_pd(), hi = _mm256_setzero_pd();
+		__m256 r;
+		for (i=0; i<f->count; ++i) {
+			__m256i b1 = octets_avx2(lin + t - i, s, offs);
+			__m256i b2 = octets_avx2(rev + t - history + i, s, offs);
+			__m256 sum = _mm256_add_ps(
+				_mm256_i32gather_ps(f->ctables[i], b1, 4),
+				_mm256_i32gather_ps(f->ctables[i], b2, 4));
+			lo = _mm256_add_pd(lo, _mm256_cvtps_pd(_mm256_castps256_ps128(sum)));
+			hi = _mm256_add_pd(hi, _mm256_cvtps_pd(_mm256_extractf128_ps(sum, 1)));
+		}
+		r = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)),
+			_mm256_cvtpd_ps(hi), 1);
+		if (dst_stride == 1) {
+			_mm256_storeu_ps(dst, r);
+			dst += 8;
+		} else {
+			_mm256_storeu_ps(out, r);
+			for (i=0; i<8; ++i) {
+				*dst = out[i]; dst += dst_stride;
+			}
+		}
+	}
+	*dstp = dst;
+	return t;
+}
+
+/**
+ * copies unit stride octets to one history buffer and their bit
+ * reversed values (pshufb nibble lookup) to the other, returns the
+ * number of octets done
+ */
+__attribute__((target("ssse3")))
+static size_t fill_ssse3(const unsigned char *src, size_t n,
+	unsigned char *same, unsigned char *reversed)
+{
+	const __m128i nib = _mm_setr_epi8(0x0,0x8,0x4,0xc,0x2,0xa,0x6,0xe,
+	                                  0x1,0x9,0x5,0xd,0x3,0xb,0x7,0xf);
+	const __m128i low = _mm_set1_epi8(0x0f);
+	size_t j;
+	for (j=0; j+16<=n; j+=16) {
+		__m128i x = _mm_loadu_si128((const __m128i*)(src+j));
+		__m128i lo = _mm_shuffle_epi8(nib, _mm_and_si128(x, low));
+		__m128i hi = _mm_shuffle_epi8(nib,
+			_mm_and_si128(_mm_srli_epi16(x, 4), low));
+		_mm_storeu_si128((__m128i*)(same+j), x);
+		_mm_storeu_si128((__m128i*)(reversed+j),
+			_mm_or_si128(_mm_slli_epi16(lo, 4), hi));
+	}
+	return j;
+}
+
+#endif /* DSD2PCM_X86_SIMD */
+
+static linear_kernel select_kernel(void)
+{
+#ifdef DSD2PCM_X86_SIMD
+	if (__builtin_cpu_supports("avx2")) return translate_linear_avx2;
+	if (__builtin_cpu_supports("sse4.1")) return translate_linear_sse41;
+#endif
+	return NULL;
+}
+
+extern size_t dsd2pcm_translate_block(
+	dsd2pcm_ctx* ptr,
+	size_t samples,
+	const unsigned char *src, ptrdiff_t src_stride,
+	int lsbf,
+	float *dst, ptrdiff_t dst_stride)
+{
+	const filter *f = ptr->flt;
+	unsigned char *lin = ptr->lin + MAXHISTORY, *rev = ptr->rev + MAXHISTORY;
+	linear_kernel kernel;
+	size_t n, j, t, outputs = 0;
+	unsigned b;
+
+	kernel = select_kernel();
+	for (; samples>0; samples-=n) {
+		n = samples < BLOCK ? samples : BLOCK;
+		j = 0;
+#ifdef DSD2PCM_X86_SIMD
+		if (src_stride == 1 && __builtin_cpu_supports("ssse3")) {
+			j = lsbf ? fill_ssse3(src, n, rev, lin)
+			         : fill_ssse3(src, n, lin, rev);
+			src += j;
+		}
+#endif
+		if (lsbf) {
+			for (; j<n; ++j) {
+				b = *src; src += src_stride;
+				lin[j] = bitreverse[b];
+				rev[j] = b;
+			}
+		} else {
+			for (; j<n; ++j) {
+				b = *src; src += src_stride;
+				lin[j] = b;
+				rev[j] = bitreverse[b];
+			}
+		}
+		t = ptr->phase;
+		if (t < n) {
+			j = (n-1-t) / f->step + 1;  /* outputs in this block */
+			if (kernel) t = kernel(f, t, n, lin, rev, &dst, dst_stride);
+			dst = translate_linear(f, t, n, lin, rev, dst, dst_stride);
+			outputs += j;
+			ptr->phase += j * f->step;
+		}
+		ptr->phase -= n;
+		memmove(ptr->lin, ptr->lin + n, MAXHISTORY);
+		memmove(ptr->rev, ptr->rev + n, MAXHISTORY);
+	}
+	return outputs;
 }
 
+extern void dsd2pcm_translate(
+	dsd2pcm_ctx* ptr,
+	size_t samples,
+	const unsigned char *src, ptrdiff_t src_stride,
+	int lsbf,
+	float *dst, ptrdiff_t dst_stride)
+{
+	dsd2pcm_translate_block(ptr, samples, src, src_stride, lsbf,
+		dst, dst_stride);
+}
+
+/*
+ * The SIMD kernels put neighbouring output samples of one channel in
+ * their lanes, not the same sample of several channels: that fills all
+ * 4 (SSE4.1) or 8 (AVX2) lanes whatever the channel count, where lanes
+ * across channels would leave most of them idle for stereo. So all
+ * channels of a block go through here in one call, but one channel
+ * after the other, each at full vector width over its own history.
+ */
+extern size_t dsd2pcm_translate_multi(
+	dsd2pcm_ctx **ctx,
+	unsigned channels,
+	size_t samples,
+	const unsigned char *src, ptrdiff_t src_stride, ptrdiff_t src_chstride,
+	int lsbf,
+	float *dst, ptrdiff_t dst_stride, ptrdiff_t dst_chstride)
+{
+	unsigned ch;
+	size_t outputs = 0;
+	for (ch=0; ch<channels; ++ch) {
+		outputs = dsd2pcm_translate_block(ctx[ch], samples,
+			src + ch*src_chstride, src_stride, lsbf,
+			dst + ch*dst_chstride, dst_stride);
+	}
+	return outputs;
+}
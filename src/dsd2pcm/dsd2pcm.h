@@ -44,14 +44,23 @@ typedef struct dsd2pcm_ctx_s dsd2pcm_ctx;
 
 /**
  * initializes a "dsd2pcm engine" for one channel
- * (precomputes tables and allocates memory)
+ * (allocates memory)
  *
- * This is the only function that is not thread-safe in terms of the
- * POSIX thread-safety definition because it modifies global state
- * (lookup tables are computed during the first call)
+ * The lookup tables are constant data generated at build time, so
+ * this is thread-safe like every other function of the library.
  */
 extern dsd2pcm_ctx* dsd2pcm_init(void);
 
+/**
+ * initializes a "dsd2pcm engine" for one channel of a stream at
+ * 44100*64*multiple Hz, multiple = 1, 2, 4 or 8 (DSD64 .. DSD512).
+ * The engine uses a filter designed for that rate and decimates by
+ * 8*multiple, so every rate is converted to 352.8 kHz.
+ * dsd2pcm_init() is the same as dsd2pcm_init_rate(1).
+ * Returns NULL for other multiples.
+ */
+extern dsd2pcm_ctx* dsd2pcm_init_rate(int multiple);
+
 /**
  * deinitializes a "dsd2pcm engine"
  * (releases memory, don't forget!)
@@ -69,9 +78,32 @@ extern dsd2pcm_ctx* dsd2pcm_clone(dsd2pcm_ctx *ctx);
  */
 extern void dsd2pcm_reset(dsd2pcm_ctx *ctx);
 
+/**
+ * returns the number of past octets one output sample depends on.
+ * Once that many octets of a stream have been translated the output
+ * no longer depends on the state the engine started from.
+ */
+extern size_t dsd2pcm_history(dsd2pcm_ctx *ctx);
+
 /**
  * "translates" a stream of octets to a stream of floats
  * (8:1 decimation)
+ * Input is gathered into the context's contiguous history buffer and
+ * converted in blocks of 4096 octets, the block size of DSF and of the
+ * DSDIFF reader. Arguments are the same as for dsd2pcm_translate.
+ * Returns the number of floats written, which is fewer than samples
+ * for engines set up with dsd2pcm_init_rate(multiple > 1).
+ */
+extern size_t dsd2pcm_translate_block(dsd2pcm_ctx *ctx,
+	size_t samples,
+	const unsigned char *src, ptrdiff_t src_stride,
+	int lsbitfirst,
+	float *dst, ptrdiff_t dst_stride);
+
+/**
+ * "translates" a stream of octets to a stream of floats
+ * (8:1 decimation, kept for compatibility, same as
+ * dsd2pcm_translate_block)
  * @param ctx -- pointer to abstract context (buffers)
  * @param samples -- number of octets/samples to "translate"
  * @param src -- pointer to first octet (input)
@@ -86,6 +118,30 @@ extern void dsd2pcm_translate(dsd2pcm_ctx *ctx,
 	int lsbitfirst,
 	float *dst, ptrdiff_t dst_stride);
 
+/**
+ * "translates" all channels of a multichannel stream at once
+ * (8:1 decimation). Same result as calling dsd2pcm_translate_block
+ * once per channel, which is what it does: the SIMD kernels vectorize
+ * along time within a channel. Returns the number of floats written
+ * per channel.
+ * @param ctx -- array of contexts, one per channel
+ * @param channels -- number of channels
+ * @param samples -- number of octets/samples per channel to "translate"
+ * @param src -- pointer to first octet of the first channel (input)
+ * @param src_stride -- src pointer increment between samples
+ * @param src_chstride -- src pointer increment between channels
+ * @param lsbitfirst -- bitorder, 0=msb first, 1=lsbfirst
+ * @param dst -- pointer to first float of the first channel (output)
+ * @param dst_stride -- dst pointer increment between samples
+ * @param dst_chstride -- dst pointer increment between channels
+ */
+extern size_t dsd2pcm_translate_multi(dsd2pcm_ctx **ctx,
+	unsigned channels,
+	size_t samples,
+	const unsigned char *src, ptrdiff_t src_stride, ptrdiff_t src_chstride,
+	int lsbitfirst,
+	float *dst, ptrdiff_t dst_stride, ptrdiff_t dst_chstride);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
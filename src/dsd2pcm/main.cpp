@@ -37,13 +37,9 @@ or implied, of Sebastian Gesemann.
 
 namespace {
 
-const float my_ns_coeffs[] = {
-//     b1           b2           a1           a2
-  -1.62666423,  0.79410094,  0.61367127,  0.23311013,  // section 1
-  -1.44870017,  0.54196219,  0.03373857,  0.70316556   // section 2
-};
+const float *my_ns_coeffs = noise_shape_coeffs;    // see noiseshape.c
 
-const int my_ns_soscount = sizeof(my_ns_coeffs)/(sizeof(my_ns_coeffs[0])*4);
+const int my_ns_soscount = NOISE_SHAPE_SOS_COUNT;
 
 inline long myround(float x)
 {
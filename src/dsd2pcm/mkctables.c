@@ -0,0 +1,205 @@
+/*
+
+Copyright 2009, 2011 Sebastian Gesemann. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY SEBASTIAN GESEMANN ''AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SEBASTIAN GESEMANN OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of Sebastian Gesemann.
+
+ */
+
+/*
+ * mkctables -- writes the "8 MACs" lookup tables of the dsd2pcm
+ * filters and the bit reversal table as C source, so they end up as
+ * constant data instead of being computed on the first dsd2pcm_init().
+ * Run at build time:
+ *
+ *   mkctables > ctables.h
+ */
+
+#include <stdio.h>
+#include <math.h>
+
+#define DSD64_HTAPS 48          /* number of FIR constants at DSD64 */
+#define MAX_MULTIPLE 8          /* DSD512 */
+
+/*
+ * Properties of this 96-tap lowpass filter when applied on a signal
+ * with sampling rate of 44100*64 Hz:
+ *
+ * () has a delay of 17 microseconds.
+ *
+ * () flat response up to 48 kHz
+ *
+ * () if you downsample afterwards by a factor of 8, the
+ *    spectrum below 70 kHz is practically alias-free.
+ *
+ * () stopband rejection is about 160 dB
+ *
+ * The coefficient tables ("ctables") take only 6 Kibi Bytes and
+ * should fit into a modern processor's fast cache.
+ */
+
+/*
+ * The 2nd half (48 coeffs) of a 96-tap symmetric lowpass filter
+ */
+static const double htaps[DSD64_HTAPS] = {
+  0.09950731974056658,
+  0.09562845727714668,
+  0.08819647126516944,
+  0.07782552527068175,
+  0.06534876523171299,
+  0.05172629311427257,
+  0.0379429484910187,
+  0.02490921351762261,
+  0.0133774746265897,
+  0.003883043418804416,
+ -0.003284703416210726,
+ -0.008080250212687497,
+ -0.01067241812471033,
+ -0.01139427235000863,
+ -0.0106813877974587,
+ -0.009007905078766049,
+ -0.006828859761015335,
+ -0.004535184322001496,
+ -0.002425035959059578,
+ -0.0006922187080790708,
+  0.0005700762133516592,
+  0.001353838005269448,
+  0.001713709169690937,
+  0.001742046839472948,
+  0.001545601648013235,
+  0.001226696225277855,
+  0.0008704322683580222,
+  0.0005381636200535649,
+  0.000266446345425276,
+  7.002968738383528e-05,
+ -5.279407053811266e-05,
+ -0.0001140625650874684,
+ -0.0001304796361231895,
+ -0.0001189970287491285,
+ -9.396247155265073e-05,
+ -6.577634378272832e-05,
+ -4.07492895872535e-05,
+ -2.17407957554587e-05,
+ -9.163058931391722e-06,
+ -2.017460145032201e-06,
+  1.249721855219005e-06,
+  2.166655190537392e-06,
+  1.930520892991082e-06,
+  1.319400334374195e-06,
+  7.410039764949091e-07,
+  3.423230509967409e-07,
+  1.244182214744588e-07,
+  3.130441005359396e-08
+};
+
+/*
+ * DSD128, DSD256 and DSD512 get a Kaiser windowed sinc (beta 13) of
+ * 96*multiple taps with the cutoff at 150 kHz. Scaled to its own rate
+ * each one has about the same response as the DSD64 filter above when
+ * decimated to 352.8 kHz: flat up to 70 kHz, -13 dB at 176.4 kHz and
+ * at least 127 dB of stopband rejection from 282.8 kHz on.
+ */
+#define KAISER_BETA 13.0
+#define CUTOFF 150000.0
+
+static double bessel_i0(double x)
+{
+	double sum = 1.0, term = 1.0;
+	int k;
+	for (k=1; term > 1e-20*sum; ++k) {
+		term *= (x/(2*k)) * (x/(2*k));
+		sum += term;
+	}
+	return sum;
+}
+
+/* computes the 2nd half of the symmetric filter for DSD64*multiple */
+static void design(int multiple, double *half)
+{
+	int n, ntaps = 2*DSD64_HTAPS*multiple, htaps = DSD64_HTAPS*multiple;
+	double c = (ntaps-1) / 2.0;
+	double fc = CUTOFF / (44100.0*64*multiple);
+	double x, sum = 0.0;
+	for (n=0; n<htaps; ++n) {
+		x = n + 0.5;            /* distance from the center */
+		half[n] = sin(2*M_PI*fc*x) / (M_PI*x)
+			* bessel_i0(KAISER_BETA*sqrt(1 - (x/c)*(x/c)))
+			/ bessel_i0(KAISER_BETA);
+		sum += 2*half[n];
+	}
+	for (n=0; n<htaps; ++n)
+		half[n] /= sum;         /* unity gain at DC */
+}
+
+static void emit(int multiple, const double *half, int htaps)
+{
+	int ctables = (htaps+7)/8;
+	int t, e, m, k;
+	double acc;
+	printf("static const float ctables%d[%d][256] = {\n",
+		64*multiple, ctables);
+	for (t=ctables-1; t>=0; --t) {
+		k = htaps - t*8;
+		if (k>8) k=8;
+		printf("{");
+		for (e=0; e<256; ++e) {
+			acc = 0.0;
+			for (m=0; m<k; ++m) {
+				acc += (((e >> (7-m)) & 1)*2-1) * half[t*8+m];
+			}
+			printf("%s%.9ef", e == 0 ? "\n  " : e % 4 ? ", " : ",\n  ",
+				(double)(float)acc);
+		}
+		printf("\n}%s\n", t ? "," : "");
+	}
+	printf("};\n\n");
+}
+
+static void emit_bitreverse(void)
+{
+	int t, e, m;
+	printf("static const unsigned char bitreverse[256] = {");
+	for (t=0, e=0; t<256; ++t) {
+		printf("%s0x%02x", t == 0 ? "\n  " : t % 8 ? ", " : ",\n  ", e);
+		for (m=128; m && !((e^=m)&m); m>>=1)
+			;
+	}
+	printf("\n};\n\n");
+}
+
+int main(void)
+{
+	static double half[DSD64_HTAPS*MAX_MULTIPLE];
+	int multiple;
+	printf("/* generated by mkctables, do not edit */\n\n");
+	emit_bitreverse();
+	printf("#define CTABLES_MAX %d\n\n", (DSD64_HTAPS*MAX_MULTIPLE+7)/8);
+	emit(1, htaps, DSD64_HTAPS);
+	for (multiple=2; multiple<=MAX_MULTIPLE; multiple*=2) {
+		design(multiple, half);
+		emit(multiple, half, DSD64_HTAPS*multiple);
+	}
+	return 0;
+}
@@ -33,22 +33,70 @@ or implied, of Sebastian Gesemann.
 
 #include "noiseshape.h"
 
-extern int noise_shape_init(
+const float noise_shape_coeffs[NOISE_SHAPE_SOS_COUNT*4] = {
+//     b1           b2           a1           a2
+  -1.62666423,  0.79410094,  0.61367127,  0.23311013,  // section 1
+  -1.44870017,  0.54196219,  0.03373857,  0.70316556   // section 2
+};
+
+/*
+ * The others put their noise where it is least heard at their rate:
+ * 44.1 kHz weights it by the threshold of hearing, at most +18 dB, the
+ * higher rates move it above 20 kHz, at most +20 dB. Each section is
+ * (1 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2) of the noise.
+ */
+static const float ns_coeffs_176k[2*4] = {
+  -1.70061863,  0.79504822, -1.14991511,  0.90250000,  // section 1
+  -1.55685595,  0.95943206, -0.07624453,  0.32493886   // section 2
+};
+
+static const float ns_coeffs_88k[2*4] = {
+  -1.05586062,  0.41935980,  0.85626999,  0.38366280,  // section 1
+  -0.50800604,  0.89209368,  0.38793918,  0.73654617   // section 2
+};
+
+static const float ns_coeffs_44k[2*4] = {
+  -0.27118046,  0.69040834,  0.22613769,  0.01278456,  // section 1
+  -1.39527933,  0.69923617,  0.63562005,  0.60406081   // section 2
+};
+
+static const float ns_coeffs_flat[1*4] = {
+   0.0,         0.0,         0.0,         0.0
+};
+
+/*
+ * highest rate first. At 352.8 kHz the DSD noise above the audio band
+ * dithers the signal, below that the decimators have removed it.
+ */
+static const noise_shape_filter ns_filters[] = {
+	{ 300000, NOISE_SHAPE_SOS_COUNT, noise_shape_coeffs, 0.f },
+	{ 150000, 2, ns_coeffs_176k, 1.f },
+	{  80000, 2, ns_coeffs_88k, 1.f },
+	{  44100, 2, ns_coeffs_44k, 1.f },
+	{      0, 1, ns_coeffs_flat, 1.f }
+};
+
+extern const noise_shape_filter *noise_shape_filter_for(int rate)
+{
+	int i;
+	for (i=0; ns_filters[i].min_rate > rate; ++i);
+	return &ns_filters[i];
+}
+
+extern int noise_shape_init_lanes(
 	noise_shape_ctx *ctx,
 	int sos_count,
-	const float *coeffs)
+	const float *coeffs,
+	int lanes)
 {
-	int i;
 	ctx->sos_count = sos_count;
 	ctx->bbaa = coeffs;
-	ctx->t1 = (float*) malloc(sizeof(float)*sos_count);
+	ctx->lanes = lanes;
+	ctx->t1 = (float*) malloc(sizeof(float)*sos_count*lanes);
 	if (!ctx->t1) goto escape1;
-	ctx->t2 = (float*) malloc(sizeof(float)*sos_count);
+	ctx->t2 = (float*) malloc(sizeof(float)*sos_count*lanes);
 	if (!ctx->t2) goto escape2;
-	for (i=0; i<sos_count; ++i) {
-		ctx->t1[i] = 0.f;
-		ctx->t2[i] = 0.f;
-	}
+	noise_shape_reset(ctx);
 	return 0;
 escape2:
 	free(ctx->t1);
@@ -56,6 +104,24 @@ escape1:
 	return -1;
 }
 
+extern int noise_shape_init(
+	noise_shape_ctx *ctx,
+	int sos_count,
+	const float *coeffs)
+{
+	return noise_shape_init_lanes(ctx,sos_count,coeffs,1);
+}
+
+extern void noise_shape_reset(
+	noise_shape_ctx *ctx)
+{
+	int i;
+	for (i=0; i<ctx->sos_count*ctx->lanes; ++i) {
+		ctx->t1[i] = 0.f;
+		ctx->t2[i] = 0.f;
+	}
+}
+
 extern void noise_shape_destroy(
 	noise_shape_ctx *ctx)
 {
@@ -67,14 +133,16 @@ extern int noise_shape_clone(
 	const noise_shape_ctx *from,
 	noise_shape_ctx *to)
 {
+	const size_t size = sizeof(float)*from->sos_count*from->lanes;
 	to->sos_count = from->sos_count;
 	to->bbaa = from->bbaa;
-	to->t1 = (float*) malloc(sizeof(float)*to->sos_count);
+	to->lanes = from->lanes;
+	to->t1 = (float*) malloc(size);
 	if (!to->t1) goto error1;
-	to->t2 = (float*) malloc(sizeof(float)*to->sos_count);
+	to->t2 = (float*) malloc(size);
 	if (!to->t2) goto error2;
-	memcpy(to->t1,from->t1,sizeof(float)*to->sos_count);
-	memcpy(to->t2,from->t2,sizeof(float)*to->sos_count);
+	memcpy(to->t1,from->t1,size);
+	memcpy(to->t2,from->t2,size);
 	return 0;
 error2:
 	free(to->t1);
@@ -82,7 +150,7 @@ error1:
 	return -1;
 }
 
-extern float noise_shape_get(noise_shape_ctx *ctx)
+extern float noise_shape_get_lane(noise_shape_ctx *ctx, int lane)
 {
 	int i;
 	float acc;
@@ -90,24 +158,38 @@ extern float noise_shape_get(noise_shape_ctx *ctx)
 	acc = 0.0;
 	c = ctx->bbaa;
 	for (i=0; i<ctx->sos_count; ++i) {
-		float t1i = ctx->t1[i];
-		float t2i = ctx->t2[i];
-		ctx->t2[i] = acc -= t1i * c[2] + t2i * c[3];
+		float t1i = ctx->t1[i*ctx->lanes + lane];
+		float t2i = ctx->t2[i*ctx->lanes + lane];
+		ctx->t2[i*ctx->lanes + lane] = acc -= t1i * c[2] + t2i * c[3];
 		acc += t1i * c[0] + t2i * c[1];
 		c += 4;
 	}
 	return acc;
 }
 
-extern void noise_shape_update(noise_shape_ctx *ctx, float qerror)
+extern void noise_shape_update_lane(noise_shape_ctx *ctx, int lane, float qerror)
 {
-	float *p;
 	int i;
 	for (i=0; i<ctx->sos_count; ++i) {
-		ctx->t2[i] += qerror;
+		ctx->t2[i*ctx->lanes + lane] += qerror;
 	}
+}
+
+extern void noise_shape_next(noise_shape_ctx *ctx)
+{
+	float *p;
 	p = ctx->t1;
 	ctx->t1 = ctx->t2;
 	ctx->t2 = p;
 }
 
+extern float noise_shape_get(noise_shape_ctx *ctx)
+{
+	return noise_shape_get_lane(ctx,0);
+}
+
+extern void noise_shape_update(noise_shape_ctx *ctx, float qerror)
+{
+	noise_shape_update_lane(ctx,0,qerror);
+	noise_shape_next(ctx);
+}
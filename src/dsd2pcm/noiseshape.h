@@ -38,9 +38,39 @@ extern "C" {
 typedef struct noise_shape_ctx_s {
 	int sos_count;      /* number of second order sections */
 	const float *bbaa;  /* filter coefficients, owned by user */
-	float *t1, *t2;     /* filter state, owned by ns library */
+	float *t1, *t2;     /* filter state, owned by ns library,
+	                       [section*lanes + lane] */
+	int lanes;          /* independent shapers sharing the filter */
 } noise_shape_ctx;
 
+/**
+ * the noise shaping filter of dsd2pcm's main.cpp (b1 b2 a1 a2 per
+ * section), made for 352.8 kHz output
+ */
+#define NOISE_SHAPE_SOS_COUNT 2
+extern const float noise_shape_coeffs[NOISE_SHAPE_SOS_COUNT*4];
+
+/**
+ * noise shaping filter for 16 bit output at rates from min_rate up
+ * to the next filter's, with the peak of the TPDF dither (in LSB) to
+ * quantize with, 0 for none
+ */
+typedef struct noise_shape_filter_s {
+	int min_rate;
+	int sos_count;
+	const float *coeffs;
+	float dither;
+} noise_shape_filter;
+
+#define NOISE_SHAPE_MAX_SOS 2
+
+/**
+ * the filter for output at rate: noise_shape_coeffs at 352.8 kHz,
+ * others made for 176.4, 88.2 and 44.1 kHz (and the 48 kHz rates),
+ * no shaping below 44.1 kHz
+ */
+extern const noise_shape_filter *noise_shape_filter_for(int rate);
+
 /**
  * initializes a noise_shaper context
  * returns an error code or 0
@@ -50,6 +80,24 @@ extern int noise_shape_init(
 	int sos_count,
 	const float *coeffs);
 
+/**
+ * initializes a noise_shaper context for lanes channels that are
+ * shaped side by side, e.g. by SIMD code working on the state arrays
+ * directly. noise_shape_init is the same with one lane.
+ * returns an error code or 0
+ */
+extern int noise_shape_init_lanes(
+	noise_shape_ctx *ctx,
+	int sos_count,
+	const float *coeffs,
+	int lanes);
+
+/**
+ * resets the state of all lanes for a fresh new stream
+ */
+extern void noise_shape_reset(
+	noise_shape_ctx *ctx);
+
 /**
  * destroys a noise_shaper context
  */
@@ -79,6 +127,20 @@ extern float noise_shape_get(
 extern void noise_shape_update(
 	noise_shape_ctx *ctx, float qerror);
 
+/**
+ * noise_shape_get and noise_shape_update for one lane. Once every
+ * lane has had both for a sample, noise_shape_next moves all of them
+ * on to the next one.
+ */
+extern float noise_shape_get_lane(
+	noise_shape_ctx *ctx, int lane);
+
+extern void noise_shape_update_lane(
+	noise_shape_ctx *ctx, int lane, float qerror);
+
+extern void noise_shape_next(
+	noise_shape_ctx *ctx);
+
 #ifdef __cpluspluc
 } /* extern "C" */
 #endif
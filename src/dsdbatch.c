@@ -0,0 +1,478 @@
+/*
+ *  dsdbatch - DSD library to PCM WAV/FLAC.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <fcntl.h>
+#include "libdsd/libdsd.h"
+#include "dsdplay.h"
+
+/*
+** Converts every DSF/DSDIFF file of the given directory trees, files or
+** file lists to WAV or FLAC on a fixed pool of worker threads. The
+** options mean what they do for dsdplay and convert the same way
+** (options.c), so a file comes out as dsdplay -f wav/flac makes it.
+**
+** Each file is split into time segments (libdsd segment.c). A worker
+** opens the next file of the list and converts its segments. When no
+** file is left to open it steals segments from the open file that has
+** the most of them left, so one long file at the end does not leave the
+** other workers idle. Whichever worker completes the next segment of a
+** file in order writes it out. Converters are kept per worker and reset
+** between segments and files.
+**
+** A file is written to <name>.wav.part (or .flac.part) and renamed when
+** complete, and files whose output exists are skipped, so an interrupted
+** run continues where it stopped. Inputs that would share an output name
+** (a.dsf and a.dff) keep their extension in it (a.dff.wav).
+*/
+
+typedef struct {
+  gchar *path;
+  gchar *out;                  // final .wav or .flac
+  gchar *part;                 // written while converting
+  dsdfile *file;
+  dsdconverter *conv;          // template for the segments
+  dsdsegments *sg;
+  int fd;                      // -1 until opened
+  dsdwriter *w;
+  double seconds;              // audio in the file
+
+  // below under batch.lock
+  bool ready;                  // opened, segments may be handed out
+  bool failed;
+  bool writing;                // a worker is writing segments
+  bool closed;
+  guint count;                 // segments
+  guint next;                  // next segment to hand out
+  guint running;               // segments being converted
+  guint written;               // segments written
+  bool *done;                  // converted segments
+} job;
+
+typedef struct {
+  job *jobs;
+  guint num_jobs;
+  guint opened;                // jobs handed to a worker to open
+  guint finished;              // jobs closed
+  guint window;                // segments of a file converted ahead of writing
+  guint32 freq_limit;
+  resamplequality quality;
+  guint32 read_kb;
+  pcmformat format;
+  outputtype type;
+  double seconds;              // audio converted
+  guint failures;
+  GMutex lock;
+  GCond cond;
+} batch;
+
+void error(char *msg) {
+  fprintf(stderr, "ERROR: %s\n", msg);
+  exit(1);
+}
+
+static bool write_output(const guchar *data, gsize size, gpointer user_data) {
+  return writer_write(((job *)user_data)->w, data, size);
+}
+
+/* runs without the lock, nobody else looks at the job before ready */
+static bool open_job(batch *b, job *j) {
+  guint32 frequency, rate;
+  guint halfrate, ratio;
+  bool dop = FALSE;
+  gchar *dir;
+
+  if (!(j->file = dsd_open(j->path))) return FALSE;
+  if (!dsd_set_read_size(j->file, b->read_kb * 1024)) return FALSE;
+
+  frequency = plan_conversion(dsd_sample_frequency(j->file), b->freq_limit, &dop,
+			      &halfrate, &ratio);
+  rate = output_rate(dop, frequency, ratio, b->freq_limit);
+  j->seconds = (double)(j->file->sample_stop - j->file->sample_offset) * 8 / frequency;
+
+  if (!(j->conv = init_converter(&j->file->buffer, dsd_sample_frequency(j->file), dop,
+				 halfrate, ratio, b->format)))
+    return FALSE;
+  if (!converter_set_rate(j->conv, rate, b->quality)) return FALSE;
+  if (!(j->sg = init_segments(j->file, j->conv))) return FALSE;
+  j->count = segments_count(j->sg);
+  j->done = (bool *)calloc(MAX(j->count, 1), sizeof(bool));
+
+  dir = g_path_get_dirname(j->out);
+  g_mkdir_with_parents(dir, 0755);
+  g_free(dir);
+  // exclusive: two jobs writing one file must fail, not mix their output
+  if ((j->fd = open(j->part, O_WRONLY | O_CREAT | O_EXCL, 0644)) < 0) return FALSE;
+  j->w = init_writer(j->fd, b->type, dsd_channels(j->file), rate, b->format);
+
+  return j->w != NULL;
+}
+
+/* runs without the lock by the worker that set closed */
+static void close_job(job *j) {
+  bool ok = !j->failed;
+
+  if (j->fd >= 0) {
+    ok = close_writer(j->w) && ok;
+    ok = (close(j->fd) == 0) && ok;
+    if (ok)
+      ok = rename(j->part, j->out) == 0;
+    if (!ok)
+      unlink(j->part);
+  }
+  free_segments(j->sg);
+  free_converter(j->conv);
+  if (j->file) dsd_close(j->file);
+  free(j->done);
+
+  j->failed = !ok;
+  fprintf(stderr, "%s %s\n", ok ? "done" : "FAILED", j->path);
+}
+
+/*
+** Called with the lock held after a segment of j is done. Writes the
+** segments that are next in order unless another worker already does,
+** and closes the job when nothing more will come.
+*/
+static void write_ready(batch *b, job *j) {
+  bool ok;
+
+  if (j->writing) return;
+  j->writing = TRUE;
+
+  while (!j->failed && j->written < j->count && j->done[j->written]) {
+    g_mutex_unlock(&b->lock);
+    ok = segments_write(j->sg, j->written, write_output, j);
+    g_mutex_lock(&b->lock);
+    if (!ok) j->failed = TRUE;
+    j->written++;
+  }
+
+  if (!j->closed && (j->written == j->count || (j->failed && j->running == 0))) {
+    j->closed = TRUE;
+    g_mutex_unlock(&b->lock);
+    close_job(j);
+    g_mutex_lock(&b->lock);
+    b->finished++;
+    if (j->failed)
+      b->failures++;
+    else
+      b->seconds += j->seconds;
+    g_cond_broadcast(&b->cond);
+  }
+
+  j->writing = FALSE;
+}
+
+static bool claimable(batch *b, job *j) {
+  return j && j->ready && !j->failed && j->next < j->count &&
+    j->next < j->written + b->window;
+}
+
+/* the open job with the most segments left to hand out */
+static job *steal(batch *b) {
+  job *best = NULL;
+  guint i;
+
+  for (i = 0; i < b->opened; i++) {
+    job *j = &b->jobs[i];
+    if (claimable(b, j) && (!best || j->count - j->next > best->count - best->next))
+      best = j;
+  }
+
+  return best;
+}
+
+static gpointer batch_worker(gpointer data) {
+  batch *b = (batch *)data;
+  dsdconverter *conv = NULL;
+  job *own = NULL, *j;
+  guint i;
+  bool ok;
+
+  g_mutex_lock(&b->lock);
+  while (b->finished < b->num_jobs) {
+    if (claimable(b, own))
+      j = own;
+    else if (b->opened < b->num_jobs) {
+      own = &b->jobs[b->opened++];
+      g_mutex_unlock(&b->lock);
+      ok = open_job(b, own);
+      g_mutex_lock(&b->lock);
+      own->failed = !ok;
+      own->ready = TRUE;
+      write_ready(b, own);
+      g_cond_broadcast(&b->cond);
+      continue;
+    } else if (!(j = steal(b))) {
+      g_cond_wait(&b->cond, &b->lock);
+      continue;
+    }
+
+    i = j->next++;
+    j->running++;
+    g_mutex_unlock(&b->lock);
+    ok = segments_convert(j->sg, i, &conv);
+    g_mutex_lock(&b->lock);
+    j->running--;
+    j->done[i] = TRUE;
+    if (!ok) j->failed = TRUE;
+    write_ready(b, j);
+    g_cond_broadcast(&b->cond);
+  }
+  g_mutex_unlock(&b->lock);
+
+  free_converter(conv);
+
+  return NULL;
+}
+
+static bool dsd_extension(const gchar *name) {
+  const gchar *ext = strrchr(name, '.');
+  return ext && (!g_ascii_strcasecmp(ext, ".dsf") || !g_ascii_strcasecmp(ext, ".dff"));
+}
+
+/* the jobs collected so far and every output name they have taken */
+typedef struct {
+  GPtrArray *jobs;
+  GHashTable *outputs;
+} joblist;
+
+/* outdir/<name><ext>, NULL if another input has taken it */
+static gchar *output_name(joblist *jl, const gchar *outdir, const gchar *name,
+			  const gchar *ext) {
+  gchar *file = g_strconcat(name, ext, NULL);
+  gchar *out = g_build_filename(outdir, file, NULL);
+
+  g_free(file);
+  if (g_hash_table_contains(jl->outputs, out)) {
+    g_free(out);
+    return NULL;
+  }
+  g_hash_table_add(jl->outputs, g_strdup(out));
+  return out;
+}
+
+/*
+** queues path to be converted to outdir/<stem><ext>, or outdir/<name><ext>
+** if another input has that, unless the output exists
+*/
+static void add_file(joblist *jl, const gchar *path, const gchar *outdir,
+		     const gchar *ext) {
+  gchar *base = g_path_get_basename(path), *stem, *out;
+  job *j;
+
+  stem = g_strndup(base, strrchr(base, '.') ? (gsize)(strrchr(base, '.') - base) : strlen(base));
+  if (!(out = output_name(jl, outdir, stem, ext)))
+    out = output_name(jl, outdir, base, ext);
+  g_free(base);
+  g_free(stem);
+  if (!out) {
+    fprintf(stderr, "duplicate %s\n", path);
+    return;
+  }
+
+  j = (job *)calloc(1, sizeof(job));
+  j->path = g_strdup(path);
+  j->fd = -1;
+  j->out = out;
+  j->part = g_strconcat(j->out, ".part", NULL);
+
+  if (g_file_test(j->out, G_FILE_TEST_EXISTS)) {
+    fprintf(stderr, "skip %s\n", j->path);
+    g_free(j->path);
+    g_free(j->out);
+    g_free(j->part);
+    free(j);
+    return;
+  }
+  unlink(j->part);             // left by an interrupted run
+  g_ptr_array_add(jl->jobs, j);
+}
+
+static gint compare_names(gconstpointer a, gconstpointer b) {
+  return strcmp(*(const gchar **)a, *(const gchar **)b);
+}
+
+/* the tree under dir is mirrored under outdir */
+static void add_tree(joblist *jl, const gchar *dir, const gchar *outdir,
+		     const gchar *ext) {
+  GPtrArray *names = g_ptr_array_new();
+  GDir *d;
+  const gchar *name;
+  guint i;
+
+  if (!(d = g_dir_open(dir, 0, NULL))) {
+    fprintf(stderr, "cannot read %s\n", dir);
+    return;
+  }
+  while ((name = g_dir_read_name(d)))
+    g_ptr_array_add(names, g_strdup(name));
+  g_dir_close(d);
+  g_ptr_array_sort(names, compare_names);
+
+  for (i = 0; i < names->len; i++) {
+    gchar *path = g_build_filename(dir, g_ptr_array_index(names, i), NULL);
+    if (g_file_test(path, G_FILE_TEST_IS_DIR)) {
+      gchar *sub = g_build_filename(outdir, g_ptr_array_index(names, i), NULL);
+      add_tree(jl, path, sub, ext);
+      g_free(sub);
+    } else if (dsd_extension(path))
+      add_file(jl, path, outdir, ext);
+    g_free(path);
+    g_free(g_ptr_array_index(names, i));
+  }
+  g_ptr_array_free(names, TRUE);
+}
+
+static void add_path(joblist *jl, const gchar *path, const gchar *outdir,
+		     const gchar *ext) {
+  gchar *dir;
+
+  if (g_file_test(path, G_FILE_TEST_IS_DIR)) {
+    add_tree(jl, path, outdir ? outdir : path, ext);
+  } else {
+    dir = g_path_get_dirname(path);
+    add_file(jl, path, outdir ? outdir : dir, ext);
+    g_free(dir);
+  }
+}
+
+static void add_list(joblist *jl, const gchar *list, const gchar *outdir,
+		     const gchar *ext) {
+  char line[4096];
+  FILE *f;
+
+  if (!(f = fopen(list, "r"))) error("cannot open file list!");
+  while (fgets(line, sizeof(line), f)) {
+    g_strstrip(line);
+    if (line[0] != '\0')
+      add_path(jl, line, outdir, ext);
+  }
+  fclose(f);
+}
+
+int main(int argc, char *argv[]) {
+  batch b;
+  joblist list = { g_ptr_array_new(), g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL) };
+  joblist *jl = &list;
+  GPtrArray *lists = g_ptr_array_new(), *paths = g_ptr_array_new();
+  GThread **workers;
+  char *outdir = NULL;
+  const gchar *ext;
+  guint threads = 0, i;
+  gint64 t;
+
+  memset(&b, 0, sizeof(b));
+  b.format = PCM_S24LE;
+  b.type = OUTPUT_WAV;
+  b.quality = RESAMPLE_HIGH;
+  b.read_kb = 64;
+
+  for (i = 1; i < (guint)argc; i++) {
+    if (argv[i][0] == '-') {
+      if (i + 1 >= (guint)argc) error("Missing option value!");
+      switch (argv[i][1]) {
+      case 'o':
+	outdir = argv[i+1];
+	break;
+      case 'r':
+	b.freq_limit = atol(argv[i+1]);
+	break;
+      case 'b':
+	if (!parse_format(argv[i+1], &b.format)) error("Unknown sample format!");
+	break;
+      case 'f':
+	if (!parse_output(argv[i+1], &b.type) || b.type == OUTPUT_RAW)
+	  error("Unknown output type!");
+	break;
+      case 'q':
+	if (!parse_quality(argv[i+1], &b.quality)) error("Unknown resampler quality!");
+	break;
+      case 'k':
+	b.read_kb = atol(argv[i+1]);
+	break;
+      case 'j':
+	threads = atol(argv[i+1]);
+	break;
+      case 'l':
+	g_ptr_array_add(lists, argv[i+1]);
+	break;
+      default:
+	error("Unknown option!");
+      }
+      i++;
+    } else {
+      g_ptr_array_add(paths, argv[i]);
+    }
+  }
+
+  b.format = output_format(b.type, b.format);
+  ext = b.type == OUTPUT_FLAC ? ".flac" : ".wav";
+
+  for (i = 0; i < paths->len; i++)
+    add_path(jl, g_ptr_array_index(paths, i), outdir, ext);
+  for (i = 0; i < lists->len; i++)
+    add_list(jl, g_ptr_array_index(lists, i), outdir, ext);
+
+  if (threads == 0) threads = g_get_num_processors();
+  b.num_jobs = jl->jobs->len;
+  b.jobs = (job *)calloc(MAX(b.num_jobs, 1), sizeof(job));
+  for (i = 0; i < b.num_jobs; i++) {
+    b.jobs[i] = *(job *)g_ptr_array_index(jl->jobs, i);
+    free(g_ptr_array_index(jl->jobs, i));
+  }
+  b.window = 2 * threads;
+  g_mutex_init(&b.lock);
+  g_cond_init(&b.cond);
+
+  t = g_get_monotonic_time();
+  workers = (GThread **)malloc(threads * sizeof(GThread *));
+  for (i = 0; i < threads; i++)
+    workers[i] = g_thread_new("dsd-batch", batch_worker, &b);
+  for (i = 0; i < threads; i++)
+    g_thread_join(workers[i]);
+  t = g_get_monotonic_time() - t;
+
+  printf("%u files, %u failed, %.1f s of audio in %.1f s, %.1fx realtime\n",
+	 b.num_jobs, b.failures, b.seconds, t / 1e6,
+	 t > 0 ? b.seconds * 1e6 / t : 0.0);
+
+  for (i = 0; i < b.num_jobs; i++) {
+    g_free(b.jobs[i].path);
+    g_free(b.jobs[i].out);
+    g_free(b.jobs[i].part);
+  }
+  free(b.jobs);
+  free(workers);
+  g_ptr_array_free(jl->jobs, TRUE);
+  g_hash_table_destroy(jl->outputs);
+  g_ptr_array_free(lists, TRUE);
+  g_ptr_array_free(paths, TRUE);
+  g_mutex_clear(&b.lock);
+  g_cond_clear(&b.cond);
+
+  return b.failures ? 1 : 0;
+}
@@ -21,24 +21,244 @@
 #include <glib.h>
 #include <stdio.h>
 #include <unistd.h>
-#include <sys/wait.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include "libdsd/libdsd.h"
+#include "dsdplay.h"
 
 void error(char *msg) {
   fprintf(stderr, "ERROR: %s\n", msg);
   exit(1);
 }
 
+static void usage(void) {
+  fprintf(stderr,
+	  "usage: dsdplay [options] [file.dsf|file.dff]   (stdin without a file)\n"
+	  "  -o <file>     output file, - is stdout (default)\n"
+	  "  -f flac|wav|raw  output type (flac)\n"
+	  "  -b 16|24|32|f32  PCM sample format (24, FLAC is 16 or 24 bit)\n"
+	  "  -u            DoP instead of PCM\n"
+	  "  -r <Hz>       highest output rate, resampled if need be (no limit)\n"
+	  "  -q low|medium|high  resampler quality (high)\n"
+	  "  -s <m:s>      start at\n"
+	  "  -e <m:s>      stop at\n"
+	  "  -k <KiB>      read size per channel (64)\n"
+	  "  -a <n>        read ahead n reads on a reader thread (0 = off)\n"
+	  "  -t <n>        threads converting the channels, 0 = one per channel\n"
+	  "                up to the number of cores (0)\n"
+	  "  -d <n>        threads decoding DST compressed DSDIFF, 0 = one per\n"
+	  "                core (0)\n"
+	  "  -j <n>        offline: convert pieces of the file on n cores, 0 = all\n"
+	  "  -p <KiB>      capacity of a pipe on the output\n"
+	  "  -v            report how long the read ahead made conversion wait\n"
+	  "  -S <socket>   run as a transcode server on socket\n"
+	  "  -C <socket>   convert on the server at socket\n");
+  exit(1);
+}
+
+/*
+** Threaded pipeline: reader thread (libdsd read-ahead) -> converter
+** thread -> writer (main thread), connected by lock-free SPSC rings of
+** preallocated slots.
+*/
+typedef struct {
+  guchar *data;
+  gsize size;
+} pcmslot;
+
+typedef struct {
+  dsdreader *reader;
+  dsdconverter *conv;
+  dsdring *ring;
+  pcmslot *slots;
+} convstage;
+
+static gpointer convert_stage(gpointer data) {
+  convstage *cs = (convstage *)data;
+  dsdbuffer *ibuffer;
+  gint n;
+
+  while ((n = ring_write_slot(cs->ring)) >= 0 && (ibuffer = dsd_read_ahead(cs->reader))) {
+    cs->slots[n].size = dsd_convert(cs->conv, ibuffer, cs->slots[n].data);
+    ring_push(cs->ring);
+  }
+  while (n >= 0 && (n = ring_write_slot(cs->ring)) >= 0 &&
+	 (cs->slots[n].size = converter_finish(cs->conv, cs->slots[n].data)) > 0)
+    ring_push(cs->ring);
+  ring_close(cs->ring);
+
+  return NULL;
+}
+
+static bool run_pipeline(dsdfile *file, dsdconverter *conv, guint depth, bool verbose,
+			 dsdwrite write, gpointer user_data) {
+  convstage cs;
+  GThread *thread;
+  guint i;
+  gint n;
+  bool ok = TRUE;
+
+  cs.reader = init_reader(file, depth);
+  cs.conv = conv;
+  cs.ring = init_ring(depth);
+  cs.slots = (pcmslot *)malloc(ring_size(cs.ring) * sizeof(pcmslot));
+  for (i = 0; i < ring_size(cs.ring); i++)
+    cs.slots[i].data = (guchar *)malloc(converter_max_output(conv));
+  thread = g_thread_new("dsd-convert", convert_stage, &cs);
+
+  while (ok && (n = ring_read_slot(cs.ring)) >= 0) {
+    ok = write(cs.slots[n].data, cs.slots[n].size, user_data);
+    ring_pop(cs.ring);
+  }
+  if (!ok) ring_cancel(cs.ring);
+
+  g_thread_join(thread);
+  if (verbose)
+    fprintf(stderr, "read wait: %.3f s\n", reader_wait_time(cs.reader) / 1e6);
+  free_reader(cs.reader);
+  for (i = 0; i < ring_size(cs.ring); i++)
+    free(cs.slots[i].data);
+  free(cs.slots);
+  free_ring(cs.ring);
+
+  return ok;
+}
+
+static bool write_output(const guchar *data, gsize size, gpointer user_data) {
+  return writer_write((dsdwriter *)user_data, data, size);
+}
+
+static int open_output(const char *outfile) {
+  int fd = strcmp(outfile, "-") ? open(outfile, O_WRONLY | O_CREAT | O_TRUNC, 0644) : 1;
+
+  if (fd < 0) error("could not open output file!");
+  return fd;
+}
+
+/* a pipe to the consumer is raised to pipe_kb, if set */
+static dsdwriter *start_output(int out, outputtype type, guint channels, guint32 rate,
+			       pcmformat format, guint32 pipe_kb) {
+  dsdwriter *w = init_writer(out, type, channels, rate, format);
+
+  if (!w) error("could not write output!");
+  if (pipe_kb && !writer_set_pipe_size(w, (gsize)pipe_kb * 1024))
+    fprintf(stderr, "WARNING: could not set the pipe size\n");
+  return w;
+}
+
+static bool read_socket(int fd, dsdwriter *w) {
+  guchar buf[65536];
+  ssize_t n;
+
+  while ((n = read(fd, buf, sizeof(buf))) > 0)
+    if (!writer_write(w, buf, n)) return FALSE;
+
+  return n == 0;
+}
+
+/*
+** Client of a transcode server (see server.c): the server converts, this
+** process writes the output file from the connection.
+*/
+static void run_client(const char *socket_path, const char *filename, bool dop,
+		       pcmformat format, guint32 freq_limit, resamplequality quality,
+		       gint64 start, gint64 stop, outputtype type, const char *outfile,
+		       guint32 pipe_kb) {
+  struct sockaddr_un addr;
+  char reply[256], name[8], *path;
+  guint32 frequency, channels;
+  guint ratio;
+  int fd, n, got_dop;
+  gsize len = 0;
+  int out;
+  dsdwriter *w;
+
+  if (!filename || !(path = realpath(filename, NULL))) error("could not open file!");
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+  if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 ||
+      connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    error("could not connect to server!");
+
+  if (!dop) format = output_format(type, format);
+  dprintf(fd, "file %s\nrate %u\nquality %s\nbits %s\n", path, freq_limit,
+	  quality_name(quality), format_name(format));
+  if (start >= 0) dprintf(fd, "start %" G_GINT64_FORMAT "\n", start);
+  if (stop >= 0) dprintf(fd, "stop %" G_GINT64_FORMAT "\n", stop);
+  if (dop) dprintf(fd, "dop\n");
+  dprintf(fd, "\n");
+  free(path);
+
+  // byte by byte, the stream follows the reply line
+  while (len + 1 < sizeof(reply) && (n = read(fd, reply + len, 1)) == 1 && reply[len] != '\n')
+    len++;
+  reply[len] = '\0';
+
+  if (sscanf(reply, "ok %d %u %u %u %7s", &got_dop, &frequency, &ratio, &channels, name) != 5 ||
+      !parse_format(name, &format)) {
+    fprintf(stderr, "ERROR: server: %s\n", reply);
+    exit(1);
+  }
+
+  out = open_output(outfile);
+  w = start_output(out, type, channels, output_rate(got_dop, frequency, ratio, freq_limit),
+		   format, pipe_kb);
+  if (!read_socket(fd, w)) error("server connection failed");
+  if (!close_writer(w) || close(out) != 0) error("write error");
+  close(fd);
+  exit(0);
+}
+
+/*
+** Converts what is left of the file and hands the output to write.
+** Offline mode (segmented): the file is cut in time and the pieces are
+** converted on jobs cores (0 = all). Only PCM of a mapped file can be
+** split. verbose reports how long the read-ahead made the converter wait.
+*/
+static void convert(dsdfile *file, dsdconverter *conv, bool segmented, guint jobs,
+		    guint read_ahead, bool verbose, dsdwrite write, gpointer user_data) {
+  dsdbuffer *ibuffer;
+  guchar *pcmout;
+  gsize bsize;
+
+  if (segmented && converter_history(conv) != G_MAXUINT32 && file->map) {
+    if (!dsd_convert_segmented(file, conv, jobs, write, user_data))
+      error("conversion failed");
+  } else if (read_ahead > 0) {
+    if (!run_pipeline(file, conv, read_ahead, verbose, write, user_data))
+      error("write error");
+  } else {
+    pcmout = (guchar *)malloc(converter_max_output(conv));
+    while ((ibuffer = dsd_read(file))) {
+      bsize = dsd_convert(conv, ibuffer, pcmout);
+      if (!write(pcmout, bsize, user_data)) error("write error");
+    }
+    while ((bsize = converter_finish(conv, pcmout)))
+      if (!write(pcmout, bsize, user_data)) error("write error");
+    free(pcmout);
+  }
+}
+
 int main(int argc, char *argv[]) {
-  pid_t pid;
-  bool dop = FALSE, halfrate = FALSE;
-  int i, commpipe[2];
-  char *filename = NULL, *outfile = "-";
+  bool dop = FALSE, segmented = FALSE, verbose = FALSE;
+  int i;
+  guint ratio = 8, halfrate = 1, read_ahead = 0, threads = 0, dst_threads = 0, jobs = 0;
+  pcmformat format = PCM_S24LE;
+  outputtype type = OUTPUT_FLAC;
+  resamplequality quality = RESAMPLE_HIGH;
+  char *filename = NULL, *outfile = "-", *server = NULL, *client = NULL;
   dsdfile *file;
+  dsdconverter *conv;
+  dsdwriter *w;
+  int out;
   gint64 start = -1, stop = -1;
-  guint32 channels, frequency, freq_limit = 0, mins;
+  guint32 channels, frequency, freq_limit = 0, mins, read_kb = 64, pipe_kb = 0;
   float secs;
 
   for (i = 1; i < argc; i++) {
@@ -50,6 +270,34 @@ int main(int argc, char *argv[]) {
       case 'r':
 	freq_limit = atol(argv[i+1]);
 	break;
+      case 'b':
+	if (!parse_format(argv[i+1], &format)) error("Unknown sample format!");
+	break;
+      case 'f':
+	if (!parse_output(argv[i+1], &type)) error("Unknown output type!");
+	break;
+      case 'q':
+	if (!parse_quality(argv[i+1], &quality)) error("Unknown resampler quality!");
+	break;
+      case 'k':
+	read_kb = atol(argv[i+1]);
+	break;
+      case 'p':
+	pipe_kb = atol(argv[i+1]);
+	break;
+      case 'a':
+	read_ahead = atol(argv[i+1]);
+	break;
+      case 't':
+	threads = atol(argv[i+1]);
+	break;
+      case 'd':
+	dst_threads = atol(argv[i+1]);
+	break;
+      case 'j':
+	segmented = TRUE;
+	jobs = atol(argv[i+1]);
+	break;
       case 's':
 	sscanf(argv[i+1],"%u:%f", &mins, &secs);
 	start = (gint64)((secs + 60.0 * mins) * 1000.0);
@@ -58,12 +306,26 @@ int main(int argc, char *argv[]) {
 	sscanf(argv[i+1],"%u:%f", &mins, &secs);
 	stop = (gint64)((secs + 60.0 * mins) * 1000.0);
 	break;
+      case 'S':
+	server = argv[i+1];
+	break;
+      case 'C':
+	client = argv[i+1];
+	break;
       case 'u':
 	dop = TRUE;
 	i--;
 	break;
+      case 'v':
+	verbose = TRUE;
+	i--;
+	break;
+      case 'h':
+	usage();
+	break;
       default:
-	error("Unknown option!");
+	fprintf(stderr, "ERROR: Unknown option!\n");
+	usage();
       }
       i++;
     } else {
@@ -71,128 +333,46 @@ int main(int argc, char *argv[]) {
     }
   }
 
+  if (server) {
+    run_server(server, read_kb);
+    return 1;
+  }
+  if (client)
+    run_client(client, filename, dop, format, freq_limit, quality, start, stop, type, outfile,
+	       pipe_kb);
+
   if ((file = dsd_open(filename)) == NULL) error("could not open file!");
+  if (!dsd_set_read_size(file, read_kb * 1024)) error("invalid read size!");
+  if (!dsd_set_threads(file, dst_threads)) error("invalid thread count!");
 
   frequency = dsd_sample_frequency(file);
   channels = dsd_channels(file);
 
-  /* 
-  ** Current implementation is for DSD64 and DSD128. 
-  ** Other DSD sample frequencies might work but not optimally. 
-  */
-
-#define DSD64 (guint32)(64 * 44100)
-#define DSD128 (guint32)(128 * 44100)
-
-#if 0
-
-  if (dop && (freq_limit != 0) && (freq_limit < (frequency / 16))) {
-    if ((freq_limit < (frequency / 32)) || (frequency < DSD128))
-      dop = FALSE;
-    else {
-      halfrate = TRUE;
-      frequency = frequency / 2;
-    }
-  }
-
-  if (!dop && frequency > DSD64) {
-    halfrate = TRUE;
-    frequency = frequency / 2;
-  }
-
-#else
-
-  if ((freq_limit != 0) && (freq_limit < (frequency / 16))) dop = FALSE;
-
-#endif
-
-  if (pipe(commpipe)) error("Pipe error!");
-  if ((pid = fork()) == -1) error("Fork error!");
+  frequency = plan_conversion(frequency, freq_limit, &dop, &halfrate, &ratio);
 
-  if (pid) {
-    dsdbuffer *obuffer, *ibuffer;
-    guchar *pcmout;
-    gsize bsize;
+  if (dop) format = PCM_S24LE;
+  else format = output_format(type, format);
 
-    dup2(commpipe[1],1);
-    close(commpipe[0]);
+  // nothing is created or truncated for a conversion that cannot run
+  conv = init_converter(&file->buffer, dsd_sample_frequency(file), dop,
+			halfrate, ratio, format);
+  if (!conv) error("unsupported sample rate!");
+  if (!converter_set_rate(conv, output_rate(dop, frequency, ratio, freq_limit), quality))
+    error("unsupported output rate!");
+  converter_set_threads(conv, threads);
+  if (start >= 0 && !converter_seek(conv, file, start)) error("seek failed!");
+  if (stop >= 0) dsd_set_stop(file, stop);
 
-    ibuffer = &file->buffer;
-    
-    if (halfrate) {
-      obuffer = init_halfrate(ibuffer);
-    } else
-      obuffer = ibuffer;
+  out = open_output(outfile);
+  w = start_output(out, type, channels, output_rate(dop, frequency, ratio, freq_limit),
+		   format, pipe_kb);
 
-    if (dop) {
-      bsize = obuffer->num_channels * obuffer->max_bytes_per_ch / 2 * sizeof(guchar) * 3;
-    } else {
-      bsize = obuffer->num_channels * obuffer->max_bytes_per_ch * sizeof(guchar) * 3;
-    }
-    pcmout = (guchar *)malloc(bsize);
-    
-    if (start >= 0) dsd_set_start(file, start);
-    if (stop >= 0) dsd_set_stop(file, stop);
-    
-    while ((ibuffer = dsd_read(file))) {
+  convert(file, conv, segmented, jobs, read_ahead, verbose, write_output, w);
+  if (!close_writer(w) || close(out) != 0) error("write error");
+  free_converter(conv);
 
-	  dsd_buffer_msb_order(ibuffer);
+  if (!dsd_eof(file)) error("file read error - EOF was expected!");
+  if (!dsd_close(file)) error("failed to close!");
 
-      if (halfrate) halfrate_filter(ibuffer, obuffer);
-
-      if (dop) {
-        dsd_over_pcm(obuffer, pcmout);
-        bsize = obuffer->num_channels * ibuffer->bytes_per_channel / 2 * sizeof(guchar) * 3;
-      } else {
-        dsd_to_pcm(obuffer, pcmout); // DSD64 to 352.8kHz PCM
-        bsize = obuffer->num_channels * ibuffer->bytes_per_channel * sizeof(guchar) * 3;
-	  }
-
-      if (fwrite(pcmout, 1, bsize, stdout) != bsize) error("write error");
-    }
-    
-    close(commpipe[1]);
-    
-    if (!dsd_eof(file)) error("file read error - EOF was expected!");
-    if (!dsd_close(file)) error("failed to close!");
-
-  } else {
-    /* 
-    ** Sox fork. Sox will:
-    ** - convert raw pcm to flac 
-    ** - take care of possible rate conversion for PCM converted 352.8kHz output
-    */
-    char freq[16], ch[16], fout[16];
-
-    dup2(commpipe[0], 0);
-    close(commpipe[1]);
-
-    if (dop) {
-      sprintf(freq,"%u", frequency / 16);
-      freq_limit = 0;
-    } else {
-      sprintf(freq,"%u", frequency / 8);
-      if (freq_limit > frequency / 8) freq_limit = 0;
-    }
-
-    sprintf(ch,"%u",channels);
-
-    if (freq_limit == 0) {
-      if (execl("/usr/bin/sox", "sox", "-t", "raw", "-c", ch, "-r", freq,
-		"-e", "signed", "-b", "24", "-", "-t", "flac", "-b", "24",
-		"-C", "0", outfile, NULL) == -1) {
-	fprintf(stderr, "execl Error!");
-	exit(1);
-      }
-    } else {
-      sprintf(fout, "%u", freq_limit);
-      if (execl("/usr/bin/sox", "sox", "-t", "raw", "-c", ch, "-r", freq,
-		"-e", "signed", "-b", "24", "-", "-t", "flac", "-b", "24",
-		"-C", "0", "-r", fout, outfile, NULL) == -1) {
-	fprintf(stderr, "execl Error!");
-	exit(1);
-      }
-    }
-  }
   return 0;
 }
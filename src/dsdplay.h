@@ -0,0 +1,37 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+
+// dsdplay.c, dsdbatch.c
+void error(char *msg);
+
+// options.c
+bool parse_format(const char *name, pcmformat *format);
+const char *format_name(pcmformat format);
+guint32 plan_conversion(guint32 frequency, guint32 freq_limit, bool *dop,
+			guint *halfrate, guint *ratio);
+bool parse_output(const char *name, outputtype *type);
+bool parse_quality(const char *name, resamplequality *quality);
+const char *quality_name(resamplequality quality);
+guint32 output_rate(bool dop, guint32 frequency, guint ratio, guint32 freq_limit);
+pcmformat output_format(outputtype type, pcmformat format);
+
+// server.c
+void run_server(const char *path, guint32 read_kb);
@@ -0,0 +1,492 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libdsd.h"
+#include "dsdinternals.h"
+#include "../dsd2pcm/dsd2pcm.h"
+
+/*
+** Multistage decimator: DSD -> 352.8 kHz (dsd2pcm, with the filter made
+** for the DSD rate) followed by up to three 2:1 halfband stages, giving
+** 176.4, 88.2 or 44.1 kHz (or the 48 kHz family equivalents).
+**
+** Every halfband stage is a 171-tap Kaiser windowed sinc (beta 12.3).
+** Passband is flat (< 1e-6) up to 0.2268 and stopband rejection is
+** 120 dB from 0.2732 of its input rate, i.e. 20 kHz / 24.1 kHz when
+** the last stage outputs 44.1 kHz. Every other tap of a halfband
+** filter is zero and only every other output is kept, so each stage
+** computes just the kept samples from the odd taps plus the center.
+** A stage is centred like the resampler: its output m is at input 2m,
+** it starts with HB_CENTER samples of silence as history and waits for
+** HB_CENTER samples after an input before it outputs it. At the end of
+** the stream decimator_flush feeds every stage that much silence, so
+** nothing is lost and the output has no delay over the 352.8 kHz
+** signal.
+**
+** An optional resampler (resample.c) takes the result to any other rate
+** before it is quantized.
+*/
+
+#define HB_HALF   43                 // non-zero side taps on each side
+#define HB_LEN    (4 * HB_HALF - 1)  // filter length
+#define HB_CENTER (2 * HB_HALF - 1)  // index of the 0.5 center tap
+#define MAX_HB_STAGES 3
+
+static const float hbtaps[HB_HALF] = {
+   0.3180502936710532,
+  -0.10532684879113861,
+   0.06237562661947626,
+  -0.04368802842462534,
+   0.033100217100979816,
+  -0.02620670568329642,
+   0.021315186535853636,
+  -0.01763745187184728,
+   0.014757280461299501,
+  -0.012434376859861606,
+   0.01052033652268191,
+  -0.008918454869899534,
+   0.007562834609570558,
+  -0.006406790794008377,
+   0.0054160700156964505,
+  -0.0045647135393765016,
+   0.0038324455903702833,
+  -0.003202978635228155,
+   0.0026628896634605494,
+  -0.0022008626494104304,
+   0.0018071715979987182,
+  -0.0014733246961680618,
+   0.0011918178396813075,
+  -0.0009559630166040902,
+   0.0007597680162845661,
+  -0.0005978511429269147,
+   0.00046537947241520714,
+  -0.00035802255134310094,
+   0.0002719158171908339,
+  -0.00020362974050522792,
+   0.00015014195736910135,
+  -0.00010881060425665765,
+   7.734777329736993e-05,
+  -5.379253151036561e-05,
+   3.648333246963777e-05,
+  -2.4029921685812107e-05,
+   1.5285019272755626e-05,
+  -9.316172290992722e-06,
+   5.378218759382054e-06,
+  -2.886808037296336e-06,
+   1.3933890682876005e-06,
+  -5.620187021736967e-07,
+   1.4826582319508845e-07
+};
+
+typedef struct {
+  float *buf;                  // history samples followed by input
+  guint32 fill;                // number of valid samples in buf
+} hbstage;
+
+struct dsddecimator_s {
+  guint num_channels;
+  guint stages;
+  guint multiple;              // dsd2pcm filter, DSD rate / DSD64
+  guint32 max_bytes_per_ch;
+  dsd2pcm_ctx **dsd2pcm;
+  hbstage *hb;                 // [stage * num_channels + ch]
+  float *dest;                 // interleaved output, max_bytes_per_ch frames
+  guint32 rate;                // output rate before any resampler
+  bool flushed;                // the stages have had their end of stream
+  dsdnoiseshaper *ns;          // 16 bit output, for decimator_rate
+  dsdresampler *rs;            // NULL unless resampling
+  float *rsout;                // interleaved resampler output
+
+  // channel parallel mode, see decimator_set_threads
+  guint groups;                // channel groups, 1 = serial
+  GThreadPool *pool;           // runs groups 1 .. groups-1
+  dsdbuffer *job;              // block being converted
+  guint32 job_frames;
+  gint pending;                // groups still running
+  GMutex lock;
+  GCond done;
+};
+
+static guint32 halfband(hbstage *st, float *out, guint stride) {
+  guint32 pos, m = 0;
+  guint j;
+
+  for (pos = 0; pos + HB_LEN <= st->fill; pos += 2) {
+    const float *x = st->buf + pos + HB_CENTER;
+    float acc = 0.5f * x[0];
+    for (j = 0; j < HB_HALF; j++)
+      acc += hbtaps[j] * (x[-(gint)(2 * j + 1)] + x[2 * j + 1]);
+    out[stride * m++] = acc;
+  }
+  st->fill -= pos;
+  memmove(st->buf, st->buf + pos, st->fill * sizeof(float));
+
+  return m;
+}
+
+/*
+** dsd2pcm filter multiple for a DSD rate: 1 for DSD64, 2 for DSD128,
+** ... 8 for DSD512. The 48 kHz based rates map the same way.
+*/
+static guint filter_multiple(guint32 frequency) {
+  guint multiple = 1;
+  while (multiple < 8 && frequency / (16 * multiple) >= 352800) multiple *= 2;
+  return multiple;
+}
+
+/* every halfband stage back to its history of silence */
+static void reset_stages(dsddecimator *dec) {
+  guint i;
+
+  for (i = 0; i < dec->stages * dec->num_channels; i++) {
+    memset(dec->hb[i].buf, 0, HB_CENTER * sizeof(float));
+    dec->hb[i].fill = HB_CENTER;
+  }
+  dec->flushed = FALSE;
+}
+
+dsddecimator *init_decimator(dsdbuffer *ibuffer, guint32 frequency, guint ratio) {
+  dsddecimator *dec;
+  guint ch, i, multiple, stages;
+
+  multiple = filter_multiple(frequency);
+  if (ratio < 8 || (ratio & (ratio - 1))) return NULL;
+  while (8 * multiple > ratio) multiple /= 2;
+  for (stages = 0; (8 * multiple << stages) < ratio; stages++);
+  if (stages > MAX_HB_STAGES) return NULL;
+
+  dec = (dsddecimator *)malloc(sizeof(dsddecimator));
+  dec->num_channels = ibuffer->num_channels;
+  dec->max_bytes_per_ch = ibuffer->max_bytes_per_ch;
+  dec->stages = stages;
+  dec->multiple = multiple;
+
+  dec->dsd2pcm = (dsd2pcm_ctx **)malloc(dec->num_channels * sizeof(dsd2pcm_ctx *));
+  for (ch = 0; ch < dec->num_channels; ch++)
+    dec->dsd2pcm[ch] = dsd2pcm_init_rate(multiple);
+
+  // room for the silence of decimator_flush after a full block
+  dec->hb = (hbstage *)malloc(dec->stages * dec->num_channels * sizeof(hbstage));
+  for (i = 0; i < dec->stages * dec->num_channels; i++)
+    dec->hb[i].buf = (float *)malloc((2 * HB_LEN + dec->max_bytes_per_ch) * sizeof(float));
+
+  dec->dest = (float *)malloc(dec->num_channels * dec->max_bytes_per_ch * sizeof(float));
+  dec->rate = frequency / ratio;
+  dec->ns = NULL;
+  dec->rs = NULL;
+  dec->rsout = NULL;
+  dec->groups = 1;
+  dec->pool = NULL;
+  reset_stages(dec);
+
+  return dec;
+}
+
+void free_decimator(dsddecimator *dec) {
+  guint ch, i;
+
+  if (!dec) return;
+  decimator_set_threads(dec, 1);
+  for (ch = 0; ch < dec->num_channels; ch++)
+    dsd2pcm_destroy(dec->dsd2pcm[ch]);
+  for (i = 0; i < dec->stages * dec->num_channels; i++)
+    free(dec->hb[i].buf);
+  free(dec->dsd2pcm);
+  free(dec->hb);
+  free(dec->dest);
+  free_noise_shaper(dec->ns);
+  free_resampler(dec->rs);
+  free(dec->rsout);
+  free(dec);
+}
+
+void reset_decimator(dsddecimator *dec) {
+  guint ch;
+
+  for (ch = 0; ch < dec->num_channels; ch++)
+    dsd2pcm_reset(dec->dsd2pcm[ch]);
+  reset_stages(dec);
+  if (dec->ns)
+    reset_noise_shaper(dec->ns);
+  if (dec->rs)
+    reset_resampler(dec->rs);
+}
+
+/*
+** Hands the output through rs, which has to take max_bytes_per_ch
+** frames per call. The decimator owns rs from now on, NULL removes it.
+*/
+void decimator_set_resampler(dsddecimator *dec, dsdresampler *rs) {
+  free_resampler(dec->rs);
+  free(dec->rsout);
+  free_noise_shaper(dec->ns);
+  dec->rs = rs;
+  dec->rsout = NULL;
+  dec->ns = NULL;
+  if (rs)
+    dec->rsout = (float *)malloc(dec->num_channels * sizeof(float) *
+				 resampler_max_output(rs, dec->max_bytes_per_ch));
+}
+
+/*
+** The next input starts at decimated frame first of the stream, which
+** fixes the resampler's phase. Call it on a fresh or reset decimator.
+*/
+void decimator_set_start(dsddecimator *dec, guint64 first) {
+  if (dec->rs)
+    resampler_set_start(dec->rs, first);
+}
+
+/*
+** Input bytes per channel after which the output no longer depends on
+** the starting state: the dsd2pcm history plus the history of every
+** halfband stage, counted in input bytes. (HB_LEN - 1) << stages
+** bounds the stages together (each needs HB_CENTER samples of its
+** input). A resampler adds its filter length, its phase is fixed by
+** decimator_set_start.
+*/
+guint32 decimator_history(dsddecimator *dec) {
+  guint32 bytes = dsd2pcm_history(dec->dsd2pcm[0]) + dec->multiple * ((HB_LEN - 1) << dec->stages);
+
+  if (dec->rs)
+    bytes += resampler_history(dec->rs) * (dec->multiple << dec->stages);
+  return bytes;
+}
+
+/*
+** Input bytes per channel after its time that an output frame depends
+** on: HB_CENTER samples at the input rate of every halfband stage, and
+** the resampler's lookahead.
+*/
+guint32 decimator_lookahead(dsddecimator *dec) {
+  guint32 bytes = HB_CENTER * dec->multiple * ((1u << dec->stages) - 1);
+
+  if (dec->rs)
+    bytes += resampler_lookahead(dec->rs) * (dec->multiple << dec->stages);
+  return bytes;
+}
+
+/* the output rate, after the resampler if there is one */
+guint32 decimator_rate(dsddecimator *dec) {
+  return dec->rs ? resampler_rate(dec->rs) : dec->rate;
+}
+
+/*
+** quantize interleaved floats. 16 bit output goes through the noise
+** shaper, whose filter and dither depend on the output rate.
+*/
+static gsize quantize(dsddecimator *dec, const float *src, guint32 frames, guchar *pcmout,
+		      pcmformat format) {
+  if (format == PCM_S16LE) {
+    if (!dec->ns)
+      dec->ns = init_noise_shaper(dec->num_channels, decimator_rate(dec));
+    return pcm_pack_shaped(dec->ns, src, frames, pcmout);
+  }
+  return pcm_pack(src, frames * dec->num_channels, format, pcmout);
+}
+
+/* quantize, after the resampler if there is one */
+static gsize pack(dsddecimator *dec, const float *src, guint32 frames, guchar *pcmout,
+		  pcmformat format) {
+  if (dec->rs) {
+    frames = resample(dec->rs, src, frames, dec->rsout);
+    src = dec->rsout;
+  }
+  return quantize(dec, src, frames, pcmout, format);
+}
+
+/*
+** The outputs one channel's stages still wait for, into dest: every
+** stage gets HB_CENTER samples of silence after the end of its input.
+*/
+static guint32 flush_channel(dsddecimator *dec, guint ch) {
+  hbstage *st = &dec->hb[ch];
+  guint32 n = 0;
+  guint k;
+
+  for (k = 0; k < dec->stages; k++, st += dec->num_channels) {
+    memset(st->buf + st->fill, 0, HB_CENTER * sizeof(float));
+    st->fill += HB_CENTER;
+    if (k + 1 < dec->stages) {
+      float *out = st[dec->num_channels].buf + st[dec->num_channels].fill;
+      st[dec->num_channels].fill += halfband(st, out, 1);
+    } else
+      n = halfband(st, dec->dest + ch, dec->num_channels);
+  }
+
+  return n;
+}
+
+/*
+** At the end of the stream: at most max_frames of what the halfband
+** stages and the resampler still hold back, 0 once they are done.
+** Without either there is nothing.
+*/
+gsize decimator_flush(dsddecimator *dec, guchar *pcmout, pcmformat format, guint32 max_frames) {
+  guint32 frames = 0;
+  guint ch;
+
+  if (!dec->flushed) {
+    dec->flushed = TRUE;
+    for (ch = 0; ch < dec->num_channels; ch++)
+      frames = flush_channel(dec, ch);
+    if (frames > 0)
+      return pack(dec, dec->dest, frames, pcmout, format);
+  }
+
+  if (!dec->rs) return 0;
+  max_frames = MIN(max_frames, resampler_max_output(dec->rs, dec->max_bytes_per_ch));
+  frames = resampler_flush(dec->rs, dec->rsout, max_frames);
+  return quantize(dec, dec->rsout, frames, pcmout, format);
+}
+
+/*
+** Without halfband stages dsd2pcm writes all channels of the block as
+** interleaved floats into dest in one pass, which are then packed.
+*/
+static gsize dsd_to_pcm_direct(dsddecimator *dec, dsdbuffer *buf, guchar *pcmout,
+			       pcmformat format) {
+  guint32 frames = dsd2pcm_translate_multi(dec->dsd2pcm, dec->num_channels,
+					   buf->bytes_per_channel, buf->data,
+					   buf->sample_step, buf->ch_step,
+					   buf->lsb_first,
+					   dec->dest, dec->num_channels, 1);
+
+  return pack(dec, dec->dest, frames, pcmout, format);
+}
+
+/* one channel of a block into dest, returns the number of frames */
+static guint32 decimate_channel(dsddecimator *dec, dsdbuffer *buf, guint ch) {
+  hbstage *st = &dec->hb[ch];
+  guint32 n = 0;
+  guint k;
+
+  if (dec->stages == 0)
+    return dsd2pcm_translate_block(dec->dsd2pcm[ch], buf->bytes_per_channel,
+				   buf->data + ch * buf->ch_step, buf->sample_step,
+				   buf->lsb_first,
+				   dec->dest + ch, dec->num_channels);
+
+  st->fill += dsd2pcm_translate_block(dec->dsd2pcm[ch], buf->bytes_per_channel,
+				      buf->data + ch * buf->ch_step, buf->sample_step,
+				      buf->lsb_first,
+				      st->buf + st->fill, 1);
+
+  for (k = 0; k < dec->stages; k++, st += dec->num_channels) {
+    if (k + 1 < dec->stages) {
+      float *out = st[dec->num_channels].buf + st[dec->num_channels].fill;
+      st[dec->num_channels].fill += halfband(st, out, 1);
+    } else
+      n = halfband(st, dec->dest + ch, dec->num_channels);
+  }
+
+  return n;
+}
+
+/*
+** Channel parallel mode: the channels are split into contiguous groups,
+** group 0 runs on the calling thread and the others on a pool. Every
+** channel has its own filter state and its own lanes in dest, so the
+** result is the same as the serial path. Quantizing waits for all.
+*/
+static guint32 decimate_group(dsddecimator *dec, guint g) {
+  guint ch, first = g * dec->num_channels / dec->groups;
+  guint last = (g + 1) * dec->num_channels / dec->groups;
+  guint32 n = 0;
+
+  for (ch = first; ch < last; ch++)
+    n = decimate_channel(dec, dec->job, ch);
+
+  return n;
+}
+
+static void decimate_worker(gpointer data, gpointer user_data) {
+  dsddecimator *dec = (dsddecimator *)user_data;
+
+  decimate_group(dec, GPOINTER_TO_UINT(data));
+  g_mutex_lock(&dec->lock);
+  if (--dec->pending == 0)
+    g_cond_signal(&dec->done);
+  g_mutex_unlock(&dec->lock);
+}
+
+/*
+** Sets the number of threads converting one stream, 0 picks one per
+** channel up to the number of cores, 1 is serial.
+*/
+void decimator_set_threads(dsddecimator *dec, guint threads) {
+  if (threads == 0)
+    threads = g_get_num_processors();
+  threads = MAX(1, MIN(threads, dec->num_channels));
+  if (threads == dec->groups) return;
+
+  if (dec->pool) {
+    g_thread_pool_free(dec->pool, FALSE, TRUE);
+    g_mutex_clear(&dec->lock);
+    g_cond_clear(&dec->done);
+    dec->pool = NULL;
+  }
+  dec->groups = threads;
+  if (threads > 1) {
+    g_mutex_init(&dec->lock);
+    g_cond_init(&dec->done);
+    dec->pool = g_thread_pool_new(decimate_worker, dec, threads - 1, TRUE, NULL);
+  }
+}
+
+static guint32 decimate_parallel(dsddecimator *dec, dsdbuffer *buf) {
+  guint g;
+  guint32 n;
+
+  dec->job = buf;
+  dec->pending = dec->groups - 1;
+  for (g = 1; g < dec->groups; g++)
+    g_thread_pool_push(dec->pool, GUINT_TO_POINTER(g), NULL);
+  n = decimate_group(dec, 0);
+
+  g_mutex_lock(&dec->lock);
+  while (dec->pending > 0)
+    g_cond_wait(&dec->done, &dec->lock);
+  g_mutex_unlock(&dec->lock);
+
+  return n;
+}
+
+gsize dsd_to_pcm_decimated(dsddecimator *dec, dsdbuffer *buf, guchar *pcmout, pcmformat format) {
+  guint32 n = 0;
+  guint ch;
+
+  if (dec->groups > 1)
+    return pack(dec, dec->dest, decimate_parallel(dec, buf), pcmout, format);
+
+  if (dec->stages == 0)
+    return dsd_to_pcm_direct(dec, buf, pcmout, format);
+
+  for (ch = 0; ch < dec->num_channels; ch++)
+    n = decimate_channel(dec, buf, ch);
+
+  // Every channel got the same input, so n is the same for all of them.
+  return pack(dec, dec->dest, n, pcmout, format);
+}
@@ -121,7 +121,21 @@ bool dsdiff_init(dsdfile *file) {
       file->buffer.lsb_first = FALSE;
       file->buffer.sample_step = file->channel_num;
       file->buffer.ch_step = 1;
+      file->buffer.block_bytes = 0;
+      file->buffer.block_step = 0;
       
+      return TRUE;
+    } else if (DSD_MATCH(chunk_head.id, "DST ")) {
+      if (!dst_init(file, chunk_head.size)) return FALSE;
+
+      // decoded it reads like the DSD chunk
+      file->buffer.max_bytes_per_ch = 4096;
+      file->buffer.lsb_first = FALSE;
+      file->buffer.sample_step = file->channel_num;
+      file->buffer.ch_step = 1;
+      file->buffer.block_bytes = 0;
+      file->buffer.block_step = 0;
+
       return TRUE;
     } else
       dsd_seek(file, chunk_head.size, SEEK_CUR);
@@ -130,16 +144,6 @@ bool dsdiff_init(dsdfile *file) {
   return FALSE;
 }
 
-bool dsdiff_set_start(dsdfile *file, guint32 mseconds) {
-  
-  if (!file) return FALSE;
-
-  file->sample_offset = (guint64)file->sampling_frequency * mseconds / 8000;
-  guint64 skip_bytes = file->sample_offset * file->channel_num;
-
-  return dsd_seek(file, skip_bytes, SEEK_CUR);
-}
-
 bool dsdiff_set_stop(dsdfile *file, guint32 mseconds) {
 
   if (!file) return FALSE;
@@ -156,7 +160,9 @@ bool dsdiff_set_stop(dsdfile *file, guint32 mseconds) {
 
 dsdbuffer *dsdiff_read(dsdfile *file) {
   guint num_samples;
+  guchar *data;
 
+  if (file->dst) return dst_read(file);
   if (file->eof) return NULL;
 
   if ((file->sample_stop - file->sample_offset) < file->buffer.max_bytes_per_ch)
@@ -164,8 +170,9 @@ dsdbuffer *dsdiff_read(dsdfile *file) {
   else
     num_samples = file->buffer.max_bytes_per_ch;
 
-  if (!dsd_read_raw(file->buffer.data, file->channel_num * num_samples, file))
+  if (!(data = dsd_read_block(file, file->channel_num * num_samples)))
       return NULL;
+  file->buffer.data = data;
 
   file->buffer.bytes_per_channel = num_samples;
   file->sample_offset += num_samples;
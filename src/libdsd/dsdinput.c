@@ -18,14 +18,24 @@
  *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  *
  */
+#define _GNU_SOURCE
 #include <glib.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "libdsd.h"
 #include "dsdinternals.h"
 
+#if defined(__linux__) && defined(SPLICE_F_MOVE)
+#define INPUT_SPLICE
+#endif
+
 const guchar bit_reverse_table[256] = 
 {
 #define R2(n)     n,     n + 2*64,     n + 1*64,     n + 3*64
@@ -34,20 +44,42 @@ const guchar bit_reverse_table[256] =
     R6(0), R6(2), R6(1), R6(3)
 };
 
+/*
+** Seekable files are memory mapped, so blocks are handed out as pointers
+** into the page cache instead of being copied through stdio. If the
+** mapping fails the file is read with stdio like a pipe.
+*/
+static void dsd_map(dsdfile *file) {
+  struct stat st;
+  void *map;
+
+  if (fstat(fileno(file->stream), &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+    return;
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fileno(file->stream), 0);
+  if (map == MAP_FAILED)
+    return;
+  madvise(map, st.st_size, MADV_SEQUENTIAL);
+  file->map = (guchar *)map;
+  file->map_size = st.st_size;
+}
+
 dsdfile *dsd_open(const char *name) {
   guchar header_id[4];
   dsdfile *file = malloc(sizeof(dsdfile));
 
-  if (name == NULL) {
+  if (name == NULL)
     file->stream = stdin;
-    file->canseek = FALSE;
-  } else {
-    if ((file->stream = fopen(name, "r")) == NULL) {
-      free(file);
-      return NULL;
-    }
-    file->canseek = TRUE;
+  else if ((file->stream = fopen(name, "r")) == NULL) {
+    free(file);
+    return NULL;
   }
+  // stdin redirected from a file seeks like a named file
+  file->canseek = (lseek(fileno(file->stream), 0, SEEK_CUR) == 0);
+  file->map = NULL;
+  file->map_size = 0;
+  file->shared = FALSE;
+  file->dst = NULL;
+  if (file->canseek) dsd_map(file);
   file->eof = FALSE;
   file->offset = 0;
   file->sample_offset = 0;
@@ -58,38 +90,91 @@ dsdfile *dsd_open(const char *name) {
 
   if (DSD_MATCH(header_id, "DSD ")) {
     file->type = DSF;
-    if (!dsf_init(file)) {
-      free(file);
-      return NULL;
-    }
+    if (!dsf_init(file)) goto error;
   } else if (DSD_MATCH(header_id, "FRM8")) {
     file->type = DSDIFF;
-    if (!dsdiff_init(file)) {
-      free(file);
-      return NULL;
-    }
-  } else {
-    free(file);
-    return NULL;
-  }
+    if (!dsdiff_init(file)) goto error;
+  } else
+    goto error;
   
-  // Finalize buffer
+  // Finalize buffer, a mapped file is read in place
   file->buffer.num_channels = file->channel_num;
   file->buffer.bytes_per_channel = 0;
-  file->buffer.data = (guchar *)malloc(sizeof(guchar) * file->buffer.max_bytes_per_ch * file->channel_num);
+  if (dsd_in_place(file))
+    file->buffer.data = NULL;
+  else
+    file->buffer.data = (guchar *)malloc(sizeof(guchar) * file->buffer.max_bytes_per_ch * file->channel_num);
 
   return file;
+
+ error:
+  free_dst(file->dst);
+  if (file->map) munmap(file->map, file->map_size);
+  if (file->stream != stdin) fclose(file->stream);
+  free(file);
+  return NULL;
+}
+
+
+/*
+** A second reader of a mapped file, reading bytes per channel
+** [first, last) of its data. The reader shares the mapping (and the DST
+** frame index), so close it before file.
+*/
+dsdfile *dsd_open_range(dsdfile *file, guint64 first, guint64 last) {
+  dsdfile *range;
+  guint32 block = file->buffer.block_bytes;
+  guint64 end;
+
+  if (!file->map || first > last || last > file->sample_count / 8)
+    return NULL;
+  if (file->dst)
+    end = file->dataoffset;    // the frame index only has frames in the file
+  else if (block)
+    end = file->dataoffset + (last + block - 1) / block * file->buffer.block_step;
+  else
+    end = file->dataoffset + last * file->channel_num;
+  if (end > file->map_size)
+    return NULL;               // truncated file
+
+  range = malloc(sizeof(dsdfile));
+  *range = *file;
+  range->shared = TRUE;
+  range->buffer.data = NULL;
+  range->sample_offset = first;
+  range->sample_stop = last;
+  range->eof = (first == last);
+  if (file->dst) {
+    range->dst = dst_open_range(file->dst);
+    range->buffer.data = (guchar *)malloc((gsize)file->buffer.max_bytes_per_ch * file->channel_num);
+  }
+  if (block)
+    range->offset = file->dataoffset + first / block * file->buffer.block_step;
+  else
+    range->offset = file->dataoffset + first * file->channel_num;
+
+  return range;
 }
 
 bool dsd_eof(dsdfile *file) {
-  if (!file->eof) file->eof = (bool)feof(file->stream);
+  if (!file->eof && !file->map) file->eof = (bool)feof(file->stream);
   return file->eof;
 }
 
 bool dsd_close(dsdfile *file) {
-  bool success = (fclose(file->stream) == 0);
-  
-  free(file->buffer.data);
+  bool success;
+
+  if (!dsd_in_place(file))
+    free(file->buffer.data);
+  free_dst(file->dst);
+  if (file->shared) {
+    free(file);
+    return TRUE;
+  }
+
+  success = (fclose(file->stream) == 0);
+  if (file->map)
+    munmap(file->map, file->map_size);
   free(file);
   
   return success;
@@ -97,47 +182,174 @@ bool dsd_close(dsdfile *file) {
 
 bool dsd_read_raw(void *buffer, size_t bytes, dsdfile *file) {
   size_t bytes_read;
-  bytes_read = fread(buffer, (size_t)1, bytes, file->stream);
+
+  if (file->map) {
+    bytes_read = file->offset < file->map_size ? MIN(bytes, file->map_size - file->offset) : 0;
+    memcpy(buffer, file->map + file->offset, bytes_read);
+    if (bytes_read < bytes) file->eof = TRUE;
+  } else
+    bytes_read = fread(buffer, (size_t)1, bytes, file->stream);
   file->offset += (goffset)bytes_read;
   
   return (bytes_read == bytes);
 }
 
+/*
+** Returns the next bytes of the file: in place when it is mapped,
+** otherwise read into buffer.data. NULL if the file ends before that.
+*/
+guchar *dsd_read_block(dsdfile *file, size_t bytes) {
+  guchar *data;
+
+  if (!file->map)
+    return dsd_read_raw(file->buffer.data, bytes, file) ? file->buffer.data : NULL;
+
+  if (file->offset > file->map_size || bytes > file->map_size - file->offset) {
+    file->offset = file->map_size;
+    file->eof = TRUE;
+    return NULL;
+  }
+  data = file->map + file->offset;
+  file->offset += bytes;
+
+  return data;
+}
+
+/*
+** Skips bytes of input that cannot seek. What stdio has already read
+** ahead is read through it, the rest is skipped on the descriptor: a
+** pipe is spliced to /dev/null without being copied to user space,
+** anything else is read in large pieces. Without a way to tell how much
+** stdio holds (glibc has one) all of it goes through stdio.
+*/
+#define SKIP_CHUNK (1 << 20)
+
+static guint64 stdio_held(FILE *stream, guint64 bytes) {
+#ifdef __GLIBC__
+  return MIN(bytes, (guint64)(stream->_IO_read_end - stream->_IO_read_ptr));
+#else
+  (void)stream;
+  return bytes;
+#endif
+}
+
+static bool dsd_skip(dsdfile *file, guint64 bytes) {
+  int fd = fileno(file->stream), null = -1;
+  guint64 held = stdio_held(file->stream, bytes);
+  guchar *buffer = NULL;
+  ssize_t n;
+
+  if (held > 0) {
+    buffer = (guchar *)malloc(SKIP_CHUNK);
+    for (; held > 0; held -= n, bytes -= n, file->offset += n)
+      if ((n = fread(buffer, 1, MIN(held, SKIP_CHUNK), file->stream)) == 0) {
+	file->eof = TRUE;
+	free(buffer);
+	return FALSE;
+      }
+  }
+
+#ifdef INPUT_SPLICE
+  null = open("/dev/null", O_WRONLY | O_CLOEXEC);
+#endif
+  while (bytes > 0) {
+#ifdef INPUT_SPLICE
+    if (null >= 0) {
+      n = splice(fd, NULL, null, NULL, MIN(bytes, SKIP_CHUNK), SPLICE_F_MOVE);
+      if (n < 0 && errno != EINTR) {
+	close(null);           // not a pipe
+	null = -1;
+	continue;
+      }
+    } else
+#endif
+    {
+      if (!buffer) buffer = (guchar *)malloc(SKIP_CHUNK);
+      n = read(fd, buffer, MIN(bytes, SKIP_CHUNK));
+      if (n < 0 && errno != EINTR) break;
+    }
+    if (n == 0) {
+      file->eof = TRUE;
+      break;
+    }
+    if (n > 0) {
+      bytes -= n;
+      file->offset += n;
+    }
+  }
+
+  if (null >= 0) close(null);
+  free(buffer);
+  return bytes == 0;
+}
+
 bool dsd_seek(dsdfile *file, goffset offset, int whence) {
   
+  if (file->map) {
+    if (whence == SEEK_SET)
+      file->offset = offset;
+    else if (whence == SEEK_CUR)
+      file->offset += offset;
+    else if (whence == SEEK_END)
+      file->offset = file->map_size + offset;
+    else
+      return FALSE;
+    return TRUE;
+  }
+
   if (file->canseek) {
     if (fseek(file->stream, offset, whence) == 0) {
-      file->offset += offset;
+      file->offset = ftello(file->stream);
       return TRUE;
     } else {
       return FALSE;
     }
   }
 
-  char buffer[8192];
-  gsize read_bytes;
-  size_t tmp;
+  if (whence == SEEK_CUR && offset >= 0)
+    return dsd_skip(file, offset);
+  if (whence == SEEK_SET && offset >= 0 && (guint64)offset >= file->offset)
+    return dsd_skip(file, offset - file->offset);
 
-  if (whence == SEEK_CUR)
-    read_bytes = offset;
-  else if (whence == SEEK_SET) {
-    if (offset < 0 || (guint64)offset < file->offset)
-      return FALSE;
-    read_bytes = offset - file->offset;
-  } else
-    return FALSE;
+  return FALSE;
+}
 
-  while (read_bytes > 0) {
-    tmp = (read_bytes > sizeof(buffer) ? sizeof(buffer) : read_bytes);
-    if (dsd_read_raw(buffer, tmp, file))
-      read_bytes -= tmp;
-    else
-      return FALSE;
+/*
+** Sets how many bytes per channel one dsd_read returns at most, rounded
+** up to whole 4096 byte blocks. Call it before the first read and before
+** sizing anything from buffer.max_bytes_per_ch.
+*/
+#define READ_BLOCK 4096
+
+bool dsd_set_read_size(dsdfile *file, guint32 bytes_per_channel) {
+  guchar *data;
+
+  if (!file || bytes_per_channel == 0) return FALSE;
+
+  bytes_per_channel = (bytes_per_channel + READ_BLOCK - 1) / READ_BLOCK * READ_BLOCK;
+  if (!dsd_in_place(file)) {
+    data = (guchar *)realloc(file->buffer.data, (gsize)bytes_per_channel * file->channel_num);
+    if (!data) return FALSE;
+    file->buffer.data = data;
   }
+  file->buffer.max_bytes_per_ch = bytes_per_channel;
 
   return TRUE;
 }
 
+/*
+** Sets the number of threads decoding a compressed (DST) file, 0 is one
+** per core, 1 is serial. Call it before the first read. Uncompressed
+** files need no decoding and ignore it.
+*/
+bool dsd_set_threads(dsdfile *file, guint threads) {
+  if (!file) return FALSE;
+  if (!file->dst) return TRUE;
+  if (threads == 0) threads = g_get_num_processors();
+
+  return dst_set_threads(file->dst, threads);
+}
+
 guint32 dsd_sample_frequency(dsdfile *file) {
   if (file) return file->sampling_frequency;
   return 0;
@@ -157,13 +369,41 @@ dsdbuffer *dsd_read(dsdfile *file) {
   return NULL;
 }
 
-bool dsd_set_start(dsdfile *file, guint32 mseconds) {
+/* byte per channel of the data at mseconds, rounded down */
+guint64 dsd_sample_at(dsdfile *file, guint32 mseconds) {
+  if (file) return (guint64)file->sampling_frequency * mseconds / 8000;
+  return 0;
+}
+
+/*
+** Positions file at byte sample per channel of its data. The offset is
+** computed from the start of the data, not from where the file is, so it
+** can be called again. Going back needs a seekable file.
+*/
+bool dsd_seek_sample(dsdfile *file, guint64 sample) {
+  guint32 block;
+  gsize offset;
+
   if (!file) return FALSE;
+  if (file->dst) return dst_seek(file, sample);
 
-  if (file->type == DSF) return dsf_set_start(file, mseconds);
-  if (file->type == DSDIFF) return dsdiff_set_start(file, mseconds);
+  block = file->buffer.block_bytes;
+  sample = MIN(sample, file->sample_count / 8);
+  if (block)
+    offset = file->dataoffset + sample / block * file->buffer.block_step;
+  else
+    offset = file->dataoffset + sample * file->channel_num;
+  if (!dsd_seek(file, offset, SEEK_SET)) return FALSE;
 
-  return FALSE;
+  file->sample_offset = sample;
+  file->eof = (sample >= file->sample_stop);
+
+  return TRUE;
+}
+
+/* to the byte, see converter_seek for a start without a filter transient */
+bool dsd_set_start(dsdfile *file, guint32 mseconds) {
+  return dsd_seek_sample(file, dsd_sample_at(file, mseconds));
 }
 
 bool dsd_set_stop(dsdfile *file, guint32 mseconds) {
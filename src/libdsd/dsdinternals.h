@@ -26,17 +26,38 @@ static inline guchar bit_reverse(guchar value) {
   return bit_reverse_table[value];
 }
 
+static inline gint32 myround(float x) {
+  return (gint32)(x + (x>=0 ? 0.5f : -0.5f));
+}
+
+static inline gint32 clip(gint32 min, gint32 value, gint32 max) {
+  if (value<min) return min;
+  if (value>max) return max;
+  return value;
+}
+
 bool dsdiff_init(dsdfile *file);
 
 bool dsf_init(dsdfile *file);
-bool dsf_set_start(dsdfile *file, guint32 mseconds);
 bool dsf_set_stop(dsdfile *file, guint32 mseconds);
 dsdbuffer *dsf_read(dsdfile *file);
 
 bool dsdiff_init(dsdfile *file);
-bool dsdiff_set_start(dsdfile *file, guint32 mseconds);
 bool dsdiff_set_stop(dsdfile *file, guint32 mseconds);
 dsdbuffer *dsdiff_read(dsdfile *file);
 
+bool dst_init(dsdfile *file, guint64 size);
+dstdecoder *dst_open_range(dstdecoder *dst);
+bool dst_set_threads(dstdecoder *dst, guint threads);
+void free_dst(dstdecoder *dst);
+dsdbuffer *dst_read(dsdfile *file);
+bool dst_seek(dsdfile *file, guint64 sample);
+
+/* dsd_read hands out the mapping itself, valid until dsd_close */
+static inline bool dsd_in_place(dsdfile *file) {
+  return file->map && !file->dst;
+}
+
 bool dsd_read_raw(void *buffer, size_t bytes, dsdfile *file);
+guchar *dsd_read_block(dsdfile *file, size_t bytes);
 bool dsd_seek(dsdfile *file, goffset offset, int whence);
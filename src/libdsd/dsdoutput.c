@@ -21,143 +21,628 @@
 #include <glib.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 #include "libdsd.h"
+#include "dsdinternals.h"
 #include "../dsd2pcm/dsd2pcm.h"
 
-static guchar halfrate_nibble[512];
-static guchar halfrate_error[512];
-static guchar *qerror;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(DSD_NO_SIMD)
+#define DOP_X86_SIMD
+#include <immintrin.h>
+#endif
 
-dsdbuffer *init_halfrate(dsdbuffer *ibuffer) {
+/*
+** Halfrate DSD to DSD conversion.
+**
+** Each input bit pair becomes one output bit: with no pending error any
+** pair other than 00 gives 1, with a pending error only 11 gives 1. The
+** pairs 01 and 10 flip the error. So the output bit of a pair is
+** a & b | (a ^ b) & ~e, where e is the starting error XOR the parity of
+** all earlier pairs - a prefix XOR. That runs on 32 pairs at a time in a
+** 64 bit word (msb = earliest bit) without any table lookups.
+**
+** Halving is chained for 4x and 8x, each stage with its own per channel
+** error state. LSB first input is bit reversed as it is loaded. The
+** output is planar and MSB first, whatever the input was. A stage that
+** gets an odd number of bytes keeps the last one and pairs it with the
+** first byte of its next input.
+*/
 
-  unsigned ierr, bitpair, prev_error, index, itmp;
-  int shr;
+#define MAX_HALFRATE_STAGES 3
 
-  for (ierr = 0; ierr <= 1; ierr++) {
+#define EVEN_BITS G_GUINT64_CONSTANT(0x5555555555555555)
+#define PAIR_BITS G_GUINT64_CONSTANT(0x3333333333333333)
+#define NIBBLES   G_GUINT64_CONSTANT(0x0f0f0f0f0f0f0f0f)
 
-    for (index = 0; index < 256; index++) {      
-      
-      itmp = 256 * ierr + index;
-      halfrate_nibble[itmp] = 0;
-      prev_error = ierr;
+struct dsdhalfrate_s {
+  guint stages;
+  guchar *qerror;              // [stage * num_channels + ch]
+  guchar *carry;               // [stage * num_channels + ch], MSB first
+  bool *held;                  // [stage * num_channels + ch], carry is pending
+  dsdbuffer out;
+};
 
-      for (shr = 6; shr >= 0; shr -= 2) {
-        halfrate_nibble[itmp] <<= 1;
-        bitpair = (index >> shr) & 0x03;
-        if ((prev_error && bitpair == 0x03) || (!prev_error && bitpair != 0x00)) 
-	  halfrate_nibble[itmp] |= 1;
-        if (bitpair == 0x01 || bitpair == 0x02) prev_error = 1 - prev_error;
-      }
-      halfrate_error[itmp] = prev_error;
+dsdhalfrate *init_halfrate(dsdbuffer *ibuffer, guint factor) {
+  dsdhalfrate *hr;
+  guint stages;
+
+  for (stages = 0; (1u << stages) < factor; stages++);
+  if (stages == 0 || stages > MAX_HALFRATE_STAGES || (1u << stages) != factor)
+    return NULL;
+
+  hr = (dsdhalfrate *)malloc(sizeof(dsdhalfrate));
+  hr->stages = stages;
+  hr->qerror = (guchar *)calloc(stages * ibuffer->num_channels, sizeof(guchar));
+  hr->carry = (guchar *)calloc(stages * ibuffer->num_channels, sizeof(guchar));
+  hr->held = (bool *)calloc(stages * ibuffer->num_channels, sizeof(bool));
+
+  hr->out.num_channels = ibuffer->num_channels;
+  hr->out.bytes_per_channel = 0;
+  hr->out.max_bytes_per_ch = ibuffer->max_bytes_per_ch / 2;
+  hr->out.lsb_first = 0;
+  hr->out.sample_step = 1;
+  hr->out.ch_step = hr->out.max_bytes_per_ch;
+  hr->out.block_bytes = 0;
+  hr->out.block_step = 0;
+  hr->out.data = (guchar *)malloc(hr->out.max_bytes_per_ch * hr->out.num_channels);
+
+  return hr;
+}
+
+void reset_halfrate(dsdhalfrate *hr) {
+  memset(hr->qerror, 0, hr->stages * hr->out.num_channels);
+  memset(hr->held, 0, hr->stages * hr->out.num_channels * sizeof(bool));
+}
+
+void free_halfrate(dsdhalfrate *hr) {
+  if (!hr) return;
+  free(hr->qerror);
+  free(hr->carry);
+  free(hr->held);
+  free(hr->out.data);
+  free(hr);
+}
+
+/* halve 32 bit pairs, returns 32 output bits and updates the error */
+static inline guint32 halfrate_word(guint64 w, guchar *qe) {
+  guint64 x = (w ^ (w >> 1)) & EVEN_BITS;
+  guint64 e = x;
+
+  // inclusive prefix XOR from the earliest (highest) pair downwards
+  e ^= e >> 2;
+  e ^= e >> 4;
+  e ^= e >> 8;
+  e ^= e >> 16;
+  e ^= e >> 32;
+  // error seen by each pair, before the pair itself
+  e ^= x;
+  if (*qe) e = ~e;
+  *qe = (e ^ x) & 1;
+
+  x = ((w & (w >> 1)) | (x & ~e)) & EVEN_BITS;
+
+  // gather the even bits into the low 32 bits, keeping their order
+  x = (x | (x >> 1)) & PAIR_BITS;
+  x = (x | (x >> 2)) & NIBBLES;
+  x = (x | (x >> 4)) & G_GUINT64_CONSTANT(0x00ff00ff00ff00ff);
+  x = (x | (x >> 8)) & G_GUINT64_CONSTANT(0x0000ffff0000ffff);
+  x = (x | (x >> 16)) & G_GUINT64_CONSTANT(0x00000000ffffffff);
+
+  return (guint32)x;
+}
+
+/* reverse the bits of every byte in a word */
+static inline guint64 bit_reverse_bytes(guint64 w) {
+  w = ((w >> 1) & EVEN_BITS) | ((w & EVEN_BITS) << 1);
+  w = ((w >> 2) & PAIR_BITS) | ((w & PAIR_BITS) << 2);
+  return ((w >> 4) & NIBBLES) | ((w & NIBBLES) << 4);
+}
+
+static void halfrate_stage(const guchar *in, guint step, bool lsbf, guint32 bytes,
+			   guchar *out, guchar *qe) {
+  guint32 s, i, n, o;
+  guint64 w;
+
+  for (s = 0; s < bytes; s += n, in += n * step) {
+    n = MIN(8, bytes - s);
+    if (n == 8 && step == 1) {
+      memcpy(&w, in, sizeof(w));
+      w = GUINT64_FROM_BE(w);
+    } else {
+      for (w = 0, i = 0; i < n; i++)
+	w |= (guint64)in[i * step] << (56 - 8 * i);
+    }
+    if (lsbf) w = bit_reverse_bytes(w);
+    o = halfrate_word(w, qe);
+    if (n == 8) {
+      o = GUINT32_TO_BE(o);
+      memcpy(out, &o, sizeof(o));
+      out += 4;
+    } else {
+      for (i = 0; i < n / 2; i++)
+	*out++ = o >> (24 - 8 * i);
     }
   }
+}
 
-  /*
-  **
-  */
+/*
+** One stage of one channel (state i): halves bytes of input, after the
+** byte held back from the last call, and holds back the last byte if
+** that leaves it odd. Returns the number of output bytes.
+*/
+static guint32 halfrate_run(dsdhalfrate *hr, guint i, const guchar *in, guint step,
+			    bool lsbf, guint32 bytes, guchar *out) {
+  guint32 made = 0;
+  guchar pair[2], last;
 
-  dsdbuffer *obuffer;
-  guint32 ch;
-  obuffer = (dsdbuffer *)malloc(sizeof(dsdbuffer));
-  obuffer->num_channels = ibuffer->num_channels;
-  obuffer->bytes_per_channel = 0;
-  obuffer->max_bytes_per_ch = ibuffer->max_bytes_per_ch / 2;
-  obuffer->lsb_first = 0;
-  obuffer->sample_step = ibuffer->sample_step;
-  obuffer->ch_step = ibuffer->ch_step;
-  obuffer->data = (guchar *)malloc(sizeof(guchar) * obuffer->max_bytes_per_ch * obuffer->num_channels);
-  qerror = (guchar *)malloc(sizeof(guchar) * obuffer->num_channels);
-  for (ch = 0; ch < obuffer->num_channels; ch++) qerror[ch] = 0;
+  if (bytes == 0) return 0;
+  if (hr->held[i]) {
+    pair[0] = hr->carry[i];
+    pair[1] = lsbf ? bit_reverse(in[0]) : in[0];
+    halfrate_stage(pair, 1, FALSE, 2, out, &hr->qerror[i]);
+    hr->held[i] = FALSE;
+    in += step;
+    out++;
+    bytes--;
+    made++;
+  }
+  if (bytes & 1) {
+    last = in[(bytes - 1) * step];
+    hr->carry[i] = lsbf ? bit_reverse(last) : last;
+    hr->held[i] = TRUE;
+    bytes--;
+  }
+  halfrate_stage(in, step, lsbf, bytes, out, &hr->qerror[i]);
 
-  return obuffer;
+  return made + bytes / 2;
 }
 
-void halfrate_filter(dsdbuffer *in, dsdbuffer *out) {
-  guint32 s, ch, index;
-  guchar *dsdin = in->data;
-  guchar *dsdout = out->data;
-  guchar newbyte;
-
-  out->bytes_per_channel = in->bytes_per_channel / 2;
+/*
+** The first stage reads the input buffer, later stages work in place:
+** a stage has always read a word before it writes the half size result.
+*/
+dsdbuffer *halfrate_filter(dsdhalfrate *hr, dsdbuffer *in) {
+  guint32 bytes = 0;
+  guint ch, k;
 
   for (ch = 0; ch < in->num_channels; ch++) {
-    guchar *dsdin2 = dsdin;
-    guchar *dsdout2 = dsdout;
-    guchar qe = qerror[ch];
-    for (s = 0; s < in->bytes_per_channel; s += 2) {
-      index = (guint32)256 * qe + *dsdin2;
-      newbyte = halfrate_nibble[index] << 4;
-      qe = halfrate_error[index];
-      dsdin2 += in->sample_step;
-
-      index = (guint32)256 * qe + *dsdin2;
-      newbyte |= halfrate_nibble[index];
-      qe = halfrate_error[index];
-      dsdin2 += in->sample_step;
-      
-      *dsdout2 = newbyte;
-      dsdout2 += out->sample_step;
+    guchar *out = hr->out.data + ch * hr->out.ch_step;
+    bytes = halfrate_run(hr, ch, in->data + ch * in->ch_step, in->sample_step,
+			 in->lsb_first, in->bytes_per_channel, out);
+    for (k = 1; k < hr->stages; k++)
+      bytes = halfrate_run(hr, k * in->num_channels + ch, out, 1, FALSE, bytes, out);
+  }
+  hr->out.bytes_per_channel = bytes;
+
+  return &hr->out;
+}
+
+/*
+** DoP: each 24 bit frame carries two DSD bytes of a channel, the earlier
+** one in the middle byte, with a marker alternating 0x05 / 0xfa per frame
+** on top. The marker lives in the caller's stream state.
+**
+** The SSSE3 path handles mono and stereo, planar (DSF, halfrate output)
+** or interleaved (DSDIFF): one pshufb puts the byte pairs in output
+** order, two more spread them to 3 byte slots and the markers are ORed
+** in. LSB first input is bit reversed on the way with a nibble lookup.
+** 16 bytes per channel is an even number of frames, so the marker
+** pattern is the same for every vector.
+*/
+
+#define DOP_MARKER_NEXT(m) ((0xfa + 0x05) - (m)) // Switch between 0x05 and 0xfa
+
+#ifdef DOP_X86_SIMD
+
+/* 8 byte pairs in output order -> 24 bytes of DoP */
+__attribute__((target("ssse3")))
+static inline void dop_store(__m128i units, __m128i mark0, __m128i mark1, guchar *out) {
+  const __m128i spread0 = _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10);
+  const __m128i spread1 = _mm_setr_epi8(11, -1, 12, 13, -1, 14, 15, -1,
+					-1, -1, -1, -1, -1, -1, -1, -1);
+
+  _mm_storeu_si128((__m128i *)out, _mm_or_si128(_mm_shuffle_epi8(units, spread0), mark0));
+  _mm_storel_epi64((__m128i *)(out + 16), _mm_or_si128(_mm_shuffle_epi8(units, spread1), mark1));
+}
+
+__attribute__((target("ssse3")))
+static inline __m128i bit_reverse_ssse3(__m128i x) {
+  const __m128i rev = _mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+				    0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+  const __m128i low = _mm_set1_epi8(0x0f);
+  __m128i lo = _mm_shuffle_epi8(rev, _mm_and_si128(x, low));
+  __m128i hi = _mm_shuffle_epi8(rev, _mm_and_si128(_mm_srli_epi16(x, 4), low));
+  return _mm_or_si128(_mm_slli_epi16(lo, 4), hi);
+}
+
+/* load 16 bytes, MSB first */
+__attribute__((target("ssse3")))
+static inline __m128i dop_load(const guchar *in, bool lsbf) {
+  __m128i x = _mm_loadu_si128((const __m128i *)in);
+  return lsbf ? bit_reverse_ssse3(x) : x;
+}
+
+/* returns the number of bytes per channel done, a multiple of 16 */
+__attribute__((target("ssse3")))
+static guint32 dop_ssse3(dsdbuffer *buf, guchar *pcmout, guchar marker) {
+  const guint nch = buf->num_channels;
+  const bool lsbf = buf->lsb_first;
+  const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  const __m128i stereo = _mm_setr_epi8(2, 0, 3, 1, 6, 4, 7, 5, 10, 8, 11, 9, 14, 12, 15, 13);
+  guchar mark[24] = { 0 };
+  __m128i mark0, mark1;
+  guint32 s = 0;
+  guint u;
+
+  for (u = 0; u < 8; u++)
+    mark[3 * u + 2] = (u / nch) & 1 ? DOP_MARKER_NEXT(marker) : marker;
+  mark0 = _mm_loadu_si128((__m128i *)mark);
+  mark1 = _mm_loadl_epi64((__m128i *)(mark + 16));
+
+  if (nch == 1) {
+    for (; s + 16 <= buf->bytes_per_channel; s += 16, pcmout += 24) {
+      __m128i x = dop_load(buf->data + s * buf->sample_step, lsbf);
+      dop_store(_mm_shuffle_epi8(x, swap), mark0, mark1, pcmout);
+    }
+  } else if (nch == 2 && buf->sample_step == 1) {
+    for (; s + 16 <= buf->bytes_per_channel; s += 16, pcmout += 48) {
+      __m128i l = _mm_shuffle_epi8(dop_load(buf->data + s, lsbf), swap);
+      __m128i r = _mm_shuffle_epi8(dop_load(buf->data + buf->ch_step + s, lsbf), swap);
+      dop_store(_mm_unpacklo_epi16(l, r), mark0, mark1, pcmout);
+      dop_store(_mm_unpackhi_epi16(l, r), mark0, mark1, pcmout + 24);
+    }
+  } else if (nch == 2 && buf->sample_step == 2 && buf->ch_step == 1) {
+    for (; s + 16 <= buf->bytes_per_channel; s += 16, pcmout += 48) {
+      __m128i a = dop_load(buf->data + 2 * s, lsbf);
+      __m128i b = dop_load(buf->data + 2 * s + 16, lsbf);
+      dop_store(_mm_shuffle_epi8(a, stereo), mark0, mark1, pcmout);
+      dop_store(_mm_shuffle_epi8(b, stereo), mark0, mark1, pcmout + 24);
     }
-    qerror[ch] = qe;
-    dsdin += in->ch_step;
-    dsdout += out->ch_step;
   }
+
+  return s;
 }
 
-void dsd_over_pcm(dsdbuffer *buf, guchar *pcmout) {
-  guint32 s, ch;
-  static guchar dop_marker = 0x05;
-  guchar *dsdin = buf->data;
+#endif /* DOP_X86_SIMD */
+
+gsize dsd_over_pcm(dsdbuffer *buf, guchar *pcmout, guchar *marker) {
+  guint32 s = 0, ch;
+  guchar *out = pcmout;
+  guchar *dsdin;
+
+#ifdef DOP_X86_SIMD
+  if (__builtin_cpu_supports("ssse3")) {
+    s = dop_ssse3(buf, out, *marker);
+    out += s / 2 * buf->num_channels * 3;
+  }
+#endif
 
-  for (s = 0; s < buf->bytes_per_channel; s += 2) {
+  for (dsdin = buf->data + s * buf->sample_step; s + 1 < buf->bytes_per_channel; s += 2) {
     guchar *dsdin2 = dsdin;
     for (ch = 0; ch < buf->num_channels; ch++) {
-      *pcmout++ = *(dsdin2 + buf->sample_step);
-      *pcmout++ = *dsdin2;
-      *pcmout++ = dop_marker;
+      if (buf->lsb_first) {
+	*out++ = bit_reverse(*(dsdin2 + buf->sample_step));
+	*out++ = bit_reverse(*dsdin2);
+      } else {
+	*out++ = *(dsdin2 + buf->sample_step);
+	*out++ = *dsdin2;
+      }
+      *out++ = *marker;
       dsdin2 += buf->ch_step;
     }
     dsdin += 2 * buf->sample_step;
-    dop_marker = (0xfa + 0x05) - dop_marker; // Switch between 0x05 and 0xfa
-  }  
+    *marker = DOP_MARKER_NEXT(*marker);
+  }
+
+  return out - pcmout;
+}
+
+/*
+** A converter owns all the state of one stream: the optional halfrate
+** filter in front, then either the DoP packer or the PCM decimator.
+*/
+
+struct dsdconverter_s {
+  dsdbuffer ibuffer;           // input geometry, data not used
+  guint32 frequency;
+  guint halfrate;
+  guint ratio;
+  bool dop;
+  pcmformat format;
+  guint32 rate;                // resampled output rate, 0 = none
+  resamplequality quality;
+  guchar dop_marker;
+  guint32 max_out;             // largest output of one dsd_convert call
+  guint64 skip;                // output frames still to drop, see converter_seek
+  dsdhalfrate *hr;
+  dsddecimator *dec;
+};
+
+/*
+** frequency is the DSD rate of the input. halfrate (1, 2, 4 or 8) divides
+** it before DoP packing or PCM conversion, ratio is the PCM decimation
+** from the halved rate.
+*/
+dsdconverter *init_converter(dsdbuffer *ibuffer, guint32 frequency, bool dop,
+			     guint halfrate, guint ratio, pcmformat format) {
+  dsdconverter *conv;
+  guint32 bytes = ibuffer->max_bytes_per_ch / halfrate;
+
+  conv = (dsdconverter *)calloc(1, sizeof(dsdconverter));
+  conv->ibuffer = *ibuffer;
+  conv->ibuffer.data = NULL;
+  conv->frequency = frequency;
+  conv->halfrate = halfrate;
+  conv->ratio = ratio;
+  conv->dop = dop;
+  conv->format = dop ? PCM_S24LE : format;
+  conv->dop_marker = DOP_MARKER;
+
+  if (halfrate > 1)
+    conv->hr = init_halfrate(ibuffer, halfrate);
+  if (!dop)
+    conv->dec = init_decimator(ibuffer, frequency / halfrate, ratio);
+  if ((halfrate > 1 && !conv->hr) || (!dop && !conv->dec)) {
+    free_converter(conv);
+    return NULL;
+  }
+
+  if (dop)
+    conv->max_out = ibuffer->num_channels * bytes / 2 * 3;
+  else
+    conv->max_out = ibuffer->num_channels * bytes * pcm_sample_bytes(format);
+
+  return conv;
+}
+
+void reset_converter(dsdconverter *conv) {
+  conv->dop_marker = DOP_MARKER;
+  conv->skip = 0;
+  if (conv->hr) reset_halfrate(conv->hr);
+  if (conv->dec) reset_decimator(conv->dec);
 }
 
-inline gint32 myround(float x)
-{
-  return (gint32)(x + (x>=0 ? 0.5f : -0.5f));
+void free_converter(dsdconverter *conv) {
+  if (!conv) return;
+  free_halfrate(conv->hr);
+  free_decimator(conv->dec);
+  free(conv);
 }
 
-inline gint32 clip(gint32 min, gint32 value, gint32 max) {
-  if (value<min) return min;
-  if (value>max) return max;
-  return value;
+/* a converter set up like conv, with fresh state and its own output format */
+dsdconverter *clone_converter(dsdconverter *conv, pcmformat format) {
+  dsdconverter *clone = init_converter(&conv->ibuffer, conv->frequency, conv->dop,
+				       conv->halfrate, conv->ratio, format);
+
+  if (clone && !converter_set_rate(clone, conv->rate, conv->quality)) {
+    free_converter(clone);
+    return NULL;
+  }
+  return clone;
 }
 
-void dsd_to_pcm(dsdbuffer *buf, guchar *pcmout) {
-  guint32 s, ch;
-  static dsd2pcm_ctx **dsd2pcm = NULL;
-  static float *dest = NULL;
+/*
+** TRUE if conv is what init_converter would make of these arguments,
+** the resampler is not compared (see converter_set_rate).
+*/
+bool converter_matches(dsdconverter *conv, dsdbuffer *ibuffer, guint32 frequency, bool dop,
+		       guint halfrate, guint ratio, pcmformat format) {
+  return conv->frequency == frequency && conv->dop == dop &&
+    conv->halfrate == halfrate && (dop || conv->ratio == ratio) &&
+    conv->format == (dop ? PCM_S24LE : format) &&
+    conv->ibuffer.num_channels == ibuffer->num_channels &&
+    conv->ibuffer.max_bytes_per_ch == ibuffer->max_bytes_per_ch;
+}
 
-  if (!dsd2pcm) {
-    dsd2pcm = (dsd2pcm_ctx **)malloc(buf->num_channels * sizeof(dsd2pcm_ctx *));
-    for (ch = 0; ch < buf->num_channels; ch++)
-      dsd2pcm[ch] = dsd2pcm_init();
-    dest = (float *)malloc(buf->num_channels * buf->max_bytes_per_ch * sizeof(float));
+/*
+** conv reset for a new stream if it is set up like like with output
+** format, otherwise conv is freed and a clone of like is returned.
+** conv may be NULL.
+*/
+dsdconverter *reuse_converter(dsdconverter *conv, dsdconverter *like, pcmformat format) {
+  if (conv && converter_matches(conv, &like->ibuffer, like->frequency, like->dop,
+				like->halfrate, like->ratio, format) &&
+      converter_set_rate(conv, like->rate, like->quality)) {
+    reset_converter(conv);
+    return conv;
   }
+  free_converter(conv);
+  return clone_converter(like, format);
+}
+
+/*
+** Input bytes per channel a fresh converter (see converter_set_start)
+** has to see before its output matches a run over the whole stream.
+** With DoP or halfrate it never does: the marker phase and the halfrate
+** error carry over the whole stream.
+*/
+guint32 converter_history(dsdconverter *conv) {
+  if (conv->dop || conv->hr) return G_MAXUINT32;
+  return decimator_history(conv->dec);
+}
+
+/* input bytes per channel after its time that an output frame depends on */
+guint32 converter_lookahead(dsdconverter *conv) {
+  if (!conv->dec) return 0;
+  return decimator_lookahead(conv->dec) * conv->halfrate;
+}
+
+/* output frames before byte bytes_per_channel of the stream */
+static guint64 output_frames(dsdconverter *conv, guint64 bytes_per_channel) {
+  guint32 pcm_rate = conv->frequency / conv->halfrate / (conv->dop ? 16 : conv->ratio);
+  guint64 frames = bytes_per_channel * 8 / (conv->halfrate * (conv->dop ? 16 : conv->ratio));
+
+  if (conv->rate)
+    frames = (frames * conv->rate + pcm_rate - 1) / pcm_rate;
+  return frames;
+}
+
+/* output bytes before byte bytes_per_channel of the stream */
+gsize converter_output_size(dsdconverter *conv, guint64 bytes_per_channel) {
+  return output_frames(conv, bytes_per_channel) * conv->ibuffer.num_channels *
+    pcm_sample_bytes(conv->format);
+}
+
+/* threads for PCM conversion, see decimator_set_threads */
+void converter_set_threads(dsdconverter *conv, guint threads) {
+  if (conv->dec) decimator_set_threads(conv->dec, threads);
+}
+
+/*
+** Resamples the PCM output to rate (0 = the decimated rate) with a
+** resampler of quality. Setting what is already set keeps the state.
+** FALSE (and no change) for DoP at any other than its own rate, or a
+** ratio the resampler cannot do.
+*/
+bool converter_set_rate(dsdconverter *conv, guint32 rate, resamplequality quality) {
+  guint32 pcm_rate = conv->frequency / conv->halfrate / (conv->dop ? 16 : conv->ratio);
+  guint32 bytes = conv->ibuffer.max_bytes_per_ch / conv->halfrate, runs = 1;
+  dsdresampler *rs = NULL;
+
+  if (rate == pcm_rate) rate = 0;
+  if (rate == conv->rate && (rate == 0 || quality == conv->quality)) return TRUE;
+  if (conv->dop) return FALSE;
+
+  if (rate) {
+    if (!(rs = init_resampler(conv->ibuffer.num_channels, pcm_rate, rate, quality,
+			      conv->ibuffer.max_bytes_per_ch)))
+      return FALSE;
+    // every run of dsd_convert may give one more frame
+    if (conv->ibuffer.block_bytes)
+      runs += conv->ibuffer.max_bytes_per_ch / conv->ibuffer.block_bytes;
+    conv->max_out = MAX(bytes, resampler_max_output(rs, bytes) + runs)
+      * conv->ibuffer.num_channels * pcm_sample_bytes(conv->format);
+  } else
+    conv->max_out = conv->ibuffer.num_channels * bytes * pcm_sample_bytes(conv->format);
+
+  decimator_set_resampler(conv->dec, rs);
+  conv->rate = rate;
+  conv->quality = quality;
+
+  return TRUE;
+}
+
+/*
+** The next input is byte sample per channel of the stream. A resampler
+** counts its output frames from the start of the stream, so they are
+** the same as in a run over the whole stream. Call it on a fresh or
+** reset converter.
+*/
+void converter_set_start(dsdconverter *conv, guint64 sample) {
+  if (conv->dec)
+    decimator_set_start(conv->dec, sample / (conv->halfrate * conv->ratio / 8));
+}
 
-  for (ch = 0; ch < buf->num_channels; ch++) {
-    dsd2pcm_translate(dsd2pcm[ch], buf->bytes_per_channel, 
-		      buf->data + ch * buf->ch_step, 
-		      buf->sample_step, 0, // 0 = lsb_first, bitreverse already done.
-		      dest + ch, buf->num_channels);
+/*
+** Starts the conversion of file at mseconds, rounded down to a whole
+** output frame. The data just before it is read as well, enough to fill
+** the filters, and conv drops what it makes of that: the output starts
+** as it would in a run over the whole file, not with filters coming out
+** of silence. Call it on a fresh or reset converter, before reading.
+** Noise shaped 16 bit output and halving (DoP above the rate limit) are
+** the exceptions: their state goes back to the start of the stream, so
+** they start afresh and differ within their noise from a whole run.
+*/
+bool converter_seek(dsdconverter *conv, dsdfile *file, guint32 mseconds) {
+  guint32 frame = conv->halfrate * (conv->dop ? 2 : conv->ratio / 8);
+  guint64 start = dsd_sample_at(file, mseconds) / frame * frame;
+  guint64 preroll = 0;
+
+  if (conv->dec) {
+    preroll = (guint64)decimator_history(conv->dec) * conv->halfrate;
+    preroll = MIN((preroll + frame - 1) / frame * frame, start);
   }
+  if (!dsd_seek_sample(file, start - preroll)) return FALSE;
+
+  converter_set_start(conv, start - preroll);
+  conv->skip = output_frames(conv, start) - output_frames(conv, start - preroll);
+
+  return TRUE;
+}
+
+/* output frames converter_seek left for the converter to drop */
+guint64 converter_skip(dsdconverter *conv) {
+  return conv->skip;
+}
+
+pcmformat converter_format(dsdconverter *conv) {
+  return conv->format;
+}
+
+/* of the PCM output, 0 for DoP */
+guint32 converter_rate(dsdconverter *conv) {
+  return conv->dec ? decimator_rate(conv->dec) : 0;
+}
+
+/* 16 bit PCM output is noise shaped, see quantize in decimate.c */
+bool converter_shaped(dsdconverter *conv) {
+  return conv->format == PCM_S16LE && conv->dec;
+}
+
+gsize converter_max_output(dsdconverter *conv) {
+  return conv->max_out;
+}
+
+static gsize convert_run(dsdconverter *conv, dsdbuffer *buf, guchar *out) {
+  if (conv->hr)
+    buf = halfrate_filter(conv->hr, buf);
+  if (conv->dop)
+    return dsd_over_pcm(buf, out, &conv->dop_marker);
+  return dsd_to_pcm_decimated(conv->dec, buf, out, conv->format);
+}
+
+/*
+** A buffer of several DSF blocks is converted one contiguous run per
+** channel at a time, the output of the runs follows each other.
+*/
+static gsize convert_runs(dsdconverter *conv, dsdbuffer *buf, guchar *out) {
+  dsdbuffer run;
+  guint32 s;
+  gsize n = 0;
+
+  if (!buf->block_bytes || buf->bytes_per_channel <= buf->block_bytes)
+    return convert_run(conv, buf, out);
 
-  for (s = 0; s < buf->num_channels * buf->bytes_per_channel; s++) {
-    float r = dest[s] * (1<<23);
-    gint32 x = clip(-(1<<23), myround(r), ((1<<23)-1));
-    *pcmout++ =  x        & 0xFF;
-    *pcmout++ = (x >>  8) & 0xFF;
-    *pcmout++ = (x >> 16) & 0xFF;
+  run = *buf;
+  for (s = 0; s < buf->bytes_per_channel; s += buf->block_bytes) {
+    run.data = buf->data + s / buf->block_bytes * buf->block_step;
+    run.bytes_per_channel = MIN(buf->block_bytes, buf->bytes_per_channel - s);
+    n += convert_run(conv, &run, out + n);
   }
+
+  return n;
+}
+
+/* drops what is left of the pre-roll from n bytes of output */
+static gsize skip_output(dsdconverter *conv, guchar *out, gsize n) {
+  gsize frame, drop;
+
+  if (G_LIKELY(!conv->skip)) return n;
+  frame = conv->ibuffer.num_channels * pcm_sample_bytes(conv->format);
+  drop = MIN(n / frame, conv->skip);
+  memmove(out, out + drop * frame, n - drop * frame);
+  conv->skip -= drop;
+
+  return n - drop * frame;
+}
+
+gsize dsd_convert(dsdconverter *conv, dsdbuffer *buf, guchar *out) {
+  return skip_output(conv, out, convert_runs(conv, buf, out));
+}
+
+/*
+** After the last dsd_convert: the output the resampler still holds,
+** at most converter_max_output bytes. Call it until it returns 0.
+*/
+gsize converter_finish(dsdconverter *conv, guchar *out) {
+  gsize frame = conv->ibuffer.num_channels * pcm_sample_bytes(conv->format), made, n;
+
+  if (!conv->dec) return 0;
+  do {                         // a stream shorter than its pre-roll
+    made = decimator_flush(conv->dec, out, conv->format, conv->max_out / frame);
+    n = skip_output(conv, out, made);
+  } while (made > 0 && n == 0);
+
+  return n;
 }
@@ -138,22 +138,12 @@ bool dsf_init(dsdfile *file) {
   file->buffer.lsb_first = (file->dsf.bits_per_sample == 1);
   file->buffer.sample_step = 1;
   file->buffer.ch_step = file->dsf.block_size_per_channel;
+  file->buffer.block_bytes = file->dsf.block_size_per_channel;
+  file->buffer.block_step = file->dsf.block_size_per_channel * file->channel_num;
 
   return TRUE;
 }
 
-bool dsf_set_start(dsdfile *file, guint32 mseconds) {
-  
-  if (!file) return FALSE;
-
-  guint64 skip_blocks = (guint64) file->sampling_frequency * mseconds / (8000 * file->dsf.block_size_per_channel);
-  guint64 skip_bytes = skip_blocks * file->dsf.block_size_per_channel * file->channel_num;
-
-  file->sample_offset = skip_blocks * file->dsf.block_size_per_channel;
-
-  return dsd_seek(file, skip_bytes, SEEK_CUR);
-}
-
 bool dsf_set_stop(dsdfile *file, guint32 mseconds) {
 
   if (!file) return FALSE;
@@ -170,19 +160,41 @@ bool dsf_set_stop(dsdfile *file, guint32 mseconds) {
   return TRUE;
 }
 
+/*
+** Reads as many whole blocks as fit max_bytes_per_ch, the last one may
+** be cut at sample_stop. The blocks stay as they are in the file, the
+** buffer describes them with block_bytes / block_step. A start inside a
+** block (see dsd_seek_sample) is read up to the end of that block first.
+*/
 dsdbuffer *dsf_read(dsdfile *file) {
+  guint32 block = file->dsf.block_size_per_channel;
+  guint32 skip = file->sample_offset % block, ch;
+  guint64 left, blocks, bytes;
+  guchar *data;
+
   if (file->eof) return NULL;
 
-  if (!dsd_read_raw(file->buffer.data, file->channel_num * file->dsf.block_size_per_channel, file))
-    return NULL;
+  left = file->sample_stop - file->sample_offset;
+  if (skip)
+    blocks = 1;
+  else
+    blocks = MAX(1, MIN(file->buffer.max_bytes_per_ch / block, (left + block - 1) / block));
 
-  if (file->dsf.block_size_per_channel >= (file->sample_stop - file->sample_offset)) {
-    file->buffer.bytes_per_channel = (file->sample_stop - file->sample_offset);
-    file->eof = TRUE;
-  } else {
-    file->sample_offset += file->dsf.block_size_per_channel;
-    file->buffer.bytes_per_channel = file->dsf.block_size_per_channel;
-  }
+  if (!(data = dsd_read_block(file, file->channel_num * blocks * block)))
+    return NULL;
+  bytes = MIN(blocks * block - skip, left);
+
+  // the channels of a mapped block are pointed into, read ones are moved down
+  if (skip && file->map)
+    data += skip;
+  else if (skip)
+    for (ch = 0; ch < file->channel_num; ch++)
+      memmove(data + ch * block, data + ch * block + skip, bytes);
+
+  file->buffer.data = data;
+  file->buffer.bytes_per_channel = bytes;
+  file->sample_offset += bytes;
+  if (file->sample_offset >= file->sample_stop) file->eof = TRUE;
 
   return &file->buffer;
 }
@@ -0,0 +1,667 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  The DST frame decoder is derived from FFmpeg's libavcodec/dstdec.c:
+ *
+ *    Direct Stream Transfer (DST) decoder
+ *    Copyright (c) 2014-2015 Peter Ross
+ *
+ *    FFmpeg is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 2.1 of the License, or (at your option) any later version.
+ *
+ *  It is used here under the LGPL 2.1 or later and, as section 3 of that
+ *  licence allows, distributed as part of dsdplay under the GNU General
+ *  Public License:
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libdsd.h"
+#include "dsdinternals.h"
+
+/*
+** DST (Direct Stream Transfer, ISO/IEC 14496-3 subpart 10) compressed
+** DSDIFF. The "DST " chunk holds an "FRTE" chunk with the number of
+** frames and the frame rate (75 per second), then one "DSTF" chunk per
+** frame, each optionally followed by a "DSTC" CRC chunk.
+**
+** Every bit is predicted from the previous 128 bits of its channel by a
+** filter, the arithmetic coded residual says whether the prediction was
+** right, with a probability looked up from the size of the prediction.
+** The frame decoder is derived from FFmpeg's dstdec.c (see the notice
+** above): one segment per channel, the filter taps are applied a byte
+** of history at a time from tables of all 256 sign patterns. Frames do
+** not depend on each other, so with dsd_set_threads they are decoded on
+** a thread pool a few frames ahead and handed out in order. By default
+** they are decoded serially.
+**
+** The decoded frames are DSDIFF data, MSB first and byte interleaved, so
+** dsd_read returns the same buffers as for an uncompressed file.
+*/
+
+#define DST_MAX_CHANNELS 6
+#define DST_MAX_ELEMENTS (2 * DST_MAX_CHANNELS)
+#define DST_SILENCE 0x69
+
+typedef struct {
+  guint elements;
+  guint length[DST_MAX_ELEMENTS];
+  gint coeff[DST_MAX_ELEMENTS][128];
+} dsttable;
+
+/* what decoding a frame needs besides its input and output */
+typedef struct {
+  dsttable fsets;
+  dsttable probs;
+  gint16 filter[DST_MAX_ELEMENTS][16][256];
+} dstctx;
+
+typedef struct {
+  const guchar *in;            // compressed frame, in the mapping or in mem
+  guchar *mem;                 // copy of a frame of an unmapped file
+  gsize mem_size;
+  gsize size;
+  guchar *out;                 // frame_bytes per channel, interleaved
+  dstctx *ctx;
+  bool done;
+} dstframe;
+
+typedef struct {
+  gsize offset;                // of the frame data in the file
+  guint32 size;
+} dstindex;
+
+struct dstdecoder_s {
+  guint num_channels;
+  guint32 frame_bytes;         // per channel
+  guint64 count;               // frames
+  gsize end;                   // end of the DST chunk
+  dstindex *index;             // mapped files only, NULL otherwise
+  bool shared;                 // index belongs to another decoder
+  GThreadPool *pool;           // NULL: frames are decoded as they are queued
+  GMutex lock;
+  GCond cond;
+  dstframe *slots;
+  guint window;
+  guint64 first;               // oldest queued frame, the one handed out
+  guint64 next;                // next frame to queue, for unmapped files also to read
+  guint queued;
+};
+
+/* MSB first, reads zeros past the end */
+typedef struct {
+  const guchar *data;
+  gsize size;
+  gsize pos;                   // in bits
+} bitreader;
+
+static inline guint32 get_bits(bitreader *br, guint n) {
+  gsize byte = br->pos >> 3;
+  guint shift = br->pos & 7, i;
+  guint64 w = 0;
+
+  if (n == 0) return 0;
+  if (byte + 8 <= br->size) {
+    memcpy(&w, br->data + byte, sizeof(w));
+    w = GUINT64_FROM_BE(w);
+  } else
+    for (i = 0; i < 8; i++)
+      w = (w << 8) | (byte + i < br->size ? br->data[byte + i] : 0);
+  br->pos += n;
+
+  return (guint32)((w << shift) >> (64 - n));
+}
+
+static inline gint32 get_sbits(bitreader *br, guint n) {
+  return (gint32)(get_bits(br, n) << (32 - n)) >> (32 - n);
+}
+
+/* Rice code: a run of zeros ended by a one, k low bits, then the sign */
+static gint32 get_rice(bitreader *br, guint k) {
+  guint32 q = 0;
+  gint32 v;
+
+  while (!get_bits(br, 1) && br->pos < 8 * br->size && q < (1u << 16))
+    q++;
+  v = (gint32)((q << k) | get_bits(br, k));
+  if (v && get_bits(br, 1))
+    v = -v;
+
+  return v;
+}
+
+typedef struct {
+  guint32 a;
+  guint32 c;
+} arith;
+
+/* one bit, p / 256 is the probability of 0 */
+static inline guint ac_get(arith *ac, bitreader *br, guint p) {
+  guint32 k = (ac->a >> 8) | ((ac->a >> 7) & 1);
+  guint32 q = k * p, a_q = ac->a - q;
+  guint e = ac->c < a_q;
+
+  if (e)
+    ac->a = a_q;
+  else {
+    ac->a = q;
+    ac->c -= a_q;
+  }
+  if (ac->a < 2048) {
+    guint n = 12 - g_bit_storage(ac->a);
+    ac->a <<= n;
+    ac->c = (ac->c << n) | get_bits(br, n);
+  }
+
+  return e;
+}
+
+/* element of every channel: all 0, or each a known one or the next new one */
+static bool read_map(bitreader *br, dsttable *t, guint *map, guint channels) {
+  guint ch;
+
+  t->elements = 1;
+  memset(map, 0, channels * sizeof(guint));
+  if (get_bits(br, 1))
+    return TRUE;
+
+  for (ch = 1; ch < channels; ch++) {
+    map[ch] = get_bits(br, g_bit_storage(t->elements));
+    if (map[ch] == t->elements) {
+      if (++t->elements >= DST_MAX_ELEMENTS) return FALSE;
+    } else if (map[ch] > t->elements)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+static const gint8 fsets_pred[3][3] = {
+  { -8, 0, 0 },
+  { -16, 8, 0 },
+  { -9, -5, 6 },
+};
+
+static const gint8 probs_pred[3][3] = {
+  { -8, 0, 0 },
+  { -16, 8, 0 },
+  { -24, 24, -8 },
+};
+
+static void read_coeffs(bitreader *br, gint *coeff, guint n, guint bits, bool is_signed,
+			gint offset) {
+  guint i;
+
+  for (i = 0; i < n; i++)
+    coeff[i] = (is_signed ? get_sbits(br, bits) : (gint)get_bits(br, bits)) + offset;
+}
+
+/*
+** Filter coefficients or probabilities of every element, plain or as
+** Rice coded residuals of a prediction from the previous ones.
+*/
+static bool read_table(bitreader *br, dsttable *t, const gint8 pred[3][3],
+		       guint length_bits, guint bits, bool is_signed, gint offset) {
+  guint i, j, k, method, lsb;
+  gint x, c;
+
+  for (i = 0; i < t->elements; i++) {
+    t->length[i] = get_bits(br, length_bits) + 1;
+    if (!get_bits(br, 1)) {
+      read_coeffs(br, t->coeff[i], t->length[i], bits, is_signed, offset);
+      continue;
+    }
+
+    if ((method = get_bits(br, 2)) == 3) return FALSE;
+    read_coeffs(br, t->coeff[i], method + 1, bits, is_signed, offset);
+    lsb = get_bits(br, 3);
+    for (j = method + 1; j < t->length[i]; j++) {
+      for (x = 0, k = 0; k <= method; k++)
+	x += pred[method][k] * t->coeff[i][j - k - 1];
+      c = get_rice(br, lsb);
+      if (x >= 0)
+	c -= (x + 4) / 8;
+      else
+	c += (-x + 3) / 8;
+      if (!is_signed && (c < offset || c >= offset + (1 << bits)))
+	return FALSE;
+      t->coeff[i][j] = c;
+    }
+  }
+
+  return TRUE;
+}
+
+/* sums of 8 taps for every pattern of 8 history bits, bit 0 the newest */
+static bool build_filter(dstctx *ctx) {
+  const dsttable *t = &ctx->fsets;
+  guint i, j, k, l, taps;
+  gint v;
+
+  for (i = 0; i < t->elements; i++) {
+    for (j = 0; j < 16; j++) {
+      taps = t->length[i] > 8 * j ? MIN(8, t->length[i] - 8 * j) : 0;
+      for (k = 0; k < 256; k++) {
+	for (v = 0, l = 0; l < taps; l++)
+	  v += ((k >> l) & 1 ? 1 : -1) * t->coeff[i][8 * j + l];
+	if (v != (gint16)v) return FALSE;
+	ctx->filter[i][j][k] = v;
+      }
+    }
+  }
+
+  return TRUE;
+}
+
+static inline gint predict(const gint16 (*filter)[256], guint64 lo, guint64 hi) {
+  gint sum = 0;
+  guint j;
+
+  for (j = 0; j < 8; j++)
+    sum += filter[j][(lo >> (8 * j)) & 0xff] + filter[8 + j][(hi >> (8 * j)) & 0xff];
+
+  return (gint16)sum;
+}
+
+static bool dst_decode(dstctx *ctx, const guchar *in, gsize size, guchar *out,
+		       guint channels, guint32 frame_bytes) {
+  bitreader br = { in, size, 0 };
+  guint felem[DST_MAX_CHANNELS], pelem[DST_MAX_CHANNELS], half[DST_MAX_CHANNELS];
+  guint64 status[DST_MAX_CHANNELS][2];
+  guint32 i, bits = 8 * frame_bytes;
+  guint ch, residual;
+  arith ac;
+
+  if (size <= 1) return FALSE;
+
+  // stored without compression
+  if (!get_bits(&br, 1)) {
+    get_bits(&br, 1);
+    if (get_bits(&br, 6)) return FALSE;
+    size = MIN(size - 1, (gsize)frame_bytes * channels);
+    memcpy(out, in + 1, size);
+    memset(out + size, DST_SILENCE, (gsize)frame_bytes * channels - size);
+    return TRUE;
+  }
+
+  // same segmentation for filters and probabilities, all channels, one segment
+  if (!get_bits(&br, 1) || !get_bits(&br, 1) || !get_bits(&br, 1))
+    return FALSE;
+
+  if (get_bits(&br, 1)) {
+    if (!read_map(&br, &ctx->fsets, felem, channels)) return FALSE;
+    ctx->probs.elements = ctx->fsets.elements;
+    memcpy(pelem, felem, sizeof(felem));
+  } else if (!read_map(&br, &ctx->fsets, felem, channels) ||
+	     !read_map(&br, &ctx->probs, pelem, channels))
+    return FALSE;
+
+  for (ch = 0; ch < channels; ch++)
+    half[ch] = get_bits(&br, 1);
+
+  if (!read_table(&br, &ctx->fsets, fsets_pred, 7, 9, TRUE, 0) ||
+      !read_table(&br, &ctx->probs, probs_pred, 6, 7, FALSE, 1) ||
+      get_bits(&br, 1) || !build_filter(ctx))
+    return FALSE;
+
+  ac.a = 4095;
+  ac.c = get_bits(&br, 12);
+  ac_get(&ac, &br, (bit_reverse(ctx->fsets.coeff[0][0] & 127) >> 1) + 1);
+
+  memset(status, 0xaa, sizeof(status));
+  memset(out, 0, (gsize)frame_bytes * channels);
+
+  for (i = 0; i < bits; i++) {
+    for (ch = 0; ch < channels; ch++) {
+      guint f = felem[ch], p = pelem[ch], prob, v;
+      gint pr = predict((const gint16 (*)[256])ctx->filter[f], status[ch][0], status[ch][1]);
+
+      if (!half[ch] || i >= ctx->fsets.length[f])
+	prob = ctx->probs.coeff[p][MIN((guint)ABS(pr) >> 3, ctx->probs.length[p] - 1)];
+      else
+	prob = 128;
+
+      residual = ac_get(&ac, &br, prob);
+      v = ((pr >> 15) ^ residual) & 1;
+      out[(i >> 3) * channels + ch] |= v << (7 - (i & 7));
+
+      status[ch][1] = (status[ch][1] << 1) | (status[ch][0] >> 63);
+      status[ch][0] = (status[ch][0] << 1) | v;
+    }
+  }
+
+  return TRUE;
+}
+
+static void decode_slot(dstdecoder *dst, dstframe *slot) {
+  if (!slot->ctx)
+    slot->ctx = (dstctx *)malloc(sizeof(dstctx));
+  // a broken frame is a dropout, not the end of the stream
+  if (!dst_decode(slot->ctx, slot->in, slot->size, slot->out,
+		  dst->num_channels, dst->frame_bytes))
+    memset(slot->out, DST_SILENCE, (gsize)dst->frame_bytes * dst->num_channels);
+}
+
+static void dst_worker(gpointer data, gpointer user_data) {
+  dstdecoder *dst = (dstdecoder *)user_data;
+  dstframe *slot = &dst->slots[GPOINTER_TO_UINT(data) - 1];
+
+  decode_slot(dst, slot);
+  g_mutex_lock(&dst->lock);
+  slot->done = TRUE;
+  g_cond_broadcast(&dst->cond);
+  g_mutex_unlock(&dst->lock);
+}
+
+/* the frame slots and, for threads > 1, a pool of that many threads */
+static void init_slots(dstdecoder *dst, guint threads) {
+  guint i;
+
+  dst->window = threads > 1 ? 2 * threads : 1;
+  dst->slots = (dstframe *)calloc(dst->window, sizeof(dstframe));
+  for (i = 0; i < dst->window; i++)
+    dst->slots[i].out = (guchar *)malloc((gsize)dst->frame_bytes * dst->num_channels);
+  if (threads > 1) {
+    g_mutex_init(&dst->lock);
+    g_cond_init(&dst->cond);
+    dst->pool = g_thread_pool_new(dst_worker, dst, threads, TRUE, NULL);
+  }
+}
+
+static void free_slots(dstdecoder *dst) {
+  guint i;
+
+  if (dst->pool) {
+    g_thread_pool_free(dst->pool, FALSE, TRUE);
+    g_mutex_clear(&dst->lock);
+    g_cond_clear(&dst->cond);
+    dst->pool = NULL;
+  }
+  for (i = 0; i < dst->window; i++) {
+    free(dst->slots[i].mem);
+    free(dst->slots[i].out);
+    free(dst->slots[i].ctx);
+  }
+  free(dst->slots);
+}
+
+static dstdecoder *new_decoder(guint channels, guint32 frame_bytes) {
+  dstdecoder *dst = (dstdecoder *)calloc(1, sizeof(dstdecoder));
+
+  dst->num_channels = channels;
+  dst->frame_bytes = frame_bytes;
+  init_slots(dst, 1);
+
+  return dst;
+}
+
+/*
+** Reads the frame chunks of a mapped file into an index, so that any
+** frame can be found without reading the ones before it.
+*/
+static bool build_index(dsdfile *file, dstdecoder *dst) {
+  gsize offset = file->offset, size;
+  guint64 n = 0;
+  guchar *p;
+
+  dst->end = MIN(dst->end, file->map_size);
+  dst->index = (dstindex *)malloc(MAX(dst->count, 1) * sizeof(dstindex));
+  while (n < dst->count && offset + 12 <= dst->end) {
+    p = file->map + offset;
+    size = GUINT64_FROM_BE(*((guint64*)(p + 4)));
+    offset += 12;
+    if (size > dst->end - offset) break;
+    if (!memcmp(p, "DSTF", 4) && size <= G_MAXUINT32) {
+      dst->index[n].offset = offset;
+      dst->index[n].size = size;
+      n++;
+    }
+    offset += size + (size & 1);
+  }
+  dst->count = n;            // a cut file plays up to where it is cut
+
+  return n > 0;
+}
+
+/*
+** Sets file up for the DST chunk it is at, size is the size of the
+** chunk. Frames are decoded serially until dst_set_threads.
+*/
+bool dst_init(dsdfile *file, guint64 size) {
+  guchar buffer[18];
+  guint32 frames, frame_bytes;
+  guint16 rate;
+  guint64 head;
+  dstdecoder *dst;
+
+  if (file->channel_num == 0 || file->channel_num > DST_MAX_CHANNELS || size < 18)
+    return FALSE;
+  if (!dsd_read_raw(buffer, sizeof(buffer), file) ||
+      memcmp(buffer, "FRTE", 4))
+    return FALSE;
+  head = GUINT64_FROM_BE(*((guint64*)(buffer + 4)));
+  frames = GUINT32_FROM_BE(*((guint32*)(buffer + 12)));
+  rate = GUINT16_FROM_BE(*((guint16*)(buffer + 16)));
+  if (head < 6 || head + 12 > size || rate == 0 ||
+      file->sampling_frequency % (8 * rate) != 0)
+    return FALSE;
+  frame_bytes = file->sampling_frequency / 8 / rate;
+  if (!dsd_seek(file, head - 6 + (head & 1), SEEK_CUR)) return FALSE;
+
+  dst = new_decoder(file->channel_num, frame_bytes);
+  dst->count = frames;
+  dst->end = file->offset + size - 12 - head - (head & 1);
+  file->dst = dst;
+  if (file->map && !build_index(file, dst))
+    return FALSE;
+
+  file->sample_offset = 0;
+  file->sample_count = 8 * dst->count * frame_bytes;
+  file->sample_stop = file->sample_count / 8;
+
+  file->dataoffset = file->offset;
+  file->datasize = file->sample_stop * file->channel_num;
+
+  return TRUE;
+}
+
+/* a decoder of the same stream for a range reader, serial, the index is shared */
+dstdecoder *dst_open_range(dstdecoder *dst) {
+  dstdecoder *range = new_decoder(dst->num_channels, dst->frame_bytes);
+
+  range->count = dst->count;
+  range->end = dst->end;
+  range->index = dst->index;
+  range->shared = TRUE;
+
+  return range;
+}
+
+static void wait_frame(dstdecoder *dst, dstframe *slot) {
+  if (!dst->pool) return;                      // decoded when queued
+  g_mutex_lock(&dst->lock);
+  while (!slot->done)
+    g_cond_wait(&dst->cond, &dst->lock);
+  g_mutex_unlock(&dst->lock);
+}
+
+/* waits for every queued frame and drops them */
+static void drain(dstdecoder *dst) {
+  guint i;
+
+  for (i = 0; i < dst->queued; i++)
+    wait_frame(dst, &dst->slots[(dst->first + i) % dst->window]);
+  dst->first = dst->next;
+  dst->queued = 0;
+}
+
+/*
+** Decodes on threads threads, 1 is serial. Only before the first read:
+** frames already read from a pipe would be lost.
+*/
+bool dst_set_threads(dstdecoder *dst, guint threads) {
+  if (dst->queued > 0) return FALSE;
+  free_slots(dst);
+  init_slots(dst, threads);
+
+  return TRUE;
+}
+
+void free_dst(dstdecoder *dst) {
+  if (!dst) return;
+  drain(dst);
+  free_slots(dst);
+  if (!dst->shared)
+    free(dst->index);
+  free(dst);
+}
+
+/* the next frame chunk of an unmapped file, into mem or skipped */
+static bool read_frame(dsdfile *file, dstframe *slot) {
+  dstdecoder *dst = file->dst;
+  guchar head[12];
+  guint64 size;
+
+  while (file->offset + 12 <= dst->end) {
+    if (!dsd_read_raw(head, sizeof(head), file)) return FALSE;
+    size = GUINT64_FROM_BE(*((guint64*)(head + 4)));
+    if (size > dst->end - file->offset) return FALSE;
+    if (!memcmp(head, "DSTF", 4)) {
+      if (!slot)
+	return dsd_seek(file, size + (size & 1), SEEK_CUR);
+      if (size > slot->mem_size) {
+	slot->mem = (guchar *)realloc(slot->mem, size);
+	slot->mem_size = size;
+      }
+      slot->in = slot->mem;
+      slot->size = size;
+      return dsd_read_raw(slot->mem, size, file) &&
+	(!(size & 1) || dsd_seek(file, 1, SEEK_CUR));
+    }
+    if (!dsd_seek(file, size + (size & 1), SEEK_CUR)) return FALSE;
+  }
+
+  return FALSE;
+}
+
+static bool queue_frame(dsdfile *file) {
+  dstdecoder *dst = file->dst;
+  guint n = dst->next % dst->window;
+  dstframe *slot = &dst->slots[n];
+
+  if (dst->index) {
+    slot->in = file->map + dst->index[dst->next].offset;
+    slot->size = dst->index[dst->next].size;
+  } else if (!read_frame(file, slot))
+    return FALSE;
+
+  dst->next++;
+  dst->queued++;
+  slot->done = FALSE;
+  if (dst->pool)
+    g_thread_pool_push(dst->pool, GUINT_TO_POINTER(n + 1), NULL);  // no NULL jobs
+  else {
+    decode_slot(dst, slot);
+    slot->done = TRUE;
+  }
+
+  return TRUE;
+}
+
+/*
+** The decoded frame, NULL if it cannot be read. Keeps the window of
+** frames after it queued, up to the one holding sample_stop.
+*/
+static dstframe *get_frame(dsdfile *file, guint64 frame) {
+  dstdecoder *dst = file->dst;
+  guint64 last = MIN(dst->count, (file->sample_stop + dst->frame_bytes - 1) / dst->frame_bytes);
+  dstframe *slot;
+
+  if (frame < dst->first || frame >= dst->next) {
+    drain(dst);
+    if (!dst->index) {
+      if (frame < dst->next) return NULL;     // no going back in a pipe
+      for (; dst->next < frame; dst->next++)
+	if (!read_frame(file, NULL)) return NULL;
+    }
+    dst->first = dst->next = frame;
+  }
+  for (; dst->first < frame; dst->first++, dst->queued--)
+    wait_frame(dst, &dst->slots[dst->first % dst->window]);
+
+  while (dst->queued < dst->window && dst->next < last)
+    if (!queue_frame(file)) break;
+  if (dst->queued == 0) return NULL;
+
+  slot = &dst->slots[frame % dst->window];
+  wait_frame(dst, slot);
+
+  return slot;
+}
+
+/* up to max_bytes_per_ch decoded bytes per channel, across frames */
+dsdbuffer *dst_read(dsdfile *file) {
+  dstdecoder *dst = file->dst;
+  guint nch = file->channel_num;
+  guint32 done = 0, pos, n;
+  dstframe *slot;
+
+  if (file->eof) return NULL;
+
+  while (done < file->buffer.max_bytes_per_ch && file->sample_offset < file->sample_stop) {
+    if (!(slot = get_frame(file, file->sample_offset / dst->frame_bytes))) {
+      file->eof = TRUE;        // cut or broken, hand out what was decoded
+      break;
+    }
+    pos = file->sample_offset % dst->frame_bytes;
+    n = MIN(dst->frame_bytes - pos, file->buffer.max_bytes_per_ch - done);
+    n = MIN(n, file->sample_stop - file->sample_offset);
+    memcpy(file->buffer.data + (gsize)done * nch, slot->out + (gsize)pos * nch, (gsize)n * nch);
+    done += n;
+    file->sample_offset += n;
+  }
+
+  if (done == 0) return NULL;
+  file->buffer.bytes_per_channel = done;
+  if (file->sample_offset >= file->sample_stop) file->eof = TRUE;
+
+  return &file->buffer;
+}
+
+/*
+** Moves to byte sample per channel. The frames are found in the index,
+** an unmapped file can only go forward and skips frames undecoded.
+*/
+bool dst_seek(dsdfile *file, guint64 sample) {
+  dstdecoder *dst = file->dst;
+
+  sample = MIN(sample, file->sample_count / 8);
+  if (!dst->index && sample / dst->frame_bytes < dst->first)
+    return FALSE;
+
+  file->sample_offset = sample;
+  file->eof = (sample >= file->sample_stop);
+
+  return TRUE;
+}
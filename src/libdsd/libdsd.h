@@ -28,6 +28,14 @@ typedef struct {
 
 typedef enum { DSF, DSDIFF } dsdtype;
 
+#define DOP_MARKER 0x05         // initial DoP marker of a stream
+
+typedef enum { PCM_S16LE, PCM_S24LE, PCM_S32LE, PCM_F32LE } pcmformat;
+
+typedef enum { OUTPUT_RAW, OUTPUT_WAV, OUTPUT_FLAC } outputtype;
+
+typedef enum { RESAMPLE_LOW, RESAMPLE_MEDIUM, RESAMPLE_HIGH } resamplequality;
+
 typedef struct {
   guint8 num_channels;
   guint32 bytes_per_channel;   // number of valid bytes (not size of array)
@@ -35,13 +43,31 @@ typedef struct {
   bool lsb_first;
   guint sample_step;
   guint ch_step;
+  guint32 block_bytes;         // bytes per channel in one contiguous run, 0 = all
+  gsize block_step;            // distance between the runs of a channel
 
   guchar *data;
 } dsdbuffer;
 
+typedef struct dsddecimator_s dsddecimator;
+typedef struct dsdnoiseshaper_s dsdnoiseshaper;
+typedef struct dsdhalfrate_s dsdhalfrate;
+typedef struct dsdconverter_s dsdconverter;
+typedef struct dsdreader_s dsdreader;
+typedef struct dsdring_s dsdring;
+typedef struct dsdsegments_s dsdsegments;
+typedef struct dsdwriter_s dsdwriter;
+typedef struct dsdresampler_s dsdresampler;
+typedef struct dstdecoder_s dstdecoder;
+
+typedef bool (*dsdwrite)(const guchar *data, gsize size, gpointer user_data);
+
 typedef struct {
   FILE *stream;                // init @ dsd_open
   bool canseek;                // init @ dsd_open
+  guchar *map;                 // init @ dsd_open, NULL unless mapped
+  gsize map_size;              // init @ dsd_open
+  bool shared;                 // init @ dsd_open, map and stream belong to another file
   bool eof;                    // init @ dsd_open
   gsize offset;                // init @ dsd_open
   dsdtype type;                // init @ dsd_open
@@ -51,11 +77,12 @@ typedef struct {
   guint32 channel_num;         // init 0 0 dsd_open, update @ dsf_init or dsdiff:parse_prop_chunk, check not 0
   guint32 sampling_frequency;  // init 0 0 dsd_open, update @ dsf_init or dsdiff:parse_prop_chunk, check not 0
 
-  guint64 sample_offset;       // init 0 @ dsd_open, set X @ dsd_set_start
+  guint64 sample_offset;       // init 0 @ dsd_open, set X @ dsd_seek_sample
   guint64 sample_count;        // init @ dsf_init or dsdiff_init
   guint64 sample_stop;         // init @ dsf_init or dsdiff_init, set X @ dsd_set_stop
 
   dsfinfo dsf;                 // init @ dsf_init
+  dstdecoder *dst;             // init @ dsd_open, set @ dst_init for DST compressed DSDIFF
 
   gsize dataoffset;            // init @ dsf_init or dsdiff_init
   gsize datasize;              // init @ dsf_init or dsdiff_init
@@ -63,26 +90,99 @@ typedef struct {
 
 } dsdfile;
 
-extern const guchar bit_reverse_table[];
-static inline void dsd_buffer_msb_order(dsdbuffer *ibuffer) {
-  guint32 s;
-  guchar *ptr;
-  if (ibuffer->lsb_first) {		  
-    ptr = ibuffer->data;
-    for (s = ibuffer->max_bytes_per_ch * ibuffer->num_channels; s > 0; s--, ptr++)
-      *ptr = bit_reverse_table[(guint8)*ptr];
-  }
+static inline guint pcm_sample_bytes(pcmformat format) {
+  return format == PCM_S16LE ? 2 : format == PCM_S24LE ? 3 : 4;
 }
 
 dsdfile *dsd_open(const char *name);
 bool dsd_close(dsdfile *file);
+dsdfile *dsd_open_range(dsdfile *file, guint64 first, guint64 last);
 bool dsd_eof(dsdfile *file);
+guint64 dsd_sample_at(dsdfile *file, guint32 mseconds);
+bool dsd_seek_sample(dsdfile *file, guint64 sample);
 bool dsd_set_start(dsdfile *file, guint32 mseconds);
 bool dsd_set_stop(dsdfile *file, guint32 mseconds);
 guint32 dsd_sample_frequency(dsdfile *file);
 guint32 dsd_channels(dsdfile *file);
 dsdbuffer *dsd_read(dsdfile *file);
-dsdbuffer *init_halfrate(dsdbuffer *ibuffer);
-void halfrate_filter(dsdbuffer *in, dsdbuffer *out);
-void dsd_over_pcm(dsdbuffer *buf, guchar *pcmout);
-void dsd_to_pcm(dsdbuffer *buf, guchar *pcmout);
+bool dsd_set_read_size(dsdfile *file, guint32 bytes_per_channel);
+bool dsd_set_threads(dsdfile *file, guint threads);
+dsdreader *init_reader(dsdfile *file, guint depth);
+dsdbuffer *dsd_read_ahead(dsdreader *r);
+gint64 reader_wait_time(dsdreader *r);
+void free_reader(dsdreader *r);
+dsdring *init_ring(guint slots);
+void free_ring(dsdring *r);
+guint ring_size(dsdring *r);
+gint ring_write_slot(dsdring *r);
+void ring_push(dsdring *r);
+void ring_close(dsdring *r);
+gint ring_read_slot(dsdring *r);
+void ring_pop(dsdring *r);
+void ring_cancel(dsdring *r);
+dsdhalfrate *init_halfrate(dsdbuffer *ibuffer, guint factor);
+void reset_halfrate(dsdhalfrate *hr);
+void free_halfrate(dsdhalfrate *hr);
+dsdbuffer *halfrate_filter(dsdhalfrate *hr, dsdbuffer *in);
+gsize dsd_over_pcm(dsdbuffer *buf, guchar *pcmout, guchar *marker);
+dsddecimator *init_decimator(dsdbuffer *ibuffer, guint32 frequency, guint ratio);
+void reset_decimator(dsddecimator *dec);
+void free_decimator(dsddecimator *dec);
+void decimator_set_threads(dsddecimator *dec, guint threads);
+void decimator_set_start(dsddecimator *dec, guint64 first);
+guint32 decimator_history(dsddecimator *dec);
+guint32 decimator_lookahead(dsddecimator *dec);
+guint32 decimator_rate(dsddecimator *dec);
+void decimator_set_resampler(dsddecimator *dec, dsdresampler *rs);
+gsize dsd_to_pcm_decimated(dsddecimator *dec, dsdbuffer *buf, guchar *pcmout, pcmformat format);
+gsize decimator_flush(dsddecimator *dec, guchar *pcmout, pcmformat format, guint32 max_frames);
+dsdresampler *init_resampler(guint channels, guint32 in_rate, guint32 out_rate,
+			     resamplequality quality, guint32 max_frames);
+void reset_resampler(dsdresampler *rs);
+void resampler_set_start(dsdresampler *rs, guint64 first);
+void free_resampler(dsdresampler *rs);
+guint32 resampler_max_output(dsdresampler *rs, guint32 frames);
+guint32 resampler_rate(dsdresampler *rs);
+guint32 resampler_history(dsdresampler *rs);
+guint32 resampler_lookahead(dsdresampler *rs);
+guint32 resample(dsdresampler *rs, const float *in, guint32 frames, float *out);
+guint32 resampler_flush(dsdresampler *rs, float *out, guint32 max_frames);
+gsize pcm_pack(const float *src, gsize count, pcmformat format, guchar *pcmout);
+dsdnoiseshaper *init_noise_shaper(guint num_channels, guint32 rate);
+void reset_noise_shaper(dsdnoiseshaper *ns);
+void free_noise_shaper(dsdnoiseshaper *ns);
+gsize pcm_pack_shaped(dsdnoiseshaper *ns, const float *src, gsize frames, guchar *pcmout);
+dsdconverter *init_converter(dsdbuffer *ibuffer, guint32 frequency, bool dop,
+			     guint halfrate, guint ratio, pcmformat format);
+void reset_converter(dsdconverter *conv);
+void free_converter(dsdconverter *conv);
+dsdconverter *clone_converter(dsdconverter *conv, pcmformat format);
+bool converter_matches(dsdconverter *conv, dsdbuffer *ibuffer, guint32 frequency, bool dop,
+		       guint halfrate, guint ratio, pcmformat format);
+dsdconverter *reuse_converter(dsdconverter *conv, dsdconverter *like, pcmformat format);
+guint32 converter_history(dsdconverter *conv);
+guint32 converter_lookahead(dsdconverter *conv);
+gsize converter_output_size(dsdconverter *conv, guint64 bytes_per_channel);
+void converter_set_threads(dsdconverter *conv, guint threads);
+bool converter_set_rate(dsdconverter *conv, guint32 rate, resamplequality quality);
+void converter_set_start(dsdconverter *conv, guint64 sample);
+bool converter_seek(dsdconverter *conv, dsdfile *file, guint32 mseconds);
+guint64 converter_skip(dsdconverter *conv);
+pcmformat converter_format(dsdconverter *conv);
+guint32 converter_rate(dsdconverter *conv);
+bool converter_shaped(dsdconverter *conv);
+gsize converter_max_output(dsdconverter *conv);
+gsize dsd_convert(dsdconverter *conv, dsdbuffer *buf, guchar *out);
+gsize converter_finish(dsdconverter *conv, guchar *out);
+dsdsegments *init_segments(dsdfile *file, dsdconverter *conv);
+void free_segments(dsdsegments *sg);
+guint segments_count(dsdsegments *sg);
+bool segments_convert(dsdsegments *sg, guint i, dsdconverter **conv);
+bool segments_write(dsdsegments *sg, guint i, dsdwrite write, gpointer user_data);
+bool dsd_convert_segmented(dsdfile *file, dsdconverter *conv, guint threads,
+			   dsdwrite write, gpointer user_data);
+dsdwriter *init_writer(int fd, outputtype type, guint channels, guint32 rate,
+		       pcmformat format);
+bool writer_set_pipe_size(dsdwriter *w, gsize bytes);
+bool writer_write(dsdwriter *w, const guchar *data, gsize size);
+bool close_writer(dsdwriter *w);
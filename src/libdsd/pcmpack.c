@@ -0,0 +1,334 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libdsd.h"
+#include "dsdinternals.h"
+#include "../dsd2pcm/noiseshape.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(DSD_NO_SIMD)
+#define PCMPACK_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/*
+** Quantize and pack interleaved float samples to little endian PCM.
+**
+** Samples are scaled to full scale, clipped and then rounded half away
+** from zero, exactly like clip(min, myround(x), max). Clipping before
+** rounding gives the same result and lets the SIMD code saturate in
+** float before the truncating conversion. S32 clips at the largest
+** float below 2^31.
+*/
+
+#define S32_MAX_FLOAT 2147483520.0f
+
+static void pack_c(const float *src, gsize count, pcmformat format, guchar *out) {
+  gsize s;
+
+  for (s = 0; s < count; s++) {
+    float r;
+    gint32 x;
+    guint32 u;
+
+    switch (format) {
+    case PCM_S16LE:
+      r = src[s] * (1<<15);
+      x = clip(-(1<<15), myround(r), ((1<<15)-1));
+      *out++ =  x        & 0xFF;
+      *out++ = (x >>  8) & 0xFF;
+      break;
+    case PCM_S24LE:
+      r = src[s] * (1<<23);
+      x = clip(-(1<<23), myround(r), ((1<<23)-1));
+      *out++ =  x        & 0xFF;
+      *out++ = (x >>  8) & 0xFF;
+      *out++ = (x >> 16) & 0xFF;
+      break;
+    case PCM_S32LE:
+      r = src[s] * 2147483648.0f;
+      if (r < -2147483648.0f) r = -2147483648.0f;
+      if (r > S32_MAX_FLOAT) r = S32_MAX_FLOAT;
+      x = myround(r);
+      *out++ =  x        & 0xFF;
+      *out++ = (x >>  8) & 0xFF;
+      *out++ = (x >> 16) & 0xFF;
+      *out++ = (x >> 24) & 0xFF;
+      break;
+    case PCM_F32LE:
+      memcpy(&u, &src[s], sizeof(u));
+      *out++ =  u        & 0xFF;
+      *out++ = (u >>  8) & 0xFF;
+      *out++ = (u >> 16) & 0xFF;
+      *out++ = (u >> 24) & 0xFF;
+      break;
+    }
+  }
+}
+
+#ifdef PCMPACK_X86_SIMD
+
+/* scale, clip and round 4 samples half away from zero */
+__attribute__((target("ssse3")))
+static inline __m128i quantize_sse(const float *src, __m128 scale, __m128 lo, __m128 hi) {
+  __m128 r = _mm_mul_ps(_mm_loadu_ps(src), scale);
+  __m128 half = _mm_or_ps(_mm_and_ps(r, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+  r = _mm_min_ps(_mm_max_ps(r, lo), hi);
+  return _mm_cvttps_epi32(_mm_add_ps(r, half));
+}
+
+/* returns the number of samples packed, the rest is left for pack_c */
+__attribute__((target("ssse3")))
+static gsize pack_ssse3(const float *src, gsize count, pcmformat format, guchar *out) {
+  gsize s = 0;
+
+  switch (format) {
+  case PCM_S16LE: {
+    const __m128 scale = _mm_set1_ps(1<<15);
+    const __m128 lo = _mm_set1_ps(-(1<<15)), hi = _mm_set1_ps((1<<15)-1);
+    for (; s + 8 <= count; s += 8, out += 16) {
+      __m128i a = quantize_sse(src + s, scale, lo, hi);
+      __m128i b = quantize_sse(src + s + 4, scale, lo, hi);
+      _mm_storeu_si128((__m128i *)out, _mm_packs_epi32(a, b));
+    }
+    break;
+  }
+  case PCM_S24LE: {
+    const __m128 scale = _mm_set1_ps(1<<23);
+    const __m128 lo = _mm_set1_ps(-(1<<23)), hi = _mm_set1_ps((1<<23)-1);
+    const __m128i pack24 = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14,
+					 -1, -1, -1, -1);
+    for (; s + 16 <= count; s += 16, out += 48) {
+      __m128i a = _mm_shuffle_epi8(quantize_sse(src + s, scale, lo, hi), pack24);
+      __m128i b = _mm_shuffle_epi8(quantize_sse(src + s + 4, scale, lo, hi), pack24);
+      __m128i c = _mm_shuffle_epi8(quantize_sse(src + s + 8, scale, lo, hi), pack24);
+      __m128i d = _mm_shuffle_epi8(quantize_sse(src + s + 12, scale, lo, hi), pack24);
+      _mm_storeu_si128((__m128i *)out, _mm_or_si128(a, _mm_slli_si128(b, 12)));
+      _mm_storeu_si128((__m128i *)(out + 16), _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+      _mm_storeu_si128((__m128i *)(out + 32), _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+    }
+    break;
+  }
+  case PCM_S32LE: {
+    const __m128 scale = _mm_set1_ps(2147483648.0f);
+    const __m128 lo = _mm_set1_ps(-2147483648.0f), hi = _mm_set1_ps(S32_MAX_FLOAT);
+    for (; s + 4 <= count; s += 4, out += 16)
+      _mm_storeu_si128((__m128i *)out, quantize_sse(src + s, scale, lo, hi));
+    break;
+  }
+  case PCM_F32LE:
+    break;
+  }
+
+  return s;
+}
+
+#endif /* PCMPACK_X86_SIMD */
+
+gsize pcm_pack(const float *src, gsize count, pcmformat format, guchar *pcmout) {
+  gsize s = 0;
+
+#ifdef PCMPACK_X86_SIMD
+  if (__builtin_cpu_supports("ssse3"))
+    s = pack_ssse3(src, count, format, pcmout);
+#endif
+  pack_c(src + s, count - s, format, pcmout + s * pcm_sample_bytes(format));
+
+  return count * pcm_sample_bytes(format);
+}
+
+/*
+** Noise shaped 16 bit output.
+**
+** The error feedback quantizer of dsd2pcm's main.cpp with a filter of
+** noiseshape.c for the output rate and the biquad recursion there.
+** Below 352.8 kHz the decimators have removed the DSD noise that would
+** dither the signal, so TPDF dither is added before quantizing and fed
+** back with the error: the dither is shaped like the rest of the noise
+** and quiet passages do not distort.
+**
+** Channels are independent lanes of one noise_shape_ctx, whose state is
+** [section][lane], with the lanes padded to a whole number of 4-lane
+** groups so that the SIMD path shapes 4 channels at once on the same
+** state. The dither of every lane comes from its own generator, one
+** frame at a time for both paths. Both paths do the same float
+** operations in the same order, so the output does not depend on the
+** CPU.
+*/
+
+#define NS_MAX_SECTIONS NOISE_SHAPE_MAX_SOS
+#define NS_SEED 0x9e3779b9u
+
+struct dsdnoiseshaper_s {
+  guint num_channels;
+  noise_shape_ctx ctx;         // num_channels rounded up to a multiple of 4 lanes
+  float dither;                // peak of the TPDF dither in LSB, 0 for none
+  guint32 *seed;               // of every lane's dither
+  float *noise;                // dither of the frame being shaped, every lane
+};
+
+dsdnoiseshaper *init_noise_shaper(guint num_channels, guint32 rate) {
+  const noise_shape_filter *f = noise_shape_filter_for(rate);
+  guint lanes = (num_channels + 3) & ~3;
+  dsdnoiseshaper *ns;
+
+  ns = (dsdnoiseshaper *)malloc(sizeof(dsdnoiseshaper));
+  ns->num_channels = num_channels;
+  if (noise_shape_init_lanes(&ns->ctx, f->sos_count, f->coeffs, lanes) != 0) {
+    free(ns);
+    return NULL;
+  }
+  ns->dither = f->dither;
+  ns->seed = (guint32 *)malloc(lanes * sizeof(guint32));
+  ns->noise = (float *)calloc(lanes, sizeof(float));
+  reset_noise_shaper(ns);
+
+  return ns;
+}
+
+void reset_noise_shaper(dsdnoiseshaper *ns) {
+  guint lane;
+
+  noise_shape_reset(&ns->ctx);
+  for (lane = 0; lane < (guint)ns->ctx.lanes; lane++)
+    ns->seed[lane] = NS_SEED * (lane + 1);
+}
+
+void free_noise_shaper(dsdnoiseshaper *ns) {
+  if (!ns) return;
+  noise_shape_destroy(&ns->ctx);
+  free(ns->seed);
+  free(ns->noise);
+  free(ns);
+}
+
+static inline float uniform(guint32 *seed) {
+  *seed = *seed * 1664525u + 1013904223u;
+  return (*seed >> 8) * (1.0f / 16777216);
+}
+
+/* the dither of the next frame: the difference of two uniform values */
+static inline void dither_frame(dsdnoiseshaper *ns) {
+  guint ch;
+
+  if (ns->dither == 0.0f) return;
+  for (ch = 0; ch < ns->num_channels; ch++) {
+    float a = uniform(&ns->seed[ch]);
+    ns->noise[ch] = (a - uniform(&ns->seed[ch])) * ns->dither;
+  }
+}
+
+static void shape_c(dsdnoiseshaper *ns, const float *src, gsize frames, guchar *out) {
+  const float limit = 1.0f + ns->dither;
+  gsize s;
+  guint ch;
+
+  for (s = 0; s < frames; s++) {
+    dither_frame(ns);
+    for (ch = 0; ch < ns->num_channels; ch++) {
+      float r, q;
+      gint32 x;
+
+      r = *src++ * (1<<15) + noise_shape_get_lane(&ns->ctx, ch);
+      x = clip(-(1<<15), myround(r + ns->noise[ch]), ((1<<15)-1));
+      q = x - r;
+      if (q < -limit) q = -limit;
+      if (q > limit) q = limit;
+      noise_shape_update_lane(&ns->ctx, ch, q);
+
+      *out++ =  x       & 0xFF;
+      *out++ = (x >> 8) & 0xFF;
+    }
+    noise_shape_next(&ns->ctx);
+  }
+}
+
+#ifdef PCMPACK_X86_SIMD
+
+__attribute__((target("ssse3")))
+static void shape_ssse3(dsdnoiseshaper *ns, const float *src, gsize frames, guchar *out) {
+  const guint nch = ns->num_channels, lanes = ns->ctx.lanes, sections = ns->ctx.sos_count;
+  const __m128 scale = _mm_set1_ps(1<<15);
+  const __m128 lo = _mm_set1_ps(-(1<<15)), hi = _mm_set1_ps((1<<15)-1);
+  const __m128 limit = _mm_set1_ps(1.0f + ns->dither), minus_limit = _mm_set1_ps(-1.0f - ns->dither);
+  gsize s;
+  guint ch, i;
+
+  for (s = 0; s < frames; s++, src += nch, out += 2 * nch) {
+    dither_frame(ns);
+    for (ch = 0; ch < nch; ch += 4) {
+      __m128 y[NS_MAX_SECTIONS], acc = _mm_setzero_ps(), r, d, q, half;
+      __m128i x;
+      const float *c = ns->ctx.bbaa;
+      float in[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      gint16 pcm[8];
+
+      // noise_shape_get_lane on 4 lanes
+      for (i = 0; i < sections; i++, c += 4) {
+	__m128 t1 = _mm_loadu_ps(ns->ctx.t1 + i * lanes + ch);
+	__m128 t2 = _mm_loadu_ps(ns->ctx.t2 + i * lanes + ch);
+	acc = y[i] = _mm_sub_ps(acc, _mm_add_ps(_mm_mul_ps(t1, _mm_set1_ps(c[2])),
+						_mm_mul_ps(t2, _mm_set1_ps(c[3]))));
+	acc = _mm_add_ps(acc, _mm_add_ps(_mm_mul_ps(t1, _mm_set1_ps(c[0])),
+					 _mm_mul_ps(t2, _mm_set1_ps(c[1]))));
+      }
+
+      // the last group may be partial, pad it with silence
+      if (ch + 4 <= nch)
+	r = _mm_loadu_ps(src + ch);
+      else {
+	memcpy(in, src + ch, (nch - ch) * sizeof(float));
+	r = _mm_loadu_ps(in);
+      }
+      r = _mm_add_ps(_mm_mul_ps(r, scale), acc);
+      d = _mm_add_ps(r, _mm_loadu_ps(ns->noise + ch));
+
+      half = _mm_or_ps(_mm_and_ps(d, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+      x = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(d, lo), hi), half));
+      q = _mm_sub_ps(_mm_cvtepi32_ps(x), r);
+      q = _mm_min_ps(_mm_max_ps(q, minus_limit), limit);
+
+      // noise_shape_update_lane on 4 lanes
+      for (i = 0; i < sections; i++)
+	_mm_storeu_ps(ns->ctx.t2 + i * lanes + ch, _mm_add_ps(y[i], q));
+
+      _mm_storeu_si128((__m128i *)pcm, _mm_packs_epi32(x, x));
+      memcpy(out + 2 * ch, pcm, MIN(4, nch - ch) * 2);
+    }
+    noise_shape_next(&ns->ctx);
+  }
+}
+
+#endif /* PCMPACK_X86_SIMD */
+
+gsize pcm_pack_shaped(dsdnoiseshaper *ns, const float *src, gsize frames, guchar *pcmout) {
+#ifdef PCMPACK_X86_SIMD
+  if (__builtin_cpu_supports("ssse3"))
+    shape_ssse3(ns, src, frames, pcmout);
+  else
+#endif
+    shape_c(ns, src, frames, pcmout);
+
+  return frames * ns->num_channels * 2;
+}
@@ -0,0 +1,155 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libdsd.h"
+#include "dsdinternals.h"
+
+/*
+** Read-ahead: a thread keeps up to depth buffers read in front of the
+** converter, so a storage stall only drains the ring instead of the
+** output. The slots go round a lock-free SPSC ring. The dsdbuffer a call
+** returns stays valid until the next call, as with dsd_read.
+**
+** Unmapped files and decoded DST are copied out of the file buffer into
+** the slot. For mapped files the slot points into the mapping and the
+** thread touches every page of it, so the page faults happen on the
+** reader thread.
+*/
+
+#define PAGE_BYTES 4096
+
+typedef struct {
+  dsdbuffer buffer;
+  guchar *mem;                 // copy of an unmapped read
+} raslot;
+
+struct dsdreader_s {
+  dsdfile *file;
+  dsdring *ring;
+  raslot *slots;               // ring_size(ring) of them
+  GThread *thread;
+  bool holding;                // a slot is handed out to the consumer
+  gint64 wait_us;
+};
+
+/* bytes of file data behind a buffer, up to the last byte of the last channel */
+static gsize buffer_span(dsdbuffer *buf) {
+  gsize runs;
+
+  if (buf->block_bytes && buf->bytes_per_channel) {
+    runs = (buf->bytes_per_channel + buf->block_bytes - 1) / buf->block_bytes;
+    return (runs - 1) * buf->block_step + (gsize)(buf->num_channels - 1) * buf->ch_step +
+      buf->bytes_per_channel - (runs - 1) * buf->block_bytes;
+  }
+  return (gsize)buf->bytes_per_channel * buf->num_channels;
+}
+
+static gpointer read_ahead(gpointer data) {
+  dsdreader *r = (dsdreader *)data;
+  volatile guchar sink = 0;
+  dsdbuffer *buf;
+  raslot *slot;
+  gsize i, span;
+  gint n;
+
+  while ((n = ring_write_slot(r->ring)) >= 0 && (buf = dsd_read(r->file))) {
+    slot = &r->slots[n];
+    slot->buffer = *buf;
+    span = buffer_span(buf);
+    if (dsd_in_place(r->file)) {
+      for (i = 0; i < span; i += PAGE_BYTES) sink += buf->data[i];
+    } else {
+      memcpy(slot->mem, buf->data, span);
+      slot->buffer.data = slot->mem;
+    }
+    ring_push(r->ring);
+  }
+  ring_close(r->ring);
+
+  (void)sink;
+  return NULL;
+}
+
+/*
+** Starts reading ahead depth buffers. Seek and stop positions and the
+** read size have to be set before, the file must not be read directly
+** until free_reader.
+*/
+dsdreader *init_reader(dsdfile *file, guint depth) {
+  dsdreader *r;
+  guint i;
+
+  if (!file || depth == 0) return NULL;
+
+  r = (dsdreader *)calloc(1, sizeof(dsdreader));
+  r->file = file;
+  r->ring = init_ring(depth);
+  r->slots = (raslot *)calloc(ring_size(r->ring), sizeof(raslot));
+  if (!dsd_in_place(file))
+    for (i = 0; i < ring_size(r->ring); i++)
+      r->slots[i].mem = (guchar *)malloc((gsize)file->buffer.max_bytes_per_ch * file->channel_num);
+  r->thread = g_thread_new("dsd-read-ahead", read_ahead, r);
+
+  return r;
+}
+
+dsdbuffer *dsd_read_ahead(dsdreader *r) {
+  gint64 t;
+  gint n;
+
+  if (r->holding) {
+    ring_pop(r->ring);
+    r->holding = FALSE;
+  }
+
+  t = g_get_monotonic_time();
+  n = ring_read_slot(r->ring);
+  r->wait_us += g_get_monotonic_time() - t;
+
+  if (n < 0) return NULL;
+  r->holding = TRUE;
+  return &r->slots[n].buffer;
+}
+
+/* total time dsd_read_ahead waited for data, in microseconds */
+gint64 reader_wait_time(dsdreader *r) {
+  return r->wait_us;
+}
+
+/* stops the thread early if the consumer did not read to the end */
+void free_reader(dsdreader *r) {
+  guint i;
+
+  if (!r) return;
+
+  ring_cancel(r->ring);
+  g_thread_join(r->thread);
+
+  for (i = 0; i < ring_size(r->ring); i++)
+    free(r->slots[i].mem);
+  free(r->slots);
+  free_ring(r->ring);
+  free(r);
+}
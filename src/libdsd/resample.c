@@ -0,0 +1,313 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "libdsd.h"
+#include "dsdinternals.h"
+
+/*
+** Polyphase rational resampler for the decimator output, e.g. 88.2 kHz
+** to 48 kHz is 80/147: conceptually the input is upsampled by L = 80,
+** lowpass filtered and every M = 147th sample kept. Only the kept
+** samples are computed, each from one of the L phases of the filter.
+**
+** The prototype is a Kaiser windowed sinc. Its stopband starts at the
+** Nyquist frequency of the lower of the two rates, the quality sets the
+** rejection and how much of the band below it is passband:
+**
+**   low      70 dB, flat to 80 %
+**   medium  100 dB, flat to 90 %
+**   high    130 dB, flat to 94 %  (e.g. 22.6 kHz at 48 kHz)
+**
+** Output frame k is at input time k * M / L, counted from the start of
+** the stream, so a conversion started anywhere (resampler_set_start)
+** lands on the same output frames as one over the whole stream. The
+** filter is centred on that time: an output waits for half the filter
+** length of input after it, and resampler_flush gets the outputs still
+** waiting at the end of the stream by feeding silence.
+**
+** Every phase is stored in reverse, padded to RS_LANES taps, so an
+** output sample is a plain dot product with the newest input at the
+** end. It is summed in RS_LANES independent partial sums, which the
+** compiler turns into SIMD multiply-adds.
+**
+** The lanes run along the taps of one channel, not across channels:
+** the taps are contiguous in both the phase and the channel's history
+** and always fill the lanes, while most streams are stereo and would
+** leave six of eight channel lanes idle. The channels of an output
+** frame share the phase, so its coefficients stay in cache meanwhile.
+*/
+
+#define RS_LANES 8
+#define RS_MAX_PHASES 1024           // L after reducing the ratio
+#define RS_MAX_TAPS 4096             // taps per phase
+
+typedef struct {
+  double rejection;            // dB
+  double passband;             // fraction of the lower Nyquist frequency
+} rsquality;
+
+static const rsquality qualities[] = {
+  { 70.0, 0.80 },              // RESAMPLE_LOW
+  { 100.0, 0.90 },             // RESAMPLE_MEDIUM
+  { 130.0, 0.94 },             // RESAMPLE_HIGH
+};
+
+struct dsdresampler_s {
+  guint num_channels;
+  guint32 up;                  // L
+  guint32 down;                // M
+  guint32 out_rate;
+  guint taps;                  // per phase, multiple of RS_LANES
+  float *coef;                 // [phase * taps + tap], reversed
+  guint32 delay;               // of the filter's centre, in phases
+  float **buf;                 // per channel: taps - 1 history samples followed by input
+  guint32 size;                // of every buf
+  guint32 fill;                // valid samples in every buf
+  guint32 pos;                 // start of the next output's window
+  guint32 phase;
+  guint64 next;                // output frame pos and phase are for
+  guint64 end;                 // input frames of the stream so far
+};
+
+static guint32 gcd(guint32 a, guint32 b) {
+  while (b) {
+    guint32 t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+/* modified Bessel function of the first kind, order 0 */
+static double bessel_i0(double x) {
+  double sum = 1.0, term = 1.0;
+  guint k;
+
+  for (k = 1; k < 200 && term > 1e-21 * sum; k++) {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+static void design_filter(dsdresampler *rs, guint32 in_rate, guint32 out_rate,
+			  const rsquality *q) {
+  guint32 n, len = rs->up * rs->taps;
+  double nyquist = MIN(in_rate, out_rate) / 2.0;
+  double rate = (double)in_rate * rs->up;          // prototype sample rate
+  double fc = nyquist * (1.0 + q->passband) / 2.0 / rate;
+  double beta = 0.1102 * (q->rejection - 8.7);
+  double center = rs->delay, i0beta = bessel_i0(beta), sum = 0.0;
+  double *h = (double *)malloc(len * sizeof(double));
+
+  // centred on a whole phase, so an output lands exactly on its time
+  for (n = 0; n < len; n++) {
+    double t = n - center, r = t / center;
+    double sinc = t == 0.0 ? 2 * fc : sin(2 * M_PI * fc * t) / (M_PI * t);
+    h[n] = sinc * bessel_i0(beta * sqrt(MAX(0.0, 1.0 - r * r))) / i0beta;
+    sum += h[n];
+  }
+
+  // phase p tap j applies to x[i - j]: stored at the end of the window
+  for (n = 0; n < len; n++) {
+    guint32 p = n % rs->up, j = n / rs->up;
+    rs->coef[p * rs->taps + rs->taps - 1 - j] = h[n] * rs->up / sum;
+  }
+  free(h);
+}
+
+/*
+** Resampler for channels of interleaved float input at in_rate, at most
+** max_frames per call. NULL if the ratio does not reduce to a usable
+** number of phases.
+*/
+dsdresampler *init_resampler(guint channels, guint32 in_rate, guint32 out_rate,
+			     resamplequality quality, guint32 max_frames) {
+  dsdresampler *rs;
+  const rsquality *q = &qualities[quality];
+  guint32 g, ch;
+  double nyquist, width, taps;
+
+  if (channels == 0 || in_rate == 0 || out_rate == 0 || quality > RESAMPLE_HIGH)
+    return NULL;
+  g = gcd(in_rate, out_rate);
+  if (out_rate / g > RS_MAX_PHASES) return NULL;
+
+  // Kaiser: length = (A - 7.95) / (14.36 * transition / rate)
+  nyquist = MIN(in_rate, out_rate) / 2.0;
+  width = nyquist * (1.0 - q->passband);
+  taps = (q->rejection - 7.95) * in_rate / (14.36 * width);
+  if (taps > RS_MAX_TAPS) return NULL;
+
+  rs = (dsdresampler *)calloc(1, sizeof(dsdresampler));
+  rs->num_channels = channels;
+  rs->up = out_rate / g;
+  rs->down = in_rate / g;
+  rs->out_rate = out_rate;
+  rs->taps = ((guint)ceil(taps) + RS_LANES - 1) / RS_LANES * RS_LANES;
+  rs->coef = (float *)calloc(rs->up * rs->taps, sizeof(float));
+  rs->delay = (rs->up * rs->taps - 1) / 2;
+  design_filter(rs, in_rate, out_rate, q);
+
+  rs->size = rs->taps + max_frames;
+  rs->buf = (float **)malloc(channels * sizeof(float *));
+  for (ch = 0; ch < channels; ch++)
+    rs->buf[ch] = (float *)malloc(rs->size * sizeof(float));
+  reset_resampler(rs);
+
+  return rs;
+}
+
+void reset_resampler(dsdresampler *rs) {
+  resampler_set_start(rs, 0);
+}
+
+/*
+** Starts over with input frame first of the stream as the next input,
+** after silence. The first output is the first frame at or after it.
+*/
+void resampler_set_start(dsdresampler *rs, guint64 first) {
+  guint64 t;
+  guint ch;
+
+  for (ch = 0; ch < rs->num_channels; ch++)
+    memset(rs->buf[ch], 0, (rs->taps - 1) * sizeof(float));
+  rs->fill = rs->taps - 1;
+  rs->next = (first * rs->up + rs->down - 1) / rs->down;
+  rs->end = first;
+
+  // the window of output next ends with the input at its time plus the delay
+  t = rs->next * rs->down + rs->delay;
+  rs->pos = t / rs->up - first;
+  rs->phase = t % rs->up;
+}
+
+void free_resampler(dsdresampler *rs) {
+  guint ch;
+
+  if (!rs) return;
+  for (ch = 0; ch < rs->num_channels; ch++)
+    free(rs->buf[ch]);
+  free(rs->buf);
+  free(rs->coef);
+  free(rs);
+}
+
+/* most output frames of one call with frames input frames */
+guint32 resampler_max_output(dsdresampler *rs, guint32 frames) {
+  return ((guint64)frames * rs->up + rs->down - 1) / rs->down + 1;
+}
+
+guint32 resampler_rate(dsdresampler *rs) {
+  return rs->out_rate;
+}
+
+/* input frames before the newest that an output sample depends on */
+guint32 resampler_history(dsdresampler *rs) {
+  return rs->taps - 1;
+}
+
+/* input frames after its time that an output sample depends on, at most */
+guint32 resampler_lookahead(dsdresampler *rs) {
+  return rs->delay / rs->up + 1;
+}
+
+static inline float dot(const float *c, const float *x, guint n) {
+  float acc[RS_LANES] = { 0 };
+  guint j, k;
+
+  for (j = 0; j < n; j += RS_LANES)
+    for (k = 0; k < RS_LANES; k++)
+      acc[k] += c[j + k] * x[j + k];
+  for (k = 1; k < RS_LANES; k++)
+    acc[0] += acc[k];
+
+  return acc[0];
+}
+
+/*
+** Every output the buffered input is enough for, at most max_frames, up
+** to the end of the stream when flushing.
+*/
+static guint32 run(dsdresampler *rs, float *out, guint32 max_frames, bool flush) {
+  guint nch = rs->num_channels, ch;
+  guint32 m = 0, drop;
+
+  while (rs->pos + rs->taps <= rs->fill && m < max_frames &&
+	 (!flush || rs->next * rs->down < rs->end * rs->up)) {
+    const float *c = rs->coef + rs->phase * rs->taps;
+    for (ch = 0; ch < nch; ch++)
+      out[m * nch + ch] = dot(c, rs->buf[ch] + rs->pos, rs->taps);
+    m++;
+    rs->next++;
+    rs->phase += rs->down;
+    rs->pos += rs->phase / rs->up;
+    rs->phase %= rs->up;
+  }
+
+  drop = MIN(rs->pos, rs->fill);
+  for (ch = 0; ch < nch; ch++)
+    memmove(rs->buf[ch], rs->buf[ch] + drop, (rs->fill - drop) * sizeof(float));
+  rs->fill -= drop;
+  rs->pos -= drop;
+
+  return m;
+}
+
+/* interleaved frames in, interleaved output frames out, returns their number */
+guint32 resample(dsdresampler *rs, const float *in, guint32 frames, float *out) {
+  guint nch = rs->num_channels, ch;
+  guint32 f;
+
+  for (ch = 0; ch < nch; ch++) {
+    float *b = rs->buf[ch] + rs->fill;
+    for (f = 0; f < frames; f++)
+      b[f] = in[f * nch + ch];
+  }
+  rs->fill += frames;
+  rs->end += frames;
+
+  return run(rs, out, G_MAXUINT32, FALSE);
+}
+
+/*
+** At the end of the stream: at most max_frames of the outputs still
+** waiting for input after them, 0 once there are none left.
+*/
+guint32 resampler_flush(dsdresampler *rs, float *out, guint32 max_frames) {
+  guint32 m = 0, n;
+  guint ch;
+
+  while (m < max_frames && rs->next * rs->down < rs->end * rs->up) {
+    n = MIN(rs->taps, rs->size - rs->fill);
+    for (ch = 0; ch < rs->num_channels; ch++)
+      memset(rs->buf[ch] + rs->fill, 0, n * sizeof(float));
+    rs->fill += n;
+    m += run(rs, out + (gsize)m * rs->num_channels, max_frames - m, TRUE);
+  }
+
+  return m;
+}
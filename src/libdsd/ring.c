@@ -0,0 +1,115 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "libdsd.h"
+
+/*
+** Lock-free single producer / single consumer ring of slot indices. The
+** slots themselves are preallocated by the user, the ring only hands out
+** which one to fill or to drain next. head is only written by the
+** producer and tail only by the consumer, both count up forever and the
+** slot is the count modulo the (power of two) size.
+**
+** An empty or full ring is waited out by yielding, then sleeping for
+** short periods, so neither side takes a lock in the steady state.
+*/
+
+#define CACHE_LINE 64
+#define RING_SPINS 64
+#define RING_SLEEP_US 200
+
+struct dsdring_s {
+  guint size;
+  gint closed;                 // producer is done
+  gint cancelled;              // consumer is done
+  gint head;                   // slots pushed
+  char pad1[CACHE_LINE];
+  gint tail;                   // slots popped
+  char pad2[CACHE_LINE];
+};
+
+static inline void ring_wait(guint *spins) {
+  if (++*spins < RING_SPINS)
+    g_thread_yield();
+  else
+    g_usleep(RING_SLEEP_US);
+}
+
+dsdring *init_ring(guint slots) {
+  dsdring *r = (dsdring *)calloc(1, sizeof(dsdring));
+
+  for (r->size = 1; r->size < slots; r->size *= 2);
+
+  return r;
+}
+
+void free_ring(dsdring *r) {
+  free(r);
+}
+
+guint ring_size(dsdring *r) {
+  return r->size;
+}
+
+/* waits for a free slot, -1 if the consumer cancelled */
+gint ring_write_slot(dsdring *r) {
+  guint head = (guint)r->head, spins = 0;
+
+  while (head - (guint)g_atomic_int_get(&r->tail) == r->size) {
+    if (g_atomic_int_get(&r->cancelled)) return -1;
+    ring_wait(&spins);
+  }
+  if (g_atomic_int_get(&r->cancelled)) return -1;
+
+  return head & (r->size - 1);
+}
+
+void ring_push(dsdring *r) {
+  g_atomic_int_set(&r->head, (gint)((guint)r->head + 1));
+}
+
+void ring_close(dsdring *r) {
+  g_atomic_int_set(&r->closed, 1);
+}
+
+/* waits for a filled slot, -1 once the producer closed and all is read */
+gint ring_read_slot(dsdring *r) {
+  guint tail = (guint)r->tail, spins = 0;
+
+  while ((guint)g_atomic_int_get(&r->head) == tail) {
+    if (g_atomic_int_get(&r->closed) && (guint)g_atomic_int_get(&r->head) == tail)
+      return -1;
+    ring_wait(&spins);
+  }
+
+  return tail & (r->size - 1);
+}
+
+void ring_pop(dsdring *r) {
+  g_atomic_int_set(&r->tail, (gint)((guint)r->tail + 1));
+}
+
+void ring_cancel(dsdring *r) {
+  g_atomic_int_set(&r->cancelled, 1);
+}
@@ -0,0 +1,257 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libdsd.h"
+#include "dsdinternals.h"
+
+/*
+** Offline conversion of one file on several cores. The data is split in
+** time into segments of whole blocks. Every segment is converted by a
+** fresh (or reset) converter from its own range reader, starting early
+** enough (whole blocks again) that the filters have filled with the
+** real preceding data. The output of that pre-roll is dropped, so the
+** rest is the same as in a serial run. A resampler also looks ahead: a
+** segment reads on into the next one and its output is cut where the
+** next one's starts, the last one flushes it. Segments can be converted
+** in any order on any thread, but have to be written out in order. A
+** start set with converter_seek is the start of segment 0, its pre-roll
+** is dropped when that segment is written.
+**
+** Noise shaped 16 bit output has state over the whole stream: the
+** segments are converted to float and shaped when they are written.
+*/
+
+#define SEGMENT_BLOCK 4096
+#define SEGMENT_BYTES (256 * SEGMENT_BLOCK)  // bytes per channel
+
+typedef struct {
+  guchar *data;
+  gsize size;
+  gsize skip;                  // pre-roll output at the start of data
+} segment;
+
+struct dsdsegments_s {
+  dsdfile *file;
+  dsdconverter *conv;          // template for the segment converters
+  pcmformat format;            // format the segments are converted to
+  guint64 first;
+  guint64 last;
+  guint64 preroll;
+  guint64 drop;                // output frames of converter_seek's pre-roll
+  guint count;
+  segment *seg;
+  dsdnoiseshaper *ns;          // noise shaped 16 bit output only
+  guchar *shaped;
+};
+
+/*
+** Splits what is left of a mapped file for conversion with conv's
+** settings, conv is only used as a template. NULL if the file is not
+** mapped or conv has no finite history (DoP, halfrate).
+*/
+dsdsegments *init_segments(dsdfile *file, dsdconverter *conv) {
+  dsdsegments *sg;
+  guint32 history = converter_history(conv);
+
+  if (!file->map || history == G_MAXUINT32) return NULL;
+
+  sg = (dsdsegments *)calloc(1, sizeof(dsdsegments));
+  sg->file = file;
+  sg->conv = conv;
+  sg->first = file->eof ? file->sample_stop : file->sample_offset;
+  sg->last = file->sample_stop;
+  sg->preroll = (history + SEGMENT_BLOCK - 1) / SEGMENT_BLOCK * SEGMENT_BLOCK;
+  sg->drop = converter_skip(conv);
+  sg->format = converter_format(conv);
+  if (converter_shaped(conv)) {
+    sg->format = PCM_F32LE;
+    sg->ns = init_noise_shaper(file->channel_num, converter_rate(conv));
+    sg->shaped = (guchar *)malloc(converter_output_size(conv, SEGMENT_BYTES));
+  }
+  sg->count = (sg->last - sg->first + SEGMENT_BYTES - 1) / SEGMENT_BYTES;
+  sg->seg = (segment *)calloc(MAX(sg->count, 1), sizeof(segment));
+
+  return sg;
+}
+
+/* the file is left at its end */
+void free_segments(dsdsegments *sg) {
+  guint i;
+
+  if (!sg) return;
+  for (i = 0; i < sg->count; i++)
+    free(sg->seg[i].data);
+  free(sg->seg);
+  free_noise_shaper(sg->ns);
+  free(sg->shaped);
+  sg->file->sample_offset = sg->last;
+  sg->file->eof = TRUE;
+  free(sg);
+}
+
+guint segments_count(dsdsegments *sg) {
+  return sg->count;
+}
+
+/*
+** Converts segment i and keeps its output until segments_write.
+** Different segments can be converted at the same time. conv is a
+** converter of the caller that is reused if it fits, or NULL for a
+** temporary one.
+*/
+bool segments_convert(dsdsegments *sg, guint i, dsdconverter **conv) {
+  segment *seg = &sg->seg[i];
+  guint64 start = sg->first + (guint64)i * SEGMENT_BYTES;
+  guint64 stop = MIN(start + SEGMENT_BYTES, sg->last);
+  guint64 from = start - MIN(sg->preroll, start - sg->first);
+  guint64 end = MIN(stop + converter_lookahead(sg->conv), sg->last);
+  dsdconverter *own = NULL;
+  dsdfile *range;
+  dsdbuffer *ibuffer;
+  gsize reads, max_out, keep, n;
+
+  if (!conv) conv = &own;
+  if (!(*conv = reuse_converter(*conv, sg->conv, sg->format)))
+    return FALSE;
+  if (!(range = dsd_open_range(sg->file, from, end))) {
+    free_converter(own);
+    return FALSE;
+  }
+
+  converter_set_start(*conv, from);
+  max_out = converter_max_output(*conv);
+  reads = (end - from + range->buffer.max_bytes_per_ch - 1) / range->buffer.max_bytes_per_ch + 1;
+  seg->data = (guchar *)malloc(reads * max_out);
+  seg->size = 0;
+  seg->skip = converter_output_size(*conv, start) - converter_output_size(*conv, from);
+  keep = converter_output_size(*conv, stop) - converter_output_size(*conv, from);
+  while ((ibuffer = dsd_read(range)))
+    seg->size += dsd_convert(*conv, ibuffer, seg->data + seg->size);
+  if (end == sg->last) {
+    do {
+      seg->data = (guchar *)realloc(seg->data, seg->size + max_out);
+      seg->size += (n = converter_finish(*conv, seg->data + seg->size));
+    } while (n > 0);
+  }
+  seg->size = MIN(seg->size, keep);
+
+  dsd_close(range);
+  free_converter(own);
+
+  return seg->size >= seg->skip;
+}
+
+/*
+** Hands the output of converted segment i to write and frees it. Call
+** it for the segments in order, from one thread at a time.
+*/
+bool segments_write(dsdsegments *sg, guint i, dsdwrite write, gpointer user_data) {
+  segment *seg = &sg->seg[i];
+  guchar *data = seg->data + seg->skip;
+  gsize size = seg->size - seg->skip;
+  bool ok;
+
+  if (sg->ns) {
+    size = pcm_pack_shaped(sg->ns, (const float *)data,
+			   size / (sizeof(float) * sg->file->channel_num), sg->shaped);
+    data = sg->shaped;
+  }
+  if (i == 0 && sg->drop) {
+    gsize cut = MIN(size, sg->drop * sg->file->channel_num * pcm_sample_bytes(converter_format(sg->conv)));
+    data += cut;
+    size -= cut;
+  }
+  ok = write(data, size, user_data);
+  free(seg->data);
+  seg->data = NULL;
+
+  return ok;
+}
+
+typedef struct {
+  dsdsegments *sg;
+  bool *done;
+  bool *ok;
+  GMutex lock;
+  GCond cond;
+} segjobs;
+
+static void segment_worker(gpointer data, gpointer user_data) {
+  segjobs *sj = (segjobs *)user_data;
+  guint i = GPOINTER_TO_UINT(data) - 1;
+  bool ok = segments_convert(sj->sg, i, NULL);
+
+  g_mutex_lock(&sj->lock);
+  sj->ok[i] = ok;
+  sj->done[i] = TRUE;
+  g_cond_broadcast(&sj->cond);
+  g_mutex_unlock(&sj->lock);
+}
+
+/*
+** Converts what is left of a mapped file on threads threads (0 = one per
+** core) and hands the output to write in order, at most two segments
+** per thread are in flight. Fails without writing anything if the file
+** cannot be split, see init_segments.
+*/
+bool dsd_convert_segmented(dsdfile *file, dsdconverter *conv, guint threads,
+			   dsdwrite write, gpointer user_data) {
+  segjobs sj;
+  GThreadPool *pool;
+  guint count, pushed, i, window;
+  bool ok = TRUE;
+
+  if (!(sj.sg = init_segments(file, conv))) return FALSE;
+  if (threads == 0) threads = g_get_num_processors();
+
+  count = segments_count(sj.sg);
+  sj.done = (bool *)calloc(MAX(count, 1), sizeof(bool));
+  sj.ok = (bool *)calloc(MAX(count, 1), sizeof(bool));
+  g_mutex_init(&sj.lock);
+  g_cond_init(&sj.cond);
+  pool = g_thread_pool_new(segment_worker, &sj, threads, TRUE, NULL);
+  window = 2 * threads;
+
+  for (i = 0, pushed = 0; i < count && ok; i++) {
+    for (; pushed < count && pushed < i + window; pushed++)
+      g_thread_pool_push(pool, GUINT_TO_POINTER(pushed + 1), NULL);  // no NULL jobs
+
+    g_mutex_lock(&sj.lock);
+    while (!sj.done[i])
+      g_cond_wait(&sj.cond, &sj.lock);
+    g_mutex_unlock(&sj.lock);
+
+    ok = sj.ok[i] && segments_write(sj.sg, i, write, user_data);
+  }
+
+  g_thread_pool_free(pool, FALSE, TRUE);
+  free_segments(sj.sg);
+  free(sj.done);
+  free(sj.ok);
+  g_mutex_clear(&sj.lock);
+  g_cond_clear(&sj.cond);
+
+  return ok;
+}
@@ -0,0 +1,746 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#define _GNU_SOURCE
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "libdsd.h"
+#include "dsdinternals.h"
+
+#if defined(__linux__) && defined(F_SETPIPE_SZ)
+#define WRITER_PIPE_SIZE
+#endif
+
+/*
+** Output writers for the packed converter output: raw, WAV (RF64 past
+** 4 GiB) and FLAC.
+**
+** Headers are written first with what is known and, if the output is a
+** regular file, rewritten with the final sizes on close. A pipe gets
+** WAV sizes of 0xFFFFFFFF and a FLAC STREAMINFO with unknown length and
+** MD5.
+**
+** The FLAC encoder is the fixed predictor subset: every subframe is
+** CONSTANT, VERBATIM or FIXED of order 0..4 with partitioned Rice coded
+** residuals, whichever is smallest. Stereo also tries left/side,
+** side/right and mid/side. Only 16 and 24 bit samples are supported.
+**
+** Output goes straight to the file descriptor. Small writes are staged
+** in a block, a write that does not fit goes out together with what is
+** staged in one writev, without being copied. The block of a pipe is
+** its capacity, which writer_set_pipe_size can raise, so every write
+** fills the pipe once and the consumer wakes up less often.
+*/
+
+#define FLAC_BLOCK 4096               // frames per FLAC frame
+#define FLAC_MAX_ORDER 4              // fixed predictor orders 0..4
+#define FLAC_MAX_PORDER 6             // Rice partition orders 0..6
+#define FLAC_STREAMINFO_OFFSET 8      // "fLaC" + metadata block header
+
+#define WAV_HEADER 104                // RIFF, JUNK/ds64, fmt and data chunk headers
+
+#define WRITER_BLOCK (256 * 1024)     // staging for anything but a pipe
+
+typedef struct {
+  guchar *buf;
+  gsize pos;                   // whole bytes in buf
+  guint64 acc;                 // bits not yet in buf, msb first
+  guint bits;
+} bitwriter;
+
+struct dsdwriter_s {
+  int fd;
+  bool pipe;                   // fd is a pipe, out is its capacity
+  guchar *out;                 // staging block
+  gsize out_size;
+  gsize out_used;              // bytes staged in out
+  outputtype type;
+  guint channels;
+  guint32 rate;
+  pcmformat format;
+  guint bytes;                 // per sample
+  bool seekable;
+  guint64 data_bytes;
+
+  // FLAC
+  guint bps;
+  gint32 *block;               // [channel * FLAC_BLOCK + frame]
+  gint32 *side;                // stereo mid / side candidates
+  guint fill;                  // frames in block
+  guchar *partial;             // an incomplete frame from the last write
+  guint partial_bytes;
+  guint64 frame_number;
+  guint64 total_frames;
+  guint32 min_frame_bytes;
+  guint32 max_frame_bytes;
+  GChecksum *md5;
+  bitwriter bw;
+};
+
+static bool wait_writable(int fd) {
+  struct pollfd pfd = { fd, POLLOUT, 0 };
+  return poll(&pfd, 1, -1) >= 0 || errno == EINTR;
+}
+
+static bool write_all(int fd, const guchar *p, gsize n) {
+  ssize_t r;
+
+  while (n > 0) {
+    if ((r = write(fd, p, n)) < 0) {
+      if ((errno == EINTR || errno == EAGAIN) && wait_writable(fd)) continue;
+      return FALSE;
+    }
+    p += r;
+    n -= r;
+  }
+  return TRUE;
+}
+
+static bool writev_all(int fd, struct iovec *iov, int count) {
+  ssize_t r;
+
+  while (count > 0) {
+    if ((r = writev(fd, iov, count)) < 0) {
+      if ((errno == EINTR || errno == EAGAIN) && wait_writable(fd)) continue;
+      return FALSE;
+    }
+    for (; count > 0 && (gsize)r >= iov->iov_len; iov++, count--)
+      r -= iov->iov_len;
+    if (count > 0) {
+      iov->iov_base = (guchar *)iov->iov_base + r;
+      iov->iov_len -= r;
+    }
+  }
+  return TRUE;
+}
+
+/* a staging block of size, keeping what is staged (and the old block on failure) */
+static bool size_out(dsdwriter *w, gsize size) {
+  guchar *out = (guchar *)realloc(w->out, size);
+
+  if (!out) return FALSE;
+  w->out = out;
+  w->out_size = size;
+
+  return TRUE;
+}
+
+/* hands the staged bytes to fd */
+static bool flush_out(dsdwriter *w) {
+  gsize n = w->out_used;
+
+  w->out_used = 0;
+  return write_all(w->fd, w->out, n);
+}
+
+static bool out_write(dsdwriter *w, const guchar *data, gsize size) {
+  // takes what is staged and data in one call, without copying
+  if (w->out_used + size > w->out_size) {
+    struct iovec iov[2] = { { w->out, w->out_used }, { (void *)data, size } };
+    w->out_used = 0;
+    return writev_all(w->fd, iov, 2);
+  }
+
+  memcpy(w->out + w->out_used, data, size);
+  w->out_used += size;
+  return TRUE;
+}
+
+/* a header goes in front of the data, or over the first one on close */
+static bool put_header(dsdwriter *w, const guchar *h, gsize size, bool final) {
+  if (!final) return out_write(w, h, size);
+  return pwrite(w->fd, h, size, 0) == (ssize_t)size;
+}
+
+static guint8 crc8_table[256];
+static guint16 crc16_table[256];
+
+static void init_crc_tables(void) {
+  static gsize done = 0;
+  guint i, j;
+
+  if (g_once_init_enter(&done)) {
+    for (i = 0; i < 256; i++) {
+      guint8 c8 = i;
+      guint16 c16 = i << 8;
+      for (j = 0; j < 8; j++) {
+	c8 = (c8 << 1) ^ (c8 & 0x80 ? 0x07 : 0);
+	c16 = (c16 << 1) ^ (c16 & 0x8000 ? 0x8005 : 0);
+      }
+      crc8_table[i] = c8;
+      crc16_table[i] = c16;
+    }
+    g_once_init_leave(&done, 1);
+  }
+}
+
+static guint8 crc8(const guchar *p, gsize n) {
+  guint8 crc = 0;
+  while (n--) crc = crc8_table[crc ^ *p++];
+  return crc;
+}
+
+static guint16 crc16(const guchar *p, gsize n) {
+  guint16 crc = 0;
+  while (n--) crc = (crc << 8) ^ crc16_table[(crc >> 8) ^ *p++];
+  return crc;
+}
+
+static inline void put_bits(bitwriter *bw, guint32 value, guint n) {
+  bw->acc = (bw->acc << n) | ((guint64)value & ((G_GUINT64_CONSTANT(1) << n) - 1));
+  bw->bits += n;
+  while (bw->bits >= 8) {
+    bw->bits -= 8;
+    bw->buf[bw->pos++] = bw->acc >> bw->bits;
+  }
+}
+
+static inline void put_signed(bitwriter *bw, gint32 value, guint n) {
+  put_bits(bw, (guint32)value, n);
+}
+
+static inline void put_rice(bitwriter *bw, gint32 value, guint k) {
+  guint32 u = ((guint32)value << 1) ^ (guint32)(value >> 31);
+  guint32 q = u >> k;
+
+  for (; q >= 32; q -= 32)
+    put_bits(bw, 0, 32);
+  put_bits(bw, 1, q + 1);
+  put_bits(bw, u, k);
+}
+
+static void align_bits(bitwriter *bw) {
+  if (bw->bits) put_bits(bw, 0, 8 - bw->bits);
+}
+
+/*
+** Fixed predictor residual of order 0..4 at x[i], i >= order.
+*/
+static inline gint32 fixed_residual(const gint32 *x, guint i, guint order) {
+  switch (order) {
+  case 0: return x[i];
+  case 1: return x[i] - x[i-1];
+  case 2: return x[i] - 2 * x[i-1] + x[i-2];
+  case 3: return x[i] - 3 * x[i-1] + 3 * x[i-2] - x[i-3];
+  default: return x[i] - 4 * x[i-1] + 6 * x[i-2] - 4 * x[i-3] + x[i-4];
+  }
+}
+
+typedef struct {
+  enum { SUB_CONSTANT, SUB_VERBATIM, SUB_FIXED } type;
+  guint order;
+  guint porder;
+  guint8 param[1 << FLAC_MAX_PORDER];
+  bool rice2;                  // a parameter needs the 5 bit escape-free coding
+  guint64 bits;
+} subplan;
+
+/* cheapest Rice parameter for values summing to sum, and its cost */
+static guint rice_param(const guint32 *u, guint n, guint64 *cost) {
+  guint64 sum = 0, best = G_MAXUINT64;
+  guint i, k, kbest = 0, k0;
+
+  for (i = 0; i < n; i++) sum += u[i];
+  for (k0 = 0; k0 < 30 && ((guint64)n << (k0 + 1)) < sum; k0++);
+
+  for (k = k0 > 0 ? k0 - 1 : 0; k <= MIN(k0 + 1, 30u); k++) {
+    guint64 c = (guint64)n * (k + 1);
+    for (i = 0; i < n; i++) c += u[i] >> k;
+    if (c < best) best = c, kbest = k;
+  }
+  *cost = best;
+
+  return kbest;
+}
+
+/* picks the subframe coding of the n samples of x, bps bits each */
+static void plan_subframe(const gint32 *x, guint n, guint bps, guint32 *u, subplan *sp) {
+  guint64 sums[FLAC_MAX_ORDER + 1] = { 0 }, cost;
+  guint i, order, p, porder, parts, k;
+
+  sp->type = SUB_CONSTANT;
+  sp->bits = 8 + bps;
+  for (i = 1; i < n && x[i] == x[0]; i++);
+  if (i == n) return;
+
+  sp->type = SUB_VERBATIM;
+  sp->bits = 8 + (guint64)n * bps;
+
+  // order by the smallest sum of absolute residuals
+  for (order = 0; order <= FLAC_MAX_ORDER && order < n; order++)
+    for (i = FLAC_MAX_ORDER; i < n; i++)
+      sums[order] += ABS((gint64)fixed_residual(x, i, order));
+  for (order = 0, i = 1; i <= FLAC_MAX_ORDER && i < n; i++)
+    if (sums[i] < sums[order]) order = i;
+
+  for (i = order; i < n; i++) {
+    gint32 r = fixed_residual(x, i, order);
+    u[i] = ((guint32)r << 1) ^ (guint32)(r >> 31);
+  }
+
+  for (porder = 0; porder <= FLAC_MAX_PORDER; porder++) {
+    guint8 param[1 << FLAC_MAX_PORDER];
+    guint64 bits = 8 + (guint64)order * bps + 6;
+    bool rice2 = FALSE;
+
+    parts = 1 << porder;
+    if (n % parts || (n >> porder) <= order) break;
+    for (p = 0; p < parts; p++) {
+      guint first = p == 0 ? order : p * (n >> porder);
+      guint last = (p + 1) * (n >> porder);
+      k = rice_param(u + first, last - first, &cost);
+      param[p] = k;
+      rice2 |= k > 14;
+      bits += cost;
+    }
+    bits += parts * (rice2 ? 5 : 4);
+    if (bits < sp->bits) {
+      sp->type = SUB_FIXED;
+      sp->order = order;
+      sp->porder = porder;
+      sp->rice2 = rice2;
+      sp->bits = bits;
+      memcpy(sp->param, param, parts);
+    }
+  }
+}
+
+static void write_subframe(bitwriter *bw, const gint32 *x, guint n, guint bps, const subplan *sp) {
+  guint i, p, parts;
+
+  switch (sp->type) {
+  case SUB_CONSTANT:
+    put_bits(bw, 0x00, 8);
+    put_signed(bw, x[0], bps);
+    break;
+  case SUB_VERBATIM:
+    put_bits(bw, 0x02, 8);
+    for (i = 0; i < n; i++)
+      put_signed(bw, x[i], bps);
+    break;
+  case SUB_FIXED:
+    put_bits(bw, (0x08 | sp->order) << 1, 8);
+    for (i = 0; i < sp->order; i++)
+      put_signed(bw, x[i], bps);
+    put_bits(bw, sp->rice2 ? 1 : 0, 2);
+    put_bits(bw, sp->porder, 4);
+    parts = 1 << sp->porder;
+    for (p = 0; p < parts; p++) {
+      guint first = p == 0 ? sp->order : p * (n >> sp->porder);
+      guint last = (p + 1) * (n >> sp->porder);
+      put_bits(bw, sp->param[p], sp->rice2 ? 5 : 4);
+      for (i = first; i < last; i++)
+	put_rice(bw, fixed_residual(x, i, sp->order), sp->param[p]);
+    }
+    break;
+  }
+}
+
+/* FLAC sample rate code, 0 = only in STREAMINFO */
+static guint rate_code(guint32 rate, guint *extra_bits, guint32 *extra) {
+  static const guint32 rates[] = { 0, 88200, 176400, 192000, 8000, 16000, 22050,
+				   24000, 32000, 44100, 48000, 96000 };
+  guint i;
+
+  *extra_bits = 0;
+  for (i = 1; i < G_N_ELEMENTS(rates); i++)
+    if (rates[i] == rate) return i;
+  if (rate % 1000 == 0 && rate / 1000 <= 255) {
+    *extra_bits = 8, *extra = rate / 1000;
+    return 12;
+  }
+  if (rate <= 65535) {
+    *extra_bits = 16, *extra = rate;
+    return 13;
+  }
+  if (rate % 10 == 0 && rate / 10 <= 65535) {
+    *extra_bits = 16, *extra = rate / 10;
+    return 14;
+  }
+  return 0;
+}
+
+/* frame number in the UTF-8 like coding of FLAC */
+static void put_utf8(bitwriter *bw, guint64 v) {
+  guint n, i;
+
+  if (v < 0x80) {
+    put_bits(bw, v, 8);
+    return;
+  }
+  for (n = 2; n < 7 && v >= (G_GUINT64_CONSTANT(1) << (5 * n + 1)); n++);
+  put_bits(bw, ((0xFF00 >> n) & 0xFF) | (guint32)(v >> (6 * (n - 1))), 8);
+  for (i = n - 1; i > 0; i--)
+    put_bits(bw, 0x80 | ((v >> (6 * (i - 1))) & 0x3F), 8);
+}
+
+/* the block as one FLAC frame */
+static bool flac_frame(dsdwriter *w) {
+  bitwriter *bw = &w->bw;
+  guint n = w->fill, ch, i, extra_bits, assign = w->channels - 1;
+  guint32 extra = 0;
+  guint code = rate_code(w->rate, &extra_bits, &extra);
+  guint32 *u = (guint32 *)w->side + 2 * FLAC_BLOCK;
+  subplan sp[4];
+  guint16 crc;
+
+  bw->pos = 0;
+  bw->bits = 0;
+  bw->acc = 0;
+
+  /*
+  ** Stereo: plan left, right, side and mid and keep the cheapest pair
+  ** of independent, left/side, side/right or mid/side.
+  */
+  if (w->channels == 2) {
+    gint32 *l = w->block, *r = w->block + FLAC_BLOCK;
+    gint32 *mid = w->side, *side = w->side + FLAC_BLOCK;
+    guint64 best;
+
+    for (i = 0; i < n; i++) {
+      mid[i] = (l[i] + r[i]) >> 1;
+      side[i] = l[i] - r[i];
+    }
+    plan_subframe(l, n, w->bps, u, &sp[0]);
+    plan_subframe(r, n, w->bps, u, &sp[1]);
+    plan_subframe(mid, n, w->bps, u, &sp[2]);
+    plan_subframe(side, n, w->bps + 1, u, &sp[3]);
+
+    best = sp[0].bits + sp[1].bits;
+    if (sp[0].bits + sp[3].bits < best) best = sp[0].bits + sp[3].bits, assign = 8;
+    if (sp[3].bits + sp[1].bits < best) best = sp[3].bits + sp[1].bits, assign = 9;
+    if (sp[2].bits + sp[3].bits < best) best = sp[2].bits + sp[3].bits, assign = 10;
+  }
+
+  put_bits(bw, 0xFFF8, 16);
+  put_bits(bw, n == FLAC_BLOCK ? 12 : 7, 4);
+  put_bits(bw, code, 4);
+  put_bits(bw, assign, 4);
+  put_bits(bw, w->bps == 16 ? 4 : 6, 3);
+  put_bits(bw, 0, 1);
+  put_utf8(bw, w->frame_number);
+  if (n != FLAC_BLOCK) put_bits(bw, n - 1, 16);
+  if (extra_bits) put_bits(bw, extra, extra_bits);
+  put_bits(bw, crc8(bw->buf, bw->pos), 8);
+
+  if (w->channels == 2) {
+    gint32 *l = w->block, *r = w->block + FLAC_BLOCK;
+    gint32 *mid = w->side, *side = w->side + FLAC_BLOCK;
+
+    switch (assign) {
+    case 8:
+      write_subframe(bw, l, n, w->bps, &sp[0]);
+      write_subframe(bw, side, n, w->bps + 1, &sp[3]);
+      break;
+    case 9:
+      write_subframe(bw, side, n, w->bps + 1, &sp[3]);
+      write_subframe(bw, r, n, w->bps, &sp[1]);
+      break;
+    case 10:
+      write_subframe(bw, mid, n, w->bps, &sp[2]);
+      write_subframe(bw, side, n, w->bps + 1, &sp[3]);
+      break;
+    default:
+      write_subframe(bw, l, n, w->bps, &sp[0]);
+      write_subframe(bw, r, n, w->bps, &sp[1]);
+    }
+  } else {
+    for (ch = 0; ch < w->channels; ch++) {
+      plan_subframe(w->block + ch * FLAC_BLOCK, n, w->bps, u, &sp[0]);
+      write_subframe(bw, w->block + ch * FLAC_BLOCK, n, w->bps, &sp[0]);
+    }
+  }
+
+  align_bits(bw);
+  crc = crc16(bw->buf, bw->pos);
+  put_bits(bw, crc, 16);
+
+  w->frame_number++;
+  w->total_frames += n;
+  w->fill = 0;
+  w->min_frame_bytes = MIN(w->min_frame_bytes, bw->pos);
+  w->max_frame_bytes = MAX(w->max_frame_bytes, bw->pos);
+
+  return out_write(w, bw->buf, bw->pos);
+}
+
+static bool flac_streaminfo(dsdwriter *w, bool final) {
+  bitwriter bw;
+  guchar buf[FLAC_STREAMINFO_OFFSET + 34];
+  guint8 digest[16];
+  gsize len = sizeof(digest), i;
+
+  bw.buf = buf;
+  bw.pos = 0;
+  bw.acc = 0;
+  bw.bits = 0;
+
+  memset(digest, 0, sizeof(digest));
+  if (final)
+    g_checksum_get_digest(w->md5, digest, &len);
+
+  put_bits(&bw, 0x664C6143, 32);             // "fLaC"
+  put_bits(&bw, 0x80, 8);                    // last metadata block, STREAMINFO
+  put_bits(&bw, 34, 24);
+  put_bits(&bw, FLAC_BLOCK, 16);
+  put_bits(&bw, FLAC_BLOCK, 16);
+  put_bits(&bw, final ? w->min_frame_bytes : 0, 24);
+  put_bits(&bw, final ? w->max_frame_bytes : 0, 24);
+  put_bits(&bw, w->rate, 20);
+  put_bits(&bw, w->channels - 1, 3);
+  put_bits(&bw, w->bps - 1, 5);
+  put_bits(&bw, w->total_frames >> 32, 4);
+  put_bits(&bw, w->total_frames, 32);
+  for (i = 0; i < sizeof(digest); i++)
+    put_bits(&bw, digest[i], 8);
+
+  return put_header(w, buf, bw.pos, final);
+}
+
+static void put_le16(guchar *p, guint16 v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8;
+}
+
+static void put_le32(guchar *p, guint32 v) {
+  put_le16(p, v & 0xFFFF);
+  put_le16(p + 2, v >> 16);
+}
+
+static void put_le64(guchar *p, guint64 v) {
+  put_le32(p, v & 0xFFFFFFFF);
+  put_le32(p + 4, v >> 32);
+}
+
+/*
+** WAVE_FORMAT_EXTENSIBLE header. A JUNK chunk keeps room for the ds64
+** chunk, which replaces it (and RIFF becomes RF64) if the data does not
+** fit 32 bit sizes. Unknown sizes are 0xFFFFFFFF.
+*/
+static bool wav_header(dsdwriter *w, bool final) {
+  static const guchar pcm_guid[16] = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+				       0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+  guchar h[WAV_HEADER];
+  guint64 data = w->data_bytes, riff = WAV_HEADER - 8 + data + (data & 1);
+  bool rf64 = final && riff > G_MAXUINT32;
+
+  memset(h, 0, sizeof(h));
+  memcpy(h, rf64 ? "RF64" : "RIFF", 4);
+  put_le32(h + 4, final && !rf64 ? riff : G_MAXUINT32);
+  memcpy(h + 8, "WAVE", 4);
+  memcpy(h + 12, rf64 ? "ds64" : "JUNK", 4);
+  put_le32(h + 16, 28);
+  if (rf64) {
+    put_le64(h + 20, riff);
+    put_le64(h + 28, data);
+    put_le64(h + 36, data / (w->channels * w->bytes));
+  }
+  memcpy(h + 48, "fmt ", 4);
+  put_le32(h + 52, 40);
+  put_le16(h + 56, 0xFFFE);
+  put_le16(h + 58, w->channels);
+  put_le32(h + 60, w->rate);
+  put_le32(h + 64, w->rate * w->channels * w->bytes);
+  put_le16(h + 68, w->channels * w->bytes);
+  put_le16(h + 70, w->bytes * 8);
+  put_le16(h + 72, 22);
+  put_le16(h + 74, w->bytes * 8);
+  put_le32(h + 76, 0);                        // channel mask: not given
+  memcpy(h + 80, pcm_guid, 16);
+  if (w->format == PCM_F32LE) h[80] = 0x03;
+  memcpy(h + 96, "data", 4);
+  put_le32(h + 100, final && !rf64 ? data : G_MAXUINT32);
+
+  return put_header(w, h, sizeof(h), final);
+}
+
+/*
+** Starts writing a stream of channels x rate samples in format to fd.
+** FLAC takes only 16 and 24 bit samples. fd stays open after
+** close_writer.
+*/
+dsdwriter *init_writer(int fd, outputtype type, guint channels, guint32 rate,
+		       pcmformat format) {
+  dsdwriter *w;
+  struct stat st;
+  bool ok = TRUE;
+  gsize size = WRITER_BLOCK;
+#ifdef WRITER_PIPE_SIZE
+  int pipe_size;
+#endif
+
+  if (type == OUTPUT_FLAC && format != PCM_S16LE && format != PCM_S24LE) return NULL;
+  if (channels == 0 || (type == OUTPUT_FLAC && channels > 8)) return NULL;
+
+  w = (dsdwriter *)calloc(1, sizeof(dsdwriter));
+  w->fd = fd;
+  w->type = type;
+  w->channels = channels;
+  w->rate = rate;
+  w->format = format;
+  w->bytes = pcm_sample_bytes(format);
+  if (fstat(fd, &st) != 0) {
+    free(w);
+    return NULL;
+  }
+  w->seekable = S_ISREG(st.st_mode) && lseek(fd, 0, SEEK_CUR) == 0;
+#ifdef WRITER_PIPE_SIZE
+  if (S_ISFIFO(st.st_mode) && (pipe_size = fcntl(fd, F_GETPIPE_SZ)) > 0) {
+    w->pipe = TRUE;
+    size = pipe_size;
+  }
+#endif
+  if (!size_out(w, size)) {
+    free(w);
+    return NULL;
+  }
+
+  if (type == OUTPUT_WAV)
+    ok = wav_header(w, FALSE);
+  else if (type == OUTPUT_FLAC) {
+    init_crc_tables();
+    w->bps = w->bytes * 8;
+    w->block = (gint32 *)malloc(channels * FLAC_BLOCK * sizeof(gint32));
+    w->side = (gint32 *)malloc(4 * FLAC_BLOCK * sizeof(gint32));
+    w->partial = (guchar *)malloc(channels * w->bytes);
+    w->bw.buf = (guchar *)malloc(channels * (FLAC_BLOCK * 4 + 32) + 64);
+    w->min_frame_bytes = G_MAXUINT32;
+    w->md5 = g_checksum_new(G_CHECKSUM_MD5);
+    ok = flac_streaminfo(w, FALSE);
+  }
+
+  if (!ok) {
+    close_writer(w);
+    return NULL;
+  }
+  return w;
+}
+
+/* unpacks whole frames of packed samples into the FLAC block */
+static bool flac_write(dsdwriter *w, const guchar *data, gsize frames) {
+  guint ch;
+  gsize f;
+
+  for (f = 0; f < frames; f++) {
+    for (ch = 0; ch < w->channels; ch++, data += w->bytes) {
+      gint32 x;
+      if (w->bytes == 2)
+	x = (gint16)(data[0] | (data[1] << 8));
+      else
+	x = (gint32)((guint32)data[0] << 8 | (guint32)data[1] << 16 | (guint32)data[2] << 24) >> 8;
+      w->block[ch * FLAC_BLOCK + w->fill] = x;
+    }
+    if (++w->fill == FLAC_BLOCK && !flac_frame(w))
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+bool writer_write(dsdwriter *w, const guchar *data, gsize size) {
+  gsize frame = w->channels * w->bytes, n;
+
+  w->data_bytes += size;
+  if (w->type != OUTPUT_FLAC)
+    return out_write(w, data, size);
+
+  g_checksum_update(w->md5, data, size);
+
+  // a frame may be split between writes
+  if (w->partial_bytes) {
+    n = MIN(size, frame - w->partial_bytes);
+    memcpy(w->partial + w->partial_bytes, data, n);
+    w->partial_bytes += n;
+    data += n;
+    size -= n;
+    if (w->partial_bytes < frame) return TRUE;
+    w->partial_bytes = 0;
+    if (!flac_write(w, w->partial, 1)) return FALSE;
+  }
+  if (!flac_write(w, data, size / frame)) return FALSE;
+  w->partial_bytes = size % frame;
+  memcpy(w->partial, data + size - w->partial_bytes, w->partial_bytes);
+
+  return TRUE;
+}
+
+/* finishes the stream and frees the writer, FALSE if writing failed */
+bool close_writer(dsdwriter *w) {
+  bool ok = TRUE;
+
+  if (!w) return FALSE;
+
+  if (w->type == OUTPUT_FLAC && w->md5 && w->fill)
+    ok = flac_frame(w);
+  else if (w->type == OUTPUT_WAV && (w->data_bytes & 1))
+    ok = out_write(w, (const guchar *)"", 1);
+  ok = ok && flush_out(w);
+
+  if (ok && w->seekable) {
+    if (w->type == OUTPUT_FLAC && w->md5)
+      ok = flac_streaminfo(w, TRUE);
+    else if (w->type == OUTPUT_WAV)
+      ok = wav_header(w, TRUE);
+  }
+
+  if (w->md5) g_checksum_free(w->md5);
+  free(w->block);
+  free(w->side);
+  free(w->partial);
+  free(w->bw.buf);
+  free(w->out);
+  free(w);
+
+  return ok;
+}
+
+/*
+** Raises (or lowers) the capacity of a pipe output to bytes, which also
+** sets the size of the staging block. FALSE if fd is not a pipe or the
+** size was refused, see /proc/sys/fs/pipe-max-size.
+*/
+bool writer_set_pipe_size(dsdwriter *w, gsize bytes) {
+#ifdef WRITER_PIPE_SIZE
+  int size;
+  bool ok;
+
+  if (!w->pipe) return FALSE;
+  ok = fcntl(w->fd, F_SETPIPE_SZ, (int)MIN(bytes, (gsize)G_MAXINT)) >= 0;
+  if ((size = fcntl(w->fd, F_GETPIPE_SZ)) <= 0) return FALSE;
+  if ((gsize)size == w->out_size) return ok;
+
+  // a block of the new capacity, after what is staged has gone out
+  if (w->out_used > (gsize)size && !flush_out(w)) return FALSE;
+  return size_out(w, size) && ok;
+#else
+  (void)w;
+  (void)bytes;
+  return FALSE;
+#endif
+}
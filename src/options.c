@@ -0,0 +1,132 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libdsd/libdsd.h"
+#include "dsdplay.h"
+
+/*
+** Option values and the conversion they ask for, shared by dsdplay,
+** its server and dsdbatch so that they convert alike.
+*/
+
+bool parse_format(const char *name, pcmformat *format) {
+  if (!strcmp(name, "16")) *format = PCM_S16LE;
+  else if (!strcmp(name, "24")) *format = PCM_S24LE;
+  else if (!strcmp(name, "32")) *format = PCM_S32LE;
+  else if (!strcmp(name, "f32")) *format = PCM_F32LE;
+  else return FALSE;
+  return TRUE;
+}
+
+const char *format_name(pcmformat format) {
+  switch (format) {
+  case PCM_S16LE: return "16";
+  case PCM_S24LE: return "24";
+  case PCM_S32LE: return "32";
+  case PCM_F32LE: return "f32";
+  }
+  return NULL;
+}
+
+/*
+** Picks the conversion for a DSD rate: returns the rate after halving
+** and sets halfrate, ratio and (if DoP cannot be kept) dop.
+*/
+guint32 plan_conversion(guint32 frequency, guint32 freq_limit, bool *dop,
+			guint *halfrate, guint *ratio) {
+  *halfrate = 1;
+  *ratio = 8;
+
+  /* 
+  ** PCM is converted with a filter made for the DSD rate, so every rate
+  ** from DSD64 to DSD512 comes out at 352.8 kHz (384 kHz for 48 kHz based
+  ** rates) before any further decimation.
+  */
+
+#define DSD64 (guint32)(64 * 44100)
+
+  /*
+  ** DoP runs at 1/16 of the DSD rate. If that is above freq_limit, halve
+  ** the DSD rate (not below DSD64) until it fits, otherwise fall back to
+  ** PCM.
+  */
+  if (*dop && freq_limit != 0) {
+    while (frequency / (16 * *halfrate) > freq_limit && frequency / (2 * *halfrate) >= DSD64)
+      *halfrate *= 2;
+    if (frequency / (16 * *halfrate) > freq_limit)
+      *dop = FALSE, *halfrate = 1;
+    else
+      frequency /= *halfrate;
+  }
+
+  /*
+  ** Decimate in libdsd down to the lowest rate (not below 44.1 kHz) that
+  ** still covers freq_limit. The resampler only does what is left over.
+  */
+  while (frequency / *ratio > 384000) *ratio *= 2;
+  if (!*dop && freq_limit != 0)
+    while (frequency / (*ratio * 2) >= MAX(freq_limit, 44100)) *ratio *= 2;
+
+  return frequency;
+}
+
+bool parse_output(const char *name, outputtype *type) {
+  if (!strcmp(name, "flac")) *type = OUTPUT_FLAC;
+  else if (!strcmp(name, "wav")) *type = OUTPUT_WAV;
+  else if (!strcmp(name, "raw")) *type = OUTPUT_RAW;
+  else return FALSE;
+  return TRUE;
+}
+
+bool parse_quality(const char *name, resamplequality *quality) {
+  if (!strcmp(name, "low")) *quality = RESAMPLE_LOW;
+  else if (!strcmp(name, "medium")) *quality = RESAMPLE_MEDIUM;
+  else if (!strcmp(name, "high")) *quality = RESAMPLE_HIGH;
+  else return FALSE;
+  return TRUE;
+}
+
+const char *quality_name(resamplequality quality) {
+  switch (quality) {
+  case RESAMPLE_LOW: return "low";
+  case RESAMPLE_MEDIUM: return "medium";
+  case RESAMPLE_HIGH: return "high";
+  }
+  return NULL;
+}
+
+/*
+** The rate of the output: decimation gets as close to freq_limit as it
+** can, the resampler takes it the rest of the way.
+*/
+guint32 output_rate(bool dop, guint32 frequency, guint ratio, guint32 freq_limit) {
+  if (dop) return frequency / 16;
+  if (freq_limit != 0 && freq_limit < frequency / ratio) return freq_limit;
+  return frequency / ratio;
+}
+
+/* FLAC is written in 16 or 24 bits */
+pcmformat output_format(outputtype type, pcmformat format) {
+  return type == OUTPUT_FLAC && format != PCM_S16LE ? PCM_S24LE : format;
+}
@@ -0,0 +1,276 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "libdsd/libdsd.h"
+#include "dsdplay.h"
+
+/*
+** Transcode server: dsdplay -S <socket> keeps running and converts for
+** clients (dsdplay -C <socket> ...) connecting to a Unix socket. A
+** request is a few text lines ended by an empty line:
+**
+**   file <absolute path>
+**   start <ms>            optional, like -s
+**   stop <ms>             optional, like -e
+**   rate <freq_limit>     like -r, 0 = no limit
+**   quality low|medium|high  like -q
+**   bits 16|24|32|f32     like -b
+**   dop                   optional, like -u
+**
+** The reply is "ok <dop> <frequency> <ratio> <channels> <bits>" and the
+** raw stream up to the end of the connection, or "error <message>".
+** frequency is the DSD rate after halving, as plan_conversion returns
+** it, and the output rate is what output_rate makes of it. A client
+** closing the connection early (a seek) ends the stream.
+**
+** Connections run on a pool of MAX_CONNECTIONS threads, any more get
+** "error busy". Converters and their output buffers are kept warm in a
+** pool and only reset for the next stream of the same kind.
+*/
+
+#define WARM_CONVERTERS 8
+#define MAX_CONNECTIONS 32
+
+typedef struct {
+  dsdconverter *conv;
+  guchar *out;                 // converter_max_output bytes
+} warmconv;
+
+static warmconv warm[WARM_CONVERTERS];
+static guint num_warm;
+static GMutex warm_lock;
+static guint32 server_read_kb;
+static gint connections;       // accepted and not yet closed
+
+static warmconv acquire_converter(dsdbuffer *ibuffer, guint32 frequency, bool dop,
+				  guint halfrate, guint ratio, pcmformat format) {
+  warmconv w = { NULL, NULL };
+  guint i;
+
+  g_mutex_lock(&warm_lock);
+  for (i = 0; i < num_warm; i++) {
+    if (converter_matches(warm[i].conv, ibuffer, frequency, dop, halfrate, ratio, format)) {
+      w = warm[i];
+      warm[i] = warm[--num_warm];
+      break;
+    }
+  }
+  g_mutex_unlock(&warm_lock);
+
+  if (w.conv)
+    reset_converter(w.conv);
+  else if ((w.conv = init_converter(ibuffer, frequency, dop, halfrate, ratio, format)))
+    w.out = (guchar *)malloc(converter_max_output(w.conv));
+
+  return w;
+}
+
+/* back to the pool, the oldest one goes if it is full */
+static void release_converter(warmconv w) {
+  warmconv old = { NULL, NULL };
+
+  g_mutex_lock(&warm_lock);
+  if (num_warm == WARM_CONVERTERS) {
+    old = warm[0];
+    memmove(warm, warm + 1, (WARM_CONVERTERS - 1) * sizeof(warmconv));
+    num_warm--;
+  }
+  warm[num_warm++] = w;
+  g_mutex_unlock(&warm_lock);
+
+  free_converter(old.conv);
+  free(old.out);
+}
+
+static bool send_all(int fd, const void *data, gsize size) {
+  const guchar *p = (const guchar *)data;
+  ssize_t n;
+
+  while (size > 0) {
+    if ((n = send(fd, p, size, MSG_NOSIGNAL)) <= 0) return FALSE;
+    p += n;
+    size -= n;
+  }
+
+  return TRUE;
+}
+
+static void reply_error(int fd, const char *msg) {
+  char line[256];
+
+  snprintf(line, sizeof(line), "error %s\n", msg);
+  send_all(fd, line, strlen(line));
+}
+
+static void serve(int fd) {
+  char line[4096], *path = NULL;
+  FILE *in;
+  dsdfile *file;
+  dsdbuffer *ibuffer;
+  warmconv w;
+  pcmformat format = PCM_S24LE;
+  resamplequality quality = RESAMPLE_HIGH;
+  bool dop = FALSE, bad = FALSE;
+  gint64 start = -1, stop = -1;
+  guint32 freq_limit = 0, frequency;
+  guint halfrate, ratio;
+  gsize bsize;
+  int len, rfd;
+
+  if ((rfd = dup(fd)) < 0) return;
+  if (!(in = fdopen(rfd, "r"))) {
+    close(rfd);
+    return;
+  }
+  while (fgets(line, sizeof(line), in) && line[0] != '\n') {
+    line[strcspn(line, "\n")] = '\0';
+    if (!strncmp(line, "file ", 5)) {
+      free(path);
+      path = strdup(line + 5);
+    } else if (!strncmp(line, "start ", 6))
+      start = atoll(line + 6);
+    else if (!strncmp(line, "stop ", 5))
+      stop = atoll(line + 5);
+    else if (!strncmp(line, "rate ", 5))
+      freq_limit = atol(line + 5);
+    else if (!strncmp(line, "quality ", 8))
+      bad |= !parse_quality(line + 8, &quality);
+    else if (!strncmp(line, "bits ", 5)) {
+      bad |= !parse_format(line + 5, &format);
+    } else if (!strcmp(line, "dop"))
+      dop = TRUE;
+  }
+  fclose(in);
+
+  if (bad) {
+    reply_error(fd, "unknown sample format or quality");
+    free(path);
+    return;
+  }
+  if (!path || !(file = dsd_open(path))) {
+    reply_error(fd, "could not open file");
+    free(path);
+    return;
+  }
+  free(path);
+  if (!dsd_set_read_size(file, server_read_kb * 1024)) {
+    reply_error(fd, "invalid read size");
+    dsd_close(file);
+    return;
+  }
+
+  frequency = plan_conversion(dsd_sample_frequency(file), freq_limit, &dop, &halfrate, &ratio);
+  if (dop) format = PCM_S24LE;
+
+  w = acquire_converter(&file->buffer, dsd_sample_frequency(file), dop, halfrate, ratio, format);
+  if (!w.conv) {
+    reply_error(fd, "unsupported sample rate");
+    dsd_close(file);
+    return;
+  }
+  if (!converter_set_rate(w.conv, output_rate(dop, frequency, ratio, freq_limit), quality)) {
+    reply_error(fd, "unsupported output rate");
+    release_converter(w);
+    dsd_close(file);
+    return;
+  }
+  w.out = (guchar *)realloc(w.out, converter_max_output(w.conv));
+
+  if (start >= 0 && !converter_seek(w.conv, file, start)) {
+    reply_error(fd, "seek failed");
+    release_converter(w);
+    dsd_close(file);
+    return;
+  }
+  if (stop >= 0) dsd_set_stop(file, stop);
+
+  len = snprintf(line, sizeof(line), "ok %d %u %u %u %s\n", dop, frequency, ratio,
+		 dsd_channels(file), format_name(format));
+  if (send_all(fd, line, len)) {
+    while ((ibuffer = dsd_read(file))) {
+      bsize = dsd_convert(w.conv, ibuffer, w.out);
+      if (!send_all(fd, w.out, bsize)) break;
+    }
+    if (!ibuffer)
+      while ((bsize = converter_finish(w.conv, w.out)))
+	if (!send_all(fd, w.out, bsize)) break;
+  }
+
+  release_converter(w);
+  dsd_close(file);
+}
+
+static void connection(gpointer data, gpointer user_data) {
+  int fd = GPOINTER_TO_INT(data) - 1;
+  gint *count = (gint *)user_data;
+
+  serve(fd);
+  close(fd);
+  g_atomic_int_add(count, -1);
+}
+
+/* does not return unless accept fails */
+void run_server(const char *path, guint32 read_kb) {
+  struct sockaddr_un addr;
+  struct stat st;
+  GThreadPool *pool;
+  int lfd, fd;
+
+  server_read_kb = read_kb;
+  signal(SIGPIPE, SIG_IGN);
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr.sun_path)) error("socket path too long!");
+  strcpy(addr.sun_path, path);
+  // only a stale socket of an earlier run is replaced
+  if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode)) unlink(path);
+
+  if ((lfd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 ||
+      bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+      listen(lfd, 16) != 0)
+    error("could not listen on socket!");
+
+  pool = g_thread_pool_new(connection, &connections, MAX_CONNECTIONS, FALSE, NULL);
+  while ((fd = accept(lfd, NULL, NULL)) >= 0 || errno == EINTR) {
+    if (fd < 0) continue;
+    if (g_atomic_int_get(&connections) >= MAX_CONNECTIONS) {
+      reply_error(fd, "busy");
+      close(fd);
+      continue;
+    }
+    g_atomic_int_inc(&connections);
+    g_thread_pool_push(pool, GINT_TO_POINTER(fd + 1), NULL);  // no NULL jobs
+  }
+
+  g_thread_pool_free(pool, FALSE, TRUE);
+  close(lfd);
+}
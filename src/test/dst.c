@@ -0,0 +1,255 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "libdsd/libdsd.h"
+#include "test.h"
+
+/*
+** The DST decoder on frames of the test encoder (dstenc.c), which uses
+** every kind of frame in turn: what dsd_read returns of a DST file is
+** byte for byte what it returns of the same signal uncompressed, serial
+** and on threads, after a seek, cut within a frame and with a broken
+** frame. Also prints how much faster than real time it decodes.
+*/
+
+#define THREADS 4
+#define SEEK_FRAMES 2.5               // into the file
+#define DST_SILENCE 0x69
+
+typedef struct {
+  guint channels;
+  guint multiple;
+  guint32 mseconds;
+} stream;
+
+static const stream streams[] = {
+  { 1, 1, 100 }, { 2, 1, 1000 }, { 6, 2, 200 }, { 6, 1, 500 },
+};
+
+static char dir[] = "/tmp/dsdplay-test-XXXXXX";
+
+/* everything dsd_read returns from sample on, *size bytes */
+static guchar *read_all(const char *name, guint threads, guint64 sample, gsize *size) {
+  dsdfile *file = dsd_open(name);
+  dsdbuffer *buf;
+  guchar *out = NULL;
+  gsize n;
+
+  *size = 0;
+  if (!file) return NULL;
+  if (dsd_set_threads(file, threads) && (sample == 0 || dsd_seek_sample(file, sample)))
+    while ((buf = dsd_read(file))) {
+      n = (gsize)buf->bytes_per_channel * buf->num_channels;
+      out = (guchar *)realloc(out, *size + n);
+      memcpy(out + *size, buf->data, n);
+      *size += n;
+    }
+  dsd_close(file);
+
+  return out;
+}
+
+static guchar *load(const char *name, gsize *size) {
+  guchar *data = NULL;
+  FILE *f = fopen(name, "rb");
+  long n;
+
+  if (f && fseek(f, 0, SEEK_END) == 0 && (n = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0) {
+    data = (guchar *)malloc(n);
+    if (fread(data, n, 1, f) == 1)
+      *size = n;
+    else {
+      free(data);
+      data = NULL;
+    }
+  }
+  if (f) fclose(f);
+
+  return data;
+}
+
+static bool save(const char *name, const guchar *data, gsize size) {
+  FILE *f = fopen(name, "wb");
+  bool ok = f && fwrite(data, size, 1, f) == 1;
+
+  return f && !fclose(f) && ok;
+}
+
+static guint64 be(const guchar *p) {
+  guint64 v = 0;
+  guint i;
+
+  for (i = 0; i < 8; i++)
+    v = v << 8 | p[i];
+  return v;
+}
+
+/* offsets and sizes of the DSTF chunks' data, the number found */
+static guint32 find_frames(const guchar *data, gsize size, gsize *offset, gsize *length,
+			   guint32 max) {
+  gsize pos = 16, end = size;
+  guint32 n = 0;
+
+  while (pos + 12 <= end) {
+    gsize chunk = be(data + pos + 4);
+
+    if (!memcmp(data + pos, "DST ", 4)) {
+      end = MIN(end, pos + 12 + chunk);
+      pos += 12;
+      continue;
+    }
+    if (!memcmp(data + pos, "DSTF", 4) && n < max) {
+      offset[n] = pos + 12;
+      length[n++] = chunk;
+    }
+    pos += 12 + chunk + (chunk & 1);
+  }
+  return n;
+}
+
+static void decode(const stream *s) {
+  guint32 frame_bytes = 2822400 * s->multiple / 8 / DST_FRAME_RATE;
+  guint32 frames = ((guint64)s->mseconds * DST_FRAME_RATE + 999) / 1000, found, k;
+  gsize frame_size = (gsize)frame_bytes * s->channels, size, ref_size = 0, dst_size = 0, cut;
+  gsize *offset = (gsize *)malloc(frames * sizeof(gsize));
+  gsize *length = (gsize *)malloc(frames * sizeof(gsize));
+  guint64 sample = (guint64)(SEEK_FRAMES * frame_bytes) + 123;
+  guchar *ref = NULL, *out, *dst = NULL, *copy;
+  char plain[64], name[64], what[32];
+  bool coded[5] = { FALSE };
+
+  snprintf(what, sizeof(what), "dst %uch DSD%u", s->channels, 64 * s->multiple);
+  snprintf(plain, sizeof(plain), "%s/plain.dff", dir);
+  snprintf(name, sizeof(name), "%s/dst.dff", dir);
+  if (!test_check(test_write_dff(plain, s->channels, s->multiple, s->mseconds, FALSE) &&
+		  test_write_dff(name, s->channels, s->multiple, s->mseconds, TRUE) &&
+		  (ref = read_all(plain, 1, 0, &ref_size)) && (dst = load(name, &dst_size)),
+		  "%s: no test files", what))
+    return;
+
+  // every kind of frame but the stored one is coded smaller
+  found = find_frames(dst, dst_size, offset, length, frames);
+  test_check(found == frames && ref_size == frames * frame_size, "%s: %u frames of %u",
+	     what, found, frames);
+  for (k = 0; k < found; k++)
+    if (length[k] < frame_size)
+      coded[k % 5] = TRUE;
+  test_check(!coded[0] && coded[1] && coded[2] && coded[3] && coded[4],
+	     "%s: frame kinds 1 to 4 are not all coded", what);
+
+  out = read_all(name, 1, 0, &size);
+  test_check(size == ref_size && !memcmp(out, ref, size), "%s: serial differs", what);
+  free(out);
+  out = read_all(name, THREADS, 0, &size);
+  test_check(size == ref_size && !memcmp(out, ref, size), "%s: %u threads differ", what,
+	     THREADS);
+  free(out);
+
+  if (frames > SEEK_FRAMES + 1) {
+    gsize at = sample * s->channels;
+
+    out = read_all(name, THREADS, sample, &size);
+    test_check(size == ref_size - at && !memcmp(out, ref + at, size),
+	       "%s: seek to %u differs", what, (guint)sample);
+    free(out);
+  }
+
+  // cut within frame k: the frames before it
+  copy = (guchar *)malloc(dst_size);
+  k = found / 2;
+  cut = offset[k] + length[k] / 2;
+  out = save(name, dst, cut) ? read_all(name, THREADS, 0, &size) : NULL;
+  test_check(out && size == k * frame_size && !memcmp(out, ref, size),
+	     "%s: cut in frame %u gives %zu bytes", what, k, size);
+  free(out);
+
+  // garbage in the arithmetic code of frame k changes frame k only
+  memcpy(copy, dst, dst_size);
+  for (cut = offset[k] + length[k] / 2; cut < offset[k] + length[k]; cut++)
+    copy[cut] ^= 0x5a;
+  out = save(name, copy, dst_size) ? read_all(name, THREADS, 0, &size) : NULL;
+  test_check(out && size == ref_size && !memcmp(out, ref, k * frame_size) &&
+	     !memcmp(out + (k + 1) * frame_size, ref + (k + 1) * frame_size,
+		     size - (k + 1) * frame_size),
+	     "%s: a broken frame %u changes other frames", what, k);
+  free(out);
+
+  // a stored frame with its reserved bits set is silence
+  memcpy(copy, dst, dst_size);
+  copy[offset[0]] = 0x01;
+  out = save(name, copy, dst_size) ? read_all(name, 1, 0, &size) : NULL;
+  if (test_check(out && size == ref_size && !memcmp(out + frame_size, ref + frame_size,
+						    size - frame_size),
+		 "%s: a bad frame header changes other frames", what))
+    for (cut = 0; cut < frame_size && out[cut] == DST_SILENCE; cut++);
+  test_check(out && cut == frame_size, "%s: a bad frame is not silence", what);
+  free(out);
+
+  unlink(plain);
+  unlink(name);
+  free(copy);
+  free(dst);
+  free(ref);
+  free(length);
+  free(offset);
+}
+
+/* serial decoding against real time */
+static void speed(const stream *s) {
+  char name[64];
+  gint64 start;
+  gsize size;
+  guchar *out;
+  double seconds, real;
+
+  snprintf(name, sizeof(name), "%s/speed.dff", dir);
+  if (!test_check(test_write_dff(name, s->channels, s->multiple, s->mseconds, TRUE),
+		  "dst speed: no test file"))
+    return;
+  start = g_get_monotonic_time();
+  out = read_all(name, 1, 0, &size);
+  seconds = (g_get_monotonic_time() - start) / 1e6;
+  real = 8.0 * size / s->channels / (2822400.0 * s->multiple);
+  printf("     dst %uch DSD%u decodes at %.1fx real time\n", s->channels, 64 * s->multiple,
+	 real / seconds);
+  test_check(out && real > seconds, "dst %uch DSD%u: slower than real time", s->channels,
+	     64 * s->multiple);
+  free(out);
+  unlink(name);
+}
+
+int main(void) {
+  guint i;
+
+  if (!mkdtemp(dir)) return 1;
+  for (i = 0; i < G_N_ELEMENTS(streams); i++)
+    decode(&streams[i]);
+  speed(&streams[1]);
+  speed(&streams[3]);
+  rmdir(dir);
+
+  return test_result();
+}
@@ -0,0 +1,432 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "test.h"
+
+/*
+** A DST frame encoder for the tests, the inverse of libdsd/dst.c. It
+** does what the decoder reads, not what a good encoder would do: the
+** prediction filters are least squares fits to the start of the frame
+** and the probability tables are measured on the frame itself.
+**
+** The frame kind picks which parts of the syntax a frame uses:
+**
+**   0  stored without compression
+**   1  one map for filters and probabilities, all channels element 0,
+**      plain tables
+**   2  one map, an element per channel, Rice coded tables
+**   3  separate maps: a filter per channel, one probability table,
+**      half probability on every other channel
+**   4  separate maps: one filter, pairs of channels share probabilities,
+**      half probability on every channel, plain and coded tables mixed
+*/
+
+#define MAX_CHANNELS 6
+#define MAX_TAPS 128
+#define MAX_PROBS 64
+#define FIT_TAPS 24                   // taps fitted, the rest are small noise
+#define FIT_BITS 4096                 // bits the fit looks at
+
+typedef struct {
+  guchar *data;
+  gsize size;                  // allocated bytes
+  gsize pos;                   // in bits
+} bitwriter;
+
+static void put_bits(bitwriter *bw, guint32 v, guint n) {
+  while (n--) {
+    if (bw->pos / 8 >= bw->size) {
+      bw->data = (guchar *)realloc(bw->data, 2 * bw->size);
+      memset(bw->data + bw->size, 0, bw->size);
+      bw->size *= 2;
+    }
+    if ((v >> n) & 1)
+      bw->data[bw->pos / 8] |= 0x80 >> (bw->pos % 8);
+    bw->pos++;
+  }
+}
+
+/* the Rice code get_rice reads */
+static void put_rice(bitwriter *bw, gint32 v, guint k) {
+  guint32 m = ABS(v), q = m >> k;
+
+  while (q--)
+    put_bits(bw, 0, 1);
+  put_bits(bw, 1, 1);
+  put_bits(bw, m & ((1u << k) - 1), k);
+  if (m)
+    put_bits(bw, v < 0, 1);
+}
+
+static guint rice_bits(gint32 v, guint k) {
+  guint32 m = ABS(v);
+  return (m >> k) + 1 + k + (m != 0);
+}
+
+/*
+** The arithmetic coder ac_get decodes: low is the 12 bits of the code
+** after those written, a carry out of it runs back into them.
+*/
+typedef struct {
+  guint32 a;
+  guint32 low;
+  gsize start;                 // first bit of the coded data
+} arith;
+
+static void ac_put(arith *ac, bitwriter *bw, guint e, guint p) {
+  guint32 k = (ac->a >> 8) | ((ac->a >> 7) & 1);
+  guint32 q = k * p, a_q = ac->a - q;
+  gsize i;
+
+  if (e)
+    ac->a = a_q;
+  else {
+    ac->low += a_q;
+    ac->a = q;
+  }
+  if (ac->low >= 4096) {
+    ac->low -= 4096;
+    for (i = bw->pos; i-- > ac->start; ) {
+      bw->data[i / 8] ^= 0x80 >> (i % 8);
+      if (bw->data[i / 8] & (0x80 >> (i % 8))) break;
+    }
+  }
+  while (ac->a < 2048) {
+    put_bits(bw, (ac->low >> 11) & 1, 1);
+    ac->low = (ac->low << 1) & 4095;
+    ac->a <<= 1;
+  }
+}
+
+static void ac_flush(arith *ac, bitwriter *bw) {
+  put_bits(bw, ac->low, 12);
+}
+
+typedef struct {
+  guint elements;
+  guint length[2 * MAX_CHANNELS];
+  gint coeff[2 * MAX_CHANNELS][MAX_TAPS];
+  bool coded[2 * MAX_CHANNELS];
+} table;
+
+static void put_map(bitwriter *bw, const guint *map, guint channels) {
+  guint ch, elements = 1;
+  bool zero = TRUE;
+
+  for (ch = 0; ch < channels; ch++)
+    zero = zero && map[ch] == 0;
+  put_bits(bw, zero, 1);
+  if (zero) return;
+  for (ch = 1; ch < channels; ch++) {
+    put_bits(bw, map[ch], g_bit_storage(elements));
+    if (map[ch] == elements) elements++;
+  }
+}
+
+static const gint pred[3][3] = {
+  { -8, 0, 0 },
+  { -16, 8, 0 },
+  { -24, 24, -8 },
+};
+
+static const gint fsets_pred[3][3] = {
+  { -8, 0, 0 },
+  { -16, 8, 0 },
+  { -9, -5, 6 },
+};
+
+/* the residuals read_table turns back into coeff with method */
+static void residuals(const gint *coeff, guint length, guint method, const gint p[3][3],
+		      gint *r) {
+  guint j, k;
+  gint x;
+
+  for (j = method + 1; j < length; j++) {
+    for (x = 0, k = 0; k <= method; k++)
+      x += p[method][k] * coeff[j - k - 1];
+    r[j] = x >= 0 ? coeff[j] + (x + 4) / 8 : coeff[j] - (-x + 3) / 8;
+  }
+}
+
+static void put_table(bitwriter *bw, const table *t, const gint p[3][3], guint length_bits,
+		      guint bits, gint offset) {
+  gint r[MAX_TAPS];
+  guint i, j, k, method, best_k = 0, size, best;
+
+  for (i = 0; i < t->elements; i++) {
+    put_bits(bw, t->length[i] - 1, length_bits);
+    put_bits(bw, t->coded[i], 1);
+    if (!t->coded[i]) {
+      for (j = 0; j < t->length[i]; j++)
+	put_bits(bw, (guint32)(t->coeff[i][j] - offset) & ((1u << bits) - 1), bits);
+      continue;
+    }
+    method = MIN((i + t->elements) % 3, t->length[i] - 1);
+    put_bits(bw, method, 2);
+    for (j = 0; j <= method; j++)
+      put_bits(bw, (guint32)(t->coeff[i][j] - offset) & ((1u << bits) - 1), bits);
+    residuals(t->coeff[i], t->length[i], method, p, r);
+    for (k = 0, best = G_MAXUINT32; k < 8; k++) {
+      for (size = 0, j = method + 1; j < t->length[i]; j++)
+	size += rice_bits(r[j], k);
+      if (size < best)
+	best = size, best_k = k;
+    }
+    put_bits(bw, best_k, 3);
+    for (j = method + 1; j < t->length[i]; j++)
+      put_rice(bw, r[j], best_k);
+  }
+}
+
+/* the bit t + 1 samples before the current one, MSB first planar data */
+static inline int history(const guchar *dsd, gint64 i, guint t) {
+  gint64 n = i - 1 - t;
+  if (n < 0) return (n & 1) ? 0 : 1;           // dst.c starts from 0xaa...
+  return (dsd[n / 8] >> (7 - n % 8)) & 1;
+}
+
+/* solves a x = b in place, n unknowns, FALSE if singular */
+static bool solve(double *a, double *b, guint n) {
+  guint i, j, k, p;
+
+  for (i = 0; i < n; i++) {
+    for (p = i, j = i + 1; j < n; j++)
+      if (fabs(a[j * n + i]) > fabs(a[p * n + i])) p = j;
+    if (fabs(a[p * n + i]) < 1e-9) return FALSE;
+    for (k = 0; k < n; k++) {
+      double t = a[i * n + k];
+      a[i * n + k] = a[p * n + k];
+      a[p * n + k] = t;
+    }
+    {
+      double t = b[i];
+      b[i] = b[p];
+      b[p] = t;
+    }
+    for (j = i + 1; j < n; j++) {
+      double f = a[j * n + i] / a[i * n + i];
+      for (k = i; k < n; k++)
+	a[j * n + k] -= f * a[i * n + k];
+      b[j] -= f * b[i];
+    }
+  }
+  for (i = n; i-- > 0; ) {
+    for (k = i + 1; k < n; k++)
+      b[i] -= a[i * n + k] * b[k];
+    b[i] /= a[i * n + i];
+  }
+
+  return TRUE;
+}
+
+/*
+** A filter of length taps for a channel: the least squares predictor of
+** its next bit as +-1, scaled to 9 bit coefficients, then small taps of
+** noise up to length.
+*/
+static void fit_filter(const guchar *dsd, guint32 bits, guint length, guint seed, gint *coeff) {
+  guint n = MIN(FIT_TAPS, length), i, j;
+  double a[FIT_TAPS * FIT_TAPS], b[FIT_TAPS], peak = 0.0;
+  guint32 s;
+
+  memset(a, 0, sizeof(a));
+  memset(b, 0, sizeof(b));
+  for (s = MAX_TAPS; s < MIN(bits, MAX_TAPS + FIT_BITS); s++) {
+    double x[FIT_TAPS], y = history(dsd, s + 1, 0) ? 1.0 : -1.0;
+    for (i = 0; i < n; i++)
+      x[i] = history(dsd, s, i) ? 1.0 : -1.0;
+    for (i = 0; i < n; i++) {
+      b[i] += x[i] * y;
+      for (j = 0; j < n; j++)
+	a[i * n + j] += x[i] * x[j];
+    }
+  }
+  if (!solve(a, b, n)) {
+    memset(b, 0, sizeof(b));
+    b[0] = 1.0;
+  }
+  for (i = 0; i < n; i++)
+    peak = MAX(peak, fabs(b[i]));
+  for (i = 0; i < length; i++) {
+    seed = seed * 1103515245 + 12345;
+    coeff[i] = i < n ? (gint)lrint(b[i] * 255.0 / peak) : (gint)((seed >> 16) % 7) - 3;
+  }
+}
+
+/* sums of 8 taps for every pattern of 8 history bits, as build_filter */
+static void build_filter(const gint *coeff, guint length, gint16 (*filter)[256]) {
+  guint j, k, l, taps;
+  gint v;
+
+  for (j = 0; j < 16; j++) {
+    taps = length > 8 * j ? MIN(8, length - 8 * j) : 0;
+    for (k = 0; k < 256; k++) {
+      for (v = 0, l = 0; l < taps; l++)
+	v += ((k >> l) & 1 ? 1 : -1) * coeff[8 * j + l];
+      filter[j][k] = v;
+    }
+  }
+}
+
+/* the prediction of every bit of a channel, as dst_decode makes them */
+static void predict_all(const gint16 (*filter)[256], const guchar *dsd, guint32 bits,
+			gint16 *pr) {
+  guint64 lo = 0xaaaaaaaaaaaaaaaaULL, hi = lo;
+  guint32 i;
+  guint j, v;
+  gint sum;
+
+  for (i = 0; i < bits; i++) {
+    for (sum = 0, j = 0; j < 8; j++)
+      sum += filter[j][(lo >> (8 * j)) & 0xff] + filter[8 + j][(hi >> (8 * j)) & 0xff];
+    pr[i] = (gint16)sum;
+    v = (dsd[i / 8] >> (7 - i % 8)) & 1;
+    hi = (hi << 1) | (lo >> 63);
+    lo = (lo << 1) | v;
+  }
+}
+
+/* the probability of a wrong prediction for every size of the prediction */
+static void measure_probs(const gint16 *const *pr, const guchar *const *dsd, const guint *chans,
+			  guint n, guint32 bits, guint length, gint *probs) {
+  guint32 miss[MAX_PROBS] = { 0 }, all[MAX_PROBS] = { 0 }, i;
+  guint c, b, v;
+
+  for (c = 0; c < n; c++)
+    for (i = 0; i < bits; i++) {
+      b = MIN((guint)ABS(pr[chans[c]][i]) >> 3, length - 1);
+      v = (dsd[chans[c]][i / 8] >> (7 - i % 8)) & 1;
+      all[b]++;
+      miss[b] += v != (pr[chans[c]][i] >= 0);
+    }
+  for (b = 0; b < length; b++)
+    probs[b] = CLAMP((gint)lrint(256.0 * (miss[b] + 0.5) / (all[b] + 1)), 1, 128);
+}
+
+/*
+** Encodes a frame of planar MSB first DSD, frame_bytes per channel,
+** into out, which has room for the stored frame. Returns its size.
+*/
+gsize test_dst_frame(const guchar *dsd, guint channels, guint32 frame_bytes, guint kind,
+		     guchar *out) {
+  guint32 bits = 8 * frame_bytes, i;
+  guint felem[MAX_CHANNELS], pelem[MAX_CHANNELS], half[MAX_CHANNELS], ch, e, n, p;
+  guint chans[MAX_CHANNELS];
+  const guchar *planar[MAX_CHANNELS];
+  gint16 (*filter)[16][256], *pr[MAX_CHANNELS];
+  table *fsets, *probs;
+  bitwriter bw;
+  arith ac;
+  gsize size;
+
+  kind %= 5;
+  if (channels == 0 || channels > MAX_CHANNELS || kind == 0) {
+    out[0] = 0;
+    for (i = 0; i < frame_bytes; i++)
+      for (ch = 0; ch < channels; ch++)
+	out[1 + (gsize)i * channels + ch] = dsd[(gsize)ch * frame_bytes + i];
+    return 1 + (gsize)frame_bytes * channels;
+  }
+
+  for (ch = 0; ch < channels; ch++) {
+    planar[ch] = dsd + (gsize)ch * frame_bytes;
+    felem[ch] = kind == 1 || kind == 4 ? 0 : ch;
+    pelem[ch] = kind == 1 || kind == 3 ? 0 : kind == 2 ? ch : ch / 2;
+    half[ch] = (kind == 3 && ch % 2) || kind == 4;
+  }
+
+  fsets = (table *)calloc(1, sizeof(table));
+  probs = (table *)calloc(1, sizeof(table));
+  filter = (gint16 (*)[16][256])malloc(2 * MAX_CHANNELS * sizeof(*filter));
+  fsets->elements = felem[channels - 1] + 1;
+  probs->elements = pelem[channels - 1] + 1;
+
+  // filters fitted to the first channel of their element, of varied lengths
+  for (e = 0; e < fsets->elements; e++) {
+    for (ch = 0; felem[ch] != e; ch++);
+    fsets->length[e] = (e + kind) % 3 == 0 ? MAX_TAPS : (e + kind) % 3 == 1 ? 61 : 9;
+    fsets->coded[e] = kind == 2 || (kind == 4 && e % 2);
+    fit_filter(planar[ch], bits, fsets->length[e], kind * 7 + e, fsets->coeff[e]);
+    build_filter(fsets->coeff[e], fsets->length[e], filter[e]);
+  }
+  for (ch = 0; ch < channels; ch++) {
+    pr[ch] = (gint16 *)malloc(bits * sizeof(gint16));
+    predict_all((const gint16 (*)[256])filter[felem[ch]], planar[ch], bits, pr[ch]);
+  }
+  for (e = 0; e < probs->elements; e++) {
+    for (n = 0, ch = 0; ch < channels; ch++)
+      if (pelem[ch] == e) chans[n++] = ch;
+    probs->length[e] = e % 2 ? 17 : MAX_PROBS;
+    probs->coded[e] = kind == 2 || (kind == 4 && !(e % 2));
+    measure_probs((const gint16 *const *)pr, planar, chans, n, bits, probs->length[e],
+		  probs->coeff[e]);
+  }
+
+  bw.size = 4096;
+  bw.data = (guchar *)calloc(bw.size, 1);
+  bw.pos = 0;
+  put_bits(&bw, 0xf, 4);                       // coded, one segment of everything
+  put_bits(&bw, kind != 3 && kind != 4, 1);    // the same map for both
+  put_map(&bw, felem, channels);
+  if (kind == 3 || kind == 4)
+    put_map(&bw, pelem, channels);
+  for (ch = 0; ch < channels; ch++)
+    put_bits(&bw, half[ch], 1);
+  put_table(&bw, fsets, fsets_pred, 7, 9, 0);
+  put_table(&bw, probs, pred, 6, 7, 1);
+  put_bits(&bw, 0, 1);
+
+  ac.a = 4095;
+  ac.low = 0;
+  ac.start = bw.pos;
+  ac_put(&ac, &bw, 0, (test_bit_reverse(fsets->coeff[0][0] & 127) >> 1) + 1);
+  for (i = 0; i < bits; i++)
+    for (ch = 0; ch < channels; ch++) {
+      guint f = felem[ch], v = (planar[ch][i / 8] >> (7 - i % 8)) & 1;
+      if (!half[ch] || i >= fsets->length[f])
+	p = probs->coeff[pelem[ch]][MIN((guint)ABS(pr[ch][i]) >> 3, probs->length[pelem[ch]] - 1)];
+      else
+	p = 128;
+      ac_put(&ac, &bw, v ^ ((pr[ch][i] >> 15) & 1), p);
+    }
+  ac_flush(&ac, &bw);
+
+  // a frame that does not compress is stored
+  size = (bw.pos + 7) / 8;
+  if (size > 1 + (gsize)frame_bytes * channels)
+    size = test_dst_frame(dsd, channels, frame_bytes, 0, out);
+  else
+    memcpy(out, bw.data, size);
+
+  for (ch = 0; ch < channels; ch++)
+    free(pr[ch]);
+  free(bw.data);
+  free(filter);
+  free(probs);
+  free(fsets);
+
+  return size;
+}
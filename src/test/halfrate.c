@@ -0,0 +1,248 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "libdsd/libdsd.h"
+#include "test.h"
+
+/*
+** halfrate_filter and dsd_over_pcm against bit by bit references, whole
+** and in uneven pieces, and the halved signal against its sine.
+*/
+
+#define BYTES 16384                   // per channel, before halving
+#define MAX_CHANNELS 6
+#define WINDOW 512                    // bits averaged to recover the sine
+
+static const guint32 pieces[] = { 4096, 1, 777, 16, 5000, 3, 4097, 31 };
+
+/*
+** One halving of MSB first bytes: a pair of equal bits gives that bit,
+** a pair of unequal bits gives 1 and 0 in turn, starting with 1.
+*/
+static guint32 ref_halve(const guchar *in, guint32 bytes, guchar *out) {
+  guint32 i;
+  guint a, b, q = 0;
+
+  memset(out, 0, bytes / 2);
+  for (i = 0; i < bytes / 2 * 8; i++) {
+    a = (in[2 * i / 8] >> (7 - 2 * i % 8)) & 1;
+    b = (in[(2 * i + 1) / 8] >> (7 - (2 * i + 1) % 8)) & 1;
+    if (a != b) {
+      a = !q;
+      q ^= 1;
+    }
+    out[i / 8] |= a << (7 - i % 8);
+  }
+
+  return bytes / 2;
+}
+
+/* the planar MSB first test signal in the layout of buf */
+static guchar *layout(const guchar *planar, guint channels, bool interleaved, bool lsbf) {
+  guchar *dsd = (guchar *)malloc(channels * BYTES);
+  guint ch, i;
+
+  for (ch = 0; ch < channels; ch++)
+    for (i = 0; i < BYTES; i++) {
+      guchar b = planar[ch * BYTES + i];
+      dsd[interleaved ? i * channels + ch : ch * BYTES + i] = lsbf ? test_bit_reverse(b) : b;
+    }
+
+  return dsd;
+}
+
+static dsdbuffer buffer(guint channels, bool interleaved, bool lsbf, guchar *data) {
+  dsdbuffer buf = { channels, BYTES, BYTES, lsbf, interleaved ? channels : 1,
+		    interleaved ? 1 : BYTES, 0, 0, data };
+  return buf;
+}
+
+/* halving by factor whole and in pieces, against ref, planar MSB first */
+static void halfrate(guint channels, guint factor, bool interleaved, bool lsbf,
+		     const guchar *planar, const guchar *ref, guint32 ref_bytes) {
+  guchar *dsd = layout(planar, channels, interleaved, lsbf);
+  guchar *whole = (guchar *)malloc(channels * BYTES), *part = (guchar *)malloc(channels * BYTES);
+  dsdbuffer in = buffer(channels, interleaved, lsbf, dsd), *o;
+  dsdhalfrate *hr = init_halfrate(&in, factor);
+  guint32 done = 0, n, made = 0;
+  guint ch, p = 0;
+
+  o = halfrate_filter(hr, &in);
+  for (ch = 0; ch < channels; ch++)
+    memcpy(whole + ch * BYTES, o->data + ch * o->ch_step, o->bytes_per_channel);
+  test_check(o->bytes_per_channel == ref_bytes && !o->lsb_first,
+	     "halfrate /%u %uch: %u bytes per channel, not %u", factor, channels,
+	     o->bytes_per_channel, ref_bytes);
+  for (ch = 0; ch < channels; ch++)
+    test_check(!memcmp(whole + ch * BYTES, ref + ch * BYTES, ref_bytes),
+	       "halfrate /%u %uch %s%s: channel %u differs from the reference", factor,
+	       channels, interleaved ? "interleaved" : "planar", lsbf ? " lsbf" : "", ch);
+
+  reset_halfrate(hr);
+  for (; done < BYTES; done += n, p++) {
+    n = MIN(pieces[p % G_N_ELEMENTS(pieces)], BYTES - done);
+    in.data = dsd + done * in.sample_step;
+    in.bytes_per_channel = n;
+    o = halfrate_filter(hr, &in);
+    for (ch = 0; ch < channels; ch++)
+      memcpy(part + ch * BYTES + made, o->data + ch * o->ch_step, o->bytes_per_channel);
+    made += o->bytes_per_channel;
+  }
+  test_check(made == ref_bytes, "halfrate /%u %uch in pieces: %u bytes, not %u",
+	     factor, channels, made, ref_bytes);
+  for (ch = 0; ch < channels; ch++)
+    test_check(!memcmp(part + ch * BYTES, whole + ch * BYTES, ref_bytes),
+	       "halfrate /%u %uch in pieces: channel %u differs from one call", factor,
+	       channels, ch);
+
+  free_halfrate(hr);
+  free(part);
+  free(whole);
+  free(dsd);
+}
+
+/* the moving average of the halved bits follows that of the sine */
+static void halfrate_signal(guint ch, guint factor, const guchar *ref, guint32 bytes) {
+  double rate = 2822400.0 / factor, worst = 0.0;
+  guint32 i, j;
+
+  for (i = 0; i + WINDOW <= 8 * bytes; i += WINDOW / 4) {
+    double sum = 0.0, sine = 0.0;
+    for (j = i; j < i + WINDOW; j++) {
+      sum += (ref[j / 8] >> (7 - j % 8)) & 1 ? 1.0 : -1.0;
+      sine += test_sine(ch, j, rate);
+    }
+    worst = MAX(worst, fabs(sum - sine) / WINDOW);
+  }
+  test_check(worst < 0.02, "halfrate /%u channel %u: off the sine by %.3f", factor, ch, worst);
+}
+
+/* DoP of planar MSB first bytes: the later byte low, the marker on top */
+static gsize ref_dop(const guchar *planar, guint channels, guint32 stride, guint32 bytes,
+		     guchar *out) {
+  guchar marker = DOP_MARKER, *p = out;
+  guint32 i;
+  guint ch;
+
+  for (i = 0; i + 1 < bytes; i += 2, marker = marker == 0x05 ? 0xfa : 0x05)
+    for (ch = 0; ch < channels; ch++) {
+      *p++ = planar[ch * stride + i + 1];
+      *p++ = planar[ch * stride + i];
+      *p++ = marker;
+    }
+
+  return p - out;
+}
+
+/* dsd_over_pcm in even sized pieces, which carry the marker over */
+static void dop(guint channels, bool interleaved, bool lsbf, const guchar *planar) {
+  guchar *dsd = layout(planar, channels, interleaved, lsbf);
+  gsize size = channels * BYTES / 2 * 3, made = 0;
+  guchar *ref = (guchar *)malloc(size), *out = (guchar *)malloc(size), marker = DOP_MARKER;
+  dsdbuffer in = buffer(channels, interleaved, lsbf, dsd);
+  guint32 done = 0, n;
+  guint p = 0;
+
+  ref_dop(planar, channels, BYTES, BYTES, ref);
+  for (; done < BYTES; done += n, p++) {
+    n = MIN((pieces[p % G_N_ELEMENTS(pieces)] + 1) & ~1, BYTES - done);
+    in.data = dsd + done * in.sample_step;
+    in.bytes_per_channel = n;
+    made += dsd_over_pcm(&in, out + made, &marker);
+  }
+  test_check(made == size && !memcmp(out, ref, size), "DoP %uch %s%s differs from the reference",
+	     channels, interleaved ? "interleaved" : "planar", lsbf ? " lsbf" : "");
+
+  free(out);
+  free(ref);
+  free(dsd);
+}
+
+/* a DoP converter halving DSD128 to DSD64: the two stages in a row */
+static void dop_converter(guint channels, const guchar *planar, const guchar *half) {
+  guchar *dsd = layout(planar, channels, FALSE, TRUE);
+  gsize size = channels * BYTES / 4 * 3, made = 0;
+  guchar *ref = (guchar *)malloc(size), *out = (guchar *)malloc(size);
+  dsdbuffer in = buffer(channels, FALSE, TRUE, dsd);
+  dsdconverter *conv;
+  guint32 done = 0, n;
+
+  in.max_bytes_per_ch = 4096;
+  conv = init_converter(&in, 5644800, TRUE, 2, 1, PCM_S24LE);
+  for (; done < BYTES; done += n) {
+    n = MIN(4096, BYTES - done);
+    in.data = dsd + done;
+    in.bytes_per_channel = n;
+    made += dsd_convert(conv, &in, out + made);
+  }
+  made += converter_finish(conv, out + made);
+  ref_dop(half, channels, BYTES, BYTES / 2, ref);
+  test_check(made == size && !memcmp(out, ref, size),
+	     "DoP converter /2 %uch differs from halving and packing", channels);
+
+  free_converter(conv);
+  free(out);
+  free(ref);
+  free(dsd);
+}
+
+int main(void) {
+  static const guint channels[] = { 1, 2, 6 };
+  guchar *planar = test_signal(MAX_CHANNELS, BYTES, 2822400);
+  guchar *ref[4], *in;
+  guint32 bytes[4];
+  guint c, ch, k, layout;
+
+  // reference halvings by 2, 4 and 8 of every channel, planar with stride BYTES
+  ref[0] = planar;
+  bytes[0] = BYTES;
+  for (k = 1; k < 4; k++) {
+    ref[k] = (guchar *)calloc(MAX_CHANNELS, BYTES);
+    for (ch = 0; ch < MAX_CHANNELS; ch++) {
+      in = ref[k - 1] + ch * BYTES;
+      bytes[k] = ref_halve(in, bytes[k - 1], ref[k] + ch * BYTES);
+    }
+  }
+
+  // layout bit 0: interleaved, bit 1: LSB first
+  for (c = 0; c < G_N_ELEMENTS(channels); c++)
+    for (k = 1; k < 4; k++)
+      for (layout = 0; layout < 4; layout++)
+	halfrate(channels[c], 1 << k, layout & 1, layout & 2, planar, ref[k], bytes[k]);
+  for (ch = 0; ch < 2; ch++)
+    for (k = 1; k < 4; k++)
+      halfrate_signal(ch, 1 << k, ref[k] + ch * BYTES, bytes[k]);
+  for (c = 0; c < G_N_ELEMENTS(channels); c++)
+    for (layout = 0; layout < 4; layout++)
+      dop(channels[c], layout & 1, layout & 2, planar);
+  for (c = 0; c < G_N_ELEMENTS(channels); c++)
+    dop_converter(channels[c], planar, ref[1]);
+
+  for (k = 0; k < 4; k++)
+    free(ref[k]);
+
+  return test_result();
+}
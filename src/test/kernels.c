@@ -0,0 +1,191 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libdsd/libdsd.h"
+#include "dsd2pcm/dsd2pcm.h"
+#include "test.h"
+
+/*
+** Digests of the output of every kernel with a SIMD path, on the test
+** signal. 'make check' builds this twice, the second time with
+** -DDSD_NO_SIMD, and the two must print the same: the SIMD paths are
+** meant to give the scalar result bit for bit.
+**
+** Input is fed in uneven pieces so that the vector loops start and end
+** anywhere within a block.
+*/
+
+#define BYTES 20000                   // per channel
+#define MAX_CHANNELS 6
+
+static const guint32 pieces[] = { 4096, 1, 777, 16, 5000, 3, 4097, 31 };
+
+/* the test signal, planar or interleaved, MSB or LSB first */
+static guchar *signal_layout(guint channels, bool interleaved, bool lsbf) {
+  guchar *planar = test_signal(channels, BYTES, 2822400), *dsd;
+  guint ch, i;
+
+  if (lsbf)
+    for (i = 0; i < channels * BYTES; i++)
+      planar[i] = test_bit_reverse(planar[i]);
+  if (!interleaved) return planar;
+  dsd = (guchar *)malloc(channels * BYTES);
+  for (ch = 0; ch < channels; ch++)
+    for (i = 0; i < BYTES; i++)
+      dsd[i * channels + ch] = planar[ch * BYTES + i];
+  free(planar);
+
+  return dsd;
+}
+
+/* dsd2pcm of every channel at once, interleaved float output */
+static void translate(guint multiple, guint channels, bool interleaved, bool lsbf) {
+  dsd2pcm_ctx *ctx[MAX_CHANNELS];
+  guchar *dsd = signal_layout(channels, interleaved, lsbf);
+  float *pcm = (float *)calloc(channels * (BYTES + 1), sizeof(float));
+  ptrdiff_t step = interleaved ? channels : 1, chstep = interleaved ? 1 : BYTES;
+  gsize frames = 0, done = 0, n;
+  guint ch, p = 0;
+  char name[64];
+
+  for (ch = 0; ch < channels; ch++)
+    ctx[ch] = dsd2pcm_init_rate(multiple);
+  for (; done < BYTES; done += n, p++) {
+    n = MIN(pieces[p % G_N_ELEMENTS(pieces)], BYTES - done);
+    frames += dsd2pcm_translate_multi(ctx, channels, n, dsd + done * step, step, chstep,
+				      lsbf, pcm + frames * channels, channels, 1);
+  }
+  for (ch = 0; ch < channels; ch++)
+    dsd2pcm_destroy(ctx[ch]);
+
+  snprintf(name, sizeof(name), "dsd2pcm x%u %uch %s%s", multiple, channels,
+	   interleaved ? "interleaved" : "planar", lsbf ? " lsbf" : "");
+  test_digest(name, pcm, frames * channels * sizeof(float));
+  free(pcm);
+  free(dsd);
+}
+
+/* DoP in even sized pieces, the marker carried from one to the next */
+static void dop(guint channels, bool interleaved, bool lsbf) {
+  guchar *dsd = signal_layout(channels, interleaved, lsbf);
+  guchar *out = (guchar *)malloc(channels * BYTES / 2 * 3), marker = DOP_MARKER;
+  dsdbuffer buf = { channels, 0, BYTES, lsbf, interleaved ? channels : 1,
+		    interleaved ? 1 : BYTES, 0, 0, NULL };
+  gsize size = 0;
+  guint done = 0, n, p = 0;
+  char name[64];
+
+  for (; done < BYTES; done += n, p++) {
+    n = MIN((pieces[p % G_N_ELEMENTS(pieces)] + 1) & ~1, BYTES - done);
+    buf.data = dsd + done * buf.sample_step;
+    buf.bytes_per_channel = n;
+    size += dsd_over_pcm(&buf, out + size, &marker);
+  }
+
+  snprintf(name, sizeof(name), "dsd_over_pcm %uch %s%s", channels,
+	   interleaved ? "interleaved" : "planar", lsbf ? " lsbf" : "");
+  test_digest(name, out, size);
+  free(out);
+  free(dsd);
+}
+
+/* PCM of channels at rate, with full scale and beyond at the start */
+static float *pcm_signal(guint channels, guint frames, guint32 rate) {
+  static const float edges[] = { 1.0f, -1.0f, 1.5f, -1.5f, 0.5f / 32768, -0.5f / 32768,
+				 1.5f / 8388608, -2.5f / 8388608, -0.0f, 0.99999994f };
+  float *pcm = (float *)malloc(channels * frames * sizeof(float));
+  guint ch, i;
+
+  for (i = 0; i < frames; i++)
+    for (ch = 0; ch < channels; ch++)
+      pcm[i * channels + ch] = test_sine(ch, i, rate);
+  memcpy(pcm, edges, MIN(sizeof(edges), channels * frames * sizeof(float)));
+
+  return pcm;
+}
+
+static void pack(pcmformat format) {
+  static const char *names[] = { "S16", "S24", "S32", "F32" };
+  guint count = 2 * BYTES, done = 0, n, p = 0;
+  float *pcm = pcm_signal(2, BYTES, 352800);
+  guchar *out = (guchar *)malloc(count * 4);
+  char name[64];
+
+  for (; done < count; done += n, p++) {
+    n = MIN(pieces[p % G_N_ELEMENTS(pieces)], count - done);
+    pcm_pack(pcm + done, n, format, out + done * pcm_sample_bytes(format));
+  }
+
+  snprintf(name, sizeof(name), "pcm_pack %s", names[format]);
+  test_digest(name, out, count * pcm_sample_bytes(format));
+  free(out);
+  free(pcm);
+}
+
+/*
+** noise shaped 16 bit output, the SIMD path shapes 4 channels at once.
+** Every rate has its own filter, below 352.8 kHz with dither.
+*/
+static void shaped(guint channels, guint32 rate) {
+  dsdnoiseshaper *ns = init_noise_shaper(channels, rate);
+  float *pcm = pcm_signal(channels, BYTES, rate);
+  guchar *out = (guchar *)malloc(channels * BYTES * 2);
+  guint done = 0, n, p = 0;
+  char name[64];
+
+  for (; done < BYTES; done += n, p++) {
+    n = MIN(pieces[p % G_N_ELEMENTS(pieces)], BYTES - done);
+    pcm_pack_shaped(ns, pcm + done * channels, n, out + done * channels * 2);
+  }
+  free_noise_shaper(ns);
+
+  snprintf(name, sizeof(name), "pcm_pack_shaped %uch %u", channels, rate);
+  test_digest(name, out, channels * BYTES * 2);
+  free(out);
+  free(pcm);
+}
+
+int main(void) {
+  static const guint multiples[] = { 1, 2, 4, 8 };
+  static const guint channels[] = { 1, 2, 6 };
+  static const guint32 rates[] = { 352800, 176400, 88200, 48000, 44100, 32000 };
+  guint m, c, r, layout;
+
+  // layout bit 0: interleaved, bit 1: LSB first
+  for (m = 0; m < G_N_ELEMENTS(multiples); m++)
+    for (c = 0; c < G_N_ELEMENTS(channels); c++)
+      for (layout = 0; layout < 4; layout++)
+	translate(multiples[m], channels[c], layout & 1, layout & 2);
+  for (c = 0; c < G_N_ELEMENTS(channels); c++)
+    for (layout = 0; layout < 4; layout++)
+      dop(channels[c], layout & 1, layout & 2);
+  for (c = PCM_S16LE; c <= PCM_F32LE; c++)
+    pack(c);
+  for (r = 0; r < G_N_ELEMENTS(rates); r++)
+    for (c = 1; c <= MAX_CHANNELS; c++)
+      shaped(c, rates[r]);
+
+  return 0;
+}
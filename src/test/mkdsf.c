@@ -0,0 +1,56 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "test.h"
+
+/*
+** mkdsf [-d] file.dsf|file.dff channels multiple mseconds: the test
+** signal as a DSF or DSDIFF file, for the tests that run dsdplay itself.
+** -d compresses the DSDIFF file with DST.
+*/
+
+int main(int argc, char *argv[]) {
+  bool dst = argc > 1 && !strcmp(argv[1], "-d"), ok;
+  const char *name;
+  gsize len;
+
+  argv += dst;
+  argc -= dst;
+  if (argc != 5) {
+    fprintf(stderr, "usage: mkdsf [-d] file.dsf|file.dff channels multiple mseconds\n");
+    return 2;
+  }
+  name = argv[1];
+  len = strlen(name);
+  if (len > 4 && !strcmp(name + len - 4, ".dff"))
+    ok = test_write_dff(name, atoi(argv[2]), atoi(argv[3]), atoi(argv[4]), dst);
+  else
+    ok = !dst && test_write_dsf(name, atoi(argv[2]), atoi(argv[3]), atoi(argv[4]));
+  if (!ok) {
+    fprintf(stderr, "mkdsf: cannot write %s\n", name);
+    return 1;
+  }
+  return 0;
+}
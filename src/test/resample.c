@@ -0,0 +1,145 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "libdsd/libdsd.h"
+#include "test.h"
+
+/*
+** The resampler on the sines of the test signal: output frame k lands
+** on input time k * in_rate / out_rate (phase and centring), every
+** output up to the end of the input comes out (flush), and a resampler
+** started within the stream gives the frames of one over all of it.
+*/
+
+#define CHANNELS 2
+#define MAX_FRAMES 4096               // input frames per call
+#define FLUSH_FRAMES 100              // output frames per resampler_flush
+
+static const guint32 pieces[] = { 4096, 1, 777, 16, 3000, 3, 4095, 31 };
+
+/* largest error against the sine of each quality, away from the ends */
+static const double tolerance[] = { 2e-4, 5e-6, 1e-6 };
+
+static const char *quality_names[] = { "low", "medium", "high" };
+
+static float *sine(guint32 rate, guint32 frames) {
+  float *x = (float *)malloc(frames * CHANNELS * sizeof(float));
+  guint32 i;
+  guint ch;
+
+  for (i = 0; i < frames; i++)
+    for (ch = 0; ch < CHANNELS; ch++)
+      x[i * CHANNELS + ch] = test_sine(ch, i, rate);
+
+  return x;
+}
+
+/* frames of in from input frame first on, in pieces, then flushed */
+static guint32 run(dsdresampler *rs, const float *in, guint32 first, guint32 frames,
+		   float *out) {
+  guint32 done = first, made = 0, n, m;
+  guint p = 0;
+
+  resampler_set_start(rs, first);
+  for (; done < frames; done += n, p++) {
+    n = MIN(pieces[p % G_N_ELEMENTS(pieces)], frames - done);
+    made += resample(rs, in + (gsize)done * CHANNELS, n, out + (gsize)made * CHANNELS);
+  }
+  while ((m = resampler_flush(rs, out + (gsize)made * CHANNELS, FLUSH_FRAMES)) > 0)
+    made += m;
+
+  return made;
+}
+
+static void resampler(guint32 in_rate, guint32 out_rate, resamplequality quality) {
+  guint32 frames = in_rate / 10, count, made, first, skip, k;
+  dsdresampler *rs = init_resampler(CHANNELS, in_rate, out_rate, quality, MAX_FRAMES);
+  float *in = sine(in_rate, frames), *out, *part;
+  double ratio = (double)in_rate / out_rate, margin, worst = 0.0;
+  guint ch;
+
+  if (!test_check(rs != NULL, "resampler %u -> %u %s: no resampler", in_rate, out_rate,
+		  quality_names[quality]))
+    return;
+
+  // every output frame k with k * in_rate / out_rate < frames
+  count = ((guint64)frames * out_rate + in_rate - 1) / in_rate;
+  out = (float *)calloc((gsize)(count + FLUSH_FRAMES) * CHANNELS, sizeof(float));
+  part = (float *)calloc((gsize)(count + FLUSH_FRAMES) * CHANNELS, sizeof(float));
+
+  made = run(rs, in, 0, frames, out);
+  test_check(made == count, "resampler %u -> %u %s: %u frames, not %u", in_rate, out_rate,
+	     quality_names[quality], made, count);
+
+  // where the window is all signal, frame k is the sine at its time
+  margin = resampler_history(rs) / 2.0 + 1;
+  for (k = 0; k < made; k++) {
+    double t = k * ratio;
+    if (t < margin || t + margin >= frames) continue;
+    for (ch = 0; ch < CHANNELS; ch++)
+      worst = MAX(worst, fabs(out[k * CHANNELS + ch] - test_sine(ch, t, in_rate)));
+  }
+  test_check(worst < tolerance[quality], "resampler %u -> %u %s: off the sine by %g",
+	     in_rate, out_rate, quality_names[quality], worst);
+
+  // the last frames come from the flush, the silence after the input
+  for (k = made - 1, worst = 0.0; k * ratio + margin >= frames; k--)
+    for (ch = 0; ch < CHANNELS; ch++)
+      worst = MAX(worst, fabs(out[k * CHANNELS + ch]));
+  test_check(worst > 0.01 && worst < 1.0, "resampler %u -> %u %s: flushed frames peak at %g",
+	     in_rate, out_rate, quality_names[quality], worst);
+
+  // started within the stream, once the window is past the start
+  first = frames / 3;
+  skip = ((guint64)first * out_rate + in_rate - 1) / in_rate;
+  made = run(rs, in, first, frames, part);
+  test_check(made == count - skip, "resampler %u -> %u %s from %u: %u frames, not %u",
+	     in_rate, out_rate, quality_names[quality], first, made, count - skip);
+  for (k = 0; k < made && (skip + k) * ratio < first + resampler_history(rs); k++);
+  test_check(!memcmp(part + (gsize)k * CHANNELS, out + (gsize)(skip + k) * CHANNELS,
+		     (gsize)(made - k) * CHANNELS * sizeof(float)),
+	     "resampler %u -> %u %s from %u: differs from the whole stream",
+	     in_rate, out_rate, quality_names[quality], first);
+
+  free_resampler(rs);
+  free(part);
+  free(out);
+  free(in);
+}
+
+int main(void) {
+  static const guint32 rates[][2] = {
+    { 352800, 48000 }, { 88200, 48000 }, { 352800, 44100 },
+    { 176400, 96000 }, { 176400, 192000 },
+  };
+  guint r, q;
+
+  for (r = 0; r < G_N_ELEMENTS(rates); r++)
+    for (q = RESAMPLE_LOW; q <= RESAMPLE_HIGH; q++)
+      resampler(rates[r][0], rates[r][1], q);
+
+  return test_result();
+}
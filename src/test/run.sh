@@ -0,0 +1,120 @@
+#!/bin/sh
+#
+# Regression tests on generated DSD signals, run by 'make check'.
+#
+#   kernels         the SIMD kernels give the scalar result bit for bit
+#   test-*          units against references, print what fails
+#   segments        dsdplay -j, -a and -t give the serial output
+#   seek            dsdplay -s gives the end of the whole output, from a
+#                   file, a pipe and with -j
+#   dst             DST compressed DSDIFF plays like the uncompressed file
+#
+
+BUILD=${BUILD:-build}
+DSDPLAY="$BUILD/dsdplay"
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+failed=0
+
+result() {
+  if [ $1 -eq 0 ]; then
+    echo "ok   $2"
+  else
+    echo "FAIL $2"
+    failed=1
+  fi
+}
+
+"$BUILD/kernels" > "$tmp/simd" && "$BUILD/kernels-scalar" > "$tmp/scalar" &&
+  diff "$tmp/scalar" "$tmp/simd"
+result $? "kernels: SIMD = scalar ($(wc -l < "$tmp/simd") outputs)"
+
+for t in halfrate resample shaper writer dst; do
+  "$BUILD/test-$t"
+  result $? "$t"
+done
+
+# DSD64 stereo and DSD128 5.1, three segments of -j (1 MiB per channel) each
+"$BUILD/mkdsf" "$tmp/2ch.dsf" 2 1 7000 && "$BUILD/mkdsf" "$tmp/6ch.dsf" 6 2 3500 ||
+  { result 1 "mkdsf"; exit 1; }
+
+# convert options more-options output [file], raw unless the options
+# say otherwise, stdin without a file
+convert() {
+  case "$1" in
+    -f*) "$DSDPLAY" $1 $2 -o "$3" ${4:+"$4"} ;;
+    *) "$DSDPLAY" -f raw $1 $2 -o "$3" ${4:+"$4"} ;;
+  esac
+}
+
+for f in 2ch 6ch; do
+  for opts in "" "-r 48000" "-b 16" "-b 32" "-b f32 -r 96000 -q low" "-u" \
+	      "-f flac -b 16 -r 44100" "-f wav"; do
+    differ=
+    convert "$opts" "-t 1" "$tmp/serial" "$tmp/$f.dsf" || differ=" serial"
+    for par in "-t 0" "-a 4" "-j 4"; do
+      convert "$opts" "$par" "$tmp/par" "$tmp/$f.dsf" && cmp -s "$tmp/serial" "$tmp/par" ||
+	differ="$differ $par"
+    done
+    [ -z "$differ" ]
+    result $? "segments $f ${opts:-raw}: -t 0, -a 4, -j 4 = serial${differ:+ (differs:$differ)}"
+  done
+done
+
+# Noise shaped 16 bit only has the length checked: its shaper starts
+# afresh at the seek, see converter_seek.
+for f in 2ch 6ch; do
+  for opts in "" "-r 48000" "-b 16 -r 48000" "-b 32" "-b f32 -r 96000 -q low" "-u" \
+	      "-b 16"; do
+    convert "$opts" "-t 1" "$tmp/whole" "$tmp/$f.dsf" &&
+      convert "$opts" "-s 0:1.7" "$tmp/seek" "$tmp/$f.dsf" &&
+      size=$(wc -c < "$tmp/seek") && [ $size -gt 0 ] &&
+      tail -c $size "$tmp/whole" > "$tmp/tail" || { result 1 "seek $f ${opts:-raw}"; continue; }
+    if [ "${opts#-b 16}" != "$opts" ]; then
+      [ $size -lt $(wc -c < "$tmp/whole") ]
+      result $? "seek $f ${opts:-raw}: -s 0:1.7 is shorter than the whole output"
+    else
+      cmp -s "$tmp/tail" "$tmp/seek"
+      result $? "seek $f ${opts:-raw}: -s 0:1.7 = end of the whole output"
+    fi
+    cat "$tmp/$f.dsf" | convert "$opts" "-s 0:1.7" "$tmp/pipe" &&
+      cmp -s "$tmp/seek" "$tmp/pipe"
+    result $? "seek $f ${opts:-raw}: from a pipe = from the file"
+    convert "$opts" "-s 0:1.7 -j 4" "$tmp/par" "$tmp/$f.dsf" && cmp -s "$tmp/seek" "$tmp/par"
+    result $? "seek $f ${opts:-raw}: -j 4 = serial"
+  done
+done
+
+# DST compressed DSDIFF (frames of test/dstenc.c) against the same signal
+# uncompressed: decoded serially, on threads, from a pipe, in -j pieces
+# and after a seek. Cut within a frame, a file plays the same frames
+# mapped and piped.
+"$BUILD/mkdsf" "$tmp/2ch.dff" 2 1 7000 && "$BUILD/mkdsf" -d "$tmp/2ch-dst.dff" 2 1 7000 &&
+  "$BUILD/mkdsf" "$tmp/6ch.dff" 6 1 1000 && "$BUILD/mkdsf" -d "$tmp/6ch-dst.dff" 6 1 1000 ||
+  { result 1 "mkdsf -d"; exit 1; }
+for f in 2ch 6ch; do
+  for opts in "" "-b 16 -r 48000"; do
+    differ=
+    convert "$opts" "-t 1" "$tmp/plain" "$tmp/$f.dff" || differ=" uncompressed"
+    for par in "-d 1" "-d 4" "-d 4 -j 4"; do
+      convert "$opts" "-t 1 $par" "$tmp/dst" "$tmp/$f-dst.dff" && cmp -s "$tmp/plain" "$tmp/dst" ||
+	differ="$differ $par"
+    done
+    cat "$tmp/$f-dst.dff" | convert "$opts" "-t 1 -d 4" "$tmp/dst" &&
+      cmp -s "$tmp/plain" "$tmp/dst" || differ="$differ pipe"
+    [ -z "$differ" ]
+    result $? "dst $f ${opts:-raw}: -d 1, -d 4, -j 4, a pipe = uncompressed${differ:+ (differs:$differ)}"
+    convert "$opts" "-s 0:0.7" "$tmp/plain" "$tmp/$f.dff" &&
+      convert "$opts" "-s 0:0.7 -d 4" "$tmp/dst" "$tmp/$f-dst.dff" && cmp -s "$tmp/plain" "$tmp/dst"
+    result $? "dst $f ${opts:-raw}: -s 0:0.7 = uncompressed"
+  done
+  size=$(wc -c < "$tmp/$f-dst.dff")
+  head -c $((size * 2 / 3)) "$tmp/$f-dst.dff" > "$tmp/cut.dff"
+  convert "" "-d 4" "$tmp/whole" "$tmp/$f-dst.dff" && convert "" "-d 4" "$tmp/dst" "$tmp/cut.dff" &&
+    cat "$tmp/cut.dff" | convert "" "-d 4" "$tmp/pipe" && cmp -s "$tmp/dst" "$tmp/pipe" &&
+    [ -s "$tmp/dst" ] && [ $(wc -c < "$tmp/dst") -lt $(wc -c < "$tmp/whole") ]
+  result $? "dst $f cut: plays its frames, piped = mapped"
+done
+
+exit $failed
@@ -0,0 +1,156 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "libdsd/libdsd.h"
+#include "test.h"
+
+/*
+** The noise shaped 16 bit output of every rate: the error against the
+** input is well below flat TPDF dither in the audio band and has no
+** harmonics of a quiet sine, which takes the dither below 352.8 kHz (at
+** 352.8 kHz the DSD noise does it). The feedback keeps a quarter of an
+** LSB of DC as the mean of the output instead of rounding it away.
+*/
+
+#define FRAMES 16384
+#define BINS 64                       // error spectrum bins in the band
+#define MAX_NOISE -10.0               // dB of flat TPDF dither in the band
+#define MAX_HARMONICS 4.0             // dB above the noise, undithered is 7 to 29
+
+static const guint32 rates[] = { 352800, 192000, 176400, 96000, 88200, 48000, 44100 };
+
+static gint16 *shape(guint32 rate, const float *in) {
+  dsdnoiseshaper *ns = init_noise_shaper(1, rate);
+  guchar *out = (guchar *)malloc(FRAMES * 2);
+  gint16 *x = (gint16 *)malloc(FRAMES * sizeof(gint16));
+  guint i;
+
+  pcm_pack_shaped(ns, in, FRAMES, out);
+  for (i = 0; i < FRAMES; i++)
+    x[i] = (gint16)(out[2 * i] | out[2 * i + 1] << 8);
+  free_noise_shaper(ns);
+  free(out);
+
+  return x;
+}
+
+/* power of e at frequency f by Goertzel, in units of flat noise of 1 LSB² */
+static double power(const double *e, double f, guint32 rate) {
+  double w = 2 * cos(2 * M_PI * f / rate), s1 = 0, s2 = 0, s;
+  guint i;
+
+  for (i = 0; i < FRAMES; i++) {
+    s = e[i] + w * s1 - s2;
+    s2 = s1;
+    s1 = s;
+  }
+  return (s1 * s1 + s2 * s2 - w * s1 * s2) / FRAMES;
+}
+
+/* in band error of a sine against TPDF dither, which gives 1/4 LSB² flat */
+static void noise(guint32 rate) {
+  double band = rate < 88200 ? 6000 : 20000, sum = 0, db;
+  double *e = (double *)malloc(FRAMES * sizeof(double));
+  float *in = (float *)malloc(FRAMES * sizeof(float));
+  gint16 *x;
+  guint i;
+
+  for (i = 0; i < FRAMES; i++)
+    in[i] = test_sine(0, i, rate);
+  x = shape(rate, in);
+  for (i = 0; i < FRAMES; i++)
+    e[i] = x[i] - (double)in[i] * 32768;
+  for (i = 1; i <= BINS; i++)
+    sum += power(e, band * i / BINS, rate);
+  db = 10 * log10(sum / BINS / 0.25);
+  test_check(db < MAX_NOISE, "shaper %u: %.1f dB of TPDF dither below %.0f Hz",
+	     rate, db, band);
+
+  free(x);
+  free(in);
+  free(e);
+}
+
+/* a DC of a quarter LSB, which rounding would lose */
+static void dc(guint32 rate) {
+  float *in = (float *)malloc(FRAMES * sizeof(float));
+  double sum = 0, mean;
+  gint16 *x;
+  guint i;
+
+  for (i = 0; i < FRAMES; i++)
+    in[i] = 0.25f / 32768;
+  x = shape(rate, in);
+  for (i = 0; i < FRAMES; i++)
+    sum += x[i];
+  mean = sum / FRAMES;
+  test_check(fabs(mean - 0.25) < 0.03, "shaper %u: mean %.3f LSB of a DC of 0.25 LSB",
+	     rate, mean);
+
+  free(x);
+  free(in);
+}
+
+/* a sine of 2 LSB, whose error has no harmonics above the noise next to them */
+static void harmonics(guint32 rate) {
+  double f = 64.0 * rate / FRAMES, floor = 0, lines = 0, db;
+  double *e = (double *)malloc(FRAMES * sizeof(double));
+  float *in = (float *)malloc(FRAMES * sizeof(float));
+  gint16 *x;
+  guint i, h;
+
+  for (i = 0; i < FRAMES; i++)
+    in[i] = 2.0 / 32768 * sin(2 * M_PI * f * i / rate);
+  x = shape(rate, in);
+  for (i = 0; i < FRAMES; i++)
+    e[i] = x[i] - (double)in[i] * 32768;
+  for (h = 2; h <= 5; h++) {
+    lines += power(e, h * f, rate);
+    for (i = 1; i <= 8; i++)
+      floor += power(e, h * f + i * (double)rate / FRAMES, rate) +
+	power(e, h * f - i * (double)rate / FRAMES, rate);
+  }
+  db = 10 * log10(lines / 4 / (floor / 64));
+  test_check(db < MAX_HARMONICS, "shaper %u: harmonics of a 2 LSB sine %.1f dB above the noise",
+	     rate, db);
+
+  free(x);
+  free(in);
+  free(e);
+}
+
+int main(void) {
+  guint r;
+
+  for (r = 0; r < G_N_ELEMENTS(rates); r++) {
+    noise(rates[r]);
+    if (rates[r] < 352800)
+      dc(rates[r]);
+    harmonics(rates[r]);
+  }
+
+  return test_result();
+}
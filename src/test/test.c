@@ -0,0 +1,262 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <math.h>
+#include "test.h"
+
+#define DSF_BLOCK 4096
+
+static guint failures = 0;
+
+/*
+** A second order sigma-delta modulator, in double precision so that the
+** bits are the same on every machine.
+*/
+guchar *test_signal(guint channels, guint32 bytes, guint32 rate) {
+  guchar *dsd = (guchar *)calloc((gsize)channels * bytes, 1);
+  guint ch;
+  guint32 i;
+
+  for (ch = 0; ch < channels; ch++) {
+    double i1 = 0.0, i2 = 0.0, y;
+    for (i = 0; i < 8 * bytes; i++) {
+      y = i2 >= 0.0 ? 1.0 : -1.0;
+      i1 += test_sine(ch, i, rate) - y;
+      i2 += i1 - y;
+      if (y > 0.0) dsd[(gsize)ch * bytes + i / 8] |= 0x80 >> (i % 8);
+    }
+  }
+
+  return dsd;
+}
+
+double test_sine(guint ch, double i, double rate) {
+  return TEST_LEVEL * sin(2.0 * M_PI * TEST_FREQ * (ch + 1) * i / rate);
+}
+
+static void put_le(guchar *p, guint64 v, guint bytes) {
+  guint i;
+  for (i = 0; i < bytes; i++, v >>= 8)
+    p[i] = v & 0xFF;
+}
+
+guchar test_bit_reverse(guchar b) {
+  guchar r = 0;
+  guint i;
+  for (i = 0; i < 8; i++)
+    r |= ((b >> i) & 1) << (7 - i);
+  return r;
+}
+
+/* DSF: 4096 byte blocks of each channel in turn, LSB first */
+bool test_write_dsf(const char *name, guint channels, guint multiple, guint32 mseconds) {
+  static const guint32 channel_type[] = { 0, 1, 2, 3, 4, 6, 7 };
+  guint32 rate = 2822400 * multiple;
+  guint32 bytes = (guint64)rate * mseconds / 8000;
+  guint32 blocks = (bytes + DSF_BLOCK - 1) / DSF_BLOCK, b;
+  gsize data = (gsize)blocks * DSF_BLOCK * channels;
+  guchar h[92], *dsd, *block;
+  guint ch, i;
+  FILE *f;
+  bool ok;
+
+  if (channels == 0 || channels >= G_N_ELEMENTS(channel_type)) return FALSE;
+  if (!(f = fopen(name, "wb"))) return FALSE;
+
+  memset(h, 0, sizeof(h));
+  memcpy(h, "DSD ", 4);
+  put_le(h + 4, 28, 8);
+  put_le(h + 12, sizeof(h) + data, 8);
+  memcpy(h + 28, "fmt ", 4);
+  put_le(h + 32, 52, 8);
+  put_le(h + 40, 1, 4);                       // format version
+  put_le(h + 48, channel_type[channels], 4);  // format id 0 at 44: DSD raw
+  put_le(h + 52, channels, 4);
+  put_le(h + 56, rate, 4);
+  put_le(h + 60, 1, 4);                       // bits per sample: LSB first
+  put_le(h + 64, (guint64)bytes * 8, 8);
+  put_le(h + 72, DSF_BLOCK, 4);
+  memcpy(h + 80, "data", 4);
+  put_le(h + 84, 12 + data, 8);
+  ok = fwrite(h, sizeof(h), 1, f) == 1;
+
+  dsd = test_signal(channels, bytes, rate);
+  block = (guchar *)malloc(DSF_BLOCK);
+  for (b = 0; ok && b < blocks; b++) {
+    for (ch = 0; ok && ch < channels; ch++) {
+      memset(block, 0, DSF_BLOCK);
+      for (i = 0; i < DSF_BLOCK && b * DSF_BLOCK + i < bytes; i++)
+	block[i] = test_bit_reverse(dsd[(gsize)ch * bytes + b * DSF_BLOCK + i]);
+      ok = fwrite(block, DSF_BLOCK, 1, f) == 1;
+    }
+  }
+  free(block);
+  free(dsd);
+
+  return fclose(f) == 0 && ok;
+}
+
+static void put_be(guchar *p, guint64 v, guint bytes) {
+  while (bytes--) {
+    p[bytes] = v & 0xFF;
+    v >>= 8;
+  }
+}
+
+/* starts a DSDIFF chunk, its size is set by end_chunk */
+static long start_chunk(FILE *f, const char *id) {
+  guchar h[12];
+  long start = ftell(f);
+
+  memcpy(h, id, 4);
+  put_be(h + 4, 0, 8);
+  return fwrite(h, sizeof(h), 1, f) == 1 ? start : -1;
+}
+
+static bool end_chunk(FILE *f, long start) {
+  guchar size[8];
+  long end = ftell(f);
+
+  if (start < 0 || end < 0) return FALSE;
+  put_be(size, end - start - 12, 8);
+  if (fseek(f, start + 4, SEEK_SET) || fwrite(size, sizeof(size), 1, f) != 1 ||
+      fseek(f, end, SEEK_SET))
+    return FALSE;
+  return !((end - start) & 1) || fputc(0, f) == 0;
+}
+
+static bool put_chunk(FILE *f, const char *id, const void *data, gsize size) {
+  long start = start_chunk(f, id);
+  return (size == 0 || fwrite(data, size, 1, f) == 1) && end_chunk(f, start);
+}
+
+/*
+** DSDIFF: the DSD chunk is the channels interleaved byte by byte, MSB
+** first. Compressed, every DST frame of 1/75 s is encoded in turn by
+** test_dst_frame and every other frame has a DSTC chunk after it. Both
+** hold a whole number of frames.
+*/
+bool test_write_dff(const char *name, guint channels, guint multiple, guint32 mseconds,
+		    bool dst) {
+  static const char *ids[] = { "SLFT", "SRGT", "C   ", "LFE ", "LS  ", "RS  " };
+  guint32 rate = 2822400 * multiple, frame_bytes = rate / 8 / DST_FRAME_RATE;
+  guint32 frames = ((guint64)rate * mseconds / 8000 + frame_bytes - 1) / frame_bytes, n;
+  guint32 bytes = frames * frame_bytes;
+  guchar prop[4 + 12 + 4 + 12 + 2 + 4 * 6 + 12 + 20], *p = prop, *dsd, *frame, *out;
+  gsize size = (gsize)frame_bytes * channels, i;
+  long form, chunk;
+  guint ch;
+  FILE *f;
+  bool ok;
+
+  if (channels == 0 || channels > G_N_ELEMENTS(ids)) return FALSE;
+  if (!(f = fopen(name, "wb"))) return FALSE;
+
+  form = start_chunk(f, "FRM8");
+  ok = fwrite("DSD ", 4, 1, f) == 1 && put_chunk(f, "FVER", "\x01\x05\x00\x00", 4);
+
+  memcpy(p, "SND FS  ", 8);
+  put_be(p + 8, 4, 8);
+  put_be(p + 16, rate, 4);
+  memcpy(p + 20, "CHNL", 4);
+  put_be(p + 24, 2 + 4 * channels, 8);
+  put_be(p + 32, channels, 2);
+  for (p += 34, ch = 0; ch < channels; ch++, p += 4)
+    memcpy(p, ids[ch], 4);
+  // type, name length, name, padded to an even size
+  memcpy(p, "CMPR", 4);
+  put_be(p + 4, dst ? 16 : 20, 8);
+  memcpy(p + 12, dst ? "DST \x0b" "DST Encoded" : "DSD \x0e" "not compressed\0", dst ? 16 : 20);
+  p += dst ? 28 : 32;
+  ok = ok && put_chunk(f, "PROP", prop, p - prop);
+
+  dsd = test_signal(channels, bytes, rate);
+  if (!dst) {
+    out = (guchar *)malloc((gsize)bytes * channels);
+    for (i = 0; i < bytes; i++)
+      for (ch = 0; ch < channels; ch++)
+	out[i * channels + ch] = dsd[(gsize)ch * bytes + i];
+    ok = ok && put_chunk(f, "DSD ", out, (gsize)bytes * channels);
+    free(out);
+  } else {
+    guchar frte[6];
+
+    frame = (guchar *)malloc(size);
+    out = (guchar *)malloc(1 + size);
+    put_be(frte, frames, 4);
+    put_be(frte + 4, DST_FRAME_RATE, 2);
+    chunk = start_chunk(f, "DST ");
+    ok = ok && put_chunk(f, "FRTE", frte, sizeof(frte));
+    for (n = 0; ok && n < frames; n++) {
+      for (ch = 0; ch < channels; ch++)
+	memcpy(frame + ch * frame_bytes, dsd + (gsize)ch * bytes + (gsize)n * frame_bytes,
+	       frame_bytes);
+      ok = put_chunk(f, "DSTF", out, test_dst_frame(frame, channels, frame_bytes, n, out));
+      if (ok && n % 2)
+	ok = put_chunk(f, "DSTC", "\0\0\0\0", 4);
+    }
+    ok = ok && end_chunk(f, chunk);
+    free(out);
+    free(frame);
+  }
+  free(dsd);
+  ok = ok && end_chunk(f, form);
+
+  return fclose(f) == 0 && ok;
+}
+
+void test_digest(const char *name, const void *data, gsize size) {
+  GChecksum *md5 = g_checksum_new(G_CHECKSUM_MD5);
+  guint8 digest[16];
+  gsize len = sizeof(digest), i;
+
+  g_checksum_update(md5, (const guchar *)data, size);
+  g_checksum_get_digest(md5, digest, &len);
+  g_checksum_free(md5);
+
+  printf("%-36s ", name);
+  for (i = 0; i < len; i++)
+    printf("%02x", digest[i]);
+  printf("\n");
+}
+
+bool test_check(bool ok, const char *fmt, ...) {
+  va_list ap;
+
+  if (ok) return TRUE;
+  failures++;
+  printf("FAIL ");
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+  printf("\n");
+
+  return FALSE;
+}
+
+int test_result(void) {
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,69 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#ifndef TEST_H
+#define TEST_H
+
+/*
+** Helpers of the regression tests, which run on a generated signal so
+** that 'make check' needs no files.
+*/
+
+#define TEST_FREQ 1000.0           // channel ch carries TEST_FREQ * (ch + 1)
+#define TEST_LEVEL 0.5             // of full scale
+#define DST_FRAME_RATE 75          // DST frames per second
+
+/* DSD bits of every channel, planar, MSB first, 8 * bytes samples at rate */
+guchar *test_signal(guint channels, guint32 bytes, guint32 rate);
+
+/* b with its bits in reverse order, for LSB first data */
+guchar test_bit_reverse(guchar b);
+
+/* the sine channel ch of test_signal carries at frame i of rate */
+double test_sine(guint ch, double i, double rate);
+
+/* writes the test signal as a DSF file of mseconds at 2822400 * multiple */
+bool test_write_dsf(const char *name, guint channels, guint multiple, guint32 mseconds);
+
+/*
+** writes the test signal as DSDIFF of mseconds at 2822400 * multiple,
+** rounded up to whole DST frames, DST compressed if dst
+*/
+bool test_write_dff(const char *name, guint channels, guint multiple, guint32 mseconds,
+		    bool dst);
+
+/*
+** encodes a DST frame of planar MSB first DSD into out (room for 1 +
+** channels * frame_bytes), returns its size. kind picks the syntax
+** used, see dstenc.c; every kind works for every frame.
+*/
+gsize test_dst_frame(const guchar *dsd, guint channels, guint32 frame_bytes, guint kind,
+		     guchar *out);
+
+/* prints name and the MD5 of size bytes at data */
+void test_digest(const char *name, const void *data, gsize size);
+
+/* counts and reports a failed check, returns ok */
+bool test_check(bool ok, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+/* 0 if every check passed, 1 otherwise */
+int test_result(void);
+
+#endif
@@ -0,0 +1,496 @@
+/*
+ *  dsdplay - DSD to PCM/DoP.
+ *
+ *  Copyright (C) 2013 Kimmo Taskinen <www.daphile.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along
+ *  with this program; if not, write to the Free Software Foundation, Inc.,
+ *  51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include "libdsd/libdsd.h"
+#include "test.h"
+
+/*
+** The WAV and FLAC writers round trip: what they write to a file or a
+** pipe is read back by the decoders below and must give the samples
+** written, with headers that describe them.
+**
+** The FLAC decoder takes what the writer makes, the fixed predictor
+** subset (CONSTANT, VERBATIM and FIXED subframes, Rice coded residuals
+** and stereo decorrelation), and checks both CRCs of every frame and
+** the MD5 of STREAMINFO.
+*/
+
+#define FLAC_BLOCK 4096
+#define FRAMES (4 * FLAC_BLOCK + 1001)     // the last FLAC frame is short, odd
+
+static const guint32 pieces[] = { 1, 4096, 7, 1000, 5, 30000, 3 };
+
+static guint8 crc8_table[256];
+static guint16 crc16_table[256];
+
+static guint32 seed = 1;
+
+/* noise of bits bits */
+static gint32 noise(guint bits) {
+  seed = seed * 1103515245 + 12345;
+  return (gint32)seed >> (32 - bits);
+}
+
+/*
+** Samples of every channel, interleaved, one FLAC block of each:
+**
+**   sines                                    FIXED order 4
+**   silence in channel 0, noise in others    CONSTANT, VERBATIM
+**   the same sine in every channel           left/side or mid/side
+**   channel 1 a random walk, channel 0 that  FIXED order 1, side/right
+**   plus a little noise, channel 2 a square
+**   plus a little noise, channel 3 a low     FIXED order 2 and 3
+**   sine of 16 bit size
+**   full scale, alternating                  side of bits + 1 bits
+**
+** bits is the sample size.
+*/
+static gint32 *samples(guint channels, guint bits) {
+  gint32 *x = (gint32 *)malloc(FRAMES * channels * sizeof(gint32));
+  gint32 max = (1 << (bits - 1)) - 1, walk = 0, t;
+  guint i, ch;
+
+  seed = 1;
+  for (i = 0; i < FRAMES; i++) {
+    t = i % FLAC_BLOCK;
+    walk += noise(8);
+    for (ch = 0; ch < channels; ch++) {
+      gint32 *s = &x[i * channels + ch];
+      switch (i / FLAC_BLOCK) {
+      case 0: *s = test_sine(ch, i, 44100) * max; break;
+      case 1: *s = ch == 0 ? 0 : noise(bits); break;
+      case 2: *s = test_sine(0, i, 44100) * max; break;
+      case 3:
+	if (ch == 0) *s = walk + noise(4);
+	else if (ch == 1) *s = walk;
+	else if (ch == 2) *s = t * t / 1024 + noise(2);
+	else if (ch == 3) *s = test_sine(0, t, 200000) * 32767;
+	else *s = noise(bits);
+	break;
+      default: *s = (i + ch) & 1 ? max : -max - 1;
+      }
+    }
+  }
+
+  return x;
+}
+
+/* the samples as little endian bytes of bytes each */
+static guchar *pack(const gint32 *x, guint channels, guint bytes) {
+  guchar *data = (guchar *)malloc(FRAMES * channels * bytes);
+  gsize i;
+  guint b;
+
+  for (i = 0; i < (gsize)FRAMES * channels; i++)
+    for (b = 0; b < bytes; b++)
+      data[i * bytes + b] = (guint32)x[i] >> (8 * b);
+
+  return data;
+}
+
+/* the writer's output of data, in pieces that split frames, through fd */
+static bool write_stream(int fd, outputtype type, guint channels, guint32 rate,
+			 pcmformat format, const guchar *data, gsize size) {
+  dsdwriter *w = init_writer(fd, type, channels, rate, format);
+  gsize done = 0, n;
+  guint p = 0;
+  bool ok = w != NULL;
+
+  for (; ok && done < size; done += n, p++) {
+    n = MIN(pieces[p % G_N_ELEMENTS(pieces)], size - done);
+    ok = writer_write(w, data + done, n);
+  }
+  return close_writer(w) && ok;
+}
+
+/*
+** What the writer makes of data, *out_size bytes, through a regular
+** file or a pipe read by this process while a child writes it.
+*/
+static guchar *written(bool to_pipe, outputtype type, guint channels, guint32 rate,
+		       pcmformat format, const guchar *data, gsize size, gsize *out_size) {
+  char name[] = "/tmp/dsdplay-test-XXXXXX";
+  guchar *out = NULL;
+  gsize used = 0;
+  int fd, fds[2], status;
+  ssize_t n = 0;
+  pid_t pid = 0;
+  bool ok;
+
+  if (!to_pipe) {
+    if ((fd = mkstemp(name)) < 0) return NULL;
+    unlink(name);
+    ok = write_stream(fd, type, channels, rate, format, data, size) && lseek(fd, 0, SEEK_SET) == 0;
+  } else {
+    if (pipe(fds) != 0) return NULL;
+    if ((pid = fork()) == 0) {
+      close(fds[0]);
+      _exit(write_stream(fds[1], type, channels, rate, format, data, size) ? 0 : 1);
+    }
+    close(fds[1]);
+    fd = fds[0];
+    ok = pid > 0;
+  }
+  while (ok && (out = (guchar *)realloc(out, used + 65536)) &&
+	 (n = read(fd, out + used, 65536)) > 0)
+    used += n;
+  close(fd);
+  if (pid > 0)
+    ok = waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0 && ok;
+
+  if (!ok || !out || n < 0) {
+    free(out);
+    return NULL;
+  }
+  *out_size = used;
+  return out;
+}
+
+static guint32 le(const guchar *p, guint bytes) {
+  guint32 v = 0;
+  while (bytes--) v = v << 8 | p[bytes];
+  return v;
+}
+
+/* WAV: WAVE_FORMAT_EXTENSIBLE with the data chunk last */
+static void wav(guint channels, guint32 rate, pcmformat format, bool to_pipe) {
+  static const guchar guid[14] = { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00,
+				   0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+  guint bytes = pcm_sample_bytes(format);
+  gint32 *x = samples(channels, MIN(bytes * 8, 24));
+  guchar *data = pack(x, channels, bytes), *f, *fmt = NULL, *d = NULL;
+  gsize size = (gsize)FRAMES * channels * bytes, fsize, pos, chunk, dsize = 0;
+  char what[64];
+
+  snprintf(what, sizeof(what), "WAV %uch %u Hz %u bit%s%s", channels, rate, bytes * 8,
+	   format == PCM_F32LE ? " float" : "", to_pipe ? " pipe" : "");
+  f = written(to_pipe, OUTPUT_WAV, channels, rate, format, data, size, &fsize);
+  if (!test_check(f && fsize >= 12 && !memcmp(f, "RIFF", 4) && !memcmp(f + 8, "WAVE", 4),
+		  "%s: no RIFF WAVE header", what))
+    goto done;
+  test_check(le(f + 4, 4) == (to_pipe ? G_MAXUINT32 : fsize - 8), "%s: RIFF size %u of %zu bytes",
+	     what, le(f + 4, 4), fsize);
+
+  for (pos = 12; pos + 8 <= fsize; pos += 8 + chunk + (chunk & 1)) {
+    chunk = le(f + pos + 4, 4);
+    if (!memcmp(f + pos, "fmt ", 4)) fmt = f + pos + 8;
+    if (!memcmp(f + pos, "data", 4)) {
+      d = f + pos + 8;
+      dsize = chunk == G_MAXUINT32 ? fsize - pos - 8 : chunk;
+      // of unknown size: up to the end, less the pad byte of odd data
+      if (chunk == G_MAXUINT32 && (size & 1) && dsize == size + 1 && !f[fsize - 1]) dsize--;
+      break;
+    }
+  }
+  if (!test_check(fmt && d && d + dsize <= f + fsize, "%s: no fmt or data chunk", what))
+    goto done;
+
+  test_check(le(fmt, 2) == 0xFFFE && le(fmt + 2, 2) == channels && le(fmt + 4, 4) == rate &&
+	     le(fmt + 8, 4) == rate * channels * bytes && le(fmt + 12, 2) == channels * bytes &&
+	     le(fmt + 14, 2) == bytes * 8 && le(fmt + 18, 2) == bytes * 8 &&
+	     le(fmt + 24, 2) == (format == PCM_F32LE ? 3 : 1) && !memcmp(fmt + 26, guid, 14),
+	     "%s: fmt chunk does not describe the samples", what);
+  test_check(dsize == size && !memcmp(d, data, size), "%s: %zu data bytes, not the %zu written",
+	     what, dsize, size);
+  if (!to_pipe)
+    test_check(d + dsize + (dsize & 1) == f + fsize, "%s: %zu bytes after the data", what,
+	       (gsize)(f + fsize - d - dsize));
+
+done:
+  free(f);
+  free(data);
+  free(x);
+}
+
+static void init_crc_tables(void) {
+  guint i, j;
+
+  for (i = 0; i < 256; i++) {
+    guint8 c8 = i;
+    guint16 c16 = i << 8;
+    for (j = 0; j < 8; j++) {
+      c8 = (c8 << 1) ^ (c8 & 0x80 ? 0x07 : 0);
+      c16 = (c16 << 1) ^ (c16 & 0x8000 ? 0x8005 : 0);
+    }
+    crc8_table[i] = c8;
+    crc16_table[i] = c16;
+  }
+}
+
+typedef struct {
+  const guchar *buf;
+  gsize size;
+  gsize pos;                   // in bits
+  bool over;                   // read past the end
+} bitreader;
+
+static guint32 get_bits(bitreader *br, guint n) {
+  guint32 v = 0;
+
+  for (; n > 0; n--, br->pos++) {
+    if (br->pos / 8 >= br->size) {
+      br->over = TRUE;
+      return 0;
+    }
+    v = v << 1 | ((br->buf[br->pos / 8] >> (7 - br->pos % 8)) & 1);
+  }
+  return v;
+}
+
+static gint32 get_signed(bitreader *br, guint n) {
+  guint32 v = get_bits(br, n);
+  return n < 32 && (v >> (n - 1)) ? (gint32)(v - (1u << n)) : (gint32)v;
+}
+
+static gint32 get_rice(bitreader *br, guint k) {
+  guint32 q = 0, u;
+
+  while (!br->over && get_bits(br, 1) == 0) q++;
+  u = q << k | get_bits(br, k);
+  return (gint32)(u >> 1) ^ -(gint32)(u & 1);
+}
+
+typedef struct {
+  guint32 rate;
+  guint channels;
+  guint bps;
+  guint64 total;
+  guint8 md5[16];
+  gint32 *x;                   // decoded, interleaved
+  guint64 frames;              // decoded
+} flacstream;
+
+/* one subframe of n samples of bps bits into x, FALSE if not decodable */
+static bool flac_subframe(bitreader *br, guint n, guint bps, gint32 *x) {
+  guint type, order, i, k, p, parts, first, last, rice;
+
+  if (get_bits(br, 1) != 0) return FALSE;
+  type = get_bits(br, 6);
+  if (get_bits(br, 1) != 0) return FALSE;               // no wasted bits
+
+  if (type == 0) {
+    x[0] = get_signed(br, bps);
+    for (i = 1; i < n; i++) x[i] = x[0];
+  } else if (type == 1) {
+    for (i = 0; i < n; i++) x[i] = get_signed(br, bps);
+  } else if (type >= 8 && type <= 12) {
+    order = type - 8;
+    for (i = 0; i < order; i++) x[i] = get_signed(br, bps);
+    rice = get_bits(br, 2);
+    if (rice > 1) return FALSE;
+    parts = 1 << get_bits(br, 4);
+    for (p = 0; p < parts; p++) {
+      k = get_bits(br, rice ? 5 : 4);
+      if (k == (rice ? 31u : 15u)) return FALSE;        // no escaped partitions
+      first = p == 0 ? order : p * (n / parts);
+      last = (p + 1) * (n / parts);
+      for (i = first; i < last; i++) {
+	gint32 r = get_rice(br, k);
+	switch (order) {
+	case 0: x[i] = r; break;
+	case 1: x[i] = r + x[i-1]; break;
+	case 2: x[i] = r + 2 * x[i-1] - x[i-2]; break;
+	case 3: x[i] = r + 3 * x[i-1] - 3 * x[i-2] + x[i-3]; break;
+	default: x[i] = r + 4 * x[i-1] - 6 * x[i-2] + 4 * x[i-3] - x[i-4];
+	}
+      }
+    }
+  } else
+    return FALSE;
+
+  return !br->over;
+}
+
+/* the frame at *pos, appended to s->x; FALSE (and why) if it is bad */
+static bool flac_frame(const guchar *f, gsize size, gsize *pos, flacstream *s,
+		       const char **why) {
+  bitreader br = { f + *pos, size - *pos, 0, FALSE };
+  guint bcode, rcode, assign, scode, ch, i, n, bps;
+  guint64 number = 0;
+  guint8 crc = 0;
+  guint16 crc16 = 0;
+  gint32 *sub[8], *x;
+  bool ok;
+
+  if (get_bits(&br, 16) != 0xFFF8) return *why = "no frame sync", FALSE;
+  bcode = get_bits(&br, 4);
+  rcode = get_bits(&br, 4);
+  assign = get_bits(&br, 4);
+  scode = get_bits(&br, 3);
+  get_bits(&br, 1);
+
+  // frame number, UTF-8 like
+  number = get_bits(&br, 8);
+  for (i = 0; number & (0x80 >> i) && i < 7; i++);
+  number &= 0xFF >> (i + 1);
+  for (; i > 1; i--)
+    number = number << 6 | (get_bits(&br, 8) & 0x3F);
+  if (number * FLAC_BLOCK != s->frames) return *why = "frame number out of order", FALSE;
+
+  if (bcode == 12) n = 4096;
+  else if (bcode == 6) n = get_bits(&br, 8) + 1;
+  else if (bcode == 7) n = get_bits(&br, 16) + 1;
+  else return *why = "unexpected block size code", FALSE;
+  if (rcode == 12) get_bits(&br, 8);
+  else if (rcode == 13 || rcode == 14) get_bits(&br, 16);
+  else if (rcode == 15) return *why = "bad rate code", FALSE;
+  if ((scode == 4 ? 16u : scode == 6 ? 24u : 0u) != s->bps)
+    return *why = "sample size differs from STREAMINFO", FALSE;
+  if ((assign < 8 ? assign + 1 : 2) != s->channels) return *why = "bad channel assignment", FALSE;
+
+  for (i = 0; i < br.pos / 8; i++) crc = crc8_table[crc ^ f[*pos + i]];
+  if (get_bits(&br, 8) != crc) return *why = "header CRC-8 mismatch", FALSE;
+
+  for (ch = 0; ch < s->channels; ch++)
+    sub[ch] = (gint32 *)malloc(n * sizeof(gint32));
+  for (ch = 0, ok = TRUE; ok && ch < s->channels; ch++) {
+    bps = s->bps + ((assign == 8 && ch == 1) || (assign == 9 && ch == 0) ||
+		    (assign == 10 && ch == 1));
+    ok = flac_subframe(&br, n, bps, sub[ch]);
+  }
+  if (!ok) {
+    for (ch = 0; ch < s->channels; ch++)
+      free(sub[ch]);
+    return *why = "bad subframe", FALSE;
+  }
+
+  s->x = (gint32 *)realloc(s->x, (s->frames + n) * s->channels * sizeof(gint32));
+  x = s->x + s->frames * s->channels;
+  for (i = 0; i < n; i++) {
+    gint32 a = sub[0][i], b = s->channels > 1 ? sub[1][i] : 0;
+    for (ch = 0; ch < s->channels; ch++)
+      x[i * s->channels + ch] = sub[ch][i];
+    if (assign == 8) x[i * 2 + 1] = a - b;
+    else if (assign == 9) x[i * 2] = a + b;
+    else if (assign == 10) {
+      gint32 mid = (a << 1) | (b & 1);
+      x[i * 2] = (mid + b) >> 1;
+      x[i * 2 + 1] = (mid - b) >> 1;
+    }
+  }
+  for (ch = 0; ch < s->channels; ch++)
+    free(sub[ch]);
+
+  br.pos = (br.pos + 7) & ~(gsize)7;
+  for (i = 0; i < br.pos / 8; i++)
+    crc16 = (crc16 << 8) ^ crc16_table[(crc16 >> 8) ^ f[*pos + i]];
+  if (get_bits(&br, 16) != crc16 || br.over) return *why = "frame CRC-16 mismatch", FALSE;
+
+  s->frames += n;
+  *pos += br.pos / 8;
+
+  return TRUE;
+}
+
+/* STREAMINFO and every frame of the stream in f */
+static bool flac_decode(const guchar *f, gsize size, flacstream *s, const char **why) {
+  bitreader br = { f, size, 0, FALSE };
+  gsize pos;
+  guint i;
+
+  memset(s, 0, sizeof(*s));
+  if (size < 42 || memcmp(f, "fLaC", 4)) return *why = "no fLaC marker", FALSE;
+  br.pos = 32;
+  if (get_bits(&br, 8) != 0x80 || get_bits(&br, 24) != 34)
+    return *why = "STREAMINFO is not the one metadata block", FALSE;
+  if (get_bits(&br, 16) != FLAC_BLOCK || get_bits(&br, 16) != FLAC_BLOCK)
+    return *why = "unexpected block size", FALSE;
+  get_bits(&br, 48);                          // min and max frame size
+  s->rate = get_bits(&br, 20);
+  s->channels = get_bits(&br, 3) + 1;
+  s->bps = get_bits(&br, 5) + 1;
+  s->total = (guint64)get_bits(&br, 4) << 32;
+  s->total |= get_bits(&br, 32);
+  for (i = 0; i < 16; i++)
+    s->md5[i] = get_bits(&br, 8);
+
+  for (pos = br.pos / 8; pos < size; )
+    if (!flac_frame(f, size, &pos, s, why)) return FALSE;
+
+  return TRUE;
+}
+
+static void flac(guint channels, guint32 rate, pcmformat format, bool to_pipe) {
+  guint bytes = pcm_sample_bytes(format);
+  gint32 *x = samples(channels, bytes * 8);
+  guchar *data = pack(x, channels, bytes), *f, zero[16] = { 0 };
+  gsize size = (gsize)FRAMES * channels * bytes, fsize, len = 16;
+  GChecksum *md5 = g_checksum_new(G_CHECKSUM_MD5);
+  guint8 digest[16];
+  const char *why = "";
+  flacstream s = { 0 };
+  bool decoded;
+  char what[64];
+
+  snprintf(what, sizeof(what), "FLAC %uch %u Hz %u bit%s", channels, rate, bytes * 8,
+	   to_pipe ? " pipe" : "");
+  g_checksum_update(md5, data, size);
+  g_checksum_get_digest(md5, digest, &len);
+  g_checksum_free(md5);
+
+  f = written(to_pipe, OUTPUT_FLAC, channels, rate, format, data, size, &fsize);
+  decoded = f && flac_decode(f, fsize, &s, &why);
+  if (test_check(f != NULL, "%s: not written", what) &&
+      test_check(decoded, "%s: %s after %" G_GINT64_FORMAT " frames", what, why,
+		 (gint64)s.frames)) {
+    test_check(s.rate == rate && s.channels == channels && s.bps == bytes * 8,
+	       "%s: STREAMINFO says %uch %u Hz %u bit", what, s.channels, s.rate, s.bps);
+    test_check(s.frames == FRAMES && !memcmp(s.x, x, size / bytes * sizeof(gint32)),
+	       "%s: decodes to other samples", what);
+    if (to_pipe)
+      test_check(s.total == 0 && !memcmp(s.md5, zero, 16),
+		 "%s: a pipe gets unknown length and MD5", what);
+    else
+      test_check(s.total == FRAMES && !memcmp(s.md5, digest, 16),
+		 "%s: STREAMINFO length or MD5 is wrong", what);
+  }
+
+  free(s.x);
+  free(f);
+  free(data);
+  free(x);
+}
+
+int main(void) {
+  static const guint channels[] = { 1, 2, 6 };
+  static const guint32 rates[] = { 44100, 352800, 50000, 11025 };
+  guint c, r, p;
+  pcmformat format;
+
+  init_crc_tables();
+  for (p = 0; p < 2; p++)
+    for (c = 0; c < G_N_ELEMENTS(channels); c++)
+      for (r = 0; r < G_N_ELEMENTS(rates); r++) {
+	for (format = PCM_S16LE; format <= PCM_F32LE; format++)
+	  wav(channels[c], rates[r], format, p);
+	flac(channels[c], rates[r], PCM_S16LE, p);
+	flac(channels[c], rates[r], PCM_S24LE, p);
+      }
+
+  return test_result();
+}